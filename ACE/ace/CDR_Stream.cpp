@@ -1068,6 +1068,7 @@ ACE_InputCDR::ACE_InputCDR (const char *buf,
                             ACE_CDR::Octet major_version,
                             ACE_CDR::Octet minor_version)
   : start_ (buf, bufsiz),
+    consumed_ (0),
     do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
     good_bit_ (true),
     major_version_ (major_version),
@@ -1089,6 +1090,7 @@ ACE_InputCDR::ACE_InputCDR (size_t bufsiz,
                             ACE_CDR::Octet major_version,
                             ACE_CDR::Octet minor_version)
   : start_ (bufsiz),
+    consumed_ (0),
     do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
     good_bit_ (true),
     major_version_ (major_version),
@@ -1109,6 +1111,7 @@ ACE_InputCDR::ACE_InputCDR (const ACE_Message_Block *data,
                             ACE_CDR::Octet minor_version,
                             ACE_Lock* lock)
   : start_ (0, ACE_Message_Block::MB_DATA, 0, 0, 0, lock),
+    consumed_ (0),
     good_bit_ (true),
     major_version_ (major_version),
     minor_version_ (minor_version),
@@ -1130,6 +1133,7 @@ ACE_InputCDR::ACE_InputCDR (ACE_Data_Block *data,
                             ACE_CDR::Octet major_version,
                             ACE_CDR::Octet minor_version)
   : start_ (data, flag),
+    consumed_ (0),
     do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
     good_bit_ (true),
     major_version_ (major_version),
@@ -1152,6 +1156,7 @@ ACE_InputCDR::ACE_InputCDR (ACE_Data_Block *data,
                             ACE_CDR::Octet major_version,
                             ACE_CDR::Octet minor_version)
   : start_ (data, flag),
+    consumed_ (0),
     do_byte_swap_ (byte_order != ACE_CDR_BYTE_ORDER),
     good_bit_ (true),
     major_version_ (major_version),
@@ -1182,6 +1187,7 @@ ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs,
                             ACE_CDR::Long offset)
   : start_ (rhs.start_,
             ACE_CDR::MAX_ALIGNMENT),
+    consumed_ (0),
     do_byte_swap_ (rhs.do_byte_swap_),
     good_bit_ (true),
     major_version_ (rhs.major_version_),
@@ -1223,6 +1229,7 @@ ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs,
                             size_t size)
   : start_ (rhs.start_,
             ACE_CDR::MAX_ALIGNMENT),
+    consumed_ (0),
     do_byte_swap_ (rhs.do_byte_swap_),
     good_bit_ (true),
     major_version_ (rhs.major_version_),
@@ -1243,7 +1250,9 @@ ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs,
     rhs.start_.rd_ptr() - incoming_start;
 
   if (newpos <= this->start_.space ()
-      && newpos + size <= this->start_.space ())
+      && newpos + size <= this->start_.space ()
+      && (rhs.start_.cont () == 0
+          || size <= rhs.start_.length ()))
     {
       // Notice that ACE_Message_Block::duplicate may leave the
       // wr_ptr() with a higher value than what we actually want.
@@ -1254,6 +1263,43 @@ ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs,
       (void) this->read_octet (byte_order);
       this->do_byte_swap_ = (byte_order != ACE_CDR_BYTE_ORDER);
     }
+  else if (rhs.start_.cont () != 0 && size <= rhs.length ())
+    {
+      // The encapsulation continues in the next blocks of a chained
+      // stream, copy it, keeping the alignment of its start.
+      ACE_Data_Block *db =
+        rhs.start_.data_block ()->clone_nocopy (
+          0, size + 2 * ACE_CDR::MAX_ALIGNMENT);
+
+      ACE_InputCDR tmp (rhs);
+
+      if (db == 0)
+        {
+          this->good_bit_ = false;
+        }
+      else
+        {
+          this->start_.data_block (db);
+          this->start_.clr_self_flags (ACE_Message_Block::DONT_DELETE);
+          ACE_CDR::mb_align (&this->start_);
+          this->start_.rd_ptr (newpos % ACE_CDR::MAX_ALIGNMENT);
+
+          if (tmp.read_octet_array (
+                reinterpret_cast<ACE_CDR::Octet *> (this->start_.rd_ptr ()),
+                static_cast<ACE_CDR::ULong> (size)))
+            {
+              this->start_.wr_ptr (this->start_.rd_ptr () + size);
+
+              ACE_CDR::Octet byte_order = 0;
+              (void) this->read_octet (byte_order);
+              this->do_byte_swap_ = (byte_order != ACE_CDR_BYTE_ORDER);
+            }
+          else
+            {
+              this->good_bit_ = false;
+            }
+        }
+    }
   else
     {
       this->good_bit_ = false;
@@ -1269,6 +1315,7 @@ ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs,
 ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs)
   : start_ (rhs.start_,
             ACE_CDR::MAX_ALIGNMENT),
+    consumed_ (0),
     do_byte_swap_ (rhs.do_byte_swap_),
     good_bit_ (true),
     major_version_ (rhs.major_version_),
@@ -1288,6 +1335,9 @@ ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs)
   this->start_.rd_ptr (rd_offset);
   this->start_.wr_ptr (wr_offset);
 
+  if (rhs.start_.cont () != 0)
+    this->start_.cont (rhs.start_.cont ()->duplicate ());
+
 #if defined (ACE_HAS_MONITOR_POINTS) && (ACE_HAS_MONITOR_POINTS == 1)
   ACE_NEW (this->monitor_,
            ACE::Monitor_Control::Size_Monitor);
@@ -1297,6 +1347,7 @@ ACE_InputCDR::ACE_InputCDR (const ACE_InputCDR& rhs)
 
 ACE_InputCDR::ACE_InputCDR (ACE_InputCDR::Transfer_Contents x)
   : start_ (x.rhs_.start_.data_block ()),
+    consumed_ (0),
     do_byte_swap_ (x.rhs_.do_byte_swap_),
     good_bit_ (true),
     major_version_ (x.rhs_.major_version_),
@@ -1310,6 +1361,9 @@ ACE_InputCDR::ACE_InputCDR (ACE_InputCDR::Transfer_Contents x)
   ACE_Data_Block* db = this->start_.data_block ()->clone_nocopy ();
   (void) x.rhs_.start_.replace_data_block (db);
 
+  this->start_.cont (x.rhs_.start_.cont ());
+  x.rhs_.start_.cont (0);
+
 #if defined (ACE_HAS_MONITOR_POINTS) && (ACE_HAS_MONITOR_POINTS == 1)
   ACE_NEW (this->monitor_,
            ACE::Monitor_Control::Size_Monitor);
@@ -1322,9 +1376,12 @@ ACE_InputCDR::operator= (const ACE_InputCDR& rhs)
 {
   if (this != &rhs)
     {
+      this->release_chain ();
       this->start_.data_block (rhs.start_.data_block ()->duplicate ());
       this->start_.rd_ptr (rhs.start_.rd_ptr ());
       this->start_.wr_ptr (rhs.start_.wr_ptr ());
+      if (rhs.start_.cont () != 0)
+        this->start_.cont (rhs.start_.cont ()->duplicate ());
       this->do_byte_swap_ = rhs.do_byte_swap_;
       this->good_bit_ = true;
       this->char_translator_ = rhs.char_translator_;
@@ -1354,6 +1411,7 @@ ACE_InputCDR::ACE_InputCDR (const ACE_OutputCDR& rhs,
             ACE_Time_Value::max_time,
             data_block_allocator,
             message_block_allocator),
+    consumed_ (0),
     do_byte_swap_ (rhs.do_byte_swap_),
     good_bit_ (true),
     major_version_ (rhs.major_version_),
@@ -1832,6 +1890,52 @@ ACE_InputCDR::read_array (void* x,
 {
   if (length == 0)
     return true;
+
+  if (this->start_.cont () != 0)
+    {
+      // The array of a chained stream is read block by block, an
+      // element that straddles two blocks is read on its own.
+      char *target = static_cast<char *> (x);
+
+      while (length != 0 && this->start_.cont () != 0)
+        {
+#if !defined (ACE_LACKS_CDR_ALIGNMENT)
+          char * const buf = ACE_ptr_align_binary (this->rd_ptr (), align);
+#else
+          char * const buf = this->rd_ptr ();
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+
+          size_t const available =
+            buf < this->wr_ptr () ? (this->wr_ptr () - buf) / size : 0;
+
+          if (available >= length)
+            break;
+
+          ACE_CDR::ULong const n =
+            available == 0 ? 1 : static_cast<ACE_CDR::ULong> (available);
+
+          if (!this->read_array_i (target, size, align, n))
+            return false;
+
+          target += n * size;
+          length -= n;
+        }
+
+      if (length == 0)
+        return true;
+
+      x = target;
+    }
+
+  return this->read_array_i (x, size, align, length);
+}
+
+ACE_CDR::Boolean
+ACE_InputCDR::read_array_i (void* x,
+                            size_t size,
+                            size_t align,
+                            ACE_CDR::ULong length)
+{
   char* buf = 0;
 
   if (this->adjust (size * length, align, buf) == 0)
@@ -1944,7 +2048,13 @@ ACE_InputCDR::read_1 (ACE_CDR::Octet *x)
       return true;
     }
 
-  this->good_bit_ = false;
+  char *buf = 0;
+  if (this->adjust_chained (1, 1, buf) == 0)
+    {
+      *x = *reinterpret_cast<ACE_CDR::Octet*> (buf);
+      return true;
+    }
+
   return false;
 }
 
@@ -2049,10 +2159,9 @@ ACE_InputCDR::skip_string (void)
               return true;
             }
         }
-      else if (this->rd_ptr () + len <= this->wr_ptr ())
+      else
         {
-          this->rd_ptr (len);
-          return true;
+          return this->skip_bytes (len);
         }
       this->good_bit_ = false;
     }
@@ -2080,18 +2189,202 @@ ACE_InputCDR::skip_wstring (void)
 ACE_CDR::Boolean
 ACE_InputCDR::skip_bytes (size_t len)
 {
-  if (this->rd_ptr () + len <= this->wr_ptr ())
+  while (this->rd_ptr () + len > this->wr_ptr ())
     {
-      this->rd_ptr (len);
-      return true;
+      // Skip the rest of the current block of a chained stream.
+      len -= this->start_.length ();
+      if (this->next_block () != 0)
+        {
+          this->good_bit_ = false;
+          return false;
+        }
+    }
+
+  this->rd_ptr (len);
+  return true;
+}
+
+void
+ACE_InputCDR::append (ACE_Message_Block *data)
+{
+  ACE_Message_Block *last = &this->start_;
+  while (last->cont () != 0)
+    last = last->cont ();
+
+  last->cont (data);
+}
+
+int
+ACE_InputCDR::pullup (size_t n)
+{
+  size_t const available = this->start_.length ();
+
+  if (n <= available)
+    return 0;
+
+  // Find the blocks that hold the next n bytes.
+  ACE_Message_Block * const first = this->start_.cont ();
+  ACE_Message_Block *last = 0;
+  size_t total = available;
+
+  for (ACE_Message_Block *i = first; i != 0 && total < n; i = i->cont ())
+    {
+      total += i->length ();
+      last = i;
+    }
+
+  if (total < n)
+    return -1;
+
+  ACE_Data_Block * const db =
+    this->start_.data_block ()->clone_nocopy (
+      0, total + 2 * ACE_CDR::MAX_ALIGNMENT);
+
+  if (db == 0)
+    return -1;
+
+  // Copy the data, keeping the alignment of the read pointer.
+  size_t const offset =
+    reinterpret_cast<uintptr_t> (this->rd_ptr ()) % ACE_CDR::MAX_ALIGNMENT;
+  char * const start =
+    ACE_ptr_align_binary (db->base (), ACE_CDR::MAX_ALIGNMENT) + offset;
+
+  ACE_OS::memcpy (start, this->rd_ptr (), available);
+  char *end = start + available;
+
+  for (ACE_Message_Block *i = first; i != last->cont (); i = i->cont ())
+    {
+      ACE_OS::memcpy (end, i->rd_ptr (), i->length ());
+      end += i->length ();
+    }
+
+  this->start_.cont (last->cont ());
+  last->cont (0);
+  ACE_Message_Block::release (first->cont ());
+  first->cont (0);
+
+  // The first copied block keeps the data block that was being read,
+  // the callers may still refer to its data.
+  ACE_Data_Block * const copied =
+    first->replace_data_block (this->start_.replace_data_block (db));
+
+  if (ACE_BIT_DISABLED (first->self_flags (), ACE_Message_Block::DONT_DELETE))
+    copied->release ();
+
+  if (ACE_BIT_ENABLED (this->start_.self_flags (), ACE_Message_Block::DONT_DELETE))
+    first->set_self_flags (ACE_Message_Block::DONT_DELETE);
+  else
+    first->clr_self_flags (ACE_Message_Block::DONT_DELETE);
+
+  this->start_.clr_self_flags (ACE_Message_Block::DONT_DELETE);
+  this->start_.rd_ptr (start);
+  this->start_.wr_ptr (end);
+
+  first->cont (this->consumed_);
+  this->consumed_ = first;
+
+  return 0;
+}
+
+int
+ACE_InputCDR::adjust_chained (size_t size,
+                              size_t align,
+                              char *&buf)
+{
+  while (this->start_.cont () != 0)
+    {
+#if !defined (ACE_LACKS_CDR_ALIGNMENT)
+      buf = ACE_ptr_align_binary (this->rd_ptr (), align);
+#else
+      buf = this->rd_ptr ();
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+
+      if (buf < this->wr_ptr ())
+        {
+          // The data starts in this block and ends in the next ones.
+          if (this->pullup ((buf - this->rd_ptr ()) + size) != 0)
+            break;
+        }
+      else if (this->next_block () != 0)
+        {
+          break;
+        }
+
+#if !defined (ACE_LACKS_CDR_ALIGNMENT)
+      buf = ACE_ptr_align_binary (this->rd_ptr (), align);
+#else
+      buf = this->rd_ptr ();
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+
+      char * const end = buf + size;
+      if (end <= this->wr_ptr ())
+        {
+          this->start_.rd_ptr (end);
+          return 0;
+        }
     }
+
+#if defined (ACE_LACKS_CDR_ALIGNMENT)
+  ACE_UNUSED_ARG (align);
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+
   this->good_bit_ = false;
-  return false;
+  return -1;
+}
+
+int
+ACE_InputCDR::next_block (void)
+{
+  ACE_Message_Block * const next = this->start_.cont ();
+
+  if (next == 0)
+    return -1;
+
+  this->start_.cont (next->cont ());
+  next->cont (0);
+
+  char * const rd_ptr = next->rd_ptr ();
+  char * const wr_ptr = next->wr_ptr ();
+
+  // Exchange the data blocks and their flags, the next message block
+  // keeps the data block that was read.
+  ACE_Data_Block * const db =
+    next->replace_data_block (this->start_.data_block ());
+  (void) this->start_.replace_data_block (db);
+
+  ACE_Message_Block::Message_Flags const nf = next->self_flags ();
+  ACE_Message_Block::Message_Flags const sf = this->start_.self_flags ();
+
+  next->clr_self_flags (nf);
+  this->start_.clr_self_flags (sf);
+
+  next->set_self_flags (sf);
+  this->start_.set_self_flags (nf);
+
+  this->start_.rd_ptr (rd_ptr);
+  this->start_.wr_ptr (wr_ptr);
+
+  next->cont (this->consumed_);
+  this->consumed_ = next;
+
+  return 0;
+}
+
+void
+ACE_InputCDR::release_chain (void)
+{
+  ACE_Message_Block::release (this->start_.cont ());
+  this->start_.cont (0);
+
+  ACE_Message_Block::release (this->consumed_);
+  this->consumed_ = 0;
 }
 
 int
 ACE_InputCDR::grow (size_t newsize)
 {
+  this->release_chain ();
+
   if (ACE_CDR::grow (&this->start_, newsize) == -1)
     return -1;
 
@@ -2113,6 +2406,7 @@ ACE_InputCDR::reset (const ACE_Message_Block* data,
                      int byte_order)
 {
   this->reset_byte_order (byte_order);
+  this->release_chain ();
   ACE_CDR::consolidate (&this->start_, data);
 
 #if defined (ACE_HAS_MONITOR_POINTS) && (ACE_HAS_MONITOR_POINTS == 1)
@@ -2133,6 +2427,11 @@ ACE_InputCDR::steal_from (ACE_InputCDR &cdr)
   this->start_.wr_ptr (cdr.start_.wr_ptr ());
   this->major_version_ = cdr.major_version_;
   this->minor_version_ = cdr.minor_version_;
+
+  this->release_chain ();
+  this->start_.cont (cdr.start_.cont ());
+  cdr.start_.cont (0);
+
   cdr.reset_contents ();
 
 #if defined (ACE_HAS_MONITOR_POINTS) && (ACE_HAS_MONITOR_POINTS == 1)
@@ -2175,6 +2474,11 @@ ACE_InputCDR::exchange_data_blocks (ACE_InputCDR &cdr)
   cdr.start_.set_self_flags (sf);
   this->start_.set_self_flags (df);
 
+  // Exchange the rest of the chains.
+  ACE_Message_Block * const dcont = cdr.start_.cont ();
+  cdr.start_.cont (this->start_.cont ());
+  this->start_.cont (dcont);
+
   // Reset the <cdr> pointers to zero before it is set again.
   cdr.start_.reset ();
   this->start_.reset ();
@@ -2220,6 +2524,12 @@ ACE_InputCDR::clone_from (ACE_InputCDR &cdr)
 {
   this->do_byte_swap_ = cdr.do_byte_swap_;
 
+  // The rest of a chained stream is copied in one block.
+  if (cdr.start_.cont () != 0 && cdr.pullup (cdr.length ()) != 0)
+    return 0;
+
+  this->release_chain ();
+
   // Get the read & write pointer positions in the incoming CDR
   // streams
   char *rd_ptr = cdr.start_.rd_ptr ();
@@ -2317,6 +2627,7 @@ ACE_InputCDR::steal_contents (void)
 {
   ACE_Message_Block* block = this->start_.clone ();
   this->start_.data_block (block->data_block ()->clone ());
+  this->release_chain ();
 
   // If at all our message had a DONT_DELETE flag set, just clear it
   // off.
@@ -2334,6 +2645,7 @@ ACE_InputCDR::steal_contents (void)
 void
 ACE_InputCDR::reset_contents (void)
 {
+  this->release_chain ();
   this->start_.data_block (this->start_.data_block ()->clone_nocopy ());
 
   // Reset the flags...
@@ -941,11 +941,31 @@ public:
    * @return The start of the message block chain for this CDR
    *         stream.
    *
-   * @note In the current implementation the chain has length 1, but
-   *       we are planning to change that.
+   * @note The chain has more than one block only if blocks were
+   *       appended to the stream, its first block is the one being
+   *       read.
    */
   const ACE_Message_Block* start (void) const;
 
+  /// Append the chain of message blocks @a data to the stream, the
+  /// blocks are read in place once the current ones are exhausted.
+  /**
+   * The stream takes ownership of @a data.  The data of each block
+   * must start at an address aligned as its offset in the stream,
+   * GIOP 1.2 fragments are, since all but the last one are padded to
+   * a multiple of ACE_CDR::MAX_ALIGNMENT.
+   */
+  void append (ACE_Message_Block *data);
+
+  /// Make the next @a n bytes of the stream contiguous at rd_ptr(),
+  /// copying them out of the next blocks of the chain if needed.
+  /**
+   * The callers that use the buffer returned by rd_ptr() directly
+   * must call it first.
+   * @return 0 on success and -1 if the stream is shorter than @a n.
+   */
+  int pullup (size_t n);
+
   // = The following functions are useful to read the contents of the
   //   CDR stream from a socket or file.
 
@@ -1058,10 +1078,15 @@ public:
 
 protected:
 
-  /// The start of the chain of message blocks, even though in the
-  /// current version the chain always has length 1.
+  /// The block being read, followed by the blocks appended to the
+  /// stream that were not read yet.
   ACE_Message_Block start_;
 
+  /// The blocks of the chain that were read.  They are kept until the
+  /// stream is destroyed since the callers may still refer to their
+  /// data.
+  ACE_Message_Block *consumed_;
+
   /// The CDR stream byte order does not match the one on the machine,
   /// swapping is needed while reading.
   bool do_byte_swap_;
@@ -1082,6 +1107,19 @@ protected:
 #endif /* ACE_HAS_MONITOR_POINTS==1 */
 
 private:
+  /// Slow path of adjust(), when the data is not in the current
+  /// block.  Reads the data from the next blocks of the chain.
+  int adjust_chained (size_t size,
+                      size_t align,
+                      char *&buf);
+
+  /// Move to the next block of the chain, the current one is kept in
+  /// consumed_.  Returns -1 if there is no next block.
+  int next_block (void);
+
+  /// Release the blocks appended to the stream.
+  void release_chain (void);
+
   ACE_CDR::Boolean read_1 (ACE_CDR::Octet *x);
   ACE_CDR::Boolean read_2 (ACE_CDR::UShort *x);
   ACE_CDR::Boolean read_4 (ACE_CDR::ULong *x);
@@ -1112,6 +1150,12 @@ private:
                                size_t align,
                                ACE_CDR::ULong length);
 
+  /// Read an array that is in the current block.
+  ACE_CDR::Boolean read_array_i (void* x,
+                                 size_t size,
+                                 size_t align,
+                                 ACE_CDR::ULong length);
+
   /**
    * On those occasions when the native codeset for wchar is smaller than
    * the size of a wchar_t, such as using UTF-16 with a 4-byte wchar_t, a
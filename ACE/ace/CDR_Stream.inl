@@ -677,6 +677,9 @@ ACE_OutputCDR::wchar_translator (ACE_WChar_Codeset_Translator * wctran)
 ACE_INLINE
 ACE_InputCDR::~ACE_InputCDR (void)
 {
+  if (this->start_.cont () != 0 || this->consumed_ != 0)
+    this->release_chain ();
+
 #if defined (ACE_HAS_MONITOR_POINTS) && (ACE_HAS_MONITOR_POINTS == 1)
   this->monitor_->remove_ref ();
 #endif /* ACE_HAS_MONITOR_POINTS==1 */
@@ -794,7 +797,11 @@ ACE_InputCDR::read_fixed (ACE_CDR::Fixed &x)
 ACE_INLINE size_t
 ACE_InputCDR::length (void) const
 {
-  return this->start_.length ();
+  if (this->start_.cont () == 0)
+    return this->start_.length ();
+
+  return this->start_.length ()
+    + ACE_CDR::total_length (this->start_.cont (), 0);
 }
 
 ACE_INLINE ACE_CDR::Boolean
@@ -1155,11 +1162,7 @@ ACE_InputCDR::adjust (size_t size,
       return 0;
     }
 
-  this->good_bit_ = false;
-  return -1;
-#if defined (ACE_LACKS_CDR_ALIGNMENT)
-  ACE_UNUSED_ARG (align);
-#endif /* ACE_LACKS_CDR_ALIGNMENT */
+  return this->adjust_chained (size, align, buf);
 }
 
 ACE_INLINE int
@@ -1702,8 +1705,7 @@ ACE_InputCDR::align_read_ptr (size_t alignment)
       return 0;
     }
 
-  this->good_bit_ = false;
-  return -1;
+  return this->adjust_chained (0, alignment, buf);
 }
 
 ACE_INLINE void
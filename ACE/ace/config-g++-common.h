@@ -41,6 +41,9 @@
 # if __cplusplus > 201402L
 #  define ACE_HAS_CPP17
 # endif
+# if __cplusplus > 201703L
+#  define ACE_HAS_CPP20
+# endif
 #endif
 
 #if (defined (i386) || defined (__i386__)) && !defined (ACE_SIZEOF_LONG_DOUBLE)
@@ -94,6 +94,45 @@ CDR_Test_Types::CDR_Test_Types (void)
     a[i] = i;
 }
 
+// Copy the contents of <cdr> in blocks of <block_size> octets, each
+// one after a gap, as a fragmented GIOP message would be received.
+static ACE_Message_Block *
+chain_blocks (const ACE_OutputCDR &cdr, size_t block_size)
+{
+  ACE_Message_Block flat (cdr.total_length () + ACE_CDR::MAX_ALIGNMENT);
+  ACE_CDR::mb_align (&flat);
+  for (const ACE_Message_Block *i = cdr.begin (); i != 0; i = i->cont ())
+    flat.copy (i->rd_ptr (), i->length ());
+
+  ACE_Message_Block *head = 0;
+  ACE_Message_Block *tail = 0;
+  while (flat.length () != 0)
+    {
+      size_t const len = ACE_MIN (block_size, flat.length ());
+
+      ACE_Message_Block *mb = 0;
+      ACE_NEW_RETURN (mb,
+                      ACE_Message_Block (len + 3 * ACE_CDR::MAX_ALIGNMENT),
+                      0);
+      ACE_CDR::mb_align (mb);
+      if (head != 0)
+        {
+          mb->rd_ptr (2 * ACE_CDR::MAX_ALIGNMENT);
+          mb->wr_ptr (2 * ACE_CDR::MAX_ALIGNMENT);
+        }
+      mb->copy (flat.rd_ptr (), len);
+      flat.rd_ptr (len);
+
+      if (tail == 0)
+        head = mb;
+      else
+        tail->cont (mb);
+      tail = mb;
+    }
+
+  return head;
+}
+
 static int
 short_stream (void)
 {
@@ -1002,6 +1041,45 @@ run_main (int argc, ACE_TCHAR *argv[])
 
   ACE_DEBUG ((LM_DEBUG,
               ACE_TEXT ("Consolidation - no errors\n\n")
+              ACE_TEXT ("Testing chained input\n\n")));
+
+  for (size_t block_size = 8; block_size <= 64; block_size *= 2)
+    {
+      ACE_Message_Block *chain = chain_blocks (output, block_size);
+      if (chain == 0)
+        return 1;
+
+      ACE_InputCDR chained (chain->data_block ()->duplicate (),
+                            0,
+                            static_cast<size_t> (chain->rd_ptr () - chain->base ()),
+                            static_cast<size_t> (chain->wr_ptr () - chain->base ()));
+      chained.append (chain->cont ());
+      chain->cont (0);
+      chain->release ();
+
+      if (chained.length () != output.total_length ())
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           ACE_TEXT ("chained length %B, expected %B\n"),
+                           chained.length (),
+                           output.total_length ()),
+                          1);
+
+      ACE_InputCDR copy (chained);
+
+      if (test_types.test_get (chained) != 0)
+        return 1;
+
+      if (copy.skip_bytes (output.total_length () - 1) == 0
+          || copy.length () != 1
+          || copy.skip_bytes (2) != 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           ACE_TEXT ("skip_bytes of chained blocks of %B failed\n"),
+                           block_size),
+                          1);
+    }
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("Chained input - no errors\n\n")
               ACE_TEXT ("Testing placeholder/replace\n\n")));
 
   output.reset();
@@ -2534,12 +2534,23 @@ TAO_CodeGen::gen_stub_hdr_includes (void)
                                "tao/String_Manager_T.h",
                                this->client_header_);
 
+  this->gen_cond_file_include (idl_global->string_member_seen_
+                                 && be_global->gen_sso_strings (),
+                               "tao/SSO_String_Manager_T.h",
+                               this->client_header_);
+
   // Include the Messaging library entry point, if AMI is enabled.
   if (be_global->ami_call_back ())
     {
       // Include Messaging skeleton file.
       this->gen_standard_include (this->client_header_,
                                   "tao/Messaging/Messaging.h");
+
+      if (be_global->gen_ami_coroutines ())
+        {
+          this->gen_standard_include (this->client_header_,
+                                      "tao/Messaging/AMI_Coroutine.h");
+        }
     }
 
   // Include the AMI4CCM library entry point, if AMI4CCM is enabled.
@@ -2831,6 +2842,12 @@ TAO_CodeGen::gen_skel_hdr_includes (void)
         {
           this->gen_standard_include (this->server_header_,
                                       "tao/Messaging/AMH_Response_Handler.h");
+
+          if (be_global->gen_amh_coroutines ())
+            {
+              this->gen_standard_include (this->server_header_,
+                                          "tao/Messaging/AMH_Coroutine.h");
+            }
         }
     }
 }
@@ -2875,6 +2892,16 @@ TAO_CodeGen::gen_skel_src_includes (void)
             "tao/PortableServer/Operation_Table_Perfect_Hash.h");
         }
         break;
+      case BE_GlobalData::TAO_SWITCH_DISPATCH:
+        {
+          this->gen_standard_include (
+            this->server_skeletons_,
+            "tao/PortableServer/Operation_Table_Switch.h");
+          this->gen_standard_include (
+            this->server_skeletons_,
+            "ace/OS_NS_string.h");
+        }
+        break;
     }
 
   if (be_global->gen_direct_collocation ())
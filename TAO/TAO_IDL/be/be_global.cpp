@@ -110,7 +110,9 @@ BE_GlobalData::BE_GlobalData (void)
     opt_tc_ (false),
     ami4ccm_call_back_ (false),
     ami_call_back_ (false),
+    gen_ami_coroutines_ (false),
     gen_amh_classes_ (false),
+    gen_amh_coroutines_ (false),
     gen_tie_classes_ (false),
     gen_smart_proxies_ (false),
     gen_inline_constants_ (true),
@@ -154,6 +156,7 @@ BE_GlobalData::BE_GlobalData (void)
     gen_conn_export_hdr_file_ (false),
     tab_size_ (2),
     alt_mapping_ (false),
+    gen_sso_strings_ (false),
     in_facet_servant_ (false),
     gen_arg_traits_ (true),
     gen_anytypecode_adapter_ (false),
@@ -1870,6 +1873,18 @@ BE_GlobalData::ami_call_back (void) const
   return this->ami_call_back_;
 }
 
+void
+BE_GlobalData::gen_ami_coroutines (bool val)
+{
+  this->gen_ami_coroutines_ = val;
+}
+
+bool
+BE_GlobalData::gen_ami_coroutines (void) const
+{
+  return this->gen_ami_coroutines_;
+}
+
 void
 BE_GlobalData::gen_amh_classes (bool val)
 {
@@ -1882,6 +1897,18 @@ BE_GlobalData::gen_amh_classes (void) const
   return this->gen_amh_classes_;
 }
 
+void
+BE_GlobalData::gen_amh_coroutines (bool val)
+{
+  this->gen_amh_coroutines_ = val;
+}
+
+bool
+BE_GlobalData::gen_amh_coroutines (void) const
+{
+  return this->gen_amh_coroutines_;
+}
+
 void
 BE_GlobalData::gen_tie_classes (bool val)
 {
@@ -2689,6 +2716,18 @@ BE_GlobalData::alt_mapping (bool val)
   this->alt_mapping_ = val;
 }
 
+bool
+BE_GlobalData::gen_sso_strings (void) const
+{
+  return this->gen_sso_strings_ && !this->alt_mapping_;
+}
+
+void
+BE_GlobalData::gen_sso_strings (bool val)
+{
+  this->gen_sso_strings_ = val;
+}
+
 bool
 BE_GlobalData::in_facet_servant (void) const
 {
@@ -2897,8 +2936,8 @@ BE_GlobalData::parse_args (long &i, char **av)
           }
         break;
         // Operation lookup strategy.
-        // <perfect_hash>, <dynamic_hash> or <binary_search>
-        // Default is perfect.
+        // <perfect_hash>, <dynamic_hash>, <binary_search>,
+        // <linear_search> or <switch>.  Default is perfect.
       case 'H':
         idl_global->append_idl_flag (av[i + 1]);
 
@@ -2924,6 +2963,10 @@ BE_GlobalData::parse_args (long &i, char **av)
           {
             be_global->lookup_strategy (BE_GlobalData::TAO_LINEAR_SEARCH);
           }
+        else if (ACE_OS::strcmp (av[i + 1], "switch") == 0)
+          {
+            be_global->lookup_strategy (BE_GlobalData::TAO_SWITCH_DISPATCH);
+          }
         else
           {
             ACE_ERROR ((LM_ERROR,
@@ -3186,6 +3229,12 @@ BE_GlobalData::parse_args (long &i, char **av)
           {
             // AMI with Call back.
             be_global->ami_call_back (true);
+
+            if (av[i][3] == 'o')
+              {
+                // Awaitable co_* stubs for C++20 coroutines.
+                be_global->gen_ami_coroutines (true);
+              }
           }
         else if (av[i][2] == 'M')
           {
@@ -3203,6 +3252,12 @@ BE_GlobalData::parse_args (long &i, char **av)
           {
             // AMH classes.
             be_global->gen_amh_classes (true);
+
+            if (av[i][3] == 'o')
+              {
+                // co_* operations for C++20 coroutine servants.
+                be_global->gen_amh_coroutines (true);
+              }
           }
         else if (av[i][2] == 'X')
           {
@@ -3271,6 +3326,12 @@ BE_GlobalData::parse_args (long &i, char **av)
                 // and sequences.
                 be_global->alt_mapping (true);
               }
+            else if (av[i][3] == 's' && av[i][4] == 'o' && '\0' == av[i][5])
+              {
+                // String members with inline storage for short
+                // strings.
+                be_global->gen_sso_strings (true);
+              }
             else
               {
                 ACE_ERROR ((
@@ -942,8 +942,12 @@ be_interface::gen_operation_table (const char *flat_name,
   switch (be_global->lookup_strategy ())
   {
     case BE_GlobalData::TAO_DYNAMIC_HASH:
+    case BE_GlobalData::TAO_SWITCH_DISPATCH:
+      // The switch strategy uses the same table, the lookup function
+      // returns a pointer to the entry.
       {
         this->skel_count_ = 0;
+        this->optable_names_.clear ();
         // Init the outstream appropriately.
         TAO_OutStream *os = tao_cg->server_skeletons ();
 
@@ -993,6 +997,7 @@ be_interface::gen_operation_table (const char *flat_name,
           }
 
         ++this->skel_count_;
+        this->optable_names_.push_back ("_is_a");
 
         if (!be_global->gen_minimum_corba ())
           {
@@ -1013,6 +1018,7 @@ be_interface::gen_operation_table (const char *flat_name,
               }
 
             ++this->skel_count_;
+            this->optable_names_.push_back ("_non_existent");
           }
 
         if (!be_global->gen_corba_e () && !be_global->gen_minimum_corba ())
@@ -1034,6 +1040,7 @@ be_interface::gen_operation_table (const char *flat_name,
               }
 
             ++this->skel_count_;
+            this->optable_names_.push_back ("_component");
           }
 
         if (!be_global->gen_corba_e () && !be_global->gen_minimum_corba ())
@@ -1050,6 +1057,7 @@ be_interface::gen_operation_table (const char *flat_name,
               }
 
             ++this->skel_count_;
+            this->optable_names_.push_back ("_interface");
           }
 
         if (!be_global->gen_minimum_corba ())
@@ -1071,9 +1079,18 @@ be_interface::gen_operation_table (const char *flat_name,
               }
 
             ++this->skel_count_;
+            this->optable_names_.push_back ("_repository_id");
           }
 
-        *os << "};" << be_nl_2;
+        *os << "};";
+
+        if (be_global->lookup_strategy () == BE_GlobalData::TAO_SWITCH_DISPATCH)
+          {
+            this->gen_switch_lookup (flat_name);
+            break;
+          }
+
+        *os << be_nl_2;
         *os << "static const ::CORBA::Long _tao_" << flat_name
             << "_optable_size = sizeof (ACE_Hash_Map_Entry<const char *,"
             << " TAO::Operation_Skeletons>) * (" << (3 * this->skel_count_)
@@ -1375,7 +1392,8 @@ be_interface::gen_optable_entries (be_interface *derived_interface,
   int const lookup_strategy =
     be_global->lookup_strategy ();
 
-  if (lookup_strategy == BE_GlobalData::TAO_DYNAMIC_HASH)
+  if (lookup_strategy == BE_GlobalData::TAO_DYNAMIC_HASH
+      || lookup_strategy == BE_GlobalData::TAO_SWITCH_DISPATCH)
     {
       for (UTL_ScopeActiveIterator si (this, UTL_Scope::IK_decls);
            !si.is_done ();
@@ -1413,6 +1431,8 @@ be_interface::gen_optable_entries (be_interface *derived_interface,
               *os << "}," << be_nl;
 
               ++derived_interface->skel_count_;
+              derived_interface->optable_names_.push_back (
+                d->original_local_name ()->get_string ());
             }
           else if (d->node_type () == AST_Decl::NT_attr)
             {
@@ -1442,6 +1462,9 @@ be_interface::gen_optable_entries (be_interface *derived_interface,
               *os << "}," << be_nl;
 
               ++derived_interface->skel_count_;
+              ACE_CString get_name ("_get_");
+              get_name += d->original_local_name ()->get_string ();
+              derived_interface->optable_names_.push_back (get_name);
 
               if (!attr->readonly ())
                 {
@@ -1464,6 +1487,9 @@ be_interface::gen_optable_entries (be_interface *derived_interface,
                   *os << "}," << be_nl;
 
                   ++derived_interface->skel_count_;
+                  ACE_CString set_name ("_set_");
+                  set_name += d->original_local_name ()->get_string ();
+                  derived_interface->optable_names_.push_back (set_name);
                 }
             }
         }
@@ -2303,6 +2329,164 @@ be_interface::gen_linear_search_instance (const char *flat_name)
       << "tao_" << flat_name << "_optable;";
 }
 
+// Output the lookup function of the switch strategy, and an instance
+// of the optable that uses it.
+void
+be_interface::gen_switch_lookup (const char *flat_name)
+{
+  TAO_OutStream *os = tao_cg->server_skeletons ();
+
+  *os << be_nl_2 << "// TAO_IDL - Generated from" << be_nl
+      << "// " << __FILE__ << ":" << __LINE__ << be_nl_2;
+
+  // Group the entries by length, the first switch is on the length
+  // of the operation name.
+  size_t max_length = 0;
+  for (size_t i = 0; i < this->optable_names_.size (); ++i)
+    {
+      if (this->optable_names_[i].length () > max_length)
+        {
+          max_length = this->optable_names_[i].length ();
+        }
+    }
+
+  *os << "static TAO_operation_db_entry const *" << be_nl
+      << "tao_" << flat_name << "_lookup (const char *opname, "
+      << "unsigned int length)" << be_nl
+      << "{" << be_idt_nl
+      << "switch (length)" << be_idt_nl
+      << "{";
+
+  for (size_t length = 1; length <= max_length; ++length)
+    {
+      ACE_Vector<size_t> entries;
+
+      for (size_t i = 0; i < this->optable_names_.size (); ++i)
+        {
+          if (this->optable_names_[i].length () == length)
+            {
+              entries.push_back (i);
+            }
+        }
+
+      if (entries.size () == 0)
+        {
+          continue;
+        }
+
+      *os << be_nl
+          << "case " << static_cast<ACE_CDR::ULong> (length) << ":"
+          << be_idt_nl;
+
+      this->gen_switch_cases (os, flat_name, entries, length);
+
+      *os << be_nl
+          << "break;" << be_uidt;
+    }
+
+  *os << be_nl
+      << "}" << be_uidt << be_nl_2
+      << "return 0;" << be_uidt_nl
+      << "}";
+
+  *os << be_nl_2
+      << "static TAO_Switch_OpTable tao_" << flat_name << "_optable ("
+      << "tao_" << flat_name << "_lookup);";
+}
+
+// The entries all have the same length.  Switch on the character
+// that tells most of them apart, until a single one is left, which
+// is then compared as a whole.
+void
+be_interface::gen_switch_cases (TAO_OutStream *os,
+                                const char *flat_name,
+                                const ACE_Vector<size_t> &entries,
+                                size_t length)
+{
+  if (entries.size () == 1)
+    {
+      size_t const index = entries[0];
+
+      *os << "if (ACE_OS::memcmp (opname, \""
+          << this->optable_names_[index].c_str () << "\", "
+          << static_cast<ACE_CDR::ULong> (length) << ") == 0)" << be_idt_nl
+          << "return &" << flat_name << "_operations["
+          << static_cast<ACE_CDR::ULong> (index) << "];" << be_uidt;
+      return;
+    }
+
+  // Find the position with the most distinct characters, the names
+  // are distinct so there is always one with at least two.
+  size_t position = 0;
+  size_t most_distinct = 0;
+
+  for (size_t p = 0; p < length; ++p)
+    {
+      bool seen[256] = { false };
+      size_t distinct = 0;
+
+      for (size_t i = 0; i < entries.size (); ++i)
+        {
+          unsigned char const c =
+            static_cast<unsigned char> (this->optable_names_[entries[i]][p]);
+
+          if (!seen[c])
+            {
+              seen[c] = true;
+              ++distinct;
+            }
+        }
+
+      if (distinct > most_distinct)
+        {
+          position = p;
+          most_distinct = distinct;
+        }
+    }
+
+  *os << "switch (opname[" << static_cast<ACE_CDR::ULong> (position) << "])"
+      << be_idt_nl
+      << "{";
+
+  bool done[256] = { false };
+
+  for (size_t i = 0; i < entries.size (); ++i)
+    {
+      char const c = this->optable_names_[entries[i]][position];
+      unsigned char const uc = static_cast<unsigned char> (c);
+
+      if (done[uc])
+        {
+          continue;
+        }
+
+      done[uc] = true;
+
+      ACE_Vector<size_t> subset;
+
+      for (size_t j = i; j < entries.size (); ++j)
+        {
+          if (this->optable_names_[entries[j]][position] == c)
+            {
+              subset.push_back (entries[j]);
+            }
+        }
+
+      // Identifiers only contain letters, digits and underscores.
+      char const label[] = { c, '\0' };
+      *os << be_nl
+          << "case '" << label << "':" << be_idt_nl;
+
+      this->gen_switch_cases (os, flat_name, subset, length);
+
+      *os << be_nl
+          << "break;" << be_uidt;
+    }
+
+  *os << be_nl
+      << "}" << be_uidt;
+}
+
 int
 be_interface::is_a_helper (be_interface * /*derived*/,
                            be_interface *bi,
@@ -348,7 +348,7 @@ be_util::arg_post_proc (void)
               ACE_TEXT ("TAO_IDL: warning, GPERF could not be executed\n")
               ACE_TEXT ("Perfect Hashing or Binary/Linear Search cannot be")
               ACE_TEXT (" done without GPERF\n")
-              ACE_TEXT ("Now, using Dynamic Hashing..\n")
+              ACE_TEXT ("Now, using the switch strategy..\n")
               ACE_TEXT ("To use Perfect Hashing or Binary/Linear")
               ACE_TEXT (" Search strategy\n")
               ACE_TEXT ("\t-Build gperf at $ACE_ROOT/apps/gperf/src\n")
@@ -359,18 +359,19 @@ be_util::arg_post_proc (void)
               ACE_TEXT (" for more details\n")
             ));
 
-          // Switching over to Dynamic Hashing.
-          be_global->lookup_strategy (BE_GlobalData::TAO_DYNAMIC_HASH);
+          // Switching over to the switch strategy, it dispatches
+          // faster than Dynamic Hashing.
+          be_global->lookup_strategy (BE_GlobalData::TAO_SWITCH_DISPATCH);
         }
     }
 #else /* Not ACE_HAS_GPERF */
   // If GPERF is not there, we cannot use PERFECT_HASH strategy. Let
-  // us go for DYNAMIC_HASH.
+  // us go for the switch strategy.
   if ((be_global->lookup_strategy () == BE_GlobalData::TAO_PERFECT_HASH) ||
       (be_global->lookup_strategy () == BE_GlobalData::TAO_BINARY_SEARCH) ||
       (be_global->lookup_strategy () == BE_GlobalData::TAO_LINEAR_SEARCH))
     {
-      be_global->lookup_strategy (BE_GlobalData::TAO_DYNAMIC_HASH);
+      be_global->lookup_strategy (BE_GlobalData::TAO_SWITCH_DISPATCH);
     }
 #endif /* ACE_HAS_GPERF */
 
@@ -565,10 +566,20 @@ be_util::usage (void)
       LM_DEBUG,
       ACE_TEXT (" -GC \t\t\tGenerate the AMI classes\n")
     ));
+  ACE_DEBUG ((
+      LM_DEBUG,
+      ACE_TEXT (" -GCo \t\t\tGenerate the AMI classes and the")
+      ACE_TEXT (" awaitable co_* stubs for C++20 coroutines\n")
+    ));
   ACE_DEBUG ((
       LM_DEBUG,
       ACE_TEXT (" -GH \t\t\tGenerate the AMH classes\n")
     ));
+  ACE_DEBUG ((
+      LM_DEBUG,
+      ACE_TEXT (" -GHo \t\t\tGenerate the AMH classes and the")
+      ACE_TEXT (" co_* operations for C++20 coroutine servants\n")
+    ));
   ACE_DEBUG ((
       LM_DEBUG,
       ACE_TEXT (" -GM \t\t\tGenerate the AMI4CCM classes\n")
@@ -646,6 +657,11 @@ be_util::usage (void)
       LM_DEBUG,
       ACE_TEXT (" -Gsp\t\t\tGenerate the code for Smart Proxies\n")
     ));
+  ACE_DEBUG ((
+      LM_DEBUG,
+      ACE_TEXT (" -Gsso\t\t\tMap the string members of structs and")
+      ACE_TEXT (" exceptions to TAO::SSO_String_Manager\n")
+    ));
   ACE_DEBUG ((
       LM_DEBUG,
       ACE_TEXT (" -Gstl\t\t\tGenerate the alternate C++ mapping for")
@@ -779,6 +795,11 @@ be_util::usage (void)
       ACE_TEXT (" -H binary_search\tTo force binary search operation")
       ACE_TEXT (" lookup strategy\n")
     ));
+  ACE_DEBUG ((
+      LM_DEBUG,
+      ACE_TEXT (" -H switch\t\tTo force switch statements operation")
+      ACE_TEXT (" lookup strategy, does not need GPERF\n")
+    ));
   ACE_DEBUG ((
       LM_DEBUG,
       ACE_TEXT (" -in \t\t\tTo generate <>s for standard #include'd")
@@ -1005,6 +1026,20 @@ be_util::overwrite_ciao_exec_files ()
   return overwrite;
 }
 
+bool
+be_util::sso_string_member (AST_Decl *field)
+{
+  if (!be_global->gen_sso_strings () || field == 0)
+    {
+      return false;
+    }
+
+  AST_Decl::NodeType const nt =
+    ScopeAsDecl (field->defined_in ())->node_type ();
+
+  return nt == AST_Decl::NT_struct || nt == AST_Decl::NT_except;
+}
+
 void
 be_util::set_arg_seen_bit (be_type *bt)
 {
@@ -0,0 +1,215 @@
+
+//=============================================================================
+/**
+ *  @file    amh_coroutine_ss.cpp
+ *
+ *  Visitor that generates the arguments of the co_* operations of the
+ *  AMH skeletons, and the forwarding of the AMH arguments to them.
+ */
+//=============================================================================
+
+#include "argument.h"
+
+// ************************************************************************
+// Visitor to generate the arguments of the co_* AMH operations
+// ************************************************************************
+
+be_visitor_args_amh_coroutine_ss::be_visitor_args_amh_coroutine_ss (
+    be_visitor_context *ctx,
+    bool upcall)
+  : be_visitor_args (ctx),
+    upcall_ (upcall)
+{
+}
+
+be_visitor_args_amh_coroutine_ss::~be_visitor_args_amh_coroutine_ss (void)
+{
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_argument (
+  be_argument *node)
+{
+  this->ctx_->node (node);
+
+  be_type *bt = be_type::narrow_from_decl (node->field_type ());
+
+  if (!bt)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_args_amh_coroutine_ss::")
+                         ACE_TEXT ("visit_argument - ")
+                         ACE_TEXT ("Bad argument type\n")),
+                        -1);
+    }
+
+  if (bt->accept (this) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_args_amh_coroutine_ss::")
+                         ACE_TEXT ("visit_argument - ")
+                         ACE_TEXT ("cannot accept visitor\n")),
+                        -1);
+    }
+
+  return 0;
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_enum (be_enum *node)
+{
+  return this->emit_value (node);
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_interface (
+  be_interface *node)
+{
+  return this->emit_var (node);
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_interface_fwd (
+  be_interface_fwd *node)
+{
+  return this->emit_var (node);
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_predefined_type (
+  be_predefined_type *node)
+{
+  AST_PredefinedType::PredefinedType pt = node->pt ();
+
+  if (pt == AST_PredefinedType::PT_pseudo
+      || pt == AST_PredefinedType::PT_object)
+    {
+      return this->emit_var (node);
+    }
+
+  return this->emit_value (node);
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_sequence (
+  be_sequence *node)
+{
+  return this->emit_value (node);
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_string (
+  be_string *node)
+{
+  TAO_OutStream *os = this->ctx_->stream ();
+  be_argument *arg =
+    be_argument::narrow_from_decl (this->ctx_->node ());
+
+  if (!this->upcall_)
+    {
+      if (node->width () == (long) sizeof (char))
+        {
+          *os << "::CORBA::String_var ";
+        }
+      else
+        {
+          *os << "::CORBA::WString_var ";
+        }
+    }
+
+  // The _var constructors copy a const string.
+  *os << arg->local_name ();
+
+  return 0;
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_structure (
+  be_structure *node)
+{
+  return this->emit_value (node);
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_union (
+  be_union *node)
+{
+  return this->emit_value (node);
+}
+
+int be_visitor_args_amh_coroutine_ss::visit_typedef (
+  be_typedef *node)
+{
+  this->ctx_->alias (node);
+
+  if (node->primitive_base_type ()->accept (this) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_args_amh_coroutine_ss::")
+                         ACE_TEXT ("visit_typedef - ")
+                         ACE_TEXT ("accept on primitive ")
+                         ACE_TEXT ("type failed\n")),
+                        -1);
+    }
+
+  this->ctx_->alias (0);
+  return 0;
+}
+
+int
+be_visitor_args_amh_coroutine_ss::visit_component (
+    be_component *node)
+{
+  return this->visit_interface (node);
+}
+
+int
+be_visitor_args_amh_coroutine_ss::visit_component_fwd (
+    be_component_fwd *node)
+{
+  return this->visit_interface_fwd (node);
+}
+
+int
+be_visitor_args_amh_coroutine_ss::emit_var (be_type *node)
+{
+  TAO_OutStream *os = this->ctx_->stream ();
+  be_argument *arg =
+    be_argument::narrow_from_decl (this->ctx_->node ());
+
+  if (this->upcall_)
+    {
+      // A _var adopts the reference it is built from.
+      *os << "::" << node->name () << "::_duplicate ("
+          << arg->local_name () << ")";
+
+      return 0;
+    }
+
+  be_type *bt = this->ctx_->alias ();
+
+  if (bt == 0)
+    {
+      bt = node;
+    }
+
+  *os << "::" << bt->name () << "_var "
+      << arg->local_name ();
+
+  return 0;
+}
+
+int
+be_visitor_args_amh_coroutine_ss::emit_value (be_type *node)
+{
+  TAO_OutStream *os = this->ctx_->stream ();
+  be_argument *arg =
+    be_argument::narrow_from_decl (this->ctx_->node ());
+
+  if (!this->upcall_)
+    {
+      be_type *bt = this->ctx_->alias ();
+
+      if (bt == 0)
+        {
+          bt = node;
+        }
+
+      *os << "::" << bt->name () << " ";
+    }
+
+  *os << arg->local_name ();
+
+  return 0;
+}
@@ -655,6 +655,11 @@ be_visitor_field_cdr_op_cs::visit_string (be_string *str)
                   << str->max_size ()->ev ()->u.ulval << "))";
             }
         }
+      else if (be_util::sso_string_member (f))
+        {
+          // Read short strings straight into the member.
+          *os << "(strm >> _tao_aggregate." << f->local_name () << ")";
+        }
       else
         {
           *os << "(strm >> _tao_aggregate." << f->local_name () << ".out ())";
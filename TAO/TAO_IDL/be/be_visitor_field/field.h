@@ -30,6 +30,7 @@
 #include "be_union.h"
 #include "be_union_fwd.h"
 #include "be_helper.h"
+#include "be_util.h"
 #include "utl_identifier.h"
 
 #include "be_visitor_field.h"
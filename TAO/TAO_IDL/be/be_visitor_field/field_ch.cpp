@@ -386,13 +386,15 @@ be_visitor_field_ch::visit_string (be_string *node)
 {
   TAO_OutStream *os = this->ctx_->stream ();
 
+  bool const sso = be_util::sso_string_member (this->ctx_->node ());
+
   if (node->width () == (long) sizeof (char))
     {
-      *os << "::TAO::String_Manager";
+      *os << (sso ? "::TAO::SSO_String_Manager" : "::TAO::String_Manager");
     }
   else
     {
-      *os << "::TAO::WString_Manager";
+      *os << (sso ? "::TAO::SSO_WString_Manager" : "::TAO::WString_Manager");
     }
 
   return 0;
@@ -397,6 +397,15 @@ be_visitor_interface::visit_operation (be_operation *node)
         ctx.state (TAO_CodeGen::TAO_OPERATION_CH);
         be_visitor_operation_ch visitor (&ctx);
         status = node->accept (&visitor);
+
+        if (status != -1
+            && node->is_sendc_ami ()
+            && be_global->gen_ami_coroutines ())
+          {
+            be_visitor_operation_ami_coroutine_ch co_visitor (&ctx);
+            status = node->accept (&co_visitor);
+          }
+
         break;
       }
     case TAO_CodeGen::TAO_ROOT_CS:
@@ -406,6 +415,12 @@ be_visitor_interface::visit_operation (be_operation *node)
         {
           be_visitor_operation_ami_cs visitor (&ctx);
           status = node->accept (&visitor);
+
+          if (status != -1 && be_global->gen_ami_coroutines ())
+            {
+              be_visitor_operation_ami_coroutine_cs co_visitor (&ctx);
+              status = node->accept (&co_visitor);
+            }
         }
       else
         {
@@ -430,8 +430,31 @@ be_visitor_interface_ss::dispatch_method (be_interface *node)
       << "TAO::Portable_Server::Servant_Upcall* servant_upcall)"
       << be_uidt_nl;
   *os << "{" << be_idt_nl;
-  *os << "this->synchronous_upcall_dispatch (req, servant_upcall, this);"
-      << be_uidt_nl;
+
+  if (be_global->lookup_strategy () == BE_GlobalData::TAO_SWITCH_DISPATCH)
+    {
+      // Call the generated lookup function directly, not through
+      // the operation table.
+      ACE_CString flat_name_holder =
+        this->generate_flat_name (node);
+
+      *os << "TAO_operation_db_entry const * const entry =" << be_idt_nl
+          << "tao_" << flat_name_holder.c_str () << "_lookup ("
+          << "req.operation ()," << be_idt_nl
+          << "static_cast<unsigned int> (req.operation_length ()));"
+          << be_uidt << be_uidt_nl << be_nl
+          << "this->synchronous_upcall_dispatch (" << be_idt_nl
+          << "req," << be_nl
+          << "servant_upcall," << be_nl
+          << "this," << be_nl
+          << "entry == 0 ? 0 : entry->skel_ptr);" << be_uidt_nl;
+    }
+  else
+    {
+      *os << "this->synchronous_upcall_dispatch (req, servant_upcall, this);"
+          << be_uidt_nl;
+    }
+
   *os << "}";
 }
 
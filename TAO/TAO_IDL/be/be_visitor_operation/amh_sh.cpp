@@ -41,11 +41,68 @@ be_visitor_amh_operation_sh::visit_operation (be_operation *node)
   TAO_OutStream *os = this->ctx_->stream ();
   this->ctx_->node (node);
 
-  this->generate_shared_prologue (node, os, "");
+  this->generate_skel_declaration (node, os, "");
+
+  if (!this->is_amh_coroutine (node))
+    {
+      if (this->generate_method (node, os, false) == -1)
+        {
+          return -1;
+        }
+
+      *os << " = 0;" << be_uidt_nl;
+
+      return 0;
+    }
+
+  *os << "\n#if (TAO_HAS_AMH_COROUTINES == 1)" << be_nl;
+
+  // The AMH operation is implemented by the skeleton, it calls the
+  // co_* operation of the servant.
+  if (this->generate_method (node, os, false) == -1)
+    {
+      return -1;
+    }
+
+  *os << ";" << be_uidt_nl << be_nl;
+
+  if (this->generate_method (node, os, true) == -1)
+    {
+      return -1;
+    }
+
+  *os << " = 0;" << be_uidt
+      << "\n#else" << be_nl;
+
+  if (this->generate_method (node, os, false) == -1)
+    {
+      return -1;
+    }
+
+  *os << " = 0;" << be_uidt
+      << "\n#endif /* TAO_HAS_AMH_COROUTINES == 1 */" << be_nl;
+
+  return 0;
+}
+
+int
+be_visitor_amh_operation_sh::generate_method (be_operation *node,
+                                              TAO_OutStream *os,
+                                              bool coroutine)
+{
+  if (coroutine)
+    {
+      this->generate_method_head (node, os, "::TAO::AMH::Coroutine", "co_");
+    }
+  else
+    {
+      this->generate_method_head (node, os, "void", "");
+    }
 
   be_visitor_context ctx (*this->ctx_);
   be_visitor_args_arglist arglist_visitor (&ctx);
   arglist_visitor.set_fixed_direction (AST_Argument::dir_IN);
+  be_visitor_args_amh_coroutine_ss co_visitor (&ctx);
   ctx.scope (node);
 
   for (UTL_ScopeActiveIterator i (node, UTL_Scope::IK_decls);
@@ -63,18 +120,29 @@ be_visitor_amh_operation_sh::visit_operation (be_operation *node)
 
       *os << "," << be_nl;
 
-      if (arglist_visitor.visit_argument (argument) == -1)
+      int status = 0;
+
+      if (coroutine)
+        {
+          status = co_visitor.visit_argument (argument);
+        }
+      else
+        {
+          status = arglist_visitor.visit_argument (argument);
+        }
+
+      if (status == -1)
         {
           ACE_ERROR_RETURN ((LM_ERROR,
                              "(%N:%l) be_visitor_amh_operation_sh::"
-                             "visit_operation - "
+                             "generate_method - "
                              "codegen for upcall args failed\n"),
                             -1);
         }
     }
 
   *os << be_uidt_nl
-      << ") = 0;" << be_uidt_nl;
+      << ")";
 
   return 0;
 }
@@ -122,6 +190,16 @@ be_visitor_amh_operation_sh::generate_shared_prologue (
     be_decl *node,
     TAO_OutStream *os,
     const char *skel_prefix)
+{
+  this->generate_skel_declaration (node, os, skel_prefix);
+  this->generate_method_head (node, os, "void", "");
+}
+
+void
+be_visitor_amh_operation_sh::generate_skel_declaration (
+    be_decl *node,
+    TAO_OutStream *os,
+    const char *skel_prefix)
 {
   *os << be_nl_2 << "// TAO_IDL - Generated from" << be_nl
       << "// " << __FILE__ << ":" << __LINE__ << be_nl_2;
@@ -134,7 +212,15 @@ be_visitor_amh_operation_sh::generate_shared_prologue (
       << "TAO::Portable_Server::Servant_Upcall *_tao_obj," << be_nl
       << "TAO_ServantBase *_tao_servant_upcall"
       << ");" << be_uidt_nl << be_uidt_nl;
+}
 
+void
+be_visitor_amh_operation_sh::generate_method_head (
+    be_decl *node,
+    TAO_OutStream *os,
+    const char *return_type,
+    const char *method_prefix)
+{
   // We need the interface node in which this operation was defined. However,
   // if this operation node was an attribute node in disguise, we get this
   // information from the context
@@ -157,11 +243,12 @@ be_visitor_amh_operation_sh::generate_shared_prologue (
       return;
     }
 
-  // Step 1 : Generate return type: always void
-  *os << "virtual void ";
+  // Step 1 : Generate return type: void, or the coroutine type of
+  //          the co_* operations
+  *os << "virtual " << return_type << " ";
 
   // Step 2: Generate the method name
-  *os << node->local_name() << " (" << be_idt << be_idt_nl;
+  *os << method_prefix << node->local_name() << " (" << be_idt << be_idt_nl;
 
   // STEP 3: Generate the argument list with the appropriate
   //         mapping. For these we grab a visitor that generates the
@@ -179,6 +179,11 @@ be_visitor_amh_operation_ss::visit_operation (be_operation *node)
       return -1;
     }
 
+  if (this->is_amh_coroutine (node))
+    {
+      return this->generate_coroutine_call (node, os);
+    }
+
   return 0;
 
 }
@@ -424,3 +429,110 @@ be_visitor_amh_operation_ss::generate_shared_epilogue (TAO_OutStream *os)
 
   return 0;
 }
+
+int
+be_visitor_amh_operation_ss::generate_coroutine_call (be_operation *node,
+                                                      TAO_OutStream *os)
+{
+  be_interface *intf =
+    be_interface::narrow_from_scope (node->defined_in ());
+
+  if (intf == 0)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "(%N:%l) generate_coroutine_call - "
+                         "bad interface scope\n"),
+                        -1);
+    }
+
+  char *buf;
+  intf->compute_full_name ("AMH_", "", buf);
+  ACE_CString amh_skel_name ("POA_");
+  amh_skel_name += buf;
+  ACE_OS::free (buf);
+  buf = 0;
+
+  intf->compute_full_name ("AMH_", "ResponseHandler_ptr", buf);
+  ACE_CString rh_name (buf);
+  ACE_OS::free (buf);
+  buf = 0;
+
+  *os << be_nl_2 << "// TAO_IDL - Generated from" << be_nl
+      << "// " << __FILE__ << ":" << __LINE__;
+
+  // The AMH operation starts the co_* coroutine of the servant, with
+  // arguments it owns.
+  *os << "\n\n#if (TAO_HAS_AMH_COROUTINES == 1)" << be_nl
+      << "void" << be_nl
+      << amh_skel_name.c_str () << "::" << node->local_name ()
+      << " (" << be_idt << be_idt_nl
+      << rh_name.c_str () << " _tao_rh";
+
+  be_visitor_context ctx (*this->ctx_);
+  ctx.scope (node);
+  be_visitor_args_arglist arglist_visitor (&ctx);
+  arglist_visitor.set_fixed_direction (AST_Argument::dir_IN);
+
+  for (UTL_ScopeActiveIterator i (node, UTL_Scope::IK_decls);
+       !i.is_done ();
+       i.next ())
+    {
+      be_argument *argument =
+        be_argument::narrow_from_decl (i.item ());
+
+      if (argument == 0
+          || argument->direction () == AST_Argument::dir_OUT)
+        {
+          continue;
+        }
+
+      *os << "," << be_nl;
+
+      if (arglist_visitor.visit_argument (argument) == -1)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "(%N:%l) be_visitor_amh_operation_ss::"
+                             "generate_coroutine_call - "
+                             "codegen for arglist failed\n"),
+                            -1);
+        }
+    }
+
+  *os << ")" << be_uidt << be_uidt_nl
+      << "{" << be_idt_nl
+      << "this->co_" << node->local_name () << " (" << be_idt << be_idt_nl
+      << "_tao_rh";
+
+  be_visitor_args_amh_coroutine_ss upcall_visitor (&ctx, true);
+
+  for (UTL_ScopeActiveIterator i (node, UTL_Scope::IK_decls);
+       !i.is_done ();
+       i.next ())
+    {
+      be_argument *argument =
+        be_argument::narrow_from_decl (i.item ());
+
+      if (argument == 0
+          || argument->direction () == AST_Argument::dir_OUT)
+        {
+          continue;
+        }
+
+      *os << "," << be_nl;
+
+      if (upcall_visitor.visit_argument (argument) == -1)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "(%N:%l) be_visitor_amh_operation_ss::"
+                             "generate_coroutine_call - "
+                             "codegen for upcall args failed\n"),
+                            -1);
+        }
+    }
+
+  *os << ");" << be_uidt << be_uidt << be_uidt_nl
+      << "}"
+      << "\n#endif /* TAO_HAS_AMH_COROUTINES == 1 */";
+
+  return 0;
+}
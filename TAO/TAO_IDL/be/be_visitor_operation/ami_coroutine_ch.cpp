@@ -0,0 +1,90 @@
+
+//=============================================================================
+/**
+ *  @file    ami_coroutine_ch.cpp
+ *
+ *  Visitor generating the declaration of the co_* AMI stubs in the
+ *  client header.
+ */
+//=============================================================================
+
+#include "operation.h"
+
+be_visitor_operation_ami_coroutine_ch::be_visitor_operation_ami_coroutine_ch (
+    be_visitor_context *ctx)
+  : be_visitor_operation (ctx)
+{
+}
+
+be_visitor_operation_ami_coroutine_ch::~be_visitor_operation_ami_coroutine_ch (
+    void)
+{
+}
+
+int
+be_visitor_operation_ami_coroutine_ch::visit_operation (be_operation *node)
+{
+  be_operation *reply_op = this->ami_coroutine_reply_operation (node);
+
+  if (reply_op == 0)
+    {
+      return 0;
+    }
+
+  TAO_OutStream *os = this->ctx_->stream ();
+  this->ctx_->node (node);
+
+  ACE_CString base (node->local_name ()->get_string ());
+  ACE_CString lname_str (base.substr (ACE_OS::strlen ("sendc_")));
+  const char *lname = lname_str.c_str ();
+
+  *os << be_nl_2 << "// TAO_IDL - Generated from" << be_nl
+      << "// " << __FILE__ << ":" << __LINE__;
+
+  *os << "\n\n#if (TAO_HAS_AMI_COROUTINES == 1)" << be_nl;
+
+  // The reply handler operation has the return value and the out and
+  // inout arguments as in arguments, they are the members.
+  *os << "struct co_" << lname << "_reply" << be_nl
+      << "{" << be_idt;
+
+  be_visitor_context ctx (*this->ctx_);
+  ctx.state (TAO_CodeGen::TAO_OPERATION_ARG_DECL_SS);
+  be_visitor_operation_argument vd_visitor (&ctx);
+
+  if (reply_op->accept (&vd_visitor) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_operation_ami_coroutine_ch::")
+                         ACE_TEXT ("visit_operation - ")
+                         ACE_TEXT ("codegen for reply members failed\n")),
+                        -1);
+    }
+
+  if (reply_op->argument_count () > 0)
+    {
+      *os << "\n";
+    }
+
+  *os << be_nl
+      << "::CORBA::Boolean _tao_demarshal (TAO_InputCDR &_tao_in);"
+      << be_uidt_nl
+      << "};" << be_nl_2;
+
+  *os << "::TAO::AMI::Awaitable<co_" << lname << "_reply>"
+      << " co_" << lname;
+
+  if (this->gen_ami_coroutine_arglist (node) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_operation_ami_coroutine_ch::")
+                         ACE_TEXT ("visit_operation - ")
+                         ACE_TEXT ("codegen for argument list failed\n")),
+                        -1);
+    }
+
+  *os << ";"
+      << "\n#endif /* TAO_HAS_AMI_COROUTINES == 1 */";
+
+  return 0;
+}
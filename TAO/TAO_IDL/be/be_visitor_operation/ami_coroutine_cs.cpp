@@ -0,0 +1,216 @@
+
+//=============================================================================
+/**
+ *  @file    ami_coroutine_cs.cpp
+ *
+ *  Visitor generating the co_* AMI stubs in the client stubs.
+ */
+//=============================================================================
+
+#include "operation.h"
+
+be_visitor_operation_ami_coroutine_cs::be_visitor_operation_ami_coroutine_cs (
+    be_visitor_context *ctx)
+  : be_visitor_operation_ami_cs (ctx)
+{
+}
+
+be_visitor_operation_ami_coroutine_cs::~be_visitor_operation_ami_coroutine_cs (
+    void)
+{
+}
+
+int
+be_visitor_operation_ami_coroutine_cs::visit_operation (be_operation *node)
+{
+  be_operation *reply_op = this->ami_coroutine_reply_operation (node);
+
+  if (reply_op == 0)
+    {
+      return 0;
+    }
+
+  TAO_OutStream *os = this->ctx_->stream ();
+  this->ctx_->node (node);
+
+  be_decl *parent =
+    be_scope::narrow_from_scope (node->defined_in ())->decl ();
+
+  ACE_CString base (node->local_name ()->get_string ());
+  ACE_CString lname_str (base.substr (ACE_OS::strlen ("sendc_")));
+  const char *lname = lname_str.c_str ();
+
+  *os << be_nl_2 << "// TAO_IDL - Generated from" << be_nl
+      << "// " << __FILE__ << ":" << __LINE__;
+
+  *os << "\n\n#if (TAO_HAS_AMI_COROUTINES == 1)";
+
+  if (this->gen_reply_demarshal (node, reply_op, lname) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_operation_ami_coroutine_cs::")
+                         ACE_TEXT ("visit_operation - ")
+                         ACE_TEXT ("codegen for reply demarshaling ")
+                         ACE_TEXT ("failed\n")),
+                        -1);
+    }
+
+  *os << be_nl_2
+      << "::TAO::AMI::Awaitable<" << parent->full_name ()
+      << "::co_" << lname << "_reply>" << be_nl
+      << parent->full_name () << "::co_" << lname;
+
+  if (this->gen_ami_coroutine_arglist (node) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_operation_ami_coroutine_cs::")
+                         ACE_TEXT ("visit_operation - ")
+                         ACE_TEXT ("codegen for argument list failed\n")),
+                        -1);
+    }
+
+  *os << be_nl << "{" << be_idt_nl
+      << "if (!this->is_evaluated ())" << be_idt_nl
+      << "{" << be_idt_nl
+      << "::CORBA::Object::tao_object_initialize (this);"
+      << be_uidt_nl
+      << "}" << be_uidt;
+
+  int const excep_count = this->gen_exceptions_data (reply_op);
+
+  if (this->gen_invocation_adapter (node) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_operation_ami_coroutine_cs::")
+                         ACE_TEXT ("visit_operation - ")
+                         ACE_TEXT ("codegen for invocation adapter ")
+                         ACE_TEXT ("failed\n")),
+                        -1);
+    }
+
+  ACE_CString rd_type ("::TAO::AMI::Reply_Dispatcher_T<co_");
+  rd_type += lname_str;
+  rd_type += "_reply>";
+
+  // The reply is delivered to the awaitable, there is no reply
+  // handler to activate.
+  *os << be_nl_2
+      << rd_type.c_str () << " *_tao_rd = 0;" << be_nl
+      << "ACE_NEW_THROW_EX (" << be_idt << be_idt_nl
+      << "_tao_rd," << be_nl
+      << rd_type.c_str () << " (" << be_idt << be_idt_nl
+      << (excep_count > 0 ? "_tao_exceptions_data," : "0,") << be_nl
+      << excep_count << "," << be_nl
+      << "this->_stubobj ()->orb_core ())," << be_uidt << be_uidt_nl
+      << "::CORBA::NO_MEMORY ());" << be_uidt << be_uidt_nl << be_nl
+      << "::TAO::AMI::Awaitable<co_" << lname << "_reply> "
+      << "_tao_awaitable (_tao_rd);" << be_nl_2
+      << "_tao_call.invoke (_tao_rd);" << be_nl_2
+      << "return _tao_awaitable;" << be_uidt_nl
+      << "}";
+
+  *os << "\n\n#endif /* TAO_HAS_AMI_COROUTINES == 1 */";
+
+  return 0;
+}
+
+int
+be_visitor_operation_ami_coroutine_cs::gen_reply_demarshal (
+  be_operation *node,
+  be_operation *reply_op,
+  const char *lname)
+{
+  TAO_OutStream *os = this->ctx_->stream ();
+
+  be_decl *parent =
+    be_scope::narrow_from_scope (node->defined_in ())->decl ();
+
+  *os << be_nl_2
+      << "::CORBA::Boolean" << be_nl
+      << parent->full_name () << "::co_" << lname
+      << "_reply::_tao_demarshal (" << be_idt << be_idt_nl
+      << "TAO_InputCDR &_tao_in)" << be_uidt << be_uidt_nl
+      << "{" << be_idt_nl;
+
+  if (!this->has_param_type (reply_op, AST_Argument::dir_IN))
+    {
+      *os << "ACE_UNUSED_ARG (_tao_in);" << be_nl
+          << "return true;" << be_uidt_nl
+          << "}";
+
+      return 0;
+    }
+
+  *os << "return" << be_idt;
+
+  be_visitor_context ctx (*this->ctx_);
+  ctx.state (TAO_CodeGen::TAO_OPERATION_ARG_DEMARSHAL_SS);
+  ctx.sub_state (TAO_CodeGen::TAO_CDR_INPUT);
+  be_visitor_operation_argument_marshal visitor (&ctx);
+
+  if (reply_op->accept (&visitor) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("be_visitor_operation_ami_coroutine_cs::")
+                         ACE_TEXT ("gen_reply_demarshal - ")
+                         ACE_TEXT ("codegen for arguments failed\n")),
+                        -1);
+    }
+
+  *os << ";" << be_uidt << be_uidt_nl
+      << "}";
+
+  return 0;
+}
+
+int
+be_visitor_operation_ami_coroutine_cs::gen_exceptions_data (
+  be_operation *reply_op)
+{
+  if (reply_op->exceptions () == 0)
+    {
+      return 0;
+    }
+
+  TAO_OutStream *os = this->ctx_->stream ();
+  int excep_count = 0;
+
+  *os << be_nl_2
+      << "static TAO::Exception_Data _tao_exceptions_data [] =" << be_nl
+      << "{" << be_idt_nl;
+
+  for (UTL_ExceptlistActiveIterator ei (reply_op->exceptions ());
+       !ei.is_done ();)
+    {
+      be_exception *ex = be_exception::narrow_from_decl (ei.item ());
+
+      *os << "{" << be_idt_nl
+          << "\"" << ex->repoID () << "\"," << be_nl
+          << ex->name () << "::_alloc"
+          << "\n#if TAO_HAS_INTERCEPTORS == 1" << be_nl;
+
+      if (be_global->tc_support ())
+        {
+          *os << ", " << ex->tc_name ();
+        }
+      else
+        {
+          *os << ", 0";
+        }
+
+      *os << "\n#endif /* TAO_HAS_INTERCEPTORS */" << be_uidt_nl
+          << "}";
+
+      ++excep_count;
+      ei.next ();
+
+      if (!ei.is_done ())
+        {
+          *os << "," << be_nl;
+        }
+    }
+
+  *os << be_uidt_nl << "};";
+
+  return excep_count;
+}
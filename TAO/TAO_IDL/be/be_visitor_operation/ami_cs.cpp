@@ -127,8 +127,49 @@ be_visitor_operation_ami_cs::visit_operation (be_operation *node)
           << "}" << be_uidt_nl << be_nl;
     }
 
+  if (this->gen_invocation_adapter (node) == -1)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "(%N:%l) be_visitor_operation_ami_cs::"
+                         "visit_operation - "
+                         "codegen for invocation adapter failed\n"),
+                        -1);
+    }
+
+  ACE_CString base (node->local_name ()->get_string ());
+  ACE_CString lname_str (base.substr (ACE_OS::strlen ("sendc_")));
+  const char *lname = lname_str.c_str ();
+
+  *os << be_nl_2
+      << "_tao_call.invoke (" << be_idt << be_idt_nl
+      << "ami_handler," << be_nl
+      << "&";
+
+  if (parent->is_nested ())
+    {
+      be_decl *gparent =
+        be_scope::narrow_from_scope (parent->defined_in ())->decl ();
+
+      *os << gparent->name () << "::";
+    }
+
+  *os << "AMI_"  << parent->local_name () << "Handler::"
+      << lname << "_reply_stub" << be_uidt_nl
+      << ");" << be_uidt;
+
+  *os << be_uidt_nl
+      << "}";
+
+  return 0;
+}
+
+int
+be_visitor_operation_ami_cs::gen_invocation_adapter (be_operation *node)
+{
+  TAO_OutStream *os = this->ctx_->stream ();
+
   // Includes the reply handler, but we have to add 1 for the retval anyway.
-  int nargs = ami_op->argument_count ();
+  int nargs = node->argument_count ();
 
   if (nargs == 1)
     {
@@ -148,7 +189,7 @@ be_visitor_operation_ami_cs::visit_operation (be_operation *node)
           << "ret_val _tao_retval;";
 
       // Declare the argument helper classes.
-      this->gen_stub_body_arglist (ami_op, os, true);
+      this->gen_stub_body_arglist (node, os, true);
 
       // Assemble the arg helper class pointer array.
       *os << be_nl_2
@@ -157,7 +198,7 @@ be_visitor_operation_ami_cs::visit_operation (be_operation *node)
           << "&_tao_retval";
 
       AST_Argument *arg = 0;
-      UTL_ScopeActiveIterator arg_list_iter (ami_op,
+      UTL_ScopeActiveIterator arg_list_iter (node,
                                              UTL_Scope::IK_decls);
 
       // For a sendc_* operation, skip the reply handler (first argument).
@@ -179,11 +220,8 @@ be_visitor_operation_ami_cs::visit_operation (be_operation *node)
 
   /// The sendc_* operation makes the invocation with the
   /// original operation name.
-  ACE_CString lname_str (base.substr (ACE_OS::strlen ("sendc_")));
-  const char *lname = lname_str.c_str ();
-
   ACE_CString opname (node->is_attr_op () ? "_" : "");
-  opname += lname;
+  opname += base.substr (ACE_OS::strlen ("sendc_"));
 
   /// Some compilers can't resolve the stream operator overload.
   const char *op_name = opname.c_str ();
@@ -217,26 +255,6 @@ be_visitor_operation_ami_cs::visit_operation (be_operation *node)
   *os << be_uidt_nl
       << ");" << be_uidt;
 
-  *os << be_nl_2
-      << "_tao_call.invoke (" << be_idt << be_idt_nl
-      << "ami_handler," << be_nl
-      << "&";
-
-  if (parent->is_nested ())
-    {
-      be_decl *gparent =
-        be_scope::narrow_from_scope (parent->defined_in ())->decl ();
-
-      *os << gparent->name () << "::";
-    }
-
-  *os << "AMI_"  << parent->local_name () << "Handler::"
-      << lname << "_reply_stub" << be_uidt_nl
-      << ");" << be_uidt;
-
-  *os << be_uidt_nl
-      << "}";
-
   return 0;
 }
 
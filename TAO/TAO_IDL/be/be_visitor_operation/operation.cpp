@@ -579,3 +579,165 @@ be_visitor_operation::gen_arg_template_param_name (AST_Decl *scope,
       *os << "_tag";
     }
 }
+
+be_operation *
+be_visitor_operation::ami_coroutine_reply_operation (be_operation *node)
+{
+  if (!be_global->gen_ami_coroutines ()
+      || !node->is_sendc_ami ()
+      || node->has_native ())
+    {
+      return 0;
+    }
+
+  be_interface *intf =
+    be_interface::narrow_from_scope (node->defined_in ());
+
+  if (intf == 0 || intf->ami_handler () == 0)
+    {
+      return 0;
+    }
+
+  // The reply handler operation is named after the sendc_* one,
+  // without the prefix.
+  ACE_CString lname (node->local_name ()->get_string ());
+  Identifier id (lname.substr (ACE_OS::strlen ("sendc_")).c_str ());
+  AST_Decl *d =
+    intf->ami_handler ()->lookup_by_name_local (&id, false);
+  id.destroy ();
+
+  be_operation *reply_op = be_operation::narrow_from_decl (d);
+
+  if (reply_op == 0)
+    {
+      return 0;
+    }
+
+  // Arrays are demarshaled through _forany locals, which the reply
+  // structure of the co_* stub does not have.
+  for (UTL_ScopeActiveIterator si (reply_op, UTL_Scope::IK_decls);
+       !si.is_done ();
+       si.next ())
+    {
+      AST_Argument *arg = AST_Argument::narrow_from_decl (si.item ());
+
+      if (arg != 0
+          && arg->field_type ()->unaliased_type ()->node_type ()
+               == AST_Decl::NT_array)
+        {
+          return 0;
+        }
+    }
+
+  return reply_op;
+}
+
+int
+be_visitor_operation::gen_ami_coroutine_arglist (be_operation *node)
+{
+  TAO_OutStream *os = this->ctx_->stream ();
+
+  be_visitor_context ctx (*this->ctx_);
+  ctx.scope (be_interface::narrow_from_scope (node->defined_in ()));
+  be_visitor_args_arglist visitor (&ctx);
+
+  *os << " (" << be_idt_nl;
+
+  UTL_ScopeActiveIterator si (node, UTL_Scope::IK_decls);
+
+  // Skip the reply handler.
+  si.next ();
+
+  if (si.is_done ())
+    {
+      *os << "void";
+    }
+
+  while (!si.is_done ())
+    {
+      be_argument *arg = be_argument::narrow_from_decl (si.item ());
+
+      if (visitor.visit_argument (arg) == -1)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             ACE_TEXT ("be_visitor_operation::")
+                             ACE_TEXT ("gen_ami_coroutine_arglist - ")
+                             ACE_TEXT ("codegen for argument failed\n")),
+                            -1);
+        }
+
+      si.next ();
+
+      if (!si.is_done ())
+        {
+          *os << "," << be_nl;
+        }
+    }
+
+  *os << ")" << be_uidt;
+
+  return 0;
+}
+
+bool
+be_visitor_operation::is_amh_coroutine (be_operation *node)
+{
+  if (!be_global->gen_amh_coroutines ()
+      || node->has_native ()
+      || node->is_sendc_ami ())
+    {
+      return false;
+    }
+
+  for (UTL_ScopeActiveIterator si (node, UTL_Scope::IK_decls);
+       !si.is_done ();
+       si.next ())
+    {
+      AST_Argument *arg = AST_Argument::narrow_from_decl (si.item ());
+
+      if (arg == 0 || arg->direction () == AST_Argument::dir_OUT)
+        {
+          continue;
+        }
+
+      AST_Type *t = arg->field_type ()->unaliased_type ();
+
+      switch (t->node_type ())
+        {
+        case AST_Decl::NT_enum:
+        case AST_Decl::NT_sequence:
+        case AST_Decl::NT_string:
+        case AST_Decl::NT_wstring:
+        case AST_Decl::NT_struct:
+        case AST_Decl::NT_union:
+        case AST_Decl::NT_component:
+        case AST_Decl::NT_component_fwd:
+          break;
+        case AST_Decl::NT_interface:
+        case AST_Decl::NT_interface_fwd:
+          if (t->is_abstract ())
+            {
+              return false;
+            }
+
+          break;
+        case AST_Decl::NT_pre_defined:
+          {
+            AST_PredefinedType *pdt =
+              AST_PredefinedType::narrow_from_decl (t);
+
+            if (pdt->pt () == AST_PredefinedType::PT_value
+                || pdt->pt () == AST_PredefinedType::PT_abstract)
+              {
+                return false;
+              }
+          }
+
+          break;
+        default:
+          return false;
+        }
+    }
+
+  return true;
+}
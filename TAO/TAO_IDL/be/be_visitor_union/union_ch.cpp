@@ -60,6 +60,14 @@ int be_visitor_union_ch::visit_union (be_union *node)
       << node->local_name () << " &operator= (const "
       << node->local_name () << " &);";
 
+  // Generate move constructor and move assignment operator.
+  *os << "\n#if defined (ACE_HAS_CPP11)" << be_nl
+      << node->local_name () << " (" << node->local_name ()
+      << " &&);" << be_nl
+      << node->local_name () << " &operator= (" << node->local_name ()
+      << " &&);"
+      << "\n#endif /* ACE_HAS_CPP11 */";
+
   // Retrieve the disriminant type.
   be_type *bt = be_type::narrow_from_decl (node->disc_type ());
 
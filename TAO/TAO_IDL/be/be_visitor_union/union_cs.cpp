@@ -263,6 +263,35 @@ int be_visitor_union_cs::visit_union (be_union *node)
   *os << be_nl << "return *this;" << be_uidt_nl;
   *os << "}" << be_nl_2;
 
+  // The move constructor and move assignment operator. Every branch
+  // is held in u_ either by value, for the fixed size types, or by
+  // pointer, so moving takes over u_ as is and leaves the source with
+  // null pointers, which _reset () and the destructor accept.
+  *os << "#if defined (ACE_HAS_CPP11)" << be_nl;
+  *os << node->name () << "::" << node->local_name ()
+      << " (::" << node->name () << " &&u)" << be_nl;
+  *os << "{" << be_idt_nl;
+  *os << "this->disc_ = u.disc_;" << be_nl;
+  *os << "ACE_OS::memcpy (&this->u_, &u.u_, sizeof (this->u_));" << be_nl;
+  *os << "ACE_OS::memset (&u.u_, 0, sizeof (u.u_));" << be_uidt_nl;
+  *os << "}" << be_nl_2;
+
+  *os << node->name () << " &" << be_nl;
+  *os << node->name () << "::operator= (::"
+      << node->name () << " &&u)" << be_nl;
+  *os << "{" << be_idt_nl;
+  *os << "if (&u == this)" << be_idt_nl
+      << "{" << be_idt_nl
+      << "return *this;" << be_uidt_nl
+      << "}" << be_uidt_nl << be_nl;
+  *os << "this->_reset ();" << be_nl;
+  *os << "this->disc_ = u.disc_;" << be_nl;
+  *os << "ACE_OS::memcpy (&this->u_, &u.u_, sizeof (this->u_));" << be_nl;
+  *os << "ACE_OS::memset (&u.u_, 0, sizeof (u.u_));" << be_nl;
+  *os << "return *this;" << be_uidt_nl;
+  *os << "}"
+      << "\n#endif /* ACE_HAS_CPP11 */" << be_nl_2;
+
   // The reset method.
   this->ctx_->state (TAO_CodeGen::TAO_UNION_PUBLIC_RESET_CS);
 
@@ -41,7 +41,8 @@ public:
     TAO_LINEAR_SEARCH,
     TAO_DYNAMIC_HASH,
     TAO_PERFECT_HASH,
-    TAO_BINARY_SEARCH
+    TAO_BINARY_SEARCH,
+    TAO_SWITCH_DISPATCH
   };
 
   /// To help with DDD portability in DDS4CCM
@@ -748,12 +749,26 @@ public:
   /// Return the flag.
   bool ami_call_back (void) const;
 
+  /// To enable or disable the generation of the awaitable co_*
+  /// stubs of the AMI operations, for C++20 coroutines.
+  void gen_ami_coroutines (bool value);
+
+  /// Return the flag.
+  bool gen_ami_coroutines (void) const;
+
   /// To enable or disable AMH in the generated code.
   void gen_amh_classes (bool value);
 
   /// Return the flag.
   bool gen_amh_classes (void) const;
 
+  /// To enable or disable the generation of the co_* AMH operations,
+  /// for servants written as C++20 coroutines.
+  void gen_amh_coroutines (bool value);
+
+  /// Return the flag.
+  bool gen_amh_coroutines (void) const;
+
   /// Set the generation of tie classes and files.
   void gen_tie_classes (bool value);
 
@@ -910,6 +925,11 @@ public:
   bool alt_mapping (void) const;
   void alt_mapping (bool val);
 
+  /// Map the string members of structs and exceptions to
+  /// TAO::SSO_String_Manager.
+  bool gen_sso_strings (void) const;
+  void gen_sso_strings (bool val);
+
   bool in_facet_servant (void) const;
   void in_facet_servant (bool val);
 
@@ -1166,9 +1186,15 @@ private:
    */
   bool ami_call_back_;
 
+  /// Flag for generating the awaitable co_* AMI stubs.
+  bool gen_ami_coroutines_;
+
   /// Flag for generating AMH classes.
   bool gen_amh_classes_;
 
+  /// Flag for generating the co_* AMH operations.
+  bool gen_amh_coroutines_;
+
   /// Flag to indicate whether we generate the tie classes and
   /// files or not.
   bool gen_tie_classes_;
@@ -1310,6 +1336,9 @@ private:
   /// Are we generating STL types?
   bool alt_mapping_;
 
+  /// Are we generating SSO string members?
+  bool gen_sso_strings_;
+
   /// Are we in the act of generating a facet servant?
   bool in_facet_servant_;
 
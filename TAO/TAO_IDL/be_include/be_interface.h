@@ -21,6 +21,9 @@
 #include "be_codegen.h"
 #include "ast_interface.h"
 
+#include "ace/Vector_T.h"
+#include "ace/SString.h"
+
 class TAO_OutStream;
 class TAO_IDL_Inheritance_Hierarchy_Worker;
 class be_visitor;
@@ -352,6 +355,18 @@ private:
   /// Create an instance of the linear search optable.
   void gen_linear_search_instance (const char *flat_name);
 
+  /// Outputs the lookup function of the switch strategy, nested
+  /// switch statements on the length and the characters of the
+  /// operation names, and an instance of TAO_Switch_OpTable using it.
+  void gen_switch_lookup (const char *flat_name);
+
+  /// Outputs the switch statements that tell apart the operations
+  /// @a entries, which all have @a length characters.
+  void gen_switch_cases (TAO_OutStream *os,
+                         const char *flat_name,
+                         const ACE_Vector<size_t> &entries,
+                         size_t length);
+
   /**
    * Called from traverse_inheritance_graph(), since base
    * components and base homes are inserted before the actual
@@ -370,6 +385,9 @@ protected:
   /// Number of static skeletons in the operation table.
   int skel_count_;
 
+  /// Names of the entries of the operation table, in table order.
+  ACE_Vector<ACE_CString> optable_names_;
+
   /// Am I directly or indirectly involved in a multiple inheritance. If the
   /// value is -1 => not computed yet.
   int in_mult_inheritance_;
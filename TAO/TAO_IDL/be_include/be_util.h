@@ -69,6 +69,12 @@ public:
   static bool
   overwrite_ciao_exec_files (void);
 
+  /// True when -Gsso maps the string member @a field to
+  /// TAO::SSO_String_Manager, which it does for the members of structs
+  /// and exceptions, not for those of valuetypes.
+  static bool
+  sso_string_member (AST_Decl *field);
+
   // Called by each node upon construction.
   static void set_arg_seen_bit (be_type *);
 };
@@ -23,5 +23,6 @@
 #include "be_visitor_argument/upcall_ss.h"
 #include "be_visitor_argument/marshal_ss.h"
 #include "be_visitor_argument/invoke_cs.h"
+#include "be_visitor_argument/amh_coroutine_ss.h"
 
 #endif /* _BE_VISITOR_ARGUMENT_H */
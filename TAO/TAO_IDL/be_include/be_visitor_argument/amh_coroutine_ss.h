@@ -0,0 +1,91 @@
+
+//=============================================================================
+/**
+ *  @file    amh_coroutine_ss.h
+ *
+ *  Visitors for generation of code for Arguments. This generates the
+ *  arguments of the co_* operations of the AMH skeletons, which own
+ *  their values, and the forwarding of the AMH arguments to them.
+ */
+//=============================================================================
+
+
+#ifndef _BE_VISITOR_ARGUMENT_AMH_COROUTINE_SS_H_
+#define _BE_VISITOR_ARGUMENT_AMH_COROUTINE_SS_H_
+
+// ************************************************************
+// class be_visitor_args_amh_coroutine_ss
+// ************************************************************
+
+/**
+ * @class be_visitor_args_amh_coroutine_ss
+ *
+ * @brief be_visitor_args_amh_coroutine_ss
+ *
+ * Visitor for the in and inout arguments of the co_* AMH operations.
+ * A coroutine may outlive the request buffer, so its arguments are
+ * taken by value with the owning type of the skeleton variables:
+ * _var for object references, String_var for strings and the type
+ * itself for the rest.  In upcall mode the visitor generates the
+ * expression that converts the AMH argument to it instead.
+ */
+class be_visitor_args_amh_coroutine_ss : public be_visitor_args
+{
+public:
+  /// constructor
+  be_visitor_args_amh_coroutine_ss (be_visitor_context *ctx,
+                                    bool upcall = false);
+
+  /// destructor
+  virtual ~be_visitor_args_amh_coroutine_ss (void);
+
+  /// visit the argument node
+  virtual int visit_argument (be_argument *node);
+
+  // =visit all the nodes that can be the types for the argument
+
+  /// visit the enum node
+  virtual int visit_enum (be_enum *node);
+
+  /// visit interface
+  virtual int visit_interface (be_interface *node);
+
+  /// visit interface forward
+  virtual int visit_interface_fwd (be_interface_fwd *node);
+
+  /// visit predefined type
+  virtual int visit_predefined_type (be_predefined_type *node);
+
+  /// visit sequence type
+  virtual int visit_sequence (be_sequence *node);
+
+  /// visit string type
+  virtual int visit_string (be_string *node);
+
+  /// visit structure type
+  virtual int visit_structure (be_structure *node);
+
+  /// visit union type
+  virtual int visit_union (be_union *node);
+
+  /// visit the typedef type
+  virtual int visit_typedef (be_typedef *node);
+
+  /// visit a component node
+  virtual int visit_component (be_component *node);
+
+  /// visit a forward declared component node
+  virtual int visit_component_fwd (be_component_fwd *node);
+
+ private:
+  /// Arguments held in a _var, @a node is the type to duplicate.
+  int emit_var (be_type *node);
+
+  /// Arguments held by value.
+  int emit_value (be_type *node);
+
+  /// Generate the upcall expression instead of the parameter.
+  bool upcall_;
+};
+
+#endif /* _BE_VISITOR_ARGUMENT_AMH_COROUTINE_SS_H_ */
@@ -30,6 +30,23 @@ private:
   void generate_shared_prologue (be_decl *node,
                                  TAO_OutStream *os,
                                  const char *skel_prefix);
+
+  /// Declaration of the static skeleton of @a node.
+  void generate_skel_declaration (be_decl *node,
+                                  TAO_OutStream *os,
+                                  const char *skel_prefix);
+
+  /// Return type, name and ResponseHandler argument of a method.
+  void generate_method_head (be_decl *node,
+                             TAO_OutStream *os,
+                             const char *return_type,
+                             const char *method_prefix);
+
+  /// Declaration of the AMH operation @a node, or of its co_*
+  /// operation if @a coroutine, without the final ';'.
+  int generate_method (be_operation *node,
+                       TAO_OutStream *os,
+                       bool coroutine);
 };
 
 #endif /* AMH_OPERATION_SS_H */
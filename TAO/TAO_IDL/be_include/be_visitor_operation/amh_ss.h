@@ -34,6 +34,11 @@ protected:
   int generate_shared_section (be_decl *node,
                                TAO_OutStream *os);
   int generate_shared_epilogue (TAO_OutStream *os);
+
+  /// Definition of the AMH operation @a node, which calls its co_*
+  /// operation.
+  int generate_coroutine_call (be_operation *node,
+                               TAO_OutStream *os);
 };
 
 #endif /* AMH_OPERATION_SS_H */
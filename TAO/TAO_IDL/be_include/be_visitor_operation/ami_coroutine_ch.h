@@ -0,0 +1,40 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    ami_coroutine_ch.h
+ *
+ *  Visitor generating the declaration of the co_* AMI stubs in the
+ *  client header.
+ */
+//=============================================================================
+
+#ifndef _BE_VISITOR_OPERATION_AMI_COROUTINE_CH_H_
+#define _BE_VISITOR_OPERATION_AMI_COROUTINE_CH_H_
+
+// ************************************************************
+// Operation visitor for the co_* AMI stubs in client header
+// ************************************************************
+
+/**
+ * @class be_visitor_operation_ami_coroutine_ch
+ *
+ * @brief be_visitor_operation_ami_coroutine_ch
+ *
+ * Generates, for a sendc_* operation, the structure that holds its
+ * reply and the declaration of the awaitable co_* stub.
+ */
+class be_visitor_operation_ami_coroutine_ch : public be_visitor_operation
+{
+public:
+  /// constructor
+  be_visitor_operation_ami_coroutine_ch (be_visitor_context *ctx);
+
+  /// destructor
+  ~be_visitor_operation_ami_coroutine_ch (void);
+
+  /// visit operation.
+  virtual int visit_operation (be_operation *node);
+};
+
+#endif /* _BE_VISITOR_OPERATION_AMI_COROUTINE_CH_H_ */
@@ -0,0 +1,52 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    ami_coroutine_cs.h
+ *
+ *  Visitor generating the co_* AMI stubs in the client stubs.
+ */
+//=============================================================================
+
+#ifndef _BE_VISITOR_OPERATION_AMI_COROUTINE_CS_H_
+#define _BE_VISITOR_OPERATION_AMI_COROUTINE_CS_H_
+
+// ************************************************************
+// Operation visitor for the co_* AMI stubs in client stubs
+// ************************************************************
+
+/**
+ * @class be_visitor_operation_ami_coroutine_cs
+ *
+ * @brief be_visitor_operation_ami_coroutine_cs
+ *
+ * Generates, for a sendc_* operation, the demarshaling of its reply
+ * structure and the co_* stub.  The co_* stub makes the same request
+ * as the sendc_* one, with a reply dispatcher that resumes the
+ * awaiting coroutine instead of a reply handler.
+ */
+class be_visitor_operation_ami_coroutine_cs
+  : public be_visitor_operation_ami_cs
+{
+public:
+  /// constructor
+  be_visitor_operation_ami_coroutine_cs (be_visitor_context *ctx);
+
+  /// destructor
+  ~be_visitor_operation_ami_coroutine_cs (void);
+
+  /// visit operation.
+  virtual int visit_operation (be_operation *node);
+
+private:
+  /// generate the demarshaling of the reply structure
+  int gen_reply_demarshal (be_operation *node,
+                           be_operation *reply_op,
+                           const char *lname);
+
+  /// generate the table of the user exceptions of @a reply_op
+  /// @return the number of user exceptions
+  int gen_exceptions_data (be_operation *reply_op);
+};
+
+#endif /* _BE_VISITOR_OPERATION_AMI_COROUTINE_CS_H_ */
@@ -44,6 +44,10 @@ public:
   int gen_pre_stub_info (be_operation *node,
                          be_type *bt);
 
+  /// generate the argument helpers and the invocation adapter of the
+  /// sendc_* operation
+  int gen_invocation_adapter (be_operation *node);
+
   // =helper
   /// stuff to output after every member of the scope is handled
   virtual int post_process (be_decl *);
@@ -82,6 +82,20 @@ public:
   void gen_arg_template_param_name (AST_Decl *scope,
                                     AST_Type *bt,
                                     TAO_OutStream *os);
+
+  /// The operation of the AMI reply handler that receives the reply
+  /// of the sendc_* operation @a node, if a co_* stub is generated
+  /// for it, otherwise 0.
+  be_operation *ami_coroutine_reply_operation (be_operation *node);
+
+  /// Generate the argument list of the co_* stub of the sendc_*
+  /// operation @a node, its arguments without the reply handler.
+  int gen_ami_coroutine_arglist (be_operation *node);
+
+  /// Is a co_* operation generated in the AMH skeleton of @a node?
+  /// Not for operations with array or valuetype arguments, which
+  /// have no owning type to keep them while the coroutine runs.
+  bool is_amh_coroutine (be_operation *node);
 };
 
 #endif /* _BE_VISITOR_OPERATION_OPERATION_H_ */
@@ -14,6 +14,7 @@
 
 #include "orbsvcs/ESF/ESF_Immediate_Changes.h"
 #include "orbsvcs/ESF/ESF_Delayed_Changes.h"
+#include "orbsvcs/ESF/ESF_Epoch_Hash.h"
 #include "orbsvcs/ESF/ESF_Copy_On_Write.h"
 #include "orbsvcs/ESF/ESF_Copy_On_Read.h"
 #include "orbsvcs/ESF/ESF_Proxy_List.h"
@@ -85,6 +86,8 @@ TAO_CEC_Default_Factory::parse_collection_arg (ACE_TCHAR* opt)
         iteration_type = 2;
       else if (ACE_OS::strcasecmp (arg, ACE_TEXT("delayed")) == 0)
         iteration_type = 3;
+      else if (ACE_OS::strcasecmp (arg, ACE_TEXT("epoch")) == 0)
+        iteration_type = 4;
       else
         ORBSVCS_ERROR ((LM_ERROR,
                     "CEC_Default_Factory - "
@@ -677,7 +680,15 @@ typedef
 TAO_CEC_ProxyPushConsumer_Collection*
 TAO_CEC_Default_Factory::create_proxy_push_consumer_collection (TAO_CEC_EventChannel *)
 {
-  if (this->consumer_collection_ == 0x000)
+  if ((this->consumer_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->consumer_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPushConsumer,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPushConsumer,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->consumer_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_CEC_ProxyPushConsumer,
       TAO_ESF_Proxy_List<TAO_CEC_ProxyPushConsumer>,
       TAO_CEC_PushConsumer_List_Iterator,
@@ -765,7 +776,15 @@ TAO_CEC_Default_Factory::create_proxy_push_consumer_collection (TAO_CEC_EventCha
 TAO_CEC_TypedProxyPushConsumer_Collection*
 TAO_CEC_Default_Factory::create_proxy_push_consumer_collection (TAO_CEC_TypedEventChannel *)
 {
-  if (this->consumer_collection_ == 0x000)
+  if ((this->consumer_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->consumer_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_CEC_TypedProxyPushConsumer,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_CEC_TypedProxyPushConsumer,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->consumer_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_CEC_TypedProxyPushConsumer,
       TAO_ESF_Proxy_List<TAO_CEC_TypedProxyPushConsumer>,
       TAO_CEC_TypedPushConsumer_List_Iterator,
@@ -867,7 +886,15 @@ TAO_CEC_Default_Factory::destroy_proxy_push_consumer_collection (TAO_CEC_TypedPr
 TAO_CEC_ProxyPullConsumer_Collection*
 TAO_CEC_Default_Factory::create_proxy_pull_consumer_collection (TAO_CEC_EventChannel *)
 {
-  if (this->consumer_collection_ == 0x000)
+  if ((this->consumer_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->consumer_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPullConsumer,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPullConsumer,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->consumer_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_CEC_ProxyPullConsumer,
       TAO_ESF_Proxy_List<TAO_CEC_ProxyPullConsumer>,
       TAO_CEC_PullConsumer_List_Iterator,
@@ -960,7 +987,15 @@ TAO_CEC_Default_Factory::destroy_proxy_pull_consumer_collection (TAO_CEC_ProxyPu
 TAO_CEC_ProxyPushSupplier_Collection*
 TAO_CEC_Default_Factory::create_proxy_push_supplier_collection (TAO_CEC_EventChannel *)
 {
-  if (this->supplier_collection_ == 0x000)
+  if ((this->supplier_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->supplier_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPushSupplier,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPushSupplier,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->supplier_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_CEC_ProxyPushSupplier,
       TAO_ESF_Proxy_List<TAO_CEC_ProxyPushSupplier>,
       TAO_CEC_PushSupplier_List_Iterator,
@@ -1048,7 +1083,15 @@ TAO_CEC_Default_Factory::create_proxy_push_supplier_collection (TAO_CEC_EventCha
 TAO_CEC_ProxyPushSupplier_Collection*
 TAO_CEC_Default_Factory::create_proxy_push_supplier_collection (TAO_CEC_TypedEventChannel *)
 {
-  if (this->supplier_collection_ == 0x000)
+  if ((this->supplier_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->supplier_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPushSupplier,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPushSupplier,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->supplier_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_CEC_ProxyPushSupplier,
       TAO_ESF_Proxy_List<TAO_CEC_ProxyPushSupplier>,
       TAO_CEC_PushSupplier_List_Iterator,
@@ -1142,7 +1185,15 @@ TAO_CEC_Default_Factory::destroy_proxy_push_supplier_collection (TAO_CEC_ProxyPu
 TAO_CEC_ProxyPullSupplier_Collection*
 TAO_CEC_Default_Factory::create_proxy_pull_supplier_collection (TAO_CEC_EventChannel *)
 {
-  if (this->supplier_collection_ == 0x000)
+  if ((this->supplier_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->supplier_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPullSupplier,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_CEC_ProxyPullSupplier,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->supplier_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_CEC_ProxyPullSupplier,
       TAO_ESF_Proxy_List<TAO_CEC_ProxyPullSupplier>,
       TAO_CEC_PullSupplier_List_Iterator,
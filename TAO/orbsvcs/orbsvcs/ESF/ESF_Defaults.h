@@ -27,6 +27,12 @@
 # define TAO_ESF_DEFAULT_MAX_WRITE_DELAY 2048
 #endif /* TAO_ESF_DEFAULT_MAX_WRITE_DELAY */
 
+// The number of buckets in TAO_ESF_Epoch_Hash, a prime number
+// spreads the proxy addresses better.
+#ifndef TAO_ESF_DEFAULT_EPOCH_HASH_SIZE
+# define TAO_ESF_DEFAULT_EPOCH_HASH_SIZE 1021
+#endif /* TAO_ESF_DEFAULT_EPOCH_HASH_SIZE */
+
 #ifndef TAO_ESF_DEFAULT_ORB_ID
 # define TAO_ESF_DEFAULT_ORB_ID "" /* */
 #endif /* TAO_ESF_DEFAULT_ORB_ID */
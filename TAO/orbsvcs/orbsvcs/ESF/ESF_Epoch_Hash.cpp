@@ -0,0 +1,259 @@
+#ifndef TAO_ESF_EPOCH_HASH_CPP
+#define TAO_ESF_EPOCH_HASH_CPP
+
+#include "orbsvcs/ESF/ESF_Epoch_Hash.h"
+
+#if ! defined (__ACE_INLINE__)
+#include "orbsvcs/ESF/ESF_Epoch_Hash.inl"
+#endif /* __ACE_INLINE__ */
+
+#include "orbsvcs/ESF/ESF_Worker.h"
+#include "ace/Guard_T.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+template<class PROXY, class ACE_LOCK>
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::TAO_ESF_Epoch_Hash (size_t buckets)
+  :  buckets_ (0),
+     size_ (buckets == 0 ? 1 : buckets),
+     count_ (0),
+     epoch_ (0),
+     pending_ (0)
+{
+  this->readers_[0] = 0;
+  this->readers_[1] = 0;
+  this->retired_[0] = 0;
+  this->retired_[1] = 0;
+
+  ACE_NEW (this->buckets_, Bucket[this->size_]);
+  for (size_t i = 0; i != this->size_; ++i)
+    this->buckets_[i] = 0;
+}
+
+template<class PROXY, class ACE_LOCK>
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::~TAO_ESF_Epoch_Hash (void)
+{
+  // No iterations can be active at this point.
+  Node *list = 0;
+  for (int i = 0; i != 2; ++i)
+    {
+      while (this->retired_[i] != 0)
+        {
+          Node *node = this->retired_[i];
+          this->retired_[i] = node->retired;
+          node->retired = list;
+          list = node;
+        }
+    }
+  for (size_t i = 0; i != this->size_; ++i)
+    {
+      for (Node *node = this->buckets_[i]; node != 0; node = node->next)
+        {
+          node->retired = list;
+          list = node;
+        }
+    }
+  delete [] this->buckets_;
+
+  TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::release (list);
+}
+
+template<class PROXY, class ACE_LOCK> void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::for_each (TAO_ESF_Worker<PROXY> *worker)
+{
+  TAO_ESF_Epoch_Hash_Read_Guard<PROXY,ACE_LOCK> ace_mon (*this);
+
+  worker->set_size (static_cast<size_t> (this->count_.value ()));
+  for (size_t i = 0; i != this->size_; ++i)
+    {
+      for (Node *node = this->buckets_[i]; node != 0; node = node->next)
+        {
+          worker->work (node->proxy);
+        }
+    }
+}
+
+template<class PROXY, class ACE_LOCK> void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::disconnected (PROXY *proxy)
+{
+  Node *reclaimed = 0;
+  {
+    ACE_GUARD (ACE_LOCK, ace_mon, this->lock_);
+
+    Bucket *link = this->find_i (proxy);
+    if (link == 0)
+      return;
+
+    // Concurrent iterations positioned on the node still see its next
+    // field, only new iterations skip it.
+    Node *node = *link;
+    *link = node->next;
+    --this->count_;
+
+    this->retire_i (node);
+    reclaimed = this->reclaim_i ();
+  }
+  TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::release (reclaimed);
+}
+
+template<class PROXY, class ACE_LOCK> void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::shutdown (void)
+{
+  Node *reclaimed = 0;
+  {
+    ACE_GUARD (ACE_LOCK, ace_mon, this->lock_);
+
+    for (size_t i = 0; i != this->size_; ++i)
+      {
+        Node *node = this->buckets_[i];
+        this->buckets_[i] = 0;
+        while (node != 0)
+          {
+            Node *next = node->next;
+            this->retire_i (node);
+            node = next;
+          }
+      }
+    this->count_ = 0;
+
+    reclaimed = this->reclaim_i ();
+  }
+  TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::release (reclaimed);
+}
+
+template<class PROXY, class ACE_LOCK> long
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::enter (void)
+{
+  for (;;)
+    {
+      long const epoch = this->epoch_.value ();
+      ++this->readers_[epoch & 1];
+
+      // If the epoch did not change the writers will see our counter
+      // before they reclaim anything we can reach.
+      if (this->epoch_.value () == epoch)
+        return epoch;
+
+      --this->readers_[epoch & 1];
+    }
+}
+
+template<class PROXY, class ACE_LOCK> void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::leave (long epoch)
+{
+  if (--this->readers_[epoch & 1] != 0 || this->pending_.value () == 0)
+    return;
+
+  // Never block iterating threads, if a change is in progress it will
+  // reclaim the nodes.
+  Node *reclaimed = 0;
+  {
+    ACE_Guard<ACE_LOCK> ace_mon (this->lock_, 0);
+    if (ace_mon.locked () == 0)
+      return;
+
+    reclaimed = this->reclaim_i ();
+  }
+  TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::release (reclaimed);
+}
+
+template<class PROXY, class ACE_LOCK> void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::insert (PROXY *proxy)
+{
+  {
+    ACE_GUARD (ACE_LOCK, ace_mon, this->lock_);
+
+    if (this->find_i (proxy) == 0)
+      {
+        Bucket &head = this->buckets_[this->bucket (proxy)];
+
+        Node *node = 0;
+        ACE_NEW (node, Node (proxy, head));
+
+        // The atomic increment also makes the node contents visible
+        // before the node is published.
+        ++this->count_;
+        head = node;
+        return;
+      }
+  }
+
+  // Already there, the collection keeps a single reference.
+  proxy->_decr_refcnt ();
+}
+
+template<class PROXY, class ACE_LOCK>
+typename TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::Bucket *
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::find_i (PROXY *proxy)
+{
+  Bucket *link = &this->buckets_[this->bucket (proxy)];
+  while (*link != 0)
+    {
+      if ((*link)->proxy == proxy)
+        return link;
+      link = &(*link)->next;
+    }
+  return 0;
+}
+
+template<class PROXY, class ACE_LOCK> void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::retire_i (Node *node)
+{
+  long const slot = this->epoch_.value () & 1;
+  node->retired = this->retired_[slot];
+  this->retired_[slot] = node;
+  ++this->pending_;
+}
+
+template<class PROXY, class ACE_LOCK>
+typename TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::Node *
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::reclaim_i (void)
+{
+  Node *reclaimed = 0;
+
+  // A node retired in epoch N can be reached by iterations that
+  // started in epoch N or earlier.  The epoch only advances from N to
+  // N+1 when no iteration from N-1 is active, so only epochs N and
+  // N-1 can have active iterations, and the nodes retired in N-1 are
+  // unreachable once its counter drops to zero.
+  // Two steps are enough to reclaim everything if there are no
+  // iterations.
+  for (int step = 0; step != 2 && this->pending_.value () != 0; ++step)
+    {
+      long const epoch = this->epoch_.value ();
+      long const previous = (epoch + 1) & 1;
+
+      if (this->readers_[previous].value () != 0)
+        break;
+
+      while (this->retired_[previous] != 0)
+        {
+          Node *node = this->retired_[previous];
+          this->retired_[previous] = node->retired;
+          node->retired = reclaimed;
+          reclaimed = node;
+          --this->pending_;
+        }
+
+      ++this->epoch_;
+    }
+
+  return reclaimed;
+}
+
+template<class PROXY, class ACE_LOCK> void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::release (Node *list)
+{
+  while (list != 0)
+    {
+      Node *node = list;
+      list = node->retired;
+
+      node->proxy->_decr_refcnt ();
+      delete node;
+    }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_ESF_EPOCH_HASH_CPP */
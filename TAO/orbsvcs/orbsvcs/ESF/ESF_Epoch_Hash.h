@@ -0,0 +1,195 @@
+// -*- C++ -*-
+
+/**
+ *  @file   ESF_Epoch_Hash.h
+ *
+ *  A proxy collection that can be iterated without locks while it is
+ *  modified.
+ */
+
+#ifndef TAO_ESF_EPOCH_HASH_H
+#define TAO_ESF_EPOCH_HASH_H
+
+#include "orbsvcs/ESF/ESF_Proxy_Collection.h"
+#include "orbsvcs/ESF/ESF_Defaults.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Atomic_Op.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_ESF_Epoch_Hash_Node
+ *
+ * @brief A node in a TAO_ESF_Epoch_Hash bucket.
+ */
+template<class PROXY>
+class TAO_ESF_Epoch_Hash_Node
+{
+public:
+  /// Constructor
+  TAO_ESF_Epoch_Hash_Node (PROXY *proxy,
+                           TAO_ESF_Epoch_Hash_Node<PROXY> *next);
+
+  /// The proxy, the collection owns a reference to it.
+  PROXY *proxy;
+
+  /// The next node in the bucket, followed by the readers without
+  /// any locks.  It is not changed when the node is removed, so
+  /// readers positioned on a removed node can continue.
+  TAO_ESF_Epoch_Hash_Node<PROXY> * volatile next;
+
+  /// The next node in the list of nodes waiting to be reclaimed.
+  TAO_ESF_Epoch_Hash_Node<PROXY> *retired;
+};
+
+// ****************************************************************
+
+/**
+ * @class TAO_ESF_Epoch_Hash
+ *
+ * @brief A hash set of proxies with lock-free iteration.
+ *
+ * The Copy_On_Write and Delayed_Changes protocols either copy the
+ * complete collection for each change or delay the changes while the
+ * collection is being iterated.  Neither works well with tens of
+ * thousands of proxies that connect and disconnect frequently.
+ *
+ * This collection is a fixed size array of singly linked buckets.
+ * Threads iterating over the collection do not acquire any lock,
+ * they only increment a counter for the current epoch.  Threads
+ * changing the collection are serialized by a lock; new nodes are
+ * published at the head of their bucket, and removed nodes are
+ * unlinked but not destroyed.  Removed nodes (and the reference to
+ * their proxy) are reclaimed once all the iterations that could see
+ * them are complete, i.e. after the epoch advances twice.  The last
+ * thread to leave an epoch reclaims the pending nodes if the lock is
+ * free, otherwise the next change does it.
+ *
+ * An iteration running concurrently with changes may or may not see
+ * the proxies inserted or removed during the iteration, but it visits
+ * every other proxy exactly once.  Iterations can be nested, and
+ * workers can change the collection.
+ *
+ * The ACE_LOCK parameter serializes the changes, it also selects the
+ * implementation of the atomic counters.
+ */
+template<class PROXY, class ACE_LOCK>
+class TAO_ESF_Epoch_Hash : public TAO_ESF_Proxy_Collection<PROXY>
+{
+public:
+  typedef TAO_ESF_Epoch_Hash_Node<PROXY> Node;
+
+  /// Constructor, @a buckets is the size of the hash table, it does
+  /// not change.
+  TAO_ESF_Epoch_Hash (size_t buckets = TAO_ESF_DEFAULT_EPOCH_HASH_SIZE);
+
+  /// Destructor, releases any proxy left in the collection.
+  virtual ~TAO_ESF_Epoch_Hash (void);
+
+  // = The TAO_ESF_Proxy_Collection methods
+  virtual void for_each (TAO_ESF_Worker<PROXY> *worker);
+  virtual void connected (PROXY *proxy);
+  virtual void reconnected (PROXY *proxy);
+  virtual void disconnected (PROXY *proxy);
+  virtual void shutdown (void);
+
+  /// Start an iteration, returns the epoch to pass to leave().
+  long enter (void);
+
+  /// Complete an iteration started in @a epoch
+  void leave (long epoch);
+
+private:
+  typedef Node * volatile Bucket;
+
+  /// Insert @a proxy, the caller has incremented its reference count.
+  void insert (PROXY *proxy);
+
+  /// Find the link pointing to the node for @a proxy, returns 0 if
+  /// the proxy is not in the collection.  The caller holds the lock.
+  Bucket *find_i (PROXY *proxy);
+
+  /// Add @a node to the list of nodes waiting for the current epoch
+  /// to complete.  The caller holds the lock.
+  void retire_i (Node *node);
+
+  /// Advance the epoch as far as the active iterations allow, returns
+  /// the nodes that are no longer reachable.  The caller holds the
+  /// lock.
+  Node *reclaim_i (void);
+
+  /// Release the proxies in a list returned by reclaim_i() and
+  /// destroy the nodes.
+  static void release (Node *list);
+
+  /// Compute the bucket for @a proxy
+  size_t bucket (PROXY *proxy) const;
+
+private:
+  ACE_UNIMPLEMENTED_FUNC (TAO_ESF_Epoch_Hash (const TAO_ESF_Epoch_Hash &))
+  ACE_UNIMPLEMENTED_FUNC (TAO_ESF_Epoch_Hash &operator= (const TAO_ESF_Epoch_Hash &))
+
+  /// The hash table
+  Bucket *buckets_;
+  size_t size_;
+
+  /// The number of proxies in the collection
+  ACE_Atomic_Op<ACE_LOCK,long> count_;
+
+  /// The current epoch
+  ACE_Atomic_Op<ACE_LOCK,long> epoch_;
+
+  /// The number of iterations started on even and odd epochs.
+  ACE_Atomic_Op<ACE_LOCK,long> readers_[2];
+
+  /// The number of nodes waiting to be reclaimed
+  ACE_Atomic_Op<ACE_LOCK,long> pending_;
+
+  /// The nodes removed during even and odd epochs.
+  Node *retired_[2];
+
+  /// Serialize the changes to the collection
+  ACE_LOCK lock_;
+};
+
+// ****************************************************************
+
+/**
+ * @class TAO_ESF_Epoch_Hash_Read_Guard
+ *
+ * @brief Enter and leave a TAO_ESF_Epoch_Hash epoch.
+ */
+template<class PROXY, class ACE_LOCK>
+class TAO_ESF_Epoch_Hash_Read_Guard
+{
+public:
+  /// Constructor
+  TAO_ESF_Epoch_Hash_Read_Guard (TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK> &hash);
+
+  /// Destructor
+  ~TAO_ESF_Epoch_Hash_Read_Guard (void);
+
+private:
+  TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK> &hash_;
+  long const epoch_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+#include "orbsvcs/ESF/ESF_Epoch_Hash.inl"
+#endif /* __ACE_INLINE__ */
+
+#if defined (ACE_TEMPLATES_REQUIRE_SOURCE)
+#include "orbsvcs/ESF/ESF_Epoch_Hash.cpp"
+#endif /* ACE_TEMPLATES_REQUIRE_SOURCE */
+
+#if defined (ACE_TEMPLATES_REQUIRE_PRAGMA)
+#pragma implementation ("ESF_Epoch_Hash.cpp")
+#endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
+
+#endif /* TAO_ESF_EPOCH_HASH_H */
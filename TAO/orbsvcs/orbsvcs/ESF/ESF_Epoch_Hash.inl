@@ -0,0 +1,54 @@
+// -*- C++ -*-
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+template<class PROXY> ACE_INLINE
+TAO_ESF_Epoch_Hash_Node<PROXY>::
+    TAO_ESF_Epoch_Hash_Node (PROXY *p,
+                             TAO_ESF_Epoch_Hash_Node<PROXY> *n)
+      :  proxy (p),
+         next (n),
+         retired (0)
+{
+}
+
+// ****************************************************************
+
+template<class PROXY, class ACE_LOCK> ACE_INLINE size_t
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::bucket (PROXY *proxy) const
+{
+  // The low bits of the address are always zero.
+  return (reinterpret_cast<size_t> (proxy) >> 3) % this->size_;
+}
+
+template<class PROXY, class ACE_LOCK> ACE_INLINE void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::connected (PROXY *proxy)
+{
+  proxy->_incr_refcnt ();
+  this->insert (proxy);
+}
+
+template<class PROXY, class ACE_LOCK> ACE_INLINE void
+TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK>::reconnected (PROXY *proxy)
+{
+  proxy->_incr_refcnt ();
+  this->insert (proxy);
+}
+
+// ****************************************************************
+
+template<class PROXY, class ACE_LOCK> ACE_INLINE
+TAO_ESF_Epoch_Hash_Read_Guard<PROXY,ACE_LOCK>::
+    TAO_ESF_Epoch_Hash_Read_Guard (TAO_ESF_Epoch_Hash<PROXY,ACE_LOCK> &hash)
+      :  hash_ (hash),
+         epoch_ (hash.enter ())
+{
+}
+
+template<class PROXY, class ACE_LOCK> ACE_INLINE
+TAO_ESF_Epoch_Hash_Read_Guard<PROXY,ACE_LOCK>::
+    ~TAO_ESF_Epoch_Hash_Read_Guard (void)
+{
+  this->hash_.leave (this->epoch_);
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
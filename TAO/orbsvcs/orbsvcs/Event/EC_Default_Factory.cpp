@@ -2,6 +2,7 @@
 #include "orbsvcs/Event/EC_Default_Factory.h"
 #include "orbsvcs/Event/EC_Reactive_Dispatching.h"
 #include "orbsvcs/Event/EC_MT_Dispatching.h"
+#include "orbsvcs/Event/EC_Serial_Dispatching.h"
 #include "orbsvcs/Event/EC_Basic_Filter_Builder.h"
 #include "orbsvcs/Event/EC_Prefix_Filter_Builder.h"
 #include "orbsvcs/Event/EC_ConsumerAdmin.h"
@@ -10,6 +11,7 @@
 #include "orbsvcs/Event/EC_Default_ProxySupplier.h"
 #include "orbsvcs/Event/EC_Trivial_Supplier_Filter.h"
 #include "orbsvcs/Event/EC_Per_Supplier_Filter.h"
+#include "orbsvcs/Event/EC_Routing_Supplier_Filter.h"
 #include "orbsvcs/Event/EC_ObserverStrategy.h"
 #include "orbsvcs/Event/EC_Null_Scheduling.h"
 #include "orbsvcs/Event/EC_Group_Scheduling.h"
@@ -25,6 +27,7 @@
 #include "orbsvcs/ESF/ESF_Copy_On_Read.h"
 #include "orbsvcs/ESF/ESF_Copy_On_Write.h"
 #include "orbsvcs/ESF/ESF_Delayed_Changes.h"
+#include "orbsvcs/ESF/ESF_Epoch_Hash.h"
 #include "orbsvcs/ESF/ESF_Delayed_Command.h"
 
 #include "tao/ORB_Core.h"
@@ -90,6 +93,8 @@ TAO_EC_Default_Factory::init (int argc, ACE_TCHAR* argv[])
                 this->dispatching_ = 0;
               else if (ACE_OS::strcasecmp (opt, ACE_TEXT("mt")) == 0)
                 this->dispatching_ = 1;
+              else if (ACE_OS::strcasecmp (opt, ACE_TEXT("serial")) == 0)
+                this->dispatching_ = 3;
               else
                   this->unsupported_option_value (ACE_TEXT("-ECDispatching"), opt);
               arg_shifter.consume_arg ();
@@ -173,6 +178,8 @@ TAO_EC_Default_Factory::init (int argc, ACE_TCHAR* argv[])
                 this->supplier_filtering_ = 0;
               else if (ACE_OS::strcasecmp (opt, ACE_TEXT("per-supplier")) == 0)
                 this->supplier_filtering_ = 1;
+              else if (ACE_OS::strcasecmp (opt, ACE_TEXT("routing")) == 0)
+                this->supplier_filtering_ = 2;
               else
                   this->unsupported_option_value (ACE_TEXT("-ECSupplierFilter"), opt);
               arg_shifter.consume_arg ();
@@ -263,6 +270,8 @@ TAO_EC_Default_Factory::init (int argc, ACE_TCHAR* argv[])
                     iteration_type = 2;
                   else if (ACE_OS::strcasecmp (arg, ACE_TEXT("delayed")) == 0)
                     iteration_type = 3;
+                  else if (ACE_OS::strcasecmp (arg, ACE_TEXT("epoch")) == 0)
+                    iteration_type = 4;
                   else
                     ORBSVCS_ERROR ((LM_ERROR,
                                 "EC_Default_Factory - "
@@ -308,6 +317,8 @@ TAO_EC_Default_Factory::init (int argc, ACE_TCHAR* argv[])
                     iteration_type = 2;
                   else if (ACE_OS::strcasecmp (arg, ACE_TEXT("delayed")) == 0)
                     iteration_type = 3;
+                  else if (ACE_OS::strcasecmp (arg, ACE_TEXT("epoch")) == 0)
+                    iteration_type = 4;
                   else
                     ORBSVCS_ERROR ((LM_ERROR,
                                 "EC_Default_Factory - "
@@ -466,6 +477,18 @@ TAO_EC_Default_Factory::init (int argc, ACE_TCHAR* argv[])
             }
         }
 
+      else if (ACE_OS::strcasecmp (arg, ACE_TEXT("-ECMarshalOnce")) == 0)
+        {
+          arg_shifter.consume_arg ();
+
+          if (arg_shifter.is_parameter_next ())
+            {
+              const ACE_TCHAR* opt = arg_shifter.get_current ();
+              this->marshal_once_ = ACE_OS::atoi (opt);
+              arg_shifter.consume_arg ();
+            }
+        }
+
       else if (ACE_OS::strcasecmp (arg, ACE_TEXT("-ECQueueFullServiceObject")) == 0)
         {
           arg_shifter.consume_arg ();
@@ -538,7 +561,7 @@ TAO_EC_Dispatching*
 TAO_EC_Default_Factory::create_dispatching (TAO_EC_Event_Channel_Base *)
 {
   if (this->dispatching_ == 0)
-    return new TAO_EC_Reactive_Dispatching ();
+    return new TAO_EC_Reactive_Dispatching (this->marshal_once_);
   else if (this->dispatching_ == 1)
     {
       TAO_EC_Queue_Full_Service_Object* so =
@@ -550,6 +573,17 @@ TAO_EC_Default_Factory::create_dispatching (TAO_EC_Event_Channel_Base *)
                                         this->dispatching_threads_force_active_,
                                         so);
     }
+  else if (this->dispatching_ == 3)
+    {
+      TAO_EC_Queue_Full_Service_Object* so =
+        this->find_service_object (this->queue_full_service_object_name_.fast_rep(),
+                                   TAO_EC_DEFAULT_QUEUE_FULL_SERVICE_OBJECT_NAME);
+      return new TAO_EC_Serial_Dispatching (this->dispatching_threads_,
+                                            this->dispatching_threads_flags_,
+                                            this->dispatching_threads_priority_,
+                                            this->dispatching_threads_force_active_,
+                                            so);
+    }
   return 0;
 }
 
@@ -584,6 +618,8 @@ TAO_EC_Default_Factory::create_supplier_filter_builder (TAO_EC_Event_Channel_Bas
     return new TAO_EC_Trivial_Supplier_Filter_Builder (ec);
   else if (this->supplier_filtering_ == 1)
     return new TAO_EC_Per_Supplier_Filter_Builder (ec);
+  else if (this->supplier_filtering_ == 2)
+    return new TAO_EC_Routing_Supplier_Filter_Builder (ec);
   return 0;
 }
 
@@ -730,7 +766,15 @@ typedef
 TAO_EC_ProxyPushConsumer_Collection*
 TAO_EC_Default_Factory::create_proxy_push_consumer_collection (TAO_EC_Event_Channel_Base *)
 {
-  if (this->consumer_collection_ == 0x000)
+  if ((this->consumer_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->consumer_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_EC_ProxyPushConsumer,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_EC_ProxyPushConsumer,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->consumer_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_EC_ProxyPushConsumer,
       TAO_ESF_Proxy_List<TAO_EC_ProxyPushConsumer>,
       TAO_EC_Consumer_List_Iterator,
@@ -823,7 +867,15 @@ TAO_EC_Default_Factory::destroy_proxy_push_consumer_collection (TAO_EC_ProxyPush
 TAO_EC_ProxyPushSupplier_Collection*
 TAO_EC_Default_Factory::create_proxy_push_supplier_collection (TAO_EC_Event_Channel_Base *)
 {
-  if (this->supplier_collection_ == 0x000)
+  if ((this->supplier_collection_ & 0x00F) == 0x004)
+    {
+      if ((this->supplier_collection_ & 0x100) == 0)
+        return new TAO_ESF_Epoch_Hash<TAO_EC_ProxyPushSupplier,
+          TAO_SYNCH_MUTEX> ();
+      return new TAO_ESF_Epoch_Hash<TAO_EC_ProxyPushSupplier,
+        ACE_Null_Mutex> ();
+    }
+  else if (this->supplier_collection_ == 0x000)
     return new TAO_ESF_Immediate_Changes<TAO_EC_ProxyPushSupplier,
       TAO_ESF_Proxy_List<TAO_EC_ProxyPushSupplier>,
       TAO_EC_Supplier_List_Iterator,
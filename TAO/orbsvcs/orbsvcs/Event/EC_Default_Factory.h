@@ -182,6 +182,10 @@ protected:
 
   /// Validate the connection to consumer on connect
   int consumer_validate_connection_;
+
+  /// Marshal each event once for all the consumers (reactive
+  /// dispatching only)
+  int marshal_once_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
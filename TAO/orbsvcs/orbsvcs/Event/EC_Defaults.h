@@ -137,6 +137,10 @@
 # define TAO_EC_DEFAULT_CONSUMER_VALIDATE_CONNECTION 0 /* no validation */
 #endif /* TAO_EC_DEFAULT_CONSUMER_VALIDATE_CONNECTION */
 
+#ifndef TAO_EC_DEFAULT_MARSHAL_ONCE
+# define TAO_EC_DEFAULT_MARSHAL_ONCE 0 /* marshal for each consumer */
+#endif /* TAO_EC_DEFAULT_MARSHAL_ONCE */
+
 #include /**/ "ace/post.h"
 
 #endif /* TAO_EC_DEFAULTS_H */
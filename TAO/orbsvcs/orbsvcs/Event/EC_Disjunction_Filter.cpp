@@ -149,4 +149,21 @@ TAO_EC_Disjunction_Filter::add_dependencies (
   return 0;
 }
 
+int
+TAO_EC_Disjunction_Filter::exact_headers (TAO_EC_Header_List& headers) const
+{
+  if (this->n_ == 0)
+    return 0;
+
+  ChildrenIterator end = this->end ();
+  for (ChildrenIterator i = this->begin ();
+       i != end;
+       ++i)
+    {
+      if ((*i)->exact_headers (headers) == 0)
+        return 0;
+    }
+  return 1;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
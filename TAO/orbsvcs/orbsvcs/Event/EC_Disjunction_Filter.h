@@ -64,6 +64,7 @@ public:
   virtual int can_match (const RtecEventComm::EventHeader& header) const;
   virtual int add_dependencies (const RtecEventComm::EventHeader& header,
                                 const TAO_EC_QOS_Info &qos_info);
+  virtual int exact_headers (TAO_EC_Header_List& headers) const;
 
 private:
   TAO_EC_Disjunction_Filter (const TAO_EC_Disjunction_Filter&);
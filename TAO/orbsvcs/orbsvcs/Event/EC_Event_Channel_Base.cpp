@@ -6,6 +6,7 @@
 #include "orbsvcs/Event/EC_ObserverStrategy.h"
 #include "orbsvcs/Event/EC_ConsumerControl.h"
 #include "orbsvcs/Event/EC_SupplierControl.h"
+#include "orbsvcs/Event/EC_Supplier_Filter_Builder.h"
 #include "ace/Dynamic_Service.h"
 
 #if ! defined (__ACE_INLINE__)
@@ -151,6 +152,8 @@ TAO_EC_Event_Channel_Base::shutdown (void)
 
   this->consumer_admin_->shutdown ();
 
+  this->supplier_filter_builder_->shutdown ();
+
   {
     // Wait until all the shutdown() operations return before marking
     // the EC as destroyed...
@@ -223,6 +226,7 @@ TAO_EC_Event_Channel_Base::connected (TAO_EC_ProxyPushSupplier* supplier)
 {
   this->supplier_admin_->peer_connected (supplier);
   this->consumer_admin_->connected (supplier);
+  this->supplier_filter_builder_->connected (supplier);
   this->observer_strategy_->connected (supplier);
 }
 
@@ -231,6 +235,7 @@ TAO_EC_Event_Channel_Base::reconnected (TAO_EC_ProxyPushSupplier* supplier)
 {
   this->supplier_admin_->peer_reconnected (supplier);
   this->consumer_admin_->reconnected (supplier);
+  this->supplier_filter_builder_->reconnected (supplier);
   this->observer_strategy_->connected (supplier);
 }
 
@@ -239,6 +244,7 @@ TAO_EC_Event_Channel_Base::disconnected (TAO_EC_ProxyPushSupplier* supplier)
 {
   this->supplier_admin_->peer_disconnected (supplier);
   this->consumer_admin_->disconnected (supplier);
+  this->supplier_filter_builder_->disconnected (supplier);
   this->observer_strategy_->disconnected (supplier);
 }
 
@@ -44,6 +44,12 @@ TAO_EC_Filter::get_qos_info (TAO_EC_QOS_Info& qos_info)
   throw CORBA::NO_IMPLEMENT (TAO::VMCID, CORBA::COMPLETED_NO);
 }
 
+int
+TAO_EC_Filter::exact_headers (TAO_EC_Header_List&) const
+{
+  return 0;
+}
+
 // ****************************************************************
 
 int
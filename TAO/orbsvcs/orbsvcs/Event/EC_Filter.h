@@ -16,6 +16,7 @@
 #include /**/ "ace/pre.h"
 
 #include "orbsvcs/RtecEventCommC.h"
+#include "ace/Unbounded_Queue.h"
 
 #include /**/ "orbsvcs/Event/event_serv_export.h"
 
@@ -27,6 +28,9 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 class TAO_EC_QOS_Info;
 
+/// A list of event headers, used to describe simple subscriptions.
+typedef ACE_Unbounded_Queue<RtecEventComm::EventHeader> TAO_EC_Header_List;
+
 /**
  * @class TAO_EC_Filter
  *
@@ -147,6 +151,16 @@ public:
    */
   virtual void get_qos_info (TAO_EC_QOS_Info& qos_info);
 
+  /**
+   * If this filter accepts exactly the events whose source and type
+   * match one of a list of headers (without wildcards) then append
+   * those headers to @a headers and return 1.  Otherwise return 0,
+   * the contents of @a headers are then undefined.
+   * The default implementation returns 0, only the filters that can
+   * be replaced by a table lookup override it.
+   */
+  virtual int exact_headers (TAO_EC_Header_List& headers) const;
+
 private:
   /// The parent...
   TAO_EC_Filter* parent_;
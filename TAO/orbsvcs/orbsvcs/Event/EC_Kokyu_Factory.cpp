@@ -52,6 +52,10 @@ TAO_EC_Kokyu_Factory::init (int argc, ACE_TCHAR* argv[])
                 {
                   this->dispatching_ = 1;
                 }
+              else if (ACE_OS::strcasecmp (opt, ACE_TEXT("serial")) == 0)
+                {
+                  this->dispatching_ = 3;
+                }
               else if (ACE_OS::strcasecmp (opt, ACE_TEXT("kokyu")) == 0)
                 {
                   this->dispatching_ = 2;
@@ -0,0 +1,172 @@
+#include "orbsvcs/Event/EC_Marshaled_Event_Set.h"
+
+#include "tao/CDR.h"
+#include "tao/Invocation_Adapter.h"
+#include "tao/Basic_Arguments.h"
+#include "tao/Var_Size_Argument_T.h"
+#include "tao/Any_Insert_Policy_T.h"
+
+#include "ace/Message_Block.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_EC_Marshaled_Event_Set_Argument
+ *
+ * @brief The IN argument for RtecEventComm::PushConsumer::push(),
+ * marshaled using a TAO_EC_Marshaled_Event_Set.
+ *
+ * The interceptors still see the original event set.
+ */
+class TAO_EC_Marshaled_Event_Set_Argument
+  : public TAO::In_Var_Size_Argument_T<RtecEventComm::EventSet,
+                                       TAO::Any_Insert_Policy_Stream>
+{
+public:
+  TAO_EC_Marshaled_Event_Set_Argument (const RtecEventComm::EventSet &event,
+                                       TAO_EC_Marshaled_Event_Set &marshaled)
+    : TAO::In_Var_Size_Argument_T<RtecEventComm::EventSet,
+                                  TAO::Any_Insert_Policy_Stream> (event),
+      marshaled_ (marshaled)
+  {
+  }
+
+  virtual CORBA::Boolean marshal (TAO_OutputCDR &cdr)
+  {
+    return this->marshaled_.marshal (cdr);
+  }
+
+private:
+  TAO_EC_Marshaled_Event_Set &marshaled_;
+};
+
+// ****************************************************************
+
+TAO_EC_Marshaled_Event_Set::TAO_EC_Marshaled_Event_Set (
+    const RtecEventComm::EventSet &event)
+  : event_ (event),
+    major_version_ (0),
+    minor_version_ (0)
+{
+  for (size_t i = 0; i != ACE_CDR::MAX_ALIGNMENT; ++i)
+    this->encoded_[i] = 0;
+}
+
+TAO_EC_Marshaled_Event_Set::~TAO_EC_Marshaled_Event_Set (void)
+{
+  for (size_t i = 0; i != ACE_CDR::MAX_ALIGNMENT; ++i)
+    ACE_Message_Block::release (this->encoded_[i]);
+}
+
+void
+TAO_EC_Marshaled_Event_Set::push (RtecEventComm::PushConsumer_ptr consumer,
+                                  const RtecEventComm::EventSet &event)
+{
+  if (&event != &this->event_
+      || consumer->_is_collocated ()
+      || consumer->_stubobj () == 0)
+    {
+      // A different event set (the filters may compose new ones), or
+      // a consumer that is not going to marshal anything.
+      consumer->push (event);
+      return;
+    }
+
+  if (!consumer->is_evaluated ())
+    ::CORBA::Object::tao_object_initialize (consumer);
+
+  TAO::Arg_Traits<void>::ret_val _tao_retval;
+  TAO_EC_Marshaled_Event_Set_Argument _tao_data (event, *this);
+
+  TAO::Argument *_the_tao_operation_signature [] =
+    {
+      &_tao_retval,
+      &_tao_data
+    };
+
+  TAO::Invocation_Adapter _tao_call (
+      consumer,
+      _the_tao_operation_signature,
+      2,
+      "push",
+      4,
+      TAO::TAO_CO_NONE,
+      TAO::TAO_ONEWAY_INVOCATION
+    );
+
+  _tao_call.invoke (0, 0);
+}
+
+CORBA::Boolean
+TAO_EC_Marshaled_Event_Set::marshal (TAO_OutputCDR &cdr)
+{
+  ACE_CDR::Octet major = 0;
+  ACE_CDR::Octet minor = 0;
+  cdr.get_version (major, minor);
+
+  if (cdr.char_translator () != 0
+      || cdr.wchar_translator () != 0
+      || cdr.do_byte_swap ())
+    {
+      return cdr << this->event_;
+    }
+
+  size_t const alignment =
+    cdr.current_alignment () % ACE_CDR::MAX_ALIGNMENT;
+
+  ACE_Message_Block *mb = this->encoded_[alignment];
+  if (mb == 0)
+    {
+      mb = this->encode (cdr, alignment);
+      if (mb == 0)
+        return cdr << this->event_;
+    }
+  else if (major != this->major_version_ || minor != this->minor_version_)
+    {
+      // All the consumers usually speak the same GIOP version, only
+      // the first one gets cached.
+      return cdr << this->event_;
+    }
+
+  return cdr.write_octet_array_mb (mb);
+}
+
+ACE_Message_Block *
+TAO_EC_Marshaled_Event_Set::encode (TAO_OutputCDR &cdr, size_t alignment)
+{
+  ACE_CDR::Octet major = 0;
+  ACE_CDR::Octet minor = 0;
+  cdr.get_version (major, minor);
+
+  for (size_t i = 0; i != ACE_CDR::MAX_ALIGNMENT; ++i)
+    {
+      if (this->encoded_[i] != 0
+          && (major != this->major_version_ || minor != this->minor_version_))
+        return 0;
+    }
+
+  // Pad the stream so the event set starts at the same alignment it
+  // will have in the request, then skip the padding.
+  TAO_OutputCDR encoder;
+  encoder.set_version (major, minor);
+  for (size_t i = 0; i != alignment; ++i)
+    encoder.write_octet (0);
+
+  if (!(encoder << this->event_) || encoder.consolidate () != 0)
+    return 0;
+
+  // The data block is shared with the requests, but only while they
+  // are sent by this thread, the transport copies any message that
+  // it queues.
+  ACE_Message_Block *mb = encoder.begin ()->duplicate ();
+  if (mb == 0)
+    return 0;
+  mb->rd_ptr (alignment);
+
+  this->major_version_ = major;
+  this->minor_version_ = minor;
+  this->encoded_[alignment] = mb;
+  return mb;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,94 @@
+// -*- C++ -*-
+
+/**
+ *  @file   EC_Marshaled_Event_Set.h
+ *
+ *  Marshal an event set once and reuse the encoding for each remote
+ *  consumer that receives it.
+ */
+
+#ifndef TAO_EC_MARSHALED_EVENT_SET_H
+#define TAO_EC_MARSHALED_EVENT_SET_H
+#include /**/ "ace/pre.h"
+
+#include "orbsvcs/RtecEventCommC.h"
+#include /**/ "orbsvcs/Event/event_serv_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/CDR_Base.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+class ACE_Message_Block;
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_OutputCDR;
+
+/**
+ * @class TAO_EC_Marshaled_Event_Set
+ *
+ * @brief Cache the CDR encoding of an event set during a fanout.
+ *
+ * When an event is delivered to many remote consumers the stubs
+ * marshal the same event set once per consumer.  This class keeps
+ * the encoding of the event set and copies (or, for large events,
+ * chains) it into the request of each consumer, so only the GIOP
+ * header is marshaled for each push.
+ *
+ * The CDR encoding depends on the alignment of the stream position
+ * where the event set starts, which varies with the length of the
+ * request header; one encoding is kept for each of the
+ * ACE_CDR::MAX_ALIGNMENT possible offsets, and they are computed on
+ * demand.
+ * Streams with a different GIOP version, byte order or codeset
+ * translators fall back to the regular marshaling code.
+ *
+ * The object lives for a single fanout (see TAO_EC_Filter_Worker),
+ * it does not copy the event set, and it is not thread safe.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Marshaled_Event_Set
+{
+public:
+  /// Constructor, the encoding of @a event is computed on first use.
+  TAO_EC_Marshaled_Event_Set (const RtecEventComm::EventSet &event);
+
+  /// Destructor
+  ~TAO_EC_Marshaled_Event_Set (void);
+
+  /// Push @a event to @a consumer.  If @a event is the event set
+  /// cached by this object and the consumer is remote the cached
+  /// encoding is used, otherwise this is just consumer->push().
+  void push (RtecEventComm::PushConsumer_ptr consumer,
+             const RtecEventComm::EventSet &event);
+
+  /// Write the event set into @a cdr
+  CORBA::Boolean marshal (TAO_OutputCDR &cdr);
+
+private:
+  /// Compute the encoding for a stream at @a alignment, returns 0 on
+  /// failure.
+  ACE_Message_Block *encode (TAO_OutputCDR &cdr, size_t alignment);
+
+private:
+  ACE_UNIMPLEMENTED_FUNC (TAO_EC_Marshaled_Event_Set (const TAO_EC_Marshaled_Event_Set &))
+  ACE_UNIMPLEMENTED_FUNC (TAO_EC_Marshaled_Event_Set &operator= (const TAO_EC_Marshaled_Event_Set &))
+
+  /// The event set
+  const RtecEventComm::EventSet &event_;
+
+  /// The encodings, indexed by the stream alignment.
+  ACE_Message_Block *encoded_[ACE_CDR::MAX_ALIGNMENT];
+
+  /// The GIOP version used for the encodings.
+  ACE_CDR::Octet major_version_;
+  ACE_CDR::Octet minor_version_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_EC_MARSHALED_EVENT_SET_H */
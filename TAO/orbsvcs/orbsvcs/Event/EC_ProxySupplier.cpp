@@ -2,6 +2,7 @@
 #include "orbsvcs/Event/EC_Dispatching.h"
 #include "orbsvcs/Event/EC_Filter_Builder.h"
 #include "orbsvcs/Event/EC_QOS_Info.h"
+#include "orbsvcs/Event/EC_Marshaled_Event_Set.h"
 #include "orbsvcs/Event/EC_Event_Channel_Base.h"
 #include "orbsvcs/Event/EC_Scheduling_Strategy.h"
 #include "orbsvcs/Event/EC_ConsumerControl.h"
@@ -218,6 +219,26 @@ TAO_EC_ProxyPushSupplier::filter_nocopy (RtecEventComm::EventSet& event,
   return result;
 }
 
+void
+TAO_EC_ProxyPushSupplier::push_matched (const RtecEventComm::EventSet& event,
+                                        TAO_EC_QOS_Info& qos_info)
+{
+  Destroy_Guard auto_destroy (this->refcount_,
+                              this->event_channel_,
+                              this);
+
+  {
+    ACE_GUARD_THROW_EX (
+            ACE_Lock, ace_mon, *this->lock_,
+            RtecEventChannelAdmin::EventChannel::SYNCHRONIZATION_ERROR ());
+
+    if (this->is_connected_i ())
+      {
+        this->push (event, qos_info);
+      }
+  }
+}
+
 void
 TAO_EC_ProxyPushSupplier::push (const RtecEventComm::EventSet& event,
                                 TAO_EC_QOS_Info& qos_info)
@@ -377,10 +398,22 @@ void
 TAO_EC_ProxyPushSupplier::reactive_push_to_consumer (
     RtecEventComm::PushConsumer_ptr consumer,
     const RtecEventComm::EventSet& event)
+{
+  this->reactive_push_to_consumer (consumer, event, 0);
+}
+
+void
+TAO_EC_ProxyPushSupplier::reactive_push_to_consumer (
+    RtecEventComm::PushConsumer_ptr consumer,
+    const RtecEventComm::EventSet& event,
+    TAO_EC_Marshaled_Event_Set *marshaled)
 {
   try
     {
-      consumer->push (event);
+      if (marshaled == 0)
+        consumer->push (event);
+      else
+        marshaled->push (consumer, event);
     }
   catch (const CORBA::OBJECT_NOT_EXIST&)
     {
@@ -469,4 +502,15 @@ TAO_EC_ProxyPushSupplier::add_dependencies (
   return this->child_->add_dependencies (header, qos_info);
 }
 
+int
+TAO_EC_ProxyPushSupplier::exact_headers (TAO_EC_Header_List &headers) const
+{
+  ACE_GUARD_RETURN (ACE_Lock, ace_mon, *this->lock_, 0);
+
+  if (!this->is_connected_i () || this->child_ == 0)
+    return 0;
+
+  return this->child_->exact_headers (headers);
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
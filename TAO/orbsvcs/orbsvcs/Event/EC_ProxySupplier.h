@@ -27,6 +27,7 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 class TAO_EC_Event_Channel_Base;
 class TAO_EC_ProxyPushConsumer;
+class TAO_EC_Marshaled_Event_Set;
 
 /**
  * @class TAO_EC_ProxyPushSupplier
@@ -116,6 +117,12 @@ public:
   void reactive_push_to_consumer (RtecEventComm::PushConsumer_ptr consumer,
                                   const RtecEventComm::EventSet &event);
 
+  /// Same as above, but if @a marshaled is not 0 its cached encoding
+  /// of the event is used to push to remote consumers.
+  void reactive_push_to_consumer (RtecEventComm::PushConsumer_ptr consumer,
+                                  const RtecEventComm::EventSet &event,
+                                  TAO_EC_Marshaled_Event_Set *marshaled);
+
   /**
    * Invoke the _non_existent() pseudo-operation on the consumer. If
    * it is disconnected then it returns true and sets the
@@ -141,6 +148,16 @@ public:
   virtual int can_match (const RtecEventComm::EventHeader &header) const;
   virtual int add_dependencies (const RtecEventComm::EventHeader &header,
                                 const TAO_EC_QOS_Info &qos_info);
+  virtual int exact_headers (TAO_EC_Header_List &headers) const;
+
+  /**
+   * Push the event to the consumer without walking the filter tree.
+   * Used by the supplier filters that already know the event matches
+   * the subscriptions, for instance using the headers returned by
+   * exact_headers().
+   */
+  void push_matched (const RtecEventComm::EventSet &event,
+                     TAO_EC_QOS_Info &qos_info);
 
 protected:
   /// Set the consumer, used by some implementations to change the
@@ -189,6 +206,10 @@ private:
 
   /// Template method hooks.
   virtual void refcount_zero_hook (void);
+  /// Called before the event is dispatched.  When the dispatching
+  /// strategy reuses a single encoding for all the consumers
+  /// (-ECMarshalOnce) changes to the event are not seen by remote
+  /// consumers.
   virtual void pre_dispatch_hook (RtecEventComm::EventSet&);
   virtual PortableServer::ObjectId object_id (void) = 0;
 };
@@ -26,6 +26,8 @@
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+class TAO_EC_Marshaled_Event_Set;
+
 /**
  * @class TAO_EC_QOS_Info
  *
@@ -55,6 +57,13 @@ public:
    * timeouts for the same consumer.
    */
   long timer_id_;
+
+  /**
+   * The encoding of the event set being delivered, shared by all the
+   * consumers that receive it.  Only valid during the fanout, it is 0
+   * if the supplier filter does not provide one.
+   */
+  TAO_EC_Marshaled_Event_Set *marshaled_event_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
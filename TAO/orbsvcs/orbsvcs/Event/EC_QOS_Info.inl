@@ -5,7 +5,8 @@ ACE_INLINE
 TAO_EC_QOS_Info::TAO_EC_QOS_Info (void)
   :  rt_info (-1),
      preemption_priority (0),
-     timer_id_ (-1)
+     timer_id_ (-1),
+     marshaled_event_ (0)
 {
 }
 
@@ -13,7 +14,8 @@ ACE_INLINE
 TAO_EC_QOS_Info::TAO_EC_QOS_Info (const TAO_EC_QOS_Info &rhs)
   :  rt_info (rhs.rt_info),
      preemption_priority (rhs.preemption_priority),
-     timer_id_ (rhs.timer_id_)
+     timer_id_ (rhs.timer_id_),
+     marshaled_event_ (rhs.marshaled_event_)
 {
 }
 
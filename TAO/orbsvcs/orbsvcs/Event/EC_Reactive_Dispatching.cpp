@@ -1,12 +1,14 @@
 #include "orbsvcs/Event/EC_Reactive_Dispatching.h"
 #include "orbsvcs/Event/EC_ProxySupplier.h"
+#include "orbsvcs/Event/EC_QOS_Info.h"
 
 
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
-TAO_EC_Reactive_Dispatching::TAO_EC_Reactive_Dispatching (void)
-  : TAO_EC_Dispatching ()
+TAO_EC_Reactive_Dispatching::TAO_EC_Reactive_Dispatching (int marshal_once)
+  : TAO_EC_Dispatching (),
+    marshal_once_ (marshal_once)
 {
 }
 
@@ -24,18 +26,24 @@ void
 TAO_EC_Reactive_Dispatching::push (TAO_EC_ProxyPushSupplier* proxy,
                                    RtecEventComm::PushConsumer_ptr consumer,
                                    const RtecEventComm::EventSet& event,
-                                   TAO_EC_QOS_Info&)
+                                   TAO_EC_QOS_Info& qos_info)
 {
-  proxy->reactive_push_to_consumer (consumer, event);
+  proxy->reactive_push_to_consumer (
+    consumer,
+    event,
+    this->marshal_once_ ? qos_info.marshaled_event_ : 0);
 }
 
 void
 TAO_EC_Reactive_Dispatching::push_nocopy (TAO_EC_ProxyPushSupplier* proxy,
                                           RtecEventComm::PushConsumer_ptr consumer,
                                           RtecEventComm::EventSet& event,
-                                          TAO_EC_QOS_Info&)
+                                          TAO_EC_QOS_Info& qos_info)
 {
-  proxy->reactive_push_to_consumer (consumer, event);
+  proxy->reactive_push_to_consumer (
+    consumer,
+    event,
+    this->marshal_once_ ? qos_info.marshaled_event_ : 0);
 }
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -37,9 +37,9 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 class TAO_RTEvent_Serv_Export TAO_EC_Reactive_Dispatching : public TAO_EC_Dispatching
 {
 public:
-  /// The scheduler is used to find the range of priorities and similar
-  /// info.
-  TAO_EC_Reactive_Dispatching (void);
+  /// Constructor.  If @a marshal_once is not zero the event sets are
+  /// marshaled once for all the consumers that receive them.
+  TAO_EC_Reactive_Dispatching (int marshal_once = 0);
 
   // = The EC_Dispatching methods.
   virtual void activate (void);
@@ -52,6 +52,10 @@ public:
                             RtecEventComm::PushConsumer_ptr consumer,
                             RtecEventComm::EventSet &event,
                             TAO_EC_QOS_Info &qos_info);
+
+private:
+  /// Reuse the encoding of each event set for all its consumers.
+  int marshal_once_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
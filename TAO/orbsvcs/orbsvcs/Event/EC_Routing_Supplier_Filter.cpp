@@ -0,0 +1,331 @@
+#include "orbsvcs/Event/EC_Routing_Supplier_Filter.h"
+#include "orbsvcs/Event/EC_Event_Channel_Base.h"
+#include "orbsvcs/Event/EC_ProxySupplier.h"
+#include "orbsvcs/Event/EC_Marshaled_Event_Set.h"
+#include "orbsvcs/Event/EC_QOS_Info.h"
+#include "orbsvcs/Event/EC_Scheduling_Strategy.h"
+#include "orbsvcs/Event/EC_ProxyConsumer.h" // @@ MSVC 6 bug
+
+#include "ace/Guard_T.h"
+#include "ace/Vector_T.h"
+
+#if !defined (TAO_EC_ROUTING_DEFAULT_TABLE_SIZE)
+#define TAO_EC_ROUTING_DEFAULT_TABLE_SIZE 1024
+#endif
+
+/// The number of consumers that can be matched by an event without
+/// allocating memory.
+#if !defined (TAO_EC_ROUTING_PREALLOCATED_MATCHES)
+#define TAO_EC_ROUTING_PREALLOCATED_MATCHES 32
+#endif
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_EC_Routing_Supplier_Filter::
+    TAO_EC_Routing_Supplier_Filter (TAO_EC_Event_Channel_Base* ec)
+  :  event_channel_ (ec),
+     routes_ (TAO_EC_ROUTING_DEFAULT_TABLE_SIZE),
+     simple_ (TAO_EC_ROUTING_DEFAULT_TABLE_SIZE)
+{
+}
+
+TAO_EC_Routing_Supplier_Filter::~TAO_EC_Routing_Supplier_Filter (void)
+{
+  this->clear ();
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::bind (TAO_EC_ProxyPushConsumer*)
+{
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::unbind (TAO_EC_ProxyPushConsumer*)
+{
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::connected (TAO_EC_ProxyPushSupplier*)
+{
+  // The builder receives the connection notifications for the whole
+  // event channel, the per-supplier notifications are redundant.
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::reconnected (TAO_EC_ProxyPushSupplier*)
+{
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::disconnected (TAO_EC_ProxyPushSupplier*)
+{
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::shutdown (void)
+{
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::push (const RtecEventComm::EventSet& event,
+                                      TAO_EC_ProxyPushConsumer *consumer)
+{
+  TAO_EC_Scheduling_Strategy* scheduling_strategy =
+    this->event_channel_->scheduling_strategy ();
+  scheduling_strategy->schedule_event (event,
+                                       consumer,
+                                       this);
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::push_scheduled_event (RtecEventComm::EventSet &event,
+                                                      const TAO_EC_QOS_Info &event_info)
+{
+  if (event.length () != 1
+      || event[0].header.source == 0
+      || event[0].header.type == 0)
+    {
+      // Cannot use the table, let each consumer decide.
+      TAO_EC_Filter_Worker worker (event, event_info);
+      this->event_channel_->for_each_consumer (&worker);
+      return;
+    }
+
+  ACE_Vector<TAO_EC_ProxyPushSupplier*,TAO_EC_ROUTING_PREALLOCATED_MATCHES> proxies;
+  size_t matched = 0;
+  {
+    ACE_READ_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+    Consumer_Set *set = 0;
+    if (this->routes_.find (routing_key (event[0].header), set) == 0)
+      {
+        Consumer_Set::iterator end = set->end ();
+        for (Consumer_Set::iterator i = set->begin (); i != end; ++i)
+          {
+            (*i)->_incr_refcnt ();
+            proxies.push_back (*i);
+          }
+      }
+    matched = proxies.size ();
+
+    Consumer_Set::iterator end = this->complex_.end ();
+    for (Consumer_Set::iterator i = this->complex_.begin (); i != end; ++i)
+      {
+        (*i)->_incr_refcnt ();
+        proxies.push_back (*i);
+      }
+  }
+
+  TAO_EC_Marshaled_Event_Set marshaled_event (event);
+  size_t const size = proxies.size ();
+  size_t j = 0;
+  try
+    {
+      for (; j != size; ++j)
+        {
+          TAO_EC_QOS_Info qos_info = event_info;
+          qos_info.marshaled_event_ = &marshaled_event;
+          if (j < matched)
+            proxies[j]->push_matched (event, qos_info);
+          else
+            proxies[j]->filter (event, qos_info);
+          proxies[j]->_decr_refcnt ();
+        }
+    }
+  catch (const CORBA::Exception&)
+    {
+      for (; j != size; ++j)
+        proxies[j]->_decr_refcnt ();
+      throw;
+    }
+}
+
+CORBA::ULong
+TAO_EC_Routing_Supplier_Filter::_incr_refcnt (void)
+{
+  return 1;
+}
+
+CORBA::ULong
+TAO_EC_Routing_Supplier_Filter::_decr_refcnt (void)
+{
+  return 1;
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::add_consumer (TAO_EC_ProxyPushSupplier* supplier)
+{
+  TAO_EC_Header_List *headers = 0;
+  ACE_NEW (headers, TAO_EC_Header_List);
+
+  // Compute the keys without holding our lock, exact_headers() uses
+  // the proxy lock.
+  int const simple = supplier->exact_headers (*headers);
+
+  ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+  if (this->remove_i (supplier) == 0)
+    {
+      // New in the table, the table keeps a reference.
+      supplier->_incr_refcnt ();
+    }
+
+  if (simple == 0 || headers->is_empty ())
+    {
+      delete headers;
+      this->complex_.insert (supplier);
+      return;
+    }
+
+  for (TAO_EC_Header_List::ITERATOR i (*headers); !i.done (); i.advance ())
+    {
+      RtecEventComm::EventHeader *header = 0;
+      i.next (header);
+      ACE_UINT64 const key = routing_key (*header);
+      Consumer_Set *set = 0;
+      if (this->routes_.find (key, set) == -1)
+        {
+          ACE_NEW (set, Consumer_Set);
+          this->routes_.bind (key, set);
+        }
+      set->insert (supplier);
+    }
+  this->simple_.bind (supplier, headers);
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::remove_consumer (TAO_EC_ProxyPushSupplier* supplier)
+{
+  {
+    ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+    if (this->remove_i (supplier) == 0)
+      return;
+  }
+  supplier->_decr_refcnt ();
+}
+
+int
+TAO_EC_Routing_Supplier_Filter::remove_i (TAO_EC_ProxyPushSupplier* supplier)
+{
+  if (this->complex_.remove (supplier) == 0)
+    return 1;
+
+  TAO_EC_Header_List *headers = 0;
+  if (this->simple_.unbind (supplier, headers) == -1)
+    return 0;
+
+  for (TAO_EC_Header_List::ITERATOR i (*headers); !i.done (); i.advance ())
+    {
+      RtecEventComm::EventHeader *header = 0;
+      i.next (header);
+      ACE_UINT64 const key = routing_key (*header);
+      Consumer_Set *set = 0;
+      if (this->routes_.find (key, set) == 0)
+        {
+          set->remove (supplier);
+          if (set->is_empty ())
+            {
+              this->routes_.unbind (key);
+              delete set;
+            }
+        }
+    }
+  delete headers;
+  return 1;
+}
+
+void
+TAO_EC_Routing_Supplier_Filter::clear (void)
+{
+  Consumer_Set released;
+  {
+    ACE_WRITE_GUARD (TAO_SYNCH_RW_MUTEX, ace_mon, this->lock_);
+
+    for (Consumer_Map::iterator i = this->simple_.begin ();
+         i != this->simple_.end ();
+         ++i)
+      {
+        released.insert ((*i).ext_id_);
+        delete (*i).int_id_;
+      }
+    this->simple_.unbind_all ();
+
+    for (Routing_Table::iterator i = this->routes_.begin ();
+         i != this->routes_.end ();
+         ++i)
+      {
+        delete (*i).int_id_;
+      }
+    this->routes_.unbind_all ();
+
+    Consumer_Set::iterator end = this->complex_.end ();
+    for (Consumer_Set::iterator i = this->complex_.begin (); i != end; ++i)
+      released.insert (*i);
+    this->complex_.reset ();
+  }
+
+  Consumer_Set::iterator end = released.end ();
+  for (Consumer_Set::iterator i = released.begin (); i != end; ++i)
+    (*i)->_decr_refcnt ();
+}
+
+ACE_UINT64
+TAO_EC_Routing_Supplier_Filter::routing_key (
+    const RtecEventComm::EventHeader& header)
+{
+  return (static_cast<ACE_UINT64> (static_cast<CORBA::ULong> (header.source)) << 32)
+    | static_cast<CORBA::ULong> (header.type);
+}
+
+// ****************************************************************
+
+TAO_EC_Routing_Supplier_Filter_Builder::
+  TAO_EC_Routing_Supplier_Filter_Builder (TAO_EC_Event_Channel_Base *ec)
+  :  filter_ (ec)
+{
+}
+
+TAO_EC_Supplier_Filter*
+TAO_EC_Routing_Supplier_Filter_Builder::create (
+    RtecEventChannelAdmin::SupplierQOS&)
+{
+  return &this->filter_;
+}
+
+void
+TAO_EC_Routing_Supplier_Filter_Builder::destroy (
+    TAO_EC_Supplier_Filter*)
+{
+}
+
+void
+TAO_EC_Routing_Supplier_Filter_Builder::connected (
+    TAO_EC_ProxyPushSupplier* supplier)
+{
+  this->filter_.add_consumer (supplier);
+}
+
+void
+TAO_EC_Routing_Supplier_Filter_Builder::reconnected (
+    TAO_EC_ProxyPushSupplier* supplier)
+{
+  // The subscriptions may have changed, add_consumer() replaces the
+  // previous entries.
+  this->filter_.add_consumer (supplier);
+}
+
+void
+TAO_EC_Routing_Supplier_Filter_Builder::disconnected (
+    TAO_EC_ProxyPushSupplier* supplier)
+{
+  this->filter_.remove_consumer (supplier);
+}
+
+void
+TAO_EC_Routing_Supplier_Filter_Builder::shutdown (void)
+{
+  this->filter_.clear ();
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
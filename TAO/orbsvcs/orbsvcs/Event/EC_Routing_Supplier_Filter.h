@@ -0,0 +1,166 @@
+// -*- C++ -*-
+
+/**
+ *  @file   EC_Routing_Supplier_Filter.h
+ *
+ *  A channel-wide supplier filter that routes events using a hash
+ *  table indexed by event source and type.
+ */
+
+#ifndef TAO_EC_ROUTING_SUPPLIER_FILTER_H
+#define TAO_EC_ROUTING_SUPPLIER_FILTER_H
+#include /**/ "ace/pre.h"
+
+#include "orbsvcs/Event/EC_Supplier_Filter.h"
+#include "orbsvcs/Event/EC_Supplier_Filter_Builder.h"
+#include "orbsvcs/Event/EC_Filter.h"
+#include /**/ "orbsvcs/Event/event_serv_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Unbounded_Set.h"
+#include "ace/Null_Mutex.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_EC_Event_Channel_Base;
+class TAO_EC_ProxyPushSupplier;
+
+/**
+ * @class TAO_EC_Routing_Supplier_Filter
+ *
+ * @brief Route events to the consumers using a (source,type) table.
+ *
+ * Most consumers subscribe to a disjunction of (source,type) pairs,
+ * evaluating the filter tree of every consumer for each event is
+ * wasteful in that case.
+ * This strategy keeps a single table for the event channel, mapping
+ * each (source,type) pair to the set of consumers that subscribe to
+ * it.  The table is updated as consumers connect and disconnect.
+ * Events are pushed directly to the consumers found in the table,
+ * bypassing their filter trees, the consumers with more complex
+ * subscriptions (wildcards, conjunctions, timeouts, bitmasks, etc.)
+ * are kept in a separate list and always use their filter trees.
+ * Events sets with more than one element, or events with wildcards
+ * in their header, fall back to the filter trees of all consumers.
+ *
+ * A single instance is shared by all the suppliers of the event
+ * channel.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Routing_Supplier_Filter
+  : public TAO_EC_Supplier_Filter
+{
+public:
+  /// Constructor
+  TAO_EC_Routing_Supplier_Filter (TAO_EC_Event_Channel_Base* ec);
+
+  /// Destructor
+  virtual ~TAO_EC_Routing_Supplier_Filter (void);
+
+  // = The TAO_EC_Supplier_Filter methods.
+  virtual void bind (TAO_EC_ProxyPushConsumer* consumer);
+  virtual void unbind (TAO_EC_ProxyPushConsumer* consumer);
+  virtual void connected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void reconnected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void disconnected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void shutdown (void);
+  virtual void push (const RtecEventComm::EventSet& event,
+                     TAO_EC_ProxyPushConsumer *consumer);
+  virtual void push_scheduled_event (RtecEventComm::EventSet &event,
+                                     const TAO_EC_QOS_Info &event_info);
+  virtual CORBA::ULong _decr_refcnt (void);
+  virtual CORBA::ULong _incr_refcnt (void);
+
+  /// Update the routing table when a consumer connects, reconnects or
+  /// disconnects from the event channel.
+  void add_consumer (TAO_EC_ProxyPushSupplier* supplier);
+  void remove_consumer (TAO_EC_ProxyPushSupplier* supplier);
+
+  /// Release all the consumers in the routing table.
+  void clear (void);
+
+private:
+  /// Compute the table key for a (source,type) pair.
+  static ACE_UINT64 routing_key (const RtecEventComm::EventHeader& header);
+
+  /// Remove @a supplier from the table, the caller holds the lock.
+  /// Returns 0 if @a supplier was not in the table.
+  int remove_i (TAO_EC_ProxyPushSupplier* supplier);
+
+private:
+  typedef ACE_Unbounded_Set<TAO_EC_ProxyPushSupplier*> Consumer_Set;
+
+  /// The consumers interested in each (source,type) pair.
+  typedef ACE_Hash_Map_Manager_Ex<ACE_UINT64,
+                                  Consumer_Set*,
+                                  ACE_Hash<ACE_UINT64>,
+                                  ACE_Equal_To<ACE_UINT64>,
+                                  ACE_Null_Mutex> Routing_Table;
+
+  /// The headers used to insert each consumer in the routing table,
+  /// the filter tree is already gone when the consumer disconnects so
+  /// the keys are saved here.
+  typedef ACE_Hash_Map_Manager_Ex<TAO_EC_ProxyPushSupplier*,
+                                  TAO_EC_Header_List*,
+                                  ACE_Pointer_Hash<TAO_EC_ProxyPushSupplier*>,
+                                  ACE_Equal_To<TAO_EC_ProxyPushSupplier*>,
+                                  ACE_Null_Mutex> Consumer_Map;
+
+  /// The event channel, used to locate the set of consumers.
+  TAO_EC_Event_Channel_Base *event_channel_;
+
+  /// Synchronize access to the tables, pushes only take a read lock.
+  TAO_SYNCH_RW_MUTEX lock_;
+
+  /// The routing table
+  Routing_Table routes_;
+
+  /// The simple consumers in the routing table
+  Consumer_Map simple_;
+
+  /// The consumers whose subscriptions cannot be expressed in the
+  /// routing table.
+  Consumer_Set complex_;
+};
+
+// ****************************************************************
+
+/**
+ * @class TAO_EC_Routing_Supplier_Filter_Builder
+ *
+ * @brief Create a single Routing_Supplier_Filter.
+ *
+ * This Factory creates a single Routing_Supplier_Filter that is used
+ * by all the suppliers (i.e. ProxyConsumers) of an event channel.
+ * The builder is informed of the consumers that connect to the event
+ * channel and keeps the filter routing table up to date.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Routing_Supplier_Filter_Builder
+  : public TAO_EC_Supplier_Filter_Builder
+{
+public:
+  /// constructor....
+  TAO_EC_Routing_Supplier_Filter_Builder (TAO_EC_Event_Channel_Base* ec);
+
+  // = The TAO_EC_Supplier_Filter_Builder methods...
+  virtual TAO_EC_Supplier_Filter*
+      create (RtecEventChannelAdmin::SupplierQOS& qos);
+  virtual void
+      destroy (TAO_EC_Supplier_Filter *filter);
+  virtual void connected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void reconnected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void disconnected (TAO_EC_ProxyPushSupplier* supplier);
+  virtual void shutdown (void);
+
+private:
+  /// The filter....
+  TAO_EC_Routing_Supplier_Filter filter_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_EC_ROUTING_SUPPLIER_FILTER_H */
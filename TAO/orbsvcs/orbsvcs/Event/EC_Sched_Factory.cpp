@@ -46,6 +46,10 @@ TAO_EC_Sched_Factory::init (int argc, ACE_TCHAR* argv[])
                 {
                   this->dispatching_ = 1;
                 }
+              else if (ACE_OS::strcasecmp (opt, ACE_TEXT("serial")) == 0)
+                {
+                  this->dispatching_ = 3;
+                }
               else if (ACE_OS::strcasecmp (opt, ACE_TEXT("priority")) == 0)
                 {
                   this->dispatching_ = 2;
@@ -0,0 +1,356 @@
+#include "orbsvcs/Log_Macros.h"
+#include "orbsvcs/Event/EC_Serial_Dispatching.h"
+#include "orbsvcs/Event/EC_ProxySupplier.h"
+
+#include "tao/ORB_Constants.h"
+#include "ace/Numeric_Limits.h"
+
+#if !defined (TAO_EC_SERIAL_DISPATCHING_DEFAULT_MAP_SIZE)
+#define TAO_EC_SERIAL_DISPATCHING_DEFAULT_MAP_SIZE 1024
+#endif
+
+/// The maximum number of events delivered to one consumer before
+/// giving other consumers a chance to run.
+#if !defined (TAO_EC_SERIAL_DISPATCHING_BATCH)
+#define TAO_EC_SERIAL_DISPATCHING_BATCH 16
+#endif
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_EC_Serial_Queue::TAO_EC_Serial_Queue (TAO_EC_ProxyPushSupplier *proxy)
+  : proxy_ (proxy),
+    head_ (0),
+    tail_ (0),
+    count_ (0)
+{
+}
+
+// ****************************************************************
+
+TAO_EC_Serial_Run_Command::TAO_EC_Serial_Run_Command (
+    TAO_EC_Serial_Dispatching *dispatching,
+    TAO_EC_Serial_Queue *queue)
+  : dispatching_ (dispatching),
+    queue_ (queue)
+{
+}
+
+int
+TAO_EC_Serial_Run_Command::execute (void)
+{
+  this->dispatching_->run (this->queue_);
+  return 0;
+}
+
+// ****************************************************************
+
+TAO_EC_Serial_Dispatching::TAO_EC_Serial_Dispatching (
+    int nthreads,
+    int thread_creation_flags,
+    int thread_priority,
+    int force_activate,
+    TAO_EC_Queue_Full_Service_Object* so,
+    size_t queue_hwm)
+  :  nthreads_ (nthreads),
+     thread_creation_flags_ (thread_creation_flags),
+     thread_priority_ (thread_priority),
+     force_activate_ (force_activate),
+     task_ (0, 0),
+     queues_ (TAO_EC_SERIAL_DISPATCHING_DEFAULT_MAP_SIZE),
+     allocator_ (ACE_Allocator::instance ()),
+     drained_ (lock_),
+     queue_hwm_ (queue_hwm),
+     shutdown_ (false),
+     active_ (0),
+     queue_full_service_object_ (so)
+{
+  // The pool queue holds at most one entry per consumer, the
+  // per-consumer limit is enforced in push_nocopy().
+  this->task_.msg_queue ()->high_water_mark (
+    ACE_Numeric_Limits<size_t>::max ());
+  this->task_.open (&this->thread_manager_);
+}
+
+TAO_EC_Serial_Dispatching::~TAO_EC_Serial_Dispatching (void)
+{
+  // Any queue left here was scheduled after the threads exited, the
+  // run commands died with the pool queue.
+  for (MAPTYPE::iterator i = this->queues_.begin ();
+       i != this->queues_.end ();
+       ++i)
+    {
+      TAO_EC_Serial_Queue *queue = (*i).int_id_;
+      TAO_EC_Serial_Dispatching::release_chain (queue->head_);
+      delete queue;
+    }
+  this->queues_.unbind_all ();
+}
+
+void
+TAO_EC_Serial_Dispatching::activate (void)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  if (this->active_ != 0)
+    return;
+
+  this->active_ = 1;
+
+  if (this->task_.activate (this->thread_creation_flags_,
+                            this->nthreads_,
+                            1,
+                            this->thread_priority_) == -1)
+    {
+      if (this->force_activate_ != 0)
+        {
+          ORBSVCS_DEBUG ((LM_DEBUG,
+                      "EC (%P|%t) activating serial dispatching pool at"
+                      " default priority\n"));
+          if (this->task_.activate (THR_BOUND, this->nthreads_) == -1)
+            ORBSVCS_ERROR ((LM_ERROR,
+                        "EC (%P|%t) cannot activate serial dispatching pool.\n"));
+        }
+    }
+}
+
+void
+TAO_EC_Serial_Dispatching::shutdown (void)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    if (this->active_ == 0)
+      return;
+
+    // Release the suppliers waiting for a queue to drain.
+    this->shutdown_ = true;
+    this->drained_.broadcast ();
+  }
+
+  // The pool threads need the lock to finish their current batch, do
+  // not hold it while waiting for them.
+  for (int i = 0; i < this->nthreads_; ++i)
+    {
+      this->task_.putq (new TAO_EC_Shutdown_Task_Command);
+    }
+  this->thread_manager_.wait ();
+}
+
+void
+TAO_EC_Serial_Dispatching::push (TAO_EC_ProxyPushSupplier* proxy,
+                                 RtecEventComm::PushConsumer_ptr consumer,
+                                 const RtecEventComm::EventSet& event,
+                                 TAO_EC_QOS_Info& qos_info)
+{
+  RtecEventComm::EventSet event_copy = event;
+  this->push_nocopy (proxy, consumer, event_copy, qos_info);
+}
+
+void
+TAO_EC_Serial_Dispatching::push_nocopy (TAO_EC_ProxyPushSupplier* proxy,
+                                        RtecEventComm::PushConsumer_ptr consumer,
+                                        RtecEventComm::EventSet& event,
+                                        TAO_EC_QOS_Info&)
+{
+  // Double checked locking....
+  if (this->active_ == 0)
+    this->activate ();
+
+  TAO_EC_Serial_Queue *ready = 0;
+  bool full = false;
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    full = this->queue_full_service_object_ != 0 && this->is_full_i (proxy);
+    if (!full)
+      ready = this->enqueue_i (proxy, consumer, event);
+  }
+
+  if (full)
+    {
+      // The service object may block or push back into the EC, do not
+      // call it with the lock held.
+      int const action =
+        this->queue_full_service_object_->queue_full_action (&this->task_,
+                                                             proxy,
+                                                             consumer,
+                                                             event);
+      if (action == TAO_EC_Queue_Full_Service_Object::SILENTLY_DISCARD)
+        return;
+
+      // WAIT_TO_EMPTY: wait until the pool threads drain the queue,
+      // unless we are one of them, only this thread could drain it
+      // then.
+      bool const in_pool = this->thread_manager_.task () == &this->task_;
+
+      ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+      while (!in_pool && !this->shutdown_ && this->is_full_i (proxy))
+        {
+          this->drained_.wait ();
+        }
+
+      ready = this->enqueue_i (proxy, consumer, event);
+    }
+
+  if (ready != 0)
+    this->schedule (ready);
+}
+
+TAO_EC_Serial_Queue *
+TAO_EC_Serial_Dispatching::enqueue_i (TAO_EC_ProxyPushSupplier* proxy,
+                                      RtecEventComm::PushConsumer_ptr consumer,
+                                      RtecEventComm::EventSet& event)
+{
+  TAO_EC_Serial_Queue *ready = 0;
+  TAO_EC_Serial_Queue *queue = 0;
+  if (this->queues_.find (proxy, queue) == -1)
+    {
+      ACE_NEW_THROW_EX (queue,
+                        TAO_EC_Serial_Queue (proxy),
+                        CORBA::NO_MEMORY (TAO::VMCID,
+                                          CORBA::COMPLETED_NO));
+      if (this->queues_.bind (proxy, queue) == -1)
+        {
+          delete queue;
+          throw CORBA::NO_MEMORY (TAO::VMCID, CORBA::COMPLETED_NO);
+        }
+      // A new queue is not in the pool yet, schedule it once the
+      // event is appended.
+      ready = queue;
+    }
+
+  void* buf = this->allocator_->malloc (sizeof (TAO_EC_Push_Command));
+
+  if (buf == 0)
+    {
+      if (ready != 0)
+        {
+          this->queues_.unbind (proxy);
+          delete ready;
+        }
+      throw CORBA::NO_MEMORY (TAO::VMCID, CORBA::COMPLETED_NO);
+    }
+
+  ACE_Message_Block *mb =
+    new (buf) TAO_EC_Push_Command (proxy,
+                                   consumer,
+                                   event,
+                                   this->data_block_.duplicate (),
+                                   this->allocator_);
+
+  if (queue->tail_ == 0)
+    queue->head_ = mb;
+  else
+    queue->tail_->next (mb);
+  queue->tail_ = mb;
+  ++queue->count_;
+
+  return ready;
+}
+
+bool
+TAO_EC_Serial_Dispatching::is_full_i (TAO_EC_ProxyPushSupplier* proxy)
+{
+  TAO_EC_Serial_Queue *queue = 0;
+  return this->queues_.find (proxy, queue) == 0
+    && queue->count_ >= this->queue_hwm_;
+}
+
+void
+TAO_EC_Serial_Dispatching::run (TAO_EC_Serial_Queue *queue)
+{
+  ACE_Message_Block *batch = 0;
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    // Detach up to TAO_EC_SERIAL_DISPATCHING_BATCH commands, new
+    // events are appended to the queue while we deliver these.
+    batch = queue->head_;
+    ACE_Message_Block *last = batch;
+    for (size_t n = 1;
+         n < TAO_EC_SERIAL_DISPATCHING_BATCH && last->next () != 0;
+         ++n)
+      {
+        last = last->next ();
+      }
+    queue->head_ = last->next ();
+    if (queue->head_ == 0)
+      queue->tail_ = 0;
+    last->next (0);
+  }
+
+  size_t delivered = 0;
+  while (batch != 0)
+    {
+      ACE_Message_Block *mb = batch;
+      batch = batch->next ();
+      mb->next (0);
+      ++delivered;
+
+      try
+        {
+          TAO_EC_Dispatch_Command *command =
+            dynamic_cast<TAO_EC_Dispatch_Command*> (mb);
+          if (command != 0)
+            command->execute ();
+        }
+      catch (const CORBA::Exception& ex)
+        {
+          ex._tao_print_exception ("EC (%P|%t) exception in serial dispatching");
+        }
+
+      ACE_Message_Block::release (mb);
+    }
+
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    // Wake up the suppliers waiting for this queue to drain.
+    if (queue->count_ >= this->queue_hwm_)
+      this->drained_.broadcast ();
+
+    queue->count_ -= delivered;
+    if (queue->head_ == 0)
+      {
+        // Nothing else arrived, the next push for this consumer will
+        // create (and schedule) a new queue.
+        this->queues_.unbind (queue->proxy_);
+        delete queue;
+        return;
+      }
+  }
+
+  // More events arrived, go to the back of the line.
+  this->schedule (queue);
+}
+
+void
+TAO_EC_Serial_Dispatching::schedule (TAO_EC_Serial_Queue *queue)
+{
+  ACE_Message_Block *mb = 0;
+  ACE_NEW (mb,
+           TAO_EC_Serial_Run_Command (this, queue));
+
+  if (this->task_.putq (mb) == -1)
+    {
+      ORBSVCS_ERROR ((LM_ERROR,
+                  "EC (%P|%t) cannot schedule consumer in serial "
+                  "dispatching pool\n"));
+      ACE_Message_Block::release (mb);
+    }
+}
+
+void
+TAO_EC_Serial_Dispatching::release_chain (ACE_Message_Block *mb)
+{
+  while (mb != 0)
+    {
+      ACE_Message_Block *next = mb->next ();
+      mb->next (0);
+      ACE_Message_Block::release (mb);
+      mb = next;
+    }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,224 @@
+// -*- C++ -*-
+
+/**
+ *  @file   EC_Serial_Dispatching.h
+ *
+ *  Dispatching strategy that multiplexes many consumers onto a fixed
+ *  pool of threads while preserving per-consumer ordering.
+ */
+
+#ifndef TAO_EC_SERIAL_DISPATCHING_H
+#define TAO_EC_SERIAL_DISPATCHING_H
+#include /**/ "ace/pre.h"
+
+#include "ace/Hash_Map_Manager_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/Condition_Thread_Mutex.h"
+
+#include "orbsvcs/Event/EC_Dispatching.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "orbsvcs/Event/EC_Dispatching_Task.h"
+
+/// The default number of pending events for a single consumer above
+/// which the queue full service object is consulted.
+#if !defined (TAO_EC_SERIAL_QUEUE_HWM)
+#define TAO_EC_SERIAL_QUEUE_HWM 16384
+#endif
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_EC_Serial_Dispatching;
+
+/**
+ * @class TAO_EC_Serial_Queue
+ *
+ * @brief The pending events for a single consumer.
+ *
+ * Each consumer with events in flight owns one of these queues.  At
+ * most one pool thread drains a given queue at any time, which is
+ * what keeps the events for one consumer in FIFO order even though
+ * the pool is shared.  The queue only exists while it has pending
+ * events, so idle consumers cost nothing.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Serial_Queue
+{
+public:
+  /// Constructor
+  TAO_EC_Serial_Queue (TAO_EC_ProxyPushSupplier *proxy);
+
+  /// The proxy whose events are serialized by this queue.
+  TAO_EC_ProxyPushSupplier *proxy_;
+
+  /// The pending push commands, chained through
+  /// ACE_Message_Block::next().
+  ACE_Message_Block *head_;
+  ACE_Message_Block *tail_;
+
+  /// The number of pending commands.
+  size_t count_;
+};
+
+/**
+ * @class TAO_EC_Serial_Run_Command
+ *
+ * @brief Drain (part of) a TAO_EC_Serial_Queue in a pool thread.
+ *
+ * One of these commands is in the pool queue for each consumer that
+ * has pending events.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Serial_Run_Command
+  : public TAO_EC_Dispatch_Command
+{
+public:
+  /// Constructor
+  TAO_EC_Serial_Run_Command (TAO_EC_Serial_Dispatching *dispatching,
+                             TAO_EC_Serial_Queue *queue);
+
+  /// Command callback
+  virtual int execute (void);
+
+private:
+  /// The dispatching strategy that owns @a queue_
+  TAO_EC_Serial_Dispatching *dispatching_;
+
+  /// The queue to drain
+  TAO_EC_Serial_Queue *queue_;
+};
+
+/**
+ * @class TAO_EC_Serial_Dispatching
+ *
+ * @brief Dispatching strategy that keeps per-consumer ordering on a
+ * shared pool of threads.
+ *
+ * The TAO_EC_MT_Dispatching strategy uses a single queue serviced by
+ * several threads, consequently two events for the same consumer can
+ * be delivered concurrently and out of order.  The
+ * TAO_EC_TPC_Dispatching strategy preserves ordering but uses one
+ * thread per consumer, which does not scale to large numbers of
+ * consumers.
+ * This strategy uses a fixed pool of threads, each consumer gets a
+ * serial queue of pending events, and the queue (not the individual
+ * events) is scheduled on the pool.  A consumer is serviced by at most
+ * one thread at a time; after a batch of events it is sent to the
+ * back of the pool queue so a busy consumer cannot starve the others.
+ * When a consumer has @a queue_hwm pending events the queue full
+ * service object decides whether the supplier discards the event or
+ * waits until the pool threads drain the queue below that mark.
+ */
+class TAO_RTEvent_Serv_Export TAO_EC_Serial_Dispatching
+  : public TAO_EC_Dispatching
+{
+public:
+  /// Constructor
+  /// It will create @a nthreads servicing threads...
+  TAO_EC_Serial_Dispatching (int nthreads,
+                             int thread_creation_flags,
+                             int thread_priority,
+                             int force_activate,
+                             TAO_EC_Queue_Full_Service_Object* so,
+                             size_t queue_hwm = TAO_EC_SERIAL_QUEUE_HWM);
+
+  /// Destructor
+  ~TAO_EC_Serial_Dispatching (void);
+
+  // = The EC_Dispatching methods.
+  virtual void activate (void);
+  virtual void shutdown (void);
+  virtual void push (TAO_EC_ProxyPushSupplier* proxy,
+                     RtecEventComm::PushConsumer_ptr consumer,
+                     const RtecEventComm::EventSet& event,
+                     TAO_EC_QOS_Info& qos_info);
+  virtual void push_nocopy (TAO_EC_ProxyPushSupplier* proxy,
+                            RtecEventComm::PushConsumer_ptr consumer,
+                            RtecEventComm::EventSet& event,
+                            TAO_EC_QOS_Info& qos_info);
+
+  /// Deliver the next batch of events in @a queue, called from the
+  /// pool threads.
+  void run (TAO_EC_Serial_Queue *queue);
+
+private:
+  /// Put a run command for @a queue at the end of the pool queue.
+  void schedule (TAO_EC_Serial_Queue *queue);
+
+  /// Append a push command for @a proxy to its serial queue, must be
+  /// called with the lock held.  Returns the queue if it was created
+  /// and must be scheduled, 0 otherwise.
+  TAO_EC_Serial_Queue *enqueue_i (TAO_EC_ProxyPushSupplier* proxy,
+                                  RtecEventComm::PushConsumer_ptr consumer,
+                                  RtecEventComm::EventSet& event);
+
+  /// Return true if the queue for @a proxy has reached the high water
+  /// mark, must be called with the lock held.
+  bool is_full_i (TAO_EC_ProxyPushSupplier* proxy);
+
+  /// Release all the commands chained starting at @a mb
+  static void release_chain (ACE_Message_Block *mb);
+
+private:
+  /// Use our own thread manager.
+  ACE_Thread_Manager thread_manager_;
+
+  /// The number of active tasks
+  int nthreads_;
+
+  /// The flags (THR_BOUND, THR_NEW_LWP, etc.) used to create the
+  /// dispatching threads.
+  int thread_creation_flags_;
+
+  /// The priority of the dispatching threads.
+  int thread_priority_;
+
+  /// If activation at the requested priority fails then we fallback on
+  /// the defaults for thread activation.
+  int force_activate_;
+
+  /// The pool of threads, its queue contains the consumers ready to
+  /// run.
+  TAO_EC_Dispatching_Task task_;
+
+  typedef ACE_Hash_Map_Manager_Ex<TAO_EC_ProxyPushSupplier*,
+                                  TAO_EC_Serial_Queue*,
+                                  ACE_Pointer_Hash<TAO_EC_ProxyPushSupplier*>,
+                                  ACE_Equal_To<TAO_EC_ProxyPushSupplier*>,
+                                  ACE_Null_Mutex> MAPTYPE;
+
+  /// The consumers with pending events.
+  MAPTYPE queues_;
+
+  /// Allocator and data block used for the push commands
+  ACE_Allocator *allocator_;
+  ACE_Locked_Data_Block<ACE_Lock_Adapter<TAO_SYNCH_MUTEX> > data_block_;
+
+  /// Synchronize access to internal data, it protects the map as well
+  /// as the contents of each serial queue.
+  TAO_SYNCH_MUTEX lock_;
+
+  /// Signaled when the pool threads drain a queue that was at the
+  /// high water mark, and on shutdown.
+  TAO_SYNCH_CONDITION drained_;
+
+  /// The number of pending events for a single consumer above which
+  /// the queue full service object is consulted.
+  size_t queue_hwm_;
+
+  /// Set once shutdown() starts, suppliers stop waiting for the
+  /// queues to drain.
+  bool shutdown_;
+
+  /// Are the threads running?
+  int active_;
+
+  /// Invoked when the queue for a single consumer is full.
+  TAO_EC_Queue_Full_Service_Object* queue_full_service_object_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_EC_SERIAL_DISPATCHING_H */
@@ -20,6 +20,7 @@ void
 TAO_EC_Filter_Worker::work (TAO_EC_ProxyPushSupplier *supplier)
 {
   TAO_EC_QOS_Info qos_info = this->event_info_;
+  qos_info.marshaled_event_ = &this->marshaled_event_;
   supplier->filter (this->event_, qos_info);
 }
 
@@ -18,6 +18,7 @@
 
 #include "orbsvcs/RtecEventCommC.h"
 #include "orbsvcs/ESF/ESF_Worker.h"
+#include "orbsvcs/Event/EC_Marshaled_Event_Set.h"
 
 #include /**/ "orbsvcs/Event/event_serv_export.h"
 
@@ -130,6 +131,9 @@ private:
 
   /// The QoS info propagated on each event.
   const TAO_EC_QOS_Info &event_info_;
+
+  /// The encoding of the event, shared by all the consumers.
+  TAO_EC_Marshaled_Event_Set marshaled_event_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
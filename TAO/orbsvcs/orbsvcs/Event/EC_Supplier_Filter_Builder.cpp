@@ -8,4 +8,24 @@ TAO_EC_Supplier_Filter_Builder::~TAO_EC_Supplier_Filter_Builder (void)
 {
 }
 
+void
+TAO_EC_Supplier_Filter_Builder::connected (TAO_EC_ProxyPushSupplier *)
+{
+}
+
+void
+TAO_EC_Supplier_Filter_Builder::reconnected (TAO_EC_ProxyPushSupplier *)
+{
+}
+
+void
+TAO_EC_Supplier_Filter_Builder::disconnected (TAO_EC_ProxyPushSupplier *)
+{
+}
+
+void
+TAO_EC_Supplier_Filter_Builder::shutdown (void)
+{
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -28,6 +28,7 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 class TAO_EC_Supplier_Filter;
 class TAO_EC_ProxyPushConsumer;
+class TAO_EC_ProxyPushSupplier;
 
 /**
  * @class TAO_EC_Supplier_Filter_Builder
@@ -54,6 +55,20 @@ public:
   /// The user is returning the filter for destruction/recycling.
   virtual void
       destroy (TAO_EC_Supplier_Filter *filter) = 0;
+
+  /**
+   * The event channel informs the builder about all the consumers
+   * that connect, reconnect or disconnect, builders that keep
+   * channel-wide data structures use this to update them.  The
+   * default implementation does nothing.
+   */
+  virtual void connected (TAO_EC_ProxyPushSupplier *supplier);
+  virtual void reconnected (TAO_EC_ProxyPushSupplier *supplier);
+  virtual void disconnected (TAO_EC_ProxyPushSupplier *supplier);
+
+  /// The event channel is shutting down, the default implementation
+  /// does nothing.
+  virtual void shutdown (void);
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
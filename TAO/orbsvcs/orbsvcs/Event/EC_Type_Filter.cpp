@@ -110,6 +110,16 @@ TAO_EC_Type_Filter::add_dependencies (
   return this->can_match (header);
 }
 
+int
+TAO_EC_Type_Filter::exact_headers (TAO_EC_Header_List& headers) const
+{
+  if (this->header_.source == 0 || this->header_.type == 0)
+    return 0;
+  if (headers.enqueue_tail (this->header_) == -1)
+    return 0;
+  return 1;
+}
+
 int
 TAO_EC_Type_Filter::filter_set (const RtecEventComm::EventSet& event,
                                 TAO_EC_QOS_Info& qos_info)
@@ -0,0 +1,392 @@
+#include "orbsvcs/Log_Macros.h"
+#include "orbsvcs/Notify/MIOP/Federation_Receiver.h"
+
+#include "ace/OS_NS_sys_time.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_Notify_Federation_Peer::TAO_Notify_Federation_Peer (
+    NotifyFederation::SequenceNumber next)
+  : next_ (next),
+    nak_next_ (0)
+{
+}
+
+// ****************************************************************
+
+TAO_Notify_Federation_Receiver::TAO_Notify_Federation_Receiver (
+    CORBA::ULong id,
+    size_t max_pending)
+  : id_ (id),
+    max_pending_ (max_pending),
+    flushing_ (false),
+    delivered_ (0),
+    lost_ (0)
+{
+}
+
+TAO_Notify_Federation_Receiver::~TAO_Notify_Federation_Receiver (void)
+{
+  for (Peer_Map::iterator i = this->peers_.begin ();
+       i != this->peers_.end ();
+       ++i)
+    {
+      delete (*i).int_id_;
+    }
+
+  CosNotification::StructuredEvent *event = 0;
+  while (this->ready_.dequeue_head (event) == 0)
+    {
+      delete event;
+    }
+}
+
+void
+TAO_Notify_Federation_Receiver::init (
+    CosNotifyChannelAdmin::EventChannel_ptr channel)
+{
+  if (CORBA::is_nil (channel))
+    {
+      ORBSVCS_ERROR ((LM_ERROR, "TAO_Notify_Federation_Receiver::init(): "
+                      "nil channel.\n"));
+      throw CORBA::BAD_PARAM ();
+    }
+
+  CosNotifyChannelAdmin::SupplierAdmin_var admin =
+    channel->default_supplier_admin ();
+
+  CosNotifyChannelAdmin::ProxyID proxy_id;
+  CosNotifyChannelAdmin::ProxyConsumer_var proxy =
+    admin->obtain_notification_push_consumer (
+      CosNotifyChannelAdmin::STRUCTURED_EVENT, proxy_id);
+
+  this->consumer_ =
+    CosNotifyChannelAdmin::StructuredProxyPushConsumer::_narrow (proxy.in ());
+
+  // We do not need to hear about subscription changes.
+  this->consumer_->connect_structured_push_supplier (
+    CosNotifyComm::StructuredPushSupplier::_nil ());
+}
+
+void
+TAO_Notify_Federation_Receiver::join (PortableGroup::GOA_ptr goa,
+                                      CORBA::Object_ptr group)
+{
+  this->goa_ = PortableGroup::GOA::_duplicate (goa);
+  this->oid_ = goa->create_id_for_reference (group);
+  goa->activate_object_with_id (this->oid_.in (), this);
+}
+
+void
+TAO_Notify_Federation_Receiver::shutdown (void)
+{
+  if (!CORBA::is_nil (this->goa_.in ()))
+    {
+      try
+        {
+          this->goa_->deactivate_object (this->oid_.in ());
+        }
+      catch (const CORBA::Exception&)
+        {
+          // The GOA is being destroyed.
+        }
+      this->goa_ = PortableGroup::GOA::_nil ();
+    }
+
+  CosNotifyChannelAdmin::StructuredProxyPushConsumer_var consumer;
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+    consumer = this->consumer_._retn ();
+  }
+
+  if (!CORBA::is_nil (consumer.in ()))
+    {
+      try
+        {
+          consumer->disconnect_structured_push_consumer ();
+        }
+      catch (const CORBA::Exception&)
+        {
+          // The channel may be gone already.
+        }
+    }
+}
+
+CORBA::ULongLong
+TAO_Notify_Federation_Receiver::delivered (void) const
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, 0);
+  return this->delivered_;
+}
+
+CORBA::ULongLong
+TAO_Notify_Federation_Receiver::lost_count (void) const
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, 0);
+  return this->lost_;
+}
+
+void
+TAO_Notify_Federation_Receiver::push_structured_events (
+    CORBA::ULong sender,
+    NotifyFederation::SequenceNumber first,
+    const CosNotification::EventBatch &events)
+{
+  Nak nak;
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    Peer *peer = this->peer_i (sender, first);
+    if (peer == 0)
+      return;
+
+    for (CORBA::ULong i = 0; i != events.length (); ++i)
+      {
+        NotifyFederation::SequenceNumber const seq = first + i;
+        if (seq < peer->next_)
+          {
+            // A retransmission requested by another receiver.
+            continue;
+          }
+
+        if (seq == peer->next_)
+          {
+            this->deliver_i (events[i]);
+            ++peer->next_;
+          }
+        else if (peer->pending_.current_size () < this->max_pending_)
+          {
+            peer->pending_.bind (seq, events[i]);
+          }
+      }
+
+    this->drain_i (*peer);
+
+    if (peer->pending_.current_size () != 0)
+      {
+        NotifyFederation::SequenceNumber const ahead =
+          (*peer->pending_.begin ()).key ();
+        this->nak_i (sender, *peer, ahead - 1, nak);
+      }
+  }
+
+  // Ask for the missing events before pushing the ones we have.
+  this->send_nak (nak);
+  this->flush ();
+}
+
+void
+TAO_Notify_Federation_Receiver::announce (CORBA::ULong sender,
+                                          NotifyFederation::SequenceNumber next,
+                                          NotifyFederation::Repair_ptr repair)
+{
+  Nak nak;
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    Peer *peer = this->peer_i (sender, next);
+    if (peer == 0)
+      return;
+
+    if (next == 1 && peer->next_ != 1)
+      {
+        // The sender was restarted.
+        peer->next_ = 1;
+        peer->pending_.close ();
+        peer->nak_next_ = 0;
+      }
+
+    peer->repair_ = NotifyFederation::Repair::_duplicate (repair);
+
+    // Either a gap we already know about, or the last events sent
+    // were lost.
+    NotifyFederation::SequenceNumber last = next - 1;
+    if (peer->pending_.current_size () != 0)
+      last = (*peer->pending_.begin ()).key () - 1;
+    this->nak_i (sender, *peer, last, nak);
+  }
+
+  this->send_nak (nak);
+}
+
+void
+TAO_Notify_Federation_Receiver::lost (CORBA::ULong sender,
+                                      NotifyFederation::SequenceNumber first,
+                                      NotifyFederation::SequenceNumber last)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    Peer *peer = this->peer_i (sender, first);
+    if (peer == 0 || first > peer->next_ || last < peer->next_)
+      {
+        // Nothing we are waiting for, or some of the earlier events
+        // can still be repaired.
+        return;
+      }
+
+    if (TAO_debug_level > 0)
+      ORBSVCS_DEBUG ((LM_WARNING,
+                      "TAO_Notify_Federation_Receiver (%u): "
+                      "sender %u lost events %Q to %Q\n",
+                      this->id_, sender, peer->next_, last));
+
+    while (peer->pending_.current_size () != 0)
+      {
+        NotifyFederation::SequenceNumber const seq =
+          (*peer->pending_.begin ()).key ();
+        if (seq > last)
+          break;
+        peer->pending_.unbind (seq);
+      }
+
+    this->lost_ += last - peer->next_ + 1;
+    peer->next_ = last + 1;
+
+    this->drain_i (*peer);
+  }
+
+  this->flush ();
+}
+
+TAO_Notify_Federation_Receiver::Peer *
+TAO_Notify_Federation_Receiver::peer_i (CORBA::ULong sender,
+                                        NotifyFederation::SequenceNumber next)
+{
+  Peer *peer = 0;
+  if (this->peers_.find (sender, peer) == 0)
+    return peer;
+
+  // Join the stream at the first event we see.
+  ACE_NEW_RETURN (peer, Peer (next), 0);
+  if (this->peers_.bind (sender, peer) != 0)
+    {
+      delete peer;
+      return 0;
+    }
+  return peer;
+}
+
+void
+TAO_Notify_Federation_Receiver::drain_i (Peer &peer)
+{
+  while (peer.pending_.current_size () != 0)
+    {
+      Peer::Pending::ENTRY *entry = 0;
+      if (peer.pending_.find (peer.next_, entry) != 0)
+        break;
+
+      this->deliver_i (entry->item ());
+      peer.pending_.unbind (peer.next_);
+      ++peer.next_;
+    }
+}
+
+void
+TAO_Notify_Federation_Receiver::deliver_i (
+    const CosNotification::StructuredEvent &event)
+{
+  CosNotification::StructuredEvent *copy = 0;
+  ACE_NEW (copy, CosNotification::StructuredEvent (event));
+
+  if (this->ready_.enqueue_tail (copy) != 0)
+    delete copy;
+}
+
+void
+TAO_Notify_Federation_Receiver::flush (void)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    // The thread that is pushing the events pushes ours too, after
+    // the ones queued before them.
+    if (this->flushing_)
+      return;
+    this->flushing_ = true;
+  }
+
+  for (;;)
+    {
+      CosNotification::StructuredEvent *event = 0;
+      CosNotifyChannelAdmin::StructuredProxyPushConsumer_var consumer;
+      {
+        ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+        if (this->ready_.dequeue_head (event) != 0)
+          {
+            this->flushing_ = false;
+            return;
+          }
+
+        ++this->delivered_;
+        consumer =
+          CosNotifyChannelAdmin::StructuredProxyPushConsumer::_duplicate (
+            this->consumer_.in ());
+      }
+
+      if (!CORBA::is_nil (consumer.in ()))
+        {
+          try
+            {
+              consumer->push_structured_event (*event);
+            }
+          catch (const CORBA::Exception& ex)
+            {
+              if (TAO_debug_level > 0)
+                ex._tao_print_exception (
+                  "TAO_Notify_Federation_Receiver::deliver");
+            }
+        }
+
+      delete event;
+    }
+}
+
+void
+TAO_Notify_Federation_Receiver::nak_i (CORBA::ULong sender,
+                                       Peer &peer,
+                                       NotifyFederation::SequenceNumber last,
+                                       Nak &nak)
+{
+  if (CORBA::is_nil (peer.repair_.in ()) || last < peer.next_)
+    return;
+
+  ACE_Time_Value const now = ACE_OS::gettimeofday ();
+  if (peer.nak_next_ == peer.next_
+      && now - peer.nak_time_
+           < ACE_Time_Value (0, TAO_NOTIFY_FEDERATION_NAK_INTERVAL))
+    return;
+
+  peer.nak_next_ = peer.next_;
+  peer.nak_time_ = now;
+
+  if (TAO_debug_level > 1)
+    ORBSVCS_DEBUG ((LM_DEBUG,
+                    "TAO_Notify_Federation_Receiver (%u): "
+                    "NAK %Q to %Q from sender %u\n",
+                    this->id_, peer.next_, last, sender));
+
+  nak.repair_ = NotifyFederation::Repair::_duplicate (peer.repair_.in ());
+  nak.first_ = peer.next_;
+  nak.last_ = last;
+}
+
+void
+TAO_Notify_Federation_Receiver::send_nak (const Nak &nak)
+{
+  if (CORBA::is_nil (nak.repair_.in ()))
+    return;
+
+  try
+    {
+      nak.repair_->nak (this->id_, nak.first_, nak.last_);
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      if (TAO_debug_level > 0)
+        ex._tao_print_exception ("TAO_Notify_Federation_Receiver::nak");
+    }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,211 @@
+// -*- C++ -*-
+
+/**
+ *  @file   Federation_Receiver.h
+ *
+ *  Receive structured events from a MIOP group and push them into a
+ *  local Notification Service channel.
+ */
+
+#ifndef TAO_NOTIFY_FEDERATION_RECEIVER_H
+#define TAO_NOTIFY_FEDERATION_RECEIVER_H
+#include /**/ "ace/pre.h"
+
+#include "orbsvcs/Notify/MIOP/notify_miop_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "orbsvcs/Notify/MIOP/NotifyFederationS.h"
+#include "orbsvcs/CosNotifyChannelAdminC.h"
+#include "orbsvcs/PortableGroup/GOA.h"
+
+#include "ace/RB_Tree.h"
+#include "ace/Map_Manager.h"
+#include "ace/Unbounded_Queue.h"
+#include "ace/Functor_T.h"
+#include "ace/Null_Mutex.h"
+#include "ace/Time_Value.h"
+
+#ifndef TAO_NOTIFY_FEDERATION_MAX_PENDING
+/// The maximum number of out of order events kept for each sender
+# define TAO_NOTIFY_FEDERATION_MAX_PENDING 1024
+#endif /* TAO_NOTIFY_FEDERATION_MAX_PENDING */
+
+#ifndef TAO_NOTIFY_FEDERATION_NAK_INTERVAL
+/// The minimum number of microseconds between two NAKs for the same
+/// gap.
+# define TAO_NOTIFY_FEDERATION_NAK_INTERVAL 50000
+#endif /* TAO_NOTIFY_FEDERATION_NAK_INTERVAL */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_Notify_Federation_Peer
+ *
+ * @brief The state of a sender, as seen by a receiver.
+ */
+class TAO_Notify_MIOP_Export TAO_Notify_Federation_Peer
+{
+public:
+  typedef ACE_RB_Tree<NotifyFederation::SequenceNumber,
+                      CosNotification::StructuredEvent,
+                      ACE_Less_Than<NotifyFederation::SequenceNumber>,
+                      ACE_Null_Mutex> Pending;
+
+  /// Constructor, the first event expected is @a next
+  TAO_Notify_Federation_Peer (NotifyFederation::SequenceNumber next);
+
+  /// The next event to push into the channel
+  NotifyFederation::SequenceNumber next_;
+
+  /// The sender's Repair object, nil until its first announcement
+  NotifyFederation::Repair_var repair_;
+
+  /// The events received ahead of next_
+  Pending pending_;
+
+  /// The value of next_ when the last NAK was sent, and when
+  NotifyFederation::SequenceNumber nak_next_;
+  ACE_Time_Value nak_time_;
+};
+
+// ****************************************************************
+
+/**
+ * @class TAO_Notify_Federation_Receiver
+ *
+ * @brief Push the events of a MIOP group into a local channel.
+ *
+ * The receiver is activated in a GOA with the group reference used
+ * by the TAO_Notify_Federation_Sender objects, and connects as a
+ * StructuredPushSupplier to the default supplier admin of the local
+ * channel.
+ *
+ * The events of each sender are pushed into the channel in order,
+ * exactly once.  Events that arrive ahead of a gap are kept (up to a
+ * limit) until the missing ones are retransmitted; the gap is reported
+ * to the sender with a NAK when it is detected, and again if it is
+ * not repaired after a while.  When the sender reports that some
+ * events are no longer available the receiver skips them.
+ *
+ * The events are pushed into the channel without holding the lock of
+ * the receiver: the upcalls queue the events that are in order, and
+ * the first of them drains the queue while the others return.
+ */
+class TAO_Notify_MIOP_Export TAO_Notify_Federation_Receiver
+  : public virtual POA_NotifyFederation::Receiver
+{
+public:
+  /// Constructor, @a id identifies this receiver in the NAKs.
+  TAO_Notify_Federation_Receiver (
+      CORBA::ULong id,
+      size_t max_pending = TAO_NOTIFY_FEDERATION_MAX_PENDING);
+
+  /// Destructor
+  virtual ~TAO_Notify_Federation_Receiver (void);
+
+  /// Connect to the default supplier admin of @a channel
+  void init (CosNotifyChannelAdmin::EventChannel_ptr channel);
+
+  /// Activate the receiver in @a goa as a member of @a group
+  void join (PortableGroup::GOA_ptr goa, CORBA::Object_ptr group);
+
+  /// Disconnect from the channel and leave the group
+  void shutdown (void);
+
+  /// The number of events pushed into the channel
+  CORBA::ULongLong delivered (void) const;
+
+  /// The number of events the senders could not retransmit
+  CORBA::ULongLong lost_count (void) const;
+
+  // = The NotifyFederation::Receiver methods
+  virtual void push_structured_events (
+      CORBA::ULong sender,
+      NotifyFederation::SequenceNumber first,
+      const CosNotification::EventBatch &events);
+  virtual void announce (CORBA::ULong sender,
+                         NotifyFederation::SequenceNumber next,
+                         NotifyFederation::Repair_ptr repair);
+  virtual void lost (CORBA::ULong sender,
+                     NotifyFederation::SequenceNumber first,
+                     NotifyFederation::SequenceNumber last);
+
+private:
+  typedef TAO_Notify_Federation_Peer Peer;
+  typedef ACE_Map_Manager<CORBA::ULong, Peer *, ACE_Null_Mutex> Peer_Map;
+  typedef ACE_Unbounded_Queue<CosNotification::StructuredEvent *> Event_Queue;
+
+  /// Find the state of @a sender, creating it if needed, the first
+  /// event expected from a new sender is @a next.
+  Peer *peer_i (CORBA::ULong sender, NotifyFederation::SequenceNumber next);
+
+  /// Queue the events kept for @a peer that are now in order
+  void drain_i (Peer &peer);
+
+  /// Queue @a event to be pushed into the local channel
+  void deliver_i (const CosNotification::StructuredEvent &event);
+
+  /// Push the queued events into the local channel, unless another
+  /// thread is doing it.  The caller does not hold the lock.
+  void flush (void);
+
+  /// A NAK to send once the lock is released
+  struct Nak
+  {
+    NotifyFederation::Repair_var repair_;
+    NotifyFederation::SequenceNumber first_;
+    NotifyFederation::SequenceNumber last_;
+  };
+
+  /// Decide if @a sender must be asked to retransmit the events
+  /// before @a last, and fill @a nak if so.
+  void nak_i (CORBA::ULong sender,
+              Peer &peer,
+              NotifyFederation::SequenceNumber last,
+              Nak &nak);
+
+  /// Send @a nak, if any.  The caller does not hold the lock.
+  void send_nak (const Nak &nak);
+
+private:
+  ACE_UNIMPLEMENTED_FUNC (TAO_Notify_Federation_Receiver (const TAO_Notify_Federation_Receiver &))
+  ACE_UNIMPLEMENTED_FUNC (TAO_Notify_Federation_Receiver &operator= (const TAO_Notify_Federation_Receiver &))
+
+  /// Our identifier in the NAKs
+  CORBA::ULong const id_;
+
+  /// The maximum number of pending events for each sender
+  size_t const max_pending_;
+
+  /// The proxy in the local channel
+  CosNotifyChannelAdmin::StructuredProxyPushConsumer_var consumer_;
+
+  /// Where we are activated
+  PortableGroup::GOA_var goa_;
+  PortableServer::ObjectId_var oid_;
+
+  /// The senders
+  Peer_Map peers_;
+
+  /// The events in order, not pushed into the channel yet
+  Event_Queue ready_;
+
+  /// Is a thread pushing the events of ready_?
+  bool flushing_;
+
+  /// Statistics
+  CORBA::ULongLong delivered_;
+  CORBA::ULongLong lost_;
+
+  /// Protect the state of the senders and the queue of events, only
+  /// one thread at a time pushes the events so they stay in order.
+  mutable TAO_SYNCH_MUTEX lock_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_NOTIFY_FEDERATION_RECEIVER_H */
@@ -0,0 +1,396 @@
+#include "orbsvcs/Log_Macros.h"
+#include "orbsvcs/Notify/MIOP/Federation_Sender.h"
+
+#include "tao/ORB_Core.h"
+#include "tao/Object_T.h"
+#include "ace/Reactor.h"
+#include "ace/OS_NS_sys_time.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_Notify_Federation_Repair::TAO_Notify_Federation_Repair (
+    TAO_Notify_Federation_Sender *sender)
+  : sender_ (sender)
+{
+}
+
+void
+TAO_Notify_Federation_Repair::shutdown (void)
+{
+  this->sender_ = 0;
+}
+
+void
+TAO_Notify_Federation_Repair::nak (CORBA::ULong receiver,
+                                   NotifyFederation::SequenceNumber first,
+                                   NotifyFederation::SequenceNumber last)
+{
+  if (this->sender_ != 0)
+    this->sender_->retransmit (receiver, first, last);
+}
+
+// ****************************************************************
+
+TAO_Notify_Federation_Sender::Announcer::Announcer (
+    TAO_Notify_Federation_Sender *sender)
+  : sender_ (sender)
+{
+}
+
+int
+TAO_Notify_Federation_Sender::Announcer::handle_timeout (const ACE_Time_Value &,
+                                                         const void *)
+{
+  try
+    {
+      this->sender_->announce ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      if (TAO_debug_level > 0)
+        ex._tao_print_exception ("TAO_Notify_Federation_Sender::announce");
+    }
+  return 0;
+}
+
+// ****************************************************************
+
+TAO_Notify_Federation_Sender::TAO_Notify_Federation_Sender (
+    CORBA::ULong id,
+    size_t history,
+    CORBA::ULong max_batch)
+  : id_ (id),
+    max_batch_ (max_batch == 0 ? 1 : max_batch),
+    announcer_ (this),
+    reactor_ (0),
+    history_ (history == 0 ? 1 : history),
+    next_ (1),
+    repaired_first_ (0),
+    repaired_last_ (0),
+    sending_ (false)
+{
+  this->repair_ = new TAO_Notify_Federation_Repair (this);
+}
+
+TAO_Notify_Federation_Sender::~TAO_Notify_Federation_Sender (void)
+{
+  if (this->reactor_ != 0)
+    this->reactor_->cancel_timer (&this->announcer_);
+  if (this->repair_.in () != 0)
+    this->repair_->shutdown ();
+
+  Message *message = 0;
+  while (this->outgoing_.dequeue_head (message) == 0)
+    delete message;
+}
+
+void
+TAO_Notify_Federation_Sender::init (
+    CORBA::ORB_ptr orb,
+    PortableServer::POA_ptr poa,
+    CosNotifyChannelAdmin::EventChannel_ptr channel,
+    CORBA::Object_ptr group,
+    const ACE_Time_Value &announce_interval)
+{
+  if (CORBA::is_nil (channel) || CORBA::is_nil (group))
+    {
+      ORBSVCS_ERROR ((LM_ERROR, "TAO_Notify_Federation_Sender::init(): "
+                      "nil channel or group.\n"));
+      throw CORBA::BAD_PARAM ();
+    }
+
+  this->poa_ = PortableServer::POA::_duplicate (poa);
+
+  // There is no way to ask a multicast group about its interface.
+  this->group_ =
+    TAO::Narrow_Utils<NotifyFederation::Receiver>::unchecked_narrow (group);
+
+  PortableServer::ObjectId_var repair_id =
+    poa->activate_object (this->repair_.in ());
+  CORBA::Object_var obj = poa->id_to_reference (repair_id.in ());
+  this->repair_ref_ = NotifyFederation::Repair::_narrow (obj.in ());
+
+  PortableServer::ObjectId_var id = poa->activate_object (this);
+  obj = poa->id_to_reference (id.in ());
+  CosNotifyComm::StructuredPushConsumer_var consumer =
+    CosNotifyComm::StructuredPushConsumer::_narrow (obj.in ());
+
+  // Let the receivers know we exist before the first event.
+  this->announce ();
+
+  CosNotifyChannelAdmin::ConsumerAdmin_var admin =
+    channel->default_consumer_admin ();
+
+  CosNotifyChannelAdmin::ProxyID proxy_id;
+  CosNotifyChannelAdmin::ProxySupplier_var proxy =
+    admin->obtain_notification_push_supplier (
+      CosNotifyChannelAdmin::STRUCTURED_EVENT, proxy_id);
+
+  this->supplier_ =
+    CosNotifyChannelAdmin::StructuredProxyPushSupplier::_narrow (proxy.in ());
+  this->supplier_->connect_structured_push_consumer (consumer.in ());
+
+  if (announce_interval != ACE_Time_Value::zero)
+    {
+      this->reactor_ = orb->orb_core ()->reactor ();
+      this->reactor_->schedule_timer (&this->announcer_,
+                                      0,
+                                      announce_interval,
+                                      announce_interval);
+    }
+}
+
+void
+TAO_Notify_Federation_Sender::shutdown (void)
+{
+  if (this->reactor_ != 0)
+    {
+      this->reactor_->cancel_timer (&this->announcer_);
+      this->reactor_ = 0;
+    }
+
+  if (!CORBA::is_nil (this->supplier_.in ()))
+    {
+      try
+        {
+          this->supplier_->disconnect_structured_push_supplier ();
+        }
+      catch (const CORBA::Exception&)
+        {
+          // The channel may be gone already.
+        }
+      this->supplier_ = CosNotifyChannelAdmin::StructuredProxyPushSupplier::_nil ();
+    }
+
+  this->deactivate (this->repair_.in ());
+  this->repair_->shutdown ();
+  this->deactivate (this);
+}
+
+void
+TAO_Notify_Federation_Sender::announce (void)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    this->enqueue_i (Message::ANNOUNCE, this->next_);
+  }
+
+  this->flush ();
+}
+
+void
+TAO_Notify_Federation_Sender::retransmit (
+    CORBA::ULong receiver,
+    NotifyFederation::SequenceNumber first,
+    NotifyFederation::SequenceNumber last)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    if (last >= this->next_)
+      last = this->next_ - 1;
+    if (first == 0 || first > last)
+      return;
+
+    // The other receivers that lost the same messages send the same
+    // NAK, the retransmission reaches all of them.
+    ACE_Time_Value const now = ACE_OS::gettimeofday ();
+    if (first >= this->repaired_first_
+        && last <= this->repaired_last_
+        && now - this->repaired_time_
+             < ACE_Time_Value (0, TAO_NOTIFY_FEDERATION_REPAIR_HOLDOFF))
+      return;
+
+    if (TAO_debug_level > 1)
+      ORBSVCS_DEBUG ((LM_DEBUG,
+                      "TAO_Notify_Federation_Sender (%u): "
+                      "receiver %u lost %Q to %Q\n",
+                      this->id_, receiver, first, last));
+
+    this->repaired_first_ = first;
+    this->repaired_last_ = last;
+    this->repaired_time_ = now;
+
+    NotifyFederation::SequenceNumber const size = this->history_.size ();
+    NotifyFederation::SequenceNumber const oldest =
+      this->next_ > size ? this->next_ - size : 1;
+
+    if (first < oldest)
+      {
+        NotifyFederation::SequenceNumber const gone =
+          last < oldest ? last : oldest - 1;
+        this->enqueue_i (Message::LOST, first, gone);
+        first = gone + 1;
+      }
+
+    while (first <= last)
+      {
+        NotifyFederation::SequenceNumber const remaining = last - first + 1;
+        CORBA::ULong const n =
+          remaining < this->max_batch_
+            ? static_cast<CORBA::ULong> (remaining)
+            : this->max_batch_;
+
+        Message *message = this->enqueue_i (Message::EVENTS, first);
+        if (message == 0)
+          break;
+
+        message->events_.length (n);
+        for (CORBA::ULong i = 0; i != n; ++i)
+          message->events_[i] = this->history_[(first + i) % size];
+
+        first += n;
+      }
+  }
+
+  this->flush ();
+}
+
+void
+TAO_Notify_Federation_Sender::push_structured_event (
+    const CosNotification::StructuredEvent &notification)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    NotifyFederation::SequenceNumber const seq = this->next_++;
+    this->history_[seq % this->history_.size ()] = notification;
+
+    // The history may be overwritten before the message is sent, the
+    // message has its own copy.  If it cannot be queued the receivers
+    // will ask for the event again.
+    Message *message = this->enqueue_i (Message::EVENTS, seq);
+    if (message != 0)
+      {
+        message->events_.length (1);
+        message->events_[0] = notification;
+      }
+  }
+
+  this->flush ();
+}
+
+void
+TAO_Notify_Federation_Sender::disconnect_structured_push_consumer (void)
+{
+  this->supplier_ = CosNotifyChannelAdmin::StructuredProxyPushSupplier::_nil ();
+  this->shutdown ();
+}
+
+void
+TAO_Notify_Federation_Sender::offer_change (
+    const CosNotification::EventTypeSeq &,
+    const CosNotification::EventTypeSeq &)
+{
+}
+
+PortableServer::POA_ptr
+TAO_Notify_Federation_Sender::_default_POA (void)
+{
+  return PortableServer::POA::_duplicate (this->poa_.in ());
+}
+
+void
+TAO_Notify_Federation_Sender::send (
+    NotifyFederation::SequenceNumber first,
+    const CosNotification::EventBatch &events)
+{
+  this->group_->push_structured_events (this->id_, first, events);
+}
+
+TAO_Notify_Federation_Sender::Message *
+TAO_Notify_Federation_Sender::enqueue_i (Message::Kind kind,
+                                         NotifyFederation::SequenceNumber first,
+                                         NotifyFederation::SequenceNumber last)
+{
+  Message *message = 0;
+  ACE_NEW_RETURN (message, Message, 0);
+
+  message->kind_ = kind;
+  message->first_ = first;
+  message->last_ = last;
+
+  if (this->outgoing_.enqueue_tail (message) != 0)
+    {
+      delete message;
+      return 0;
+    }
+  return message;
+}
+
+void
+TAO_Notify_Federation_Sender::flush (void)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    // The thread that is sending the messages sends ours too, after
+    // the ones queued before them.
+    if (this->sending_)
+      return;
+    this->sending_ = true;
+  }
+
+  for (;;)
+    {
+      Message *message = 0;
+      {
+        ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+        if (this->outgoing_.dequeue_head (message) != 0)
+          {
+            this->sending_ = false;
+            return;
+          }
+      }
+
+      try
+        {
+          switch (message->kind_)
+            {
+            case Message::EVENTS:
+              this->send (message->first_, message->events_);
+              break;
+            case Message::ANNOUNCE:
+              this->group_->announce (this->id_,
+                                      message->first_,
+                                      this->repair_ref_.in ());
+              break;
+            case Message::LOST:
+              this->group_->lost (this->id_,
+                                  message->first_,
+                                  message->last_);
+              break;
+            }
+        }
+      catch (const CORBA::Exception& ex)
+        {
+          // The receivers will ask for the events again.
+          if (TAO_debug_level > 0)
+            ex._tao_print_exception ("TAO_Notify_Federation_Sender::send");
+        }
+
+      delete message;
+    }
+}
+
+void
+TAO_Notify_Federation_Sender::deactivate (PortableServer::ServantBase *servant)
+{
+  if (CORBA::is_nil (this->poa_.in ()))
+    return;
+
+  try
+    {
+      PortableServer::ObjectId_var id =
+        this->poa_->servant_to_id (servant);
+      this->poa_->deactivate_object (id.in ());
+    }
+  catch (const CORBA::Exception&)
+    {
+      // Not active, or the POA is being destroyed.
+    }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
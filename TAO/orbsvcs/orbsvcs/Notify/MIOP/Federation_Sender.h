@@ -0,0 +1,267 @@
+// -*- C++ -*-
+
+/**
+ *  @file   Federation_Sender.h
+ *
+ *  Forward the structured events of a local Notification Service
+ *  channel to a MIOP group.
+ */
+
+#ifndef TAO_NOTIFY_FEDERATION_SENDER_H
+#define TAO_NOTIFY_FEDERATION_SENDER_H
+#include /**/ "ace/pre.h"
+
+#include "orbsvcs/Notify/MIOP/notify_miop_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "orbsvcs/Notify/MIOP/NotifyFederationS.h"
+#include "orbsvcs/CosNotifyCommS.h"
+#include "orbsvcs/CosNotifyChannelAdminC.h"
+
+#include "tao/PortableServer/Servant_var.h"
+#include "ace/Array_Base.h"
+#include "ace/Event_Handler.h"
+#include "ace/Unbounded_Queue.h"
+#include "ace/Time_Value.h"
+
+#ifndef TAO_NOTIFY_FEDERATION_HISTORY
+/// The number of events kept for retransmission
+# define TAO_NOTIFY_FEDERATION_HISTORY 1024
+#endif /* TAO_NOTIFY_FEDERATION_HISTORY */
+
+#ifndef TAO_NOTIFY_FEDERATION_MAX_BATCH
+/// The maximum number of events in a retransmitted message
+# define TAO_NOTIFY_FEDERATION_MAX_BATCH 16
+#endif /* TAO_NOTIFY_FEDERATION_MAX_BATCH */
+
+#ifndef TAO_NOTIFY_FEDERATION_REPAIR_HOLDOFF
+/// The NAKs received this many microseconds after a retransmission
+/// that covers them are ignored.
+# define TAO_NOTIFY_FEDERATION_REPAIR_HOLDOFF 20000
+#endif /* TAO_NOTIFY_FEDERATION_REPAIR_HOLDOFF */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_Notify_Federation_Sender;
+
+/**
+ * @class TAO_Notify_Federation_Repair
+ *
+ * @brief The NotifyFederation::Repair servant of a sender.
+ */
+class TAO_Notify_MIOP_Export TAO_Notify_Federation_Repair
+  : public virtual POA_NotifyFederation::Repair
+{
+public:
+  /// Constructor
+  TAO_Notify_Federation_Repair (TAO_Notify_Federation_Sender *sender);
+
+  /// The sender is going away
+  void shutdown (void);
+
+  // = The NotifyFederation::Repair methods
+  virtual void nak (CORBA::ULong receiver,
+                    NotifyFederation::SequenceNumber first,
+                    NotifyFederation::SequenceNumber last);
+
+private:
+  TAO_Notify_Federation_Sender *sender_;
+};
+
+// ****************************************************************
+
+/**
+ * @class TAO_Notify_Federation_Sender
+ *
+ * @brief Send the structured events of a local channel to a MIOP
+ * group of receivers.
+ *
+ * The sender connects as a StructuredPushConsumer to the local
+ * channel and pushes each event it receives to a group reference
+ * (usually a corbaloc:miop: object), so a single datagram, or a
+ * single group of MIOP fragments for large events, reaches all the
+ * TAO_Notify_Federation_Receiver objects in the group.
+ *
+ * Events are numbered, and the last few are kept so they can be
+ * retransmitted (again to the whole group) when a receiver detects a
+ * gap and sends a NAK to the sender's Repair object.  Events that are
+ * no longer kept are reported to the group as lost.  The sender
+ * periodically announces its next sequence number and its Repair
+ * reference, so receivers can join at any time and detect the loss
+ * of the last events sent.
+ *
+ * The messages to the group are queued under the lock of the sender
+ * and sent without it, by one thread at a time, in the order they
+ * were queued.
+ *
+ * A channel should not have both a sender and a receiver of the same
+ * group, unless the events are filtered, or they will loop.
+ */
+class TAO_Notify_MIOP_Export TAO_Notify_Federation_Sender
+  : public virtual POA_CosNotifyComm::StructuredPushConsumer
+{
+public:
+  /// Constructor, @a id identifies this sender in the group,
+  /// @a history is the number of events kept for retransmission.
+  TAO_Notify_Federation_Sender (
+      CORBA::ULong id,
+      size_t history = TAO_NOTIFY_FEDERATION_HISTORY,
+      CORBA::ULong max_batch = TAO_NOTIFY_FEDERATION_MAX_BATCH);
+
+  /// Destructor
+  virtual ~TAO_Notify_Federation_Sender (void);
+
+  /**
+   * Activate the sender and its Repair object in @a poa, connect to
+   * the default consumer admin of @a channel, and start forwarding
+   * the events to @a group.  The announcements are sent every
+   * @a announce_interval using the reactor of @a orb.
+   */
+  void init (CORBA::ORB_ptr orb,
+             PortableServer::POA_ptr poa,
+             CosNotifyChannelAdmin::EventChannel_ptr channel,
+             CORBA::Object_ptr group,
+             const ACE_Time_Value &announce_interval);
+
+  /// Disconnect from the channel and deactivate the servants
+  void shutdown (void);
+
+  /// Send the next sequence number and the Repair reference to the
+  /// group.
+  void announce (void);
+
+  /// Send the events from @a first to @a last to the group again
+  void retransmit (CORBA::ULong receiver,
+                   NotifyFederation::SequenceNumber first,
+                   NotifyFederation::SequenceNumber last);
+
+  // = The CosNotifyComm::StructuredPushConsumer methods
+  virtual void push_structured_event (
+      const CosNotification::StructuredEvent &notification);
+  virtual void disconnect_structured_push_consumer (void);
+  virtual void offer_change (const CosNotification::EventTypeSeq &added,
+                             const CosNotification::EventTypeSeq &removed);
+
+  virtual PortableServer::POA_ptr _default_POA (void);
+
+protected:
+  /// Push the events starting at @a first to the group.  It is called
+  /// by one thread at a time, without the lock.  Tests override it to
+  /// simulate losses.
+  virtual void send (NotifyFederation::SequenceNumber first,
+                     const CosNotification::EventBatch &events);
+
+private:
+  /**
+   * @class Announcer
+   *
+   * @brief Call announce() on each timeout.
+   */
+  class Announcer : public ACE_Event_Handler
+  {
+  public:
+    Announcer (TAO_Notify_Federation_Sender *sender);
+
+    virtual int handle_timeout (const ACE_Time_Value &tv,
+                                const void *act);
+
+  private:
+    TAO_Notify_Federation_Sender *sender_;
+  };
+
+  /**
+   * @struct Message
+   *
+   * @brief A message to the group, waiting to be sent.
+   */
+  struct Message
+  {
+    enum Kind
+    {
+      EVENTS,
+      ANNOUNCE,
+      LOST
+    };
+
+    Kind kind_;
+
+    /// The first event, or the next sequence number announced
+    NotifyFederation::SequenceNumber first_;
+
+    /// The last event lost
+    NotifyFederation::SequenceNumber last_;
+
+    CosNotification::EventBatch events_;
+  };
+
+  typedef ACE_Unbounded_Queue<Message *> Message_Queue;
+
+  /// Queue a message of @a kind, the caller holds the lock
+  Message *enqueue_i (Message::Kind kind,
+                      NotifyFederation::SequenceNumber first,
+                      NotifyFederation::SequenceNumber last = 0);
+
+  /// Send the queued messages, unless another thread is doing it.
+  /// The caller does not hold the lock.
+  void flush (void);
+
+  /// Deactivate @a servant from the POA, ignoring errors
+  void deactivate (PortableServer::ServantBase *servant);
+
+private:
+  ACE_UNIMPLEMENTED_FUNC (TAO_Notify_Federation_Sender (const TAO_Notify_Federation_Sender &))
+  ACE_UNIMPLEMENTED_FUNC (TAO_Notify_Federation_Sender &operator= (const TAO_Notify_Federation_Sender &))
+
+  /// Our identifier in the group
+  CORBA::ULong const id_;
+
+  /// The maximum number of events in a retransmission
+  CORBA::ULong const max_batch_;
+
+  /// The POA where the servants are activated
+  PortableServer::POA_var poa_;
+
+  /// The group of receivers
+  NotifyFederation::Receiver_var group_;
+
+  /// The proxy in the local channel
+  CosNotifyChannelAdmin::StructuredProxyPushSupplier_var supplier_;
+
+  /// The Repair servant and its reference
+  PortableServer::Servant_var<TAO_Notify_Federation_Repair> repair_;
+  NotifyFederation::Repair_var repair_ref_;
+
+  /// Schedule the announcements
+  Announcer announcer_;
+  ACE_Reactor *reactor_;
+
+  /// The events kept for retransmission, indexed by their sequence
+  /// number modulo the size.
+  ACE_Array_Base<CosNotification::StructuredEvent> history_;
+
+  /// The sequence number of the next event
+  NotifyFederation::SequenceNumber next_;
+
+  /// The last range retransmitted and when, the NAKs sent by several
+  /// receivers for the same loss only retransmit it once.
+  NotifyFederation::SequenceNumber repaired_first_;
+  NotifyFederation::SequenceNumber repaired_last_;
+  ACE_Time_Value repaired_time_;
+
+  /// The messages not sent yet
+  Message_Queue outgoing_;
+
+  /// Is a thread sending the messages of outgoing_?
+  bool sending_;
+
+  /// Protect the history and the queue of messages
+  TAO_SYNCH_MUTEX lock_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_NOTIFY_FEDERATION_SENDER_H */
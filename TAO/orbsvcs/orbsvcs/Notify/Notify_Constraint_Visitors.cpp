@@ -4,15 +4,10 @@
 
 #include "tao/ETCL/TAO_ETCL_Constraint.h"
 
-#include "tao/DynamicAny/DynArray_i.h"
-#include "tao/DynamicAny/DynSequence_i.h"
-#include "tao/DynamicAny/DynStruct_i.h"
-#include "tao/DynamicAny/DynUnion_i.h"
 #include "tao/DynamicAny/DynEnum_i.h"
 #include "tao/DynamicAny/DynAnyFactory.h"
-#include "tao/DynamicAny/DynAnyUtils_T.h"
 
-#include "tao/AnyTypeCode/Any_Unknown_IDL_Type.h"
+#include "tao/AnyTypeCode/Any_CDR_View.h"
 #include "tao/CDR.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
@@ -211,10 +206,7 @@ TAO_Notify_Constraint_Visitor::visit_union_pos (
         TAO_ETCL_Literal_Constraint disc_val;
         this->queue_.dequeue_head (disc_val);
 
-        TAO_DynUnion_i dyn_union;
-        dyn_union.init (this->current_value_.in ());
-
-        CORBA::TypeCode_var tc = this->current_value_->type ();
+        TAO::Any_CDR_View view (this->current_value_.in ());
 
         switch (disc_val.expr_type ())
         {
@@ -222,69 +214,44 @@ TAO_Notify_Constraint_Visitor::visit_union_pos (
         case ETCL_SIGNED:
         case ETCL_UNSIGNED:
           {
+            // Only the active member of the union can be read, the
+            // constraint fails when the union holds another one.
+            TAO::Any_CDR_View disc;
+            TAO::Any_CDR_View member;
             CORBA::Any disc_any;
-            CORBA::TypeCode_var disc_tc =
-              tc->discriminator_type ();
-            CORBA::TCKind disc_kind =
-              TAO_DynAnyFactory::unalias (disc_tc.in ());
+            if (!view.discriminator (disc)
+                || !disc.value (disc_any)
+                || !view.active_member (member))
+              {
+                return -1;
+              }
 
-            switch (disc_kind)
-            {
-            case CORBA::tk_boolean:
-              disc_any <<= CORBA::Any::from_boolean ((CORBA::Boolean) disc_val);
-              break;
-            case CORBA::tk_short:
-              disc_any <<= (CORBA::Short) ((CORBA::Long) disc_val);
-              break;
-            case CORBA::tk_ushort:
-              disc_any <<= (CORBA::UShort) ((CORBA::ULong) disc_val);
-              break;
-            case CORBA::tk_long:
-              disc_any <<= (CORBA::Long) disc_val;
-              break;
-            case CORBA::tk_ulong:
-              disc_any <<= (CORBA::ULong) disc_val;
-              break;
-            case CORBA::tk_enum:
+            TAO_ETCL_Literal_Constraint disc_lit (&disc_any);
+            if (!(disc_lit == disc_val))
               {
-                TAO_OutputCDR cdr;
-                cdr.write_ulong ((CORBA::ULong) disc_val);
-                TAO_InputCDR in_cdr (cdr);
-                TAO::Unknown_IDL_Type *unk = 0;
-                ACE_NEW_RETURN (unk,
-                                TAO::Unknown_IDL_Type (disc_tc.in (),
-                                in_cdr),
-                                -1);
-
-                disc_any.replace (unk);
-                break;
+                return -1;
               }
-              // @@@ (JP) I don't think ETCL handles 64-bit
-              // integers at this point, and I also think that
-              // chars and/or wchars will just come out in the
-              // constraint as (w)strings of length 1.
-            case CORBA::tk_longlong:
-            case CORBA::tk_ulonglong:
-            case CORBA::tk_char:
-            case CORBA::tk_wchar:
-            default:
-              return -1;
-            }
 
-            DynamicAny::DynAny_var dyn_any =
-              TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any &> (
-                disc_tc.in (),
-                disc_any);
-            dyn_union.set_discriminator (dyn_any.in ());
-            DynamicAny::DynAny_var u_member =
-              dyn_union.member ();
-            this->current_value_ =
-              u_member->to_any ();
+            CORBA::Any *member_any = 0;
+            ACE_NEW_RETURN (member_any,
+                            CORBA::Any,
+                            -1);
+            CORBA::Any_var safe_member = member_any;
+
+            if (!member.value (*member_any))
+              {
+                return -1;
+              }
+
+            this->current_value_ = safe_member._retn ();
 
             break;
           }
         case ETCL_STRING:
           {
+            CORBA::TypeCode_var tc = this->current_value_->type ();
+            tc = TAO_DynAnyFactory::strip_alias (tc.in ());
+
             const char *name = (const char *) disc_val;
             CORBA::ULong count = tc->member_count ();
 
@@ -354,7 +321,7 @@ TAO_Notify_Constraint_Visitor::visit_component_pos (
     CORBA::TypeCode_var tc = this->current_value_->type ();
     CORBA::TCKind kind = TAO_DynAnyFactory::unalias (tc.in ());
 
-    DynamicAny::DynAny_var member;
+    CORBA::Any_var value;
     CORBA::Boolean success = 0;
     CORBA::ULong slot = (CORBA::ULong) *pos->integer ();
 
@@ -371,21 +338,31 @@ TAO_Notify_Constraint_Visitor::visit_component_pos (
             return -1;
           }
 
-        member = dyn_enum.current_component ();
+        DynamicAny::DynAny_var member = dyn_enum.current_component ();
+        value = member->to_any ();
         break;
       }
     case CORBA::tk_struct:
       {
-        TAO_DynStruct_i dyn_struct;
-        dyn_struct.init (this->current_value_.in ());
-        success = dyn_struct.seek (slot);
+        // Read the member in place, the other members are skipped.
+        TAO::Any_CDR_View view (this->current_value_.in ());
+        TAO::Any_CDR_View member;
 
-        if (!success)
+        if (!view.member (slot, member))
           {
             return -1;
           }
 
-        member = dyn_struct.current_component ();
+        CORBA::Any *member_any = 0;
+        ACE_NEW_RETURN (member_any,
+                        CORBA::Any,
+                        -1);
+        value = member_any;
+
+        if (!member.value (*member_any))
+          {
+            return -1;
+          }
         break;
       }
       // @@@ (JP) I think enums and structs are the only two cases
@@ -396,7 +373,6 @@ TAO_Notify_Constraint_Visitor::visit_component_pos (
       return -1;
     }
 
-    CORBA::Any_var value = member->to_any ();
     ETCL_Constraint *comp = pos->component ();
 
     if (comp == 0)
@@ -486,51 +462,28 @@ TAO_Notify_Constraint_Visitor::visit_component_array (
   {
     // If we are here (from visit_component) the Any containing the
     // component as found in filterable_data_ will be in
-    // current_value_.
-    CORBA::TypeCode_var tc = this->current_value_->type ();
-    CORBA::TCKind kind = TAO_DynAnyFactory::unalias (tc.in ());
-
-    DynamicAny::DynAny_var member;
-    CORBA::Boolean success = 0;
+    // current_value_.  Arrays and sequences are the only two cases
+    // handled by Component_Array, their element is read in place.
+    TAO::Any_CDR_View view (this->current_value_.in ());
+    TAO::Any_CDR_View element;
     CORBA::ULong slot = (CORBA::ULong) *array->integer ();
 
-    switch (kind)
-    {
-    case CORBA::tk_array:
+    if (!view.element (slot, element))
       {
-        TAO_DynEnum_i dyn_array;
-        dyn_array.init (this->current_value_.in ());
-        success = dyn_array.seek (slot);
-
-        if (!success)
-          {
-            return -1;
-          }
-
-        member = dyn_array.current_component ();
-        break;
+        return -1;
       }
-    case CORBA::tk_sequence:
-      {
-        TAO_DynStruct_i dyn_sequence;
-        dyn_sequence.init (this->current_value_.in ());
-        success = dyn_sequence.seek (slot);
 
-        if (!success)
-          {
-            return -1;
-          }
+    CORBA::Any *element_any = 0;
+    ACE_NEW_RETURN (element_any,
+                    CORBA::Any,
+                    -1);
+    CORBA::Any_var value = element_any;
 
-        member =dyn_sequence.current_component ();
-        break;
+    if (!element.value (*element_any))
+      {
+        return -1;
       }
-      // Enums and sequences are the only two cases handled
-      // by Component_Array.
-    default:
-      return -1;
-    }
 
-    CORBA::Any_var value = member->to_any ();
     ETCL_Constraint *comp = array->component ();
 
     if (comp == 0)
@@ -570,13 +523,13 @@ TAO_Notify_Constraint_Visitor::visit_special (ETCL_Special *special)
         {
         case CORBA::tk_sequence:
           {
-            TAO_DynSequence_i dyn_seq;
-            dyn_seq.init (current_value_.in());
-
-            DynamicAny::AnySeq_var any_seq =
-              dyn_seq.get_elements ();
+            // Only the length is read, not the elements.
+            TAO::Any_CDR_View view (this->current_value_.in ());
 
-            length = any_seq->length ();
+            if (!view.length (length))
+              {
+                return -1;
+              }
           }
           break;
         case CORBA::tk_array:
@@ -592,17 +545,18 @@ TAO_Notify_Constraint_Visitor::visit_special (ETCL_Special *special)
       }
     case ETCL_DISCRIMINANT:
       {
-        // If the TCKind is not a union, the call to init() will
-        // raise an exception, and the catch block will return -1;
-        TAO_DynUnion_i dyn_union;
-        dyn_union.init (this->current_value_.in ());
-
-        DynamicAny::DynAny_var disc =
-          dyn_union.get_discriminator ();
+        // If the TCKind is not a union there is no discriminator
+        // and we return -1.
+        TAO::Any_CDR_View view (this->current_value_.in ());
+        TAO::Any_CDR_View disc;
+        CORBA::Any disc_any;
 
-        CORBA::Any_var disc_any = disc->to_any ();
+        if (!view.discriminator (disc) || !disc.value (disc_any))
+          {
+            return -1;
+          }
 
-        TAO_ETCL_Literal_Constraint lit (disc_any.ptr ());
+        TAO_ETCL_Literal_Constraint lit (&disc_any);
         this->queue_.enqueue_head (lit);
         return 0;
       }
@@ -1226,22 +1180,7 @@ TAO_Notify_Constraint_Visitor::sequence_does_contain (
         return false;
       }
 
-    TAO_DynSequence_i dyn_seq;
-    dyn_seq.init (*any);
-
-    DynamicAny::AnySeq_var any_seq = dyn_seq.get_elements ();
-
-    CORBA::ULong length = any_seq->length ();
-
-    for (CORBA::ULong i = 0; i < length; ++i)
-      {
-        TAO_ETCL_Literal_Constraint element (&any_seq[i]);
-
-        if (item == element)
-          {
-            return true;
-          }
-      }
+    return this->elements_do_contain (any, item);
   }
   catch (const CORBA::Exception&)
   {
@@ -1273,22 +1212,7 @@ TAO_Notify_Constraint_Visitor::array_does_contain (
         return false;
       }
 
-    TAO_DynArray_i dyn_array;
-    dyn_array.init (*any);
-
-    DynamicAny::AnySeq_var any_seq = dyn_array.get_elements ();
-
-    CORBA::ULong length = any_seq->length ();
-
-    for (CORBA::ULong i = 0; i < length; ++i)
-      {
-        TAO_ETCL_Literal_Constraint element (&any_seq[i]);
-
-        if (item == element)
-          {
-            return true;
-          }
-      }
+    return this->elements_do_contain (any, item);
   }
   catch (const CORBA::Exception&)
   {
@@ -1306,20 +1230,20 @@ TAO_Notify_Constraint_Visitor::struct_does_contain (
 {
   try
   {
-    TAO_DynStruct_i dyn_struct;
-    dyn_struct.init (*any);
-
-    DynamicAny::NameValuePairSeq_var members =
-      dyn_struct.get_members ();
+    // Only the members of the type of the literal are read.
+    TAO::Any_CDR_View view (*any);
+    CORBA::TypeCode_var type = any->type ();
+    CORBA::TypeCode_var tc =
+      TAO_DynAnyFactory::strip_alias (type.in ());
 
-    CORBA::ULong length = members->length ();
-    CORBA::TypeCode_var tc;
+    CORBA::ULong length = tc->member_count ();
+    CORBA::TypeCode_var member_tc;
     CORBA::TCKind kind;
 
     for (CORBA::ULong i = 0; i < length; ++i)
       {
-        tc = members[i].value.type ();
-        kind = TAO_DynAnyFactory::unalias (tc.in ());
+        member_tc = tc->member_type (i);
+        kind = TAO_DynAnyFactory::unalias (member_tc.in ());
 
         // The literal and the struct member must be
         // of the same simple type.
@@ -1332,7 +1256,15 @@ TAO_Notify_Constraint_Visitor::struct_does_contain (
             continue;
           }
 
-        TAO_ETCL_Literal_Constraint element (&members[i].value);
+        TAO::Any_CDR_View member;
+        CORBA::Any value;
+
+        if (!view.member (i, member) || !member.value (value))
+          {
+            return false;
+          }
+
+        TAO_ETCL_Literal_Constraint element (&value);
 
         if (item == element)
           {
@@ -1356,16 +1288,15 @@ TAO_Notify_Constraint_Visitor::union_does_contain (
 {
   try
   {
-    TAO_DynUnion_i dyn_union;
-    dyn_union.init (*any);
-
-    DynamicAny::DynAny_var cc =
-      dyn_union.current_component ();
+    TAO::Any_CDR_View view (*any);
+    TAO::Any_CDR_View active;
 
-    CORBA::Any_var member = cc->to_any ();
+    if (!view.active_member (active))
+      {
+        return false;
+      }
 
-    CORBA::TypeCode_var tc = member->type ();
-    CORBA::TCKind kind = TAO_DynAnyFactory::unalias (tc.in ());
+    CORBA::TCKind kind = active.kind ();
 
     // The literal and the union member must be
     // of the same simple type.
@@ -1378,7 +1309,14 @@ TAO_Notify_Constraint_Visitor::union_does_contain (
         return false;
       }
 
-    TAO_ETCL_Literal_Constraint element (&member.inout ());
+    CORBA::Any member;
+
+    if (!active.value (member))
+      {
+        return false;
+      }
+
+    TAO_ETCL_Literal_Constraint element (&member);
 
     return (item == element);
   }
@@ -1388,6 +1326,49 @@ TAO_Notify_Constraint_Visitor::union_does_contain (
   }
 }
 
+CORBA::Boolean
+TAO_Notify_Constraint_Visitor::elements_do_contain (
+    const CORBA::Any *any,
+    TAO_ETCL_Literal_Constraint &item
+  )
+{
+  TAO::Any_CDR_View view (*any);
+  CORBA::ULong length = 0;
+
+  if (!view.length (length) || length == 0)
+    {
+      return false;
+    }
+
+  // Walk the elements in place, each one is copied out only to be
+  // compared.
+  TAO::Any_CDR_View element;
+
+  if (!view.element (0, element))
+    {
+      return false;
+    }
+
+  for (CORBA::ULong i = 0; i < length; ++i)
+    {
+      CORBA::Any value;
+
+      if ((i != 0 && !element.next ()) || !element.value (value))
+        {
+          return false;
+        }
+
+      TAO_ETCL_Literal_Constraint literal (&value);
+
+      if (item == literal)
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
 CORBA::Boolean
 TAO_Notify_Constraint_Visitor::any_does_contain (
     const CORBA::Any *any,
@@ -79,7 +79,7 @@ protected:
   int visit_binary_op (ETCL_Binary_Expr *binary_expr,
                        int op_type);
 
-  // These use dynamic anys to look inside the ETCL component.
+  // These read the ETCL component in place, see TAO::Any_CDR_View.
   CORBA::Boolean sequence_does_contain (const CORBA::Any *any,
                                         TAO_ETCL_Literal_Constraint &item);
   CORBA::Boolean array_does_contain (const CORBA::Any *any,
@@ -91,6 +91,10 @@ protected:
   CORBA::Boolean any_does_contain (const CORBA::Any *any,
                                    TAO_ETCL_Literal_Constraint &item);
 
+  /// Compare @a item with the elements of a sequence or array.
+  CORBA::Boolean elements_do_contain (const CORBA::Any *any,
+                                      TAO_ETCL_Literal_Constraint &item);
+
   /// Utility function to compare a TAO_ETCL_Literal_Constraint type
   /// and a type code.
   CORBA::Boolean simple_type_match (int expr_type, CORBA::TCKind tc_kind);
@@ -3,7 +3,8 @@
 #include "orbsvcs/Trader/Interpreter_Utils_T.h"
 #include "orbsvcs/Trader/Constraint_Tokens.h"
 
-#include "tao/DynamicAny/DynSequence_i.h"
+#include "tao/AnyTypeCode/Any_CDR_View.h"
+#include "tao/AnyTypeCode/Any.h"
 
 #include "ace/OS_NS_string.h"
 
@@ -598,164 +599,102 @@ sequence_does_contain (CORBA::Any* sequence,
 
 int
 TAO_Element_Equal<CORBA::Short>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::Short element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::Short value = dyn_any.get_short ();
-      return_value = (value == element);
-    }
-  catch (const CORBA::Exception&)
-    {
-    }
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::Short value;
+  return (cdr >> value) && value == element;
 }
 
 int
 TAO_Element_Equal<CORBA::UShort>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::UShort element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::UShort value = dyn_any.get_ushort ();
-      return_value = (value == element);
-    }
-  catch (const CORBA::Exception&)
-    {
-    }
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::UShort value;
+  return (cdr >> value) && value == element;
 }
 
 int
 TAO_Element_Equal<CORBA::Long>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::Long element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::Long value = dyn_any.get_long ();
-      return_value = (value == element);
-    }
-  catch (const CORBA::Exception&)
-    {
-    }
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::Long value;
+  return (cdr >> value) && value == element;
 }
 
 int
 TAO_Element_Equal<CORBA::ULong>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::ULong element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::ULong value = dyn_any.get_ulong ();
-      return_value = (value == element);
-    }
-  catch (const CORBA::Exception&)
-    {
-    }
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::ULong value;
+  return (cdr >> value) && value == element;
 }
 
 int
 TAO_Element_Equal<CORBA::LongLong>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::LongLong element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::LongLong value = dyn_any.get_longlong ();
-      return_value = (value == element);
-    }
-  catch (const CORBA::Exception&)
-    {
-    }
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::LongLong value;
+  return (cdr >> value) && value == element;
 }
 
 int
 TAO_Element_Equal<CORBA::ULongLong>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::ULongLong element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::ULongLong value = dyn_any.get_ulonglong ();
-      return_value = (value == element);
-    }
-  catch (const CORBA::Exception&)
-    {
-    }
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::ULongLong value;
+  return (cdr >> value) && value == element;
 }
 
 int
 TAO_Element_Equal<CORBA::Float>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::Float element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::Float value = dyn_any.get_float ();
-      return_value = ACE::is_equal (value, element);
-    }
-  catch (const CORBA::Exception&){}
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::Float value;
+  return (cdr >> value) && ACE::is_equal (value, element);
 }
 
 int
 TAO_Element_Equal<CORBA::Double>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::Double element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::Double value = dyn_any.get_double ();
-      return_value = ACE::is_equal (value, element);
-    }
-  catch (const CORBA::Exception&){}
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::Double value;
+  return (cdr >> value) && ACE::is_equal (value, element);
 }
 
 int
 TAO_Element_Equal<CORBA::Boolean>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              CORBA::Boolean element) const
 {
-  int return_value = 0;
-  try
-    {
-    CORBA::Boolean value = (CORBA::Boolean) dyn_any.get_short ();
-      return_value = (value == element);
-    }
-  catch (const CORBA::Exception&){}
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::Boolean value;
+  return (cdr >> ACE_InputCDR::to_boolean (value)) && value == element;
 }
 
 int
 TAO_Element_Equal<const char*>::
-operator () (TAO_DynSequence_i& dyn_any,
+operator () (const TAO::Any_CDR_View& element_view,
              const char* element) const
 {
-  int return_value = 0;
-  try
-    {
-      CORBA::String_var value = dyn_any.get_string ();
-      return_value = (ACE_OS::strcmp (value.in(), element) == 0);
-    }
-  catch (const CORBA::Exception&){}
-  return return_value;
+  TAO_InputCDR cdr (element_view.cdr ());
+  CORBA::String_var value;
+  return (cdr >> value.out ()) && ACE_OS::strcmp (value.in(), element) == 0;
 }
 
 TAO_Constraint_Validator::
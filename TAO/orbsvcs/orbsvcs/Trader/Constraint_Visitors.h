@@ -19,7 +19,10 @@
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
-class TAO_DynSequence_i;
+namespace TAO
+{
+  class Any_CDR_View;
+}
 
 class TAO_Constraint;
 class TAO_Unary_Constraint;
@@ -364,9 +367,9 @@ template<>
 class TAO_Element_Equal<CORBA::Short>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::Short element) const;
 };
 
@@ -374,9 +377,9 @@ template<>
 class TAO_Element_Equal<CORBA::UShort>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::UShort element) const;
 };
 
@@ -384,9 +387,9 @@ template<>
 class TAO_Element_Equal<CORBA::Long>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::Long element) const;
 };
 
@@ -394,9 +397,9 @@ template<>
 class TAO_Element_Equal<CORBA::ULong>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type, then
+  /// Reads the element at the position of element_view, then
   /// uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::ULong element) const;
 
 };
@@ -405,9 +408,9 @@ template<>
 class TAO_Element_Equal<CORBA::LongLong>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::LongLong element) const;
 };
 
@@ -415,9 +418,9 @@ template<>
 class TAO_Element_Equal<CORBA::ULongLong>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type, then
+  /// Reads the element at the position of element_view, then
   /// uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::ULongLong element) const;
 
 };
@@ -426,9 +429,9 @@ template<>
 class TAO_Element_Equal<CORBA::Float>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::Float element) const;
 };
 
@@ -436,9 +439,9 @@ template<>
 class TAO_Element_Equal<CORBA::Double>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::Double element) const;
 };
 
@@ -446,9 +449,9 @@ template<>
 class TAO_Element_Equal<CORBA::Boolean>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    CORBA::Boolean element) const;
 };
 
@@ -456,9 +459,9 @@ template<>
 class TAO_Element_Equal<const char*>
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type,
+  /// Reads the element at the position of element_view,
   /// then uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    const char* element) const;
 };
 
@@ -3,7 +3,7 @@
 
 #include "orbsvcs/Trader/Interpreter_Utils_T.h"
 #include "orbsvcs/Trader/Constraint_Visitors.h"
-#include "tao/DynamicAny/DynSequence_i.h"
+#include "tao/AnyTypeCode/Any_CDR_View.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -12,23 +12,27 @@ TAO_find (const CORBA::Any& sequence, const OPERAND_TYPE& element)
 {
   CORBA::Boolean return_value = 0;
   TAO_Element_Equal<OPERAND_TYPE> functor;
-  TAO_DynSequence_i dyn_seq;
 
   try
     {
-      dyn_seq.init (sequence);
+      // The elements are compared in the stream of the Any, none of
+      // them is decoded into a DynAny.
+      TAO::Any_CDR_View view (sequence);
+      TAO::Any_CDR_View element_view;
 
-      CORBA::ULong length =
-        dyn_seq.get_length ( );
-
-      dyn_seq.rewind( );
+      CORBA::ULong length = 0;
+      if (!view.length (length)
+          || length == 0
+          || !view.element (0, element_view))
+        return 0;
 
       for (CORBA::ULong i = 0 ; i < length && ! return_value; i++)
         {
-          if (functor (dyn_seq, element))
-            return_value = 1;
+          if (i != 0 && !element_view.next ())
+            break;
 
-          dyn_seq.next( );
+          if (functor (element_view, element))
+            return_value = 1;
         }
     }
   catch (const CORBA::Exception&)
@@ -275,7 +275,7 @@ TAO_Link_Attributes<IF>::max_link_follow_policy (void)
 
 template <class ELEMENT_TYPE> int
 TAO_Element_Equal<ELEMENT_TYPE>::
-operator () (TAO_DynSequence_i& ,
+operator () (const TAO::Any_CDR_View& ,
              const ELEMENT_TYPE&)
 {
   return 1;
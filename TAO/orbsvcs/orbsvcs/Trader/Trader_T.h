@@ -31,7 +31,10 @@
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
-class TAO_DynSequence_i;
+namespace TAO
+{
+  class Any_CDR_View;
+}
 
 /**
  * @class TAO_Trader
@@ -228,16 +231,16 @@ private:
  * @class TAO_Element_Equal
  *
  * @brief Function object for determining if the sequence element at the
- * current position of the dynamic sequence any parameter is equal to
+ * position of the Any_CDR_View parameter is equal to
  * the element parameter.
  */
 template <class ELEMENT_TYPE>
 class TAO_Element_Equal
 {
 public:
-  /// Calls the correct method on dyn_seq to extract the element type, then
+  /// Reads the element at the position of element_view, then
   /// uses the appropriate form of equals comparison.
-  int operator () (TAO_DynSequence_i& dyn_any,
+  int operator () (const TAO::Any_CDR_View& element_view,
                    const ELEMENT_TYPE& element);
 };
 
@@ -0,0 +1,236 @@
+#include "Counting_Consumer.h"
+#include "Counting_Supplier.h"
+#include "orbsvcs/Event_Utilities.h"
+#include "orbsvcs/Event/EC_Event_Channel.h"
+#include "orbsvcs/Event/EC_Default_Factory.h"
+
+// The events are pushed by the test itself and dispatched reactively,
+// they reach the consumers before push() returns and the counts are
+// exact, with and without the routing supplier filter.
+
+static const int event_source = 10;
+static const int other_source = 11;
+static const int type_a = 20;
+static const int type_b = 21;
+static const int type_c = 22;
+
+static const CORBA::ULong burst = 10;
+
+/// Connect @a consumer, or change its subscriptions, to the events of
+/// @a source with either type @a type or type @a other_type.
+static void
+subscribe (EC_Counting_Consumer &consumer,
+           RtecEventChannelAdmin::ConsumerAdmin_ptr consumer_admin,
+           int source,
+           int type,
+           int other_type = 0)
+{
+  ACE_ConsumerQOS_Factory consumer_qos;
+  consumer_qos.start_disjunction_group ();
+  consumer_qos.insert (source, type, 0);
+  if (other_type != 0)
+    consumer_qos.insert (source, other_type, 0);
+
+  consumer.connect (consumer_admin,
+                    consumer_qos.get_ConsumerQOS ());
+}
+
+/// Connect @a supplier, or change its publications, to push events
+/// of @a source and @a type.
+static void
+publish (EC_Counting_Supplier &supplier,
+         RtecEventChannelAdmin::SupplierAdmin_ptr supplier_admin,
+         int source,
+         int type)
+{
+  supplier.connect (supplier_admin, source, type, source, type);
+}
+
+/// Push @a burst events through @a supplier.
+static void
+push_burst (EC_Counting_Supplier &supplier)
+{
+  RtecEventComm::EventSet timeout;
+  for (CORBA::ULong i = 0; i != burst; ++i)
+    supplier.push (timeout);
+}
+
+/// Check that @a consumer received @a expected events so far.
+static int
+check (const char *step,
+       const char *name,
+       EC_Counting_Consumer &consumer,
+       CORBA::ULong expected)
+{
+  if (consumer.event_count != expected)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR - %C: %C received <%d> events instead of <%d>\n",
+                  step,
+                  name,
+                  consumer.event_count,
+                  expected));
+      return 1;
+    }
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  TAO_EC_Default_Factory::init_svcs ();
+
+  int status = 0;
+
+  try
+    {
+      // ORB initialization boiler plate...
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var object =
+        orb->resolve_initial_references ("RootPOA");
+      PortableServer::POA_var poa =
+        PortableServer::POA::_narrow (object.in ());
+      PortableServer::POAManager_var poa_manager =
+        poa->the_POAManager ();
+      poa_manager->activate ();
+
+      // ****************************************************************
+
+      TAO_EC_Event_Channel_Attributes attributes (poa.in (),
+                                                  poa.in ());
+      // The test changes subscriptions and publications by
+      // reconnecting.
+      attributes.consumer_reconnect = 1;
+      attributes.supplier_reconnect = 1;
+
+      TAO_EC_Event_Channel ec_impl (attributes);
+      ec_impl.activate ();
+
+      RtecEventChannelAdmin::EventChannel_var event_channel =
+        ec_impl._this ();
+
+      RtecEventChannelAdmin::ConsumerAdmin_var consumer_admin =
+        event_channel->for_consumers ();
+
+      RtecEventChannelAdmin::SupplierAdmin_var supplier_admin =
+        event_channel->for_suppliers ();
+
+      // ****************************************************************
+
+      // Subscribes to a single type.
+      EC_Counting_Consumer a_consumer ("Consumer/a");
+      subscribe (a_consumer, consumer_admin.in (), event_source, type_a);
+
+      // Subscribes to two types, it is in the routing table twice.
+      EC_Counting_Consumer bc_consumer ("Consumer/bc");
+      subscribe (bc_consumer, consumer_admin.in (),
+                 event_source, type_b, type_c);
+
+      // Subscribes to a source nobody publishes.
+      EC_Counting_Consumer other_consumer ("Consumer/other");
+      subscribe (other_consumer, consumer_admin.in (),
+                 other_source, type_a);
+
+      // Subscribes to any type, it is not in the routing table and
+      // always uses its filter tree.
+      EC_Counting_Consumer any_type_consumer ("Consumer/any_type");
+      subscribe (any_type_consumer, consumer_admin.in (), event_source, 0);
+
+      EC_Counting_Supplier supplier;
+      publish (supplier, supplier_admin.in (), event_source, type_a);
+
+      // ****************************************************************
+
+      CORBA::ULong a = 0;
+      CORBA::ULong bc = 0;
+      CORBA::ULong any_type = 0;
+
+      const char *step = "type a";
+      push_burst (supplier);
+      a += burst;
+      any_type += burst;
+      status += check (step, "a", a_consumer, a);
+      status += check (step, "bc", bc_consumer, bc);
+      status += check (step, "other", other_consumer, 0);
+      status += check (step, "any type", any_type_consumer, any_type);
+
+      // The supplier changes its publications.
+      step = "publications changed to type c";
+      publish (supplier, supplier_admin.in (), event_source, type_c);
+      push_burst (supplier);
+      bc += burst;
+      any_type += burst;
+      status += check (step, "a", a_consumer, a);
+      status += check (step, "bc", bc_consumer, bc);
+      status += check (step, "other", other_consumer, 0);
+      status += check (step, "any type", any_type_consumer, any_type);
+
+      // The consumers change their subscriptions, a_consumer now gets
+      // type c and no longer type a, bc_consumer keeps type b only.
+      step = "subscriptions changed";
+      subscribe (a_consumer, consumer_admin.in (), event_source, type_c);
+      subscribe (bc_consumer, consumer_admin.in (), event_source, type_b);
+      push_burst (supplier);
+      a += burst;
+      any_type += burst;
+      status += check (step, "a", a_consumer, a);
+      status += check (step, "bc", bc_consumer, bc);
+      status += check (step, "other", other_consumer, 0);
+      status += check (step, "any type", any_type_consumer, any_type);
+
+      step = "subscriptions changed, type a";
+      publish (supplier, supplier_admin.in (), event_source, type_a);
+      push_burst (supplier);
+      any_type += burst;
+      status += check (step, "a", a_consumer, a);
+      status += check (step, "bc", bc_consumer, bc);
+      status += check (step, "other", other_consumer, 0);
+      status += check (step, "any type", any_type_consumer, any_type);
+
+      step = "subscriptions changed, type b";
+      publish (supplier, supplier_admin.in (), event_source, type_b);
+      push_burst (supplier);
+      bc += burst;
+      any_type += burst;
+      status += check (step, "a", a_consumer, a);
+      status += check (step, "bc", bc_consumer, bc);
+      status += check (step, "other", other_consumer, 0);
+      status += check (step, "any type", any_type_consumer, any_type);
+
+      // A disconnected consumer leaves the routing table.
+      step = "consumer disconnected";
+      bc_consumer.disconnect ();
+      push_burst (supplier);
+      any_type += burst;
+      status += check (step, "bc", bc_consumer, bc);
+      status += check (step, "other", other_consumer, 0);
+      status += check (step, "any type", any_type_consumer, any_type);
+
+      // ****************************************************************
+
+      any_type_consumer.disconnect ();
+      other_consumer.disconnect ();
+      a_consumer.disconnect ();
+
+      supplier.disconnect ();
+
+      // ****************************************************************
+
+      event_channel->destroy ();
+
+      // ****************************************************************
+
+      poa->destroy (1, 1);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Service");
+      return 1;
+    }
+
+  return status == 0 ? 0 : 1;
+}
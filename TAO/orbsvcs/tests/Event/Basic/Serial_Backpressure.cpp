@@ -0,0 +1,286 @@
+#include "Counting_Supplier.h"
+
+#include "orbsvcs/Event_Utilities.h"
+#include "orbsvcs/Event/EC_Event_Channel.h"
+#include "orbsvcs/Event/EC_Default_Factory.h"
+#include "orbsvcs/Event/EC_Serial_Dispatching.h"
+#include "orbsvcs/RtecEventCommS.h"
+
+#include "ace/Atomic_Op.h"
+#include "ace/OS_NS_unistd.h"
+
+// The per-consumer high water mark used by the test, small enough to
+// be reached quickly by a consumer that sleeps on every event.
+static const size_t queue_hwm = 8;
+
+static const CORBA::ULong event_count = 200;
+
+/**
+ * @class Slow_Consumer
+ *
+ * @brief A consumer slower than its supplier.
+ */
+class Slow_Consumer : public POA_RtecEventComm::PushConsumer
+{
+public:
+  Slow_Consumer (void)
+    : received (0)
+  {
+  }
+
+  void connect (RtecEventChannelAdmin::ConsumerAdmin_ptr consumer_admin,
+                const RtecEventChannelAdmin::ConsumerQOS &qos)
+  {
+    RtecEventComm::PushConsumer_var consumer = this->_this ();
+    this->supplier_proxy_ = consumer_admin->obtain_push_supplier ();
+    this->supplier_proxy_->connect_push_consumer (consumer.in (), qos);
+  }
+
+  void disconnect (void)
+  {
+    this->supplier_proxy_->disconnect_push_supplier ();
+    this->supplier_proxy_ =
+      RtecEventChannelAdmin::ProxyPushSupplier::_nil ();
+
+    PortableServer::POA_var poa = this->_default_POA ();
+    PortableServer::ObjectId_var id = poa->servant_to_id (this);
+    poa->deactivate_object (id.in ());
+  }
+
+  virtual void push (const RtecEventComm::EventSet& events)
+  {
+    ACE_OS::sleep (ACE_Time_Value (0, 2000));
+    this->received += events.length ();
+  }
+
+  virtual void disconnect_push_consumer (void)
+  {
+  }
+
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, CORBA::ULong> received;
+
+private:
+  RtecEventChannelAdmin::ProxyPushSupplier_var supplier_proxy_;
+};
+
+/**
+ * @class Counting_Queue_Full_Action
+ *
+ * @brief Count the calls for a full queue and return a fixed action.
+ */
+class Counting_Queue_Full_Action : public TAO_EC_Queue_Full_Service_Object
+{
+public:
+  explicit Counting_Queue_Full_Action (int action)
+    : action_ (action),
+      calls (0)
+  {
+  }
+
+  virtual int queue_full_action (TAO_EC_Dispatching_Task *,
+                                 TAO_EC_ProxyPushSupplier *,
+                                 RtecEventComm::PushConsumer_ptr,
+                                 RtecEventComm::EventSet&)
+  {
+    ++this->calls;
+    return this->action_;
+  }
+
+private:
+  int action_;
+
+public:
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, CORBA::ULong> calls;
+};
+
+/**
+ * @class Serial_Factory
+ *
+ * @brief Create serial dispatching with a small high water mark.
+ */
+class Serial_Factory : public TAO_EC_Default_Factory
+{
+public:
+  explicit Serial_Factory (TAO_EC_Queue_Full_Service_Object *so)
+    : so_ (so)
+  {
+  }
+
+  virtual TAO_EC_Dispatching*
+      create_dispatching (TAO_EC_Event_Channel_Base*)
+  {
+    return new TAO_EC_Serial_Dispatching (1,
+                                          THR_NEW_LWP | THR_JOINABLE,
+                                          0,
+                                          1,
+                                          this->so_,
+                                          queue_hwm);
+  }
+
+private:
+  TAO_EC_Queue_Full_Service_Object *so_;
+};
+
+static void
+deactivate_servant (PortableServer::Servant servant)
+{
+  PortableServer::POA_var poa =
+    servant->_default_POA ();
+  PortableServer::ObjectId_var id =
+    poa->servant_to_id (servant);
+  poa->deactivate_object (id.in ());
+}
+
+static int
+run_test (PortableServer::POA_ptr poa, int action)
+{
+  Counting_Queue_Full_Action queue_full (action);
+  Serial_Factory factory (&queue_full);
+
+  TAO_EC_Event_Channel_Attributes attributes (poa, poa);
+  TAO_EC_Event_Channel ec_impl (attributes, &factory, 0);
+  ec_impl.activate ();
+
+  RtecEventChannelAdmin::EventChannel_var event_channel =
+    ec_impl._this ();
+
+  RtecEventChannelAdmin::ConsumerAdmin_var consumer_admin =
+    event_channel->for_consumers ();
+  RtecEventChannelAdmin::SupplierAdmin_var supplier_admin =
+    event_channel->for_suppliers ();
+
+  const int event_type = 20;
+  const int event_source = 10;
+
+  Slow_Consumer consumer;
+  {
+    ACE_ConsumerQOS_Factory consumer_qos;
+    consumer_qos.start_disjunction_group ();
+    consumer_qos.insert (event_source, event_type, 0);
+    consumer.connect (consumer_admin.in (),
+                      consumer_qos.get_ConsumerQOS ());
+  }
+
+  EC_Counting_Supplier supplier;
+  supplier.connect (supplier_admin.in (),
+                    event_source, event_type,
+                    event_source, event_type);
+
+  int status = 0;
+  RtecEventComm::EventSet unused;
+  for (CORBA::ULong i = 0; i != event_count; ++i)
+    {
+      supplier.push (unused);
+
+      // The events the consumer has not received yet are in its
+      // serial queue, which never grows past the high water mark.
+      CORBA::ULong const pending = (i + 1) - consumer.received.value ();
+      if (action == TAO_EC_Queue_Full_Service_Object::WAIT_TO_EMPTY
+          && pending > queue_hwm)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: %u events pending for the consumer, "
+                      "the high water mark is %u\n",
+                      pending, static_cast<CORBA::ULong> (queue_hwm)));
+          status = 1;
+          break;
+        }
+    }
+
+  // Let the pool drain the queue, the discarded events never arrive.
+  bool const discard =
+    action == TAO_EC_Queue_Full_Service_Object::SILENTLY_DISCARD;
+  for (int i = 0;
+       i != 500
+         && consumer.received.value ()
+              + (discard ? queue_full.calls.value () : 0) < event_count;
+       ++i)
+    {
+      ACE_OS::sleep (ACE_Time_Value (0, 10000));
+    }
+
+  CORBA::ULong const received = consumer.received.value ();
+  CORBA::ULong const calls = queue_full.calls.value ();
+
+  if (calls == 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: the queue full action was never called\n"));
+      status = 1;
+    }
+
+  if (!discard)
+    {
+      if (received != event_count)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: received %u events out of %u\n",
+                      received, event_count));
+          status = 1;
+        }
+    }
+  else if (received + calls != event_count)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: received %u events and discarded %u, "
+                  "%u were pushed\n",
+                  received, calls, event_count));
+      status = 1;
+    }
+
+  ACE_DEBUG ((LM_DEBUG,
+              "Serial backpressure (%C): received %u, queue full %u\n",
+              discard ? "discard" : "wait",
+              received, calls));
+
+  supplier.disconnect ();
+  consumer.disconnect ();
+
+  event_channel->destroy ();
+
+  deactivate_servant (&ec_impl);
+
+  return status;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  TAO_EC_Default_Factory::init_svcs ();
+
+  int status = 0;
+  try
+    {
+      // ORB initialization boiler plate...
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var object =
+        orb->resolve_initial_references ("RootPOA");
+      PortableServer::POA_var poa =
+        PortableServer::POA::_narrow (object.in ());
+      PortableServer::POAManager_var poa_manager =
+        poa->the_POAManager ();
+      poa_manager->activate ();
+
+      // ****************************************************************
+
+      status += run_test (poa.in (),
+                          TAO_EC_Queue_Full_Service_Object::WAIT_TO_EMPTY);
+
+      status += run_test (poa.in (),
+                          TAO_EC_Queue_Full_Service_Object::SILENTLY_DISCARD);
+
+      // ****************************************************************
+
+      poa->destroy (1, 1);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Service");
+      return 1;
+    }
+  return status;
+}
@@ -21,8 +21,12 @@ $svc_conf         = $test->LocalFile ("svc$conf_suffix");
 $observer_conf    = $test->LocalFile ("observer$conf_suffix");
 $svc_complex_conf = $test->LocalFile ("svc.complex$conf_suffix");
 $mt_svc_conf      = $test->LocalFile ("mt.svc$conf_suffix");
+$serial_svc_conf  = $test->LocalFile ("serial.svc$conf_suffix");
 $svc_complex_conf = $test->LocalFile ("svc.complex$conf_suffix");
 $control_conf     = $test->LocalFile ("control$conf_suffix");
+$routing_conf     = $test->LocalFile ("routing$conf_suffix");
+$marshal_conf     = $test->LocalFile ("marshal_once$conf_suffix");
+$epoch_conf       = $test->LocalFile ("epoch$conf_suffix");
 
 sub RunTest ($$$)
 {
@@ -70,6 +74,26 @@ RunTest ("Wildcard tests",
          "Wildcard",
          "-ORBsvcconf $svc_conf");
 
+RunTest ("Wildcard tests, routing supplier filter",
+         "Wildcard",
+         "-ORBsvcconf $routing_conf");
+
+RunTest ("Reconnect suppliers and consumers, routing supplier filter",
+         "Reconnect",
+         "-ORBsvcconf $routing_conf -suppliers 100 -consumers 100 -d 100 -s -c");
+
+RunTest ("Routing of event types to consumers",
+         "Routing",
+         "-ORBsvcconf $svc_conf");
+
+RunTest ("Routing of event types to consumers, routing supplier filter",
+         "Routing",
+         "-ORBsvcconf $routing_conf");
+
+RunTest ("Wildcard tests, marshal once",
+         "Wildcard",
+         "-ORBsvcconf $marshal_conf");
+
 RunTest ("Negation tests",
          "Negation",
          "-ORBsvcconf $svc_conf");
@@ -86,6 +110,18 @@ RunTest ("MT Disconnects test",
          "MT_Disconnect",
          "-ORBSvcConf $mt_svc_conf");
 
+RunTest ("MT Disconnects test, serial dispatching",
+         "MT_Disconnect",
+         "-ORBSvcConf $serial_svc_conf");
+
+RunTest ("Reconnect suppliers and consumers, serial dispatching",
+         "Reconnect",
+         "-ORBSvcConf $serial_svc_conf -suppliers 100 -consumers 100 -d 100");
+
+RunTest ("Serial dispatching with a slow consumer past the HWM",
+         "Serial_Backpressure",
+         "-ORBSvcConf $svc_conf");
+
 RunTest ("Atomic Reconnection test",
          "Atomic_Reconnect",
          "-ORBSvcConf $mt_svc_conf");
@@ -102,4 +138,12 @@ RunTest ("Random test",
          "Random",
          "-ORBSvcConf $svc_conf -suppliers 4 -consumers 4 -max_recursion 1");
 
+RunTest ("Random test, epoch collections",
+         "Random",
+         "-ORBSvcConf $epoch_conf -suppliers 4 -consumers 4 -max_recursion 1");
+
+RunTest ("Reconnect suppliers and consumers, epoch collections",
+         "Reconnect",
+         "-ORBSvcConf $epoch_conf -suppliers 100 -consumers 100 -d 100");
+
 exit $status;
@@ -0,0 +1,209 @@
+#include "orbsvcs/Notify/MIOP/Federation_Receiver.h"
+#include "orbsvcs/Notify/CosNotify_Service.h"
+#include "orbsvcs/PortableGroup/MIOP.h"
+#include "orbsvcs/PortableGroup/GOA.h"
+#include "orbsvcs/CosNotifyCommS.h"
+
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_stdio.h"
+
+static const ACE_TCHAR *group_ior =
+  ACE_TEXT ("corbaloc:miop:1.0@1.0-NotifyFederation-1/224.1.239.3:1235");
+static const ACE_TCHAR *ready_file = ACE_TEXT ("receiver.ready");
+static CORBA::ULong receiver_id = 1;
+static CORBA::ULong events = 200;
+
+/**
+ * Check that the events reach the local channel in order, and stop
+ * the ORB when all of them did.
+ */
+class Consumer : public virtual POA_CosNotifyComm::StructuredPushConsumer
+{
+public:
+  Consumer (CORBA::ORB_ptr orb)
+    : orb_ (CORBA::ORB::_duplicate (orb)),
+      received_ (0),
+      errors_ (0)
+  {
+  }
+
+  virtual void push_structured_event (
+      const CosNotification::StructuredEvent &event)
+  {
+    CORBA::ULong value = 0;
+    if (!(event.remainder_of_body >>= value) || value != this->received_)
+      {
+        ACE_ERROR ((LM_ERROR,
+                    "(%P|%t) receiver - ERROR: expected event %u, got %u\n",
+                    this->received_, value));
+        ++this->errors_;
+      }
+
+    if (++this->received_ == events)
+      this->orb_->shutdown (0);
+  }
+
+  virtual void disconnect_structured_push_consumer (void)
+  {
+  }
+
+  virtual void offer_change (const CosNotification::EventTypeSeq &,
+                             const CosNotification::EventTypeSeq &)
+  {
+  }
+
+  CORBA::ULong received (void) const
+  {
+    return this->received_;
+  }
+
+  CORBA::ULong errors (void) const
+  {
+    return this->errors_;
+  }
+
+private:
+  CORBA::ORB_var orb_;
+  CORBA::ULong received_;
+  CORBA::ULong errors_;
+};
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT ("g:o:i:n:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'g':
+        group_ior = get_opts.opt_arg ();
+        break;
+
+      case 'o':
+        ready_file = get_opts.opt_arg ();
+        break;
+
+      case 'i':
+        receiver_id = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'n':
+        events = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-g <group ior corbaloc> "
+                           "-o <ready file> "
+                           "-i <receiver id> "
+                           "-n <events>"
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  return 0;
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var obj = orb->resolve_initial_references ("RootPOA");
+      PortableGroup::GOA_var goa = PortableGroup::GOA::_narrow (obj.in ());
+      if (CORBA::is_nil (goa.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) receiver - nil RootPOA\n"),
+                          1);
+      PortableServer::POAManager_var manager = goa->the_POAManager ();
+      manager->activate ();
+
+      TAO_CosNotify_Service service;
+      service.init_service (orb.in ());
+      CosNotifyChannelAdmin::EventChannelFactory_var factory =
+        service.create (goa.in ());
+
+      CosNotifyChannelAdmin::ChannelID channel_id;
+      CosNotification::QoSProperties qos;
+      CosNotification::AdminProperties admin;
+      CosNotifyChannelAdmin::EventChannel_var channel =
+        factory->create_channel (qos, admin, channel_id);
+
+      // The local consumer
+      PortableServer::Servant_var<Consumer> consumer = new Consumer (orb.in ());
+      PortableServer::ObjectId_var id = goa->activate_object (consumer.in ());
+      obj = goa->id_to_reference (id.in ());
+      CosNotifyComm::StructuredPushConsumer_var consumer_ref =
+        CosNotifyComm::StructuredPushConsumer::_narrow (obj.in ());
+
+      CosNotifyChannelAdmin::ConsumerAdmin_var consumer_admin =
+        channel->default_consumer_admin ();
+      CosNotifyChannelAdmin::ProxyID proxy_id;
+      CosNotifyChannelAdmin::ProxySupplier_var proxy =
+        consumer_admin->obtain_notification_push_supplier (
+          CosNotifyChannelAdmin::STRUCTURED_EVENT, proxy_id);
+      CosNotifyChannelAdmin::StructuredProxyPushSupplier_var supplier =
+        CosNotifyChannelAdmin::StructuredProxyPushSupplier::_narrow (proxy.in ());
+      supplier->connect_structured_push_consumer (consumer_ref.in ());
+
+      // The gateway
+      PortableServer::Servant_var<TAO_Notify_Federation_Receiver> receiver =
+        new TAO_Notify_Federation_Receiver (receiver_id);
+      receiver->init (channel.in ());
+
+      CORBA::Object_var group = orb->string_to_object (group_ior);
+      receiver->join (goa.in (), group.in ());
+
+      FILE *output_file = ACE_OS::fopen (ready_file, "w");
+      if (output_file == 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "Cannot open output file <%s>\n",
+                           ready_file),
+                          1);
+      ACE_OS::fprintf (output_file, "ready\n");
+      ACE_OS::fclose (output_file);
+
+      ACE_Time_Value tv (60, 0);
+      orb->run (tv);
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "(%P|%t) receiver %u - received %u events, "
+                  "%Q lost by the sender\n",
+                  receiver_id,
+                  consumer->received (),
+                  receiver->lost_count ()));
+
+      CORBA::ULong const received = consumer->received ();
+      CORBA::ULong const errors = consumer->errors ();
+
+      receiver->shutdown ();
+      supplier->disconnect_structured_push_supplier ();
+      channel->destroy ();
+
+      goa->destroy (1, 1);
+      orb->destroy ();
+
+      if (received != events || errors != 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "(%P|%t) receiver - ERROR: "
+                           "%u events received, %u out of order\n",
+                           received, errors),
+                          1);
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+     & eval 'exec perl -S $0 $argv:q'
+     if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$status = 0;
+$debug_level = '0';
+
+foreach $i (@ARGV) {
+    if ($i eq '-debug') {
+        $debug_level = '10';
+    }
+}
+
+my $receiver1 = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+my $receiver2 = PerlACE::TestTarget::create_target (2) || die "Create target 2 failed\n";
+my $sender = PerlACE::TestTarget::create_target (3) || die "Create target 3 failed\n";
+
+my $ready1 = "receiver1.ready";
+my $ready2 = "receiver2.ready";
+
+my $receiver1_ready = $receiver1->LocalFile ($ready1);
+my $receiver2_ready = $receiver2->LocalFile ($ready2);
+$receiver1->DeleteFile ($ready1);
+$receiver2->DeleteFile ($ready2);
+
+$RV1 = $receiver1->CreateProcess ("receiver",
+                                  "-ORBdebuglevel $debug_level " .
+                                  "-i 1 -o $receiver1_ready");
+
+$RV2 = $receiver2->CreateProcess ("receiver",
+                                  "-ORBdebuglevel $debug_level " .
+                                  "-i 2 -o $receiver2_ready");
+
+$SN = $sender->CreateProcess ("sender",
+                              "-ORBdebuglevel $debug_level");
+
+sub KillReceivers {
+    $RV1->Kill (); $RV1->TimedWait (1);
+    $RV2->Kill (); $RV2->TimedWait (1);
+}
+
+if ($RV1->Spawn () != 0 || $RV2->Spawn () != 0) {
+    print STDERR "ERROR: cannot start the receivers\n";
+    KillReceivers ();
+    exit 1;
+}
+
+if ($receiver1->WaitForFileTimed ($ready1,
+                                  $receiver1->ProcessStartWaitInterval()) == -1
+    || $receiver2->WaitForFileTimed ($ready2,
+                                     $receiver2->ProcessStartWaitInterval()) == -1) {
+    print STDERR "ERROR: the receivers are not ready\n";
+    KillReceivers ();
+    exit 1;
+}
+
+$sender_status = $SN->SpawnWaitKill ($sender->ProcessStartWaitInterval() + 45);
+
+if ($sender_status != 0) {
+    print STDERR "ERROR: sender returned $sender_status\n";
+    $status = 1;
+}
+
+$receiver_status = $RV1->WaitKill ($receiver1->ProcessStopWaitInterval() + 60);
+
+if ($receiver_status != 0) {
+    print STDERR "ERROR: receiver 1 returned $receiver_status\n";
+    $status = 1;
+}
+
+$receiver_status = $RV2->WaitKill ($receiver2->ProcessStopWaitInterval() + 60);
+
+if ($receiver_status != 0) {
+    print STDERR "ERROR: receiver 2 returned $receiver_status\n";
+    $status = 1;
+}
+
+$receiver1->DeleteFile ($ready1);
+$receiver2->DeleteFile ($ready2);
+
+exit $status;
@@ -0,0 +1,163 @@
+#include "orbsvcs/Notify/MIOP/Federation_Sender.h"
+#include "orbsvcs/Notify/CosNotify_Service.h"
+#include "orbsvcs/PortableGroup/MIOP.h"
+#include "orbsvcs/CosNotifyChannelAdminC.h"
+
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_unistd.h"
+
+static const ACE_TCHAR *group_ior =
+  ACE_TEXT ("corbaloc:miop:1.0@1.0-NotifyFederation-1/224.1.239.3:1235");
+static CORBA::ULong events = 200;
+static CORBA::ULong drop = 7;
+
+/**
+ * Lose the first transmission of one message in @c drop, and of the
+ * last event, so the receivers have to use the NAKs and the
+ * announcements to get them.
+ */
+class Lossy_Sender : public TAO_Notify_Federation_Sender
+{
+public:
+  Lossy_Sender (void)
+    : TAO_Notify_Federation_Sender (1),
+      sent_ (0)
+  {
+  }
+
+protected:
+  virtual void send (NotifyFederation::SequenceNumber first,
+                     const CosNotification::EventBatch &batch)
+  {
+    if (first > this->sent_)
+      {
+        this->sent_ = first;
+        if (drop != 0 && (first % drop == 0 || first == events))
+          return;
+      }
+    this->TAO_Notify_Federation_Sender::send (first, batch);
+  }
+
+private:
+  NotifyFederation::SequenceNumber sent_;
+};
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT ("g:n:d:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'g':
+        group_ior = get_opts.opt_arg ();
+        break;
+
+      case 'n':
+        events = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'd':
+        drop = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-g <group ior corbaloc> "
+                           "-n <events> "
+                           "-d <drop one message in>"
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  return 0;
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var obj = orb->resolve_initial_references ("RootPOA");
+      PortableServer::POA_var poa = PortableServer::POA::_narrow (obj.in ());
+      PortableServer::POAManager_var manager = poa->the_POAManager ();
+      manager->activate ();
+
+      TAO_CosNotify_Service service;
+      service.init_service (orb.in ());
+      CosNotifyChannelAdmin::EventChannelFactory_var factory =
+        service.create (poa.in ());
+
+      CosNotifyChannelAdmin::ChannelID channel_id;
+      CosNotification::QoSProperties qos;
+      CosNotification::AdminProperties admin;
+      CosNotifyChannelAdmin::EventChannel_var channel =
+        factory->create_channel (qos, admin, channel_id);
+
+      CORBA::Object_var group = orb->string_to_object (group_ior);
+
+      PortableServer::Servant_var<Lossy_Sender> sender = new Lossy_Sender;
+      sender->init (orb.in (),
+                    poa.in (),
+                    channel.in (),
+                    group.in (),
+                    ACE_Time_Value (0, 200000));
+
+      CosNotifyChannelAdmin::SupplierAdmin_var supplier_admin =
+        channel->default_supplier_admin ();
+      CosNotifyChannelAdmin::ProxyID proxy_id;
+      CosNotifyChannelAdmin::ProxyConsumer_var proxy =
+        supplier_admin->obtain_notification_push_consumer (
+          CosNotifyChannelAdmin::STRUCTURED_EVENT, proxy_id);
+      CosNotifyChannelAdmin::StructuredProxyPushConsumer_var consumer =
+        CosNotifyChannelAdmin::StructuredProxyPushConsumer::_narrow (proxy.in ());
+      consumer->connect_structured_push_supplier (
+        CosNotifyComm::StructuredPushSupplier::_nil ());
+
+      for (CORBA::ULong i = 0; i != events; ++i)
+        {
+          CosNotification::StructuredEvent event;
+          event.header.fixed_header.event_type.domain_name =
+            CORBA::string_dup ("Federation");
+          event.header.fixed_header.event_type.type_name =
+            CORBA::string_dup ("Test");
+          event.header.fixed_header.event_name = CORBA::string_dup ("");
+          event.remainder_of_body <<= i;
+
+          consumer->push_structured_event (event);
+
+          // Let the receivers and the NAKs keep up.
+          ACE_Time_Value tv (0, 2000);
+          orb->run (tv);
+        }
+
+      // Serve the NAKs, and announce the last event.
+      ACE_Time_Value tv (5, 0);
+      orb->run (tv);
+
+      ACE_DEBUG ((LM_DEBUG, "(%P|%t) sender - sent %u events\n", events));
+
+      consumer->disconnect_structured_push_consumer ();
+      sender->shutdown ();
+      channel->destroy ();
+
+      poa->destroy (1, 1);
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
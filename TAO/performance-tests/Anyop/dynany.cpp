@@ -0,0 +1,288 @@
+
+//=============================================================================
+/**
+ *  @file   dynany.cpp
+ *
+ * Benchmark DynamicAny on large sequences: making the DynAny of a
+ * value and converting it back, reading a single element, and
+ * reading and replacing a sequence of longs in bulk.
+ */
+//=============================================================================
+
+
+#include "testC.h"
+#include "tao/DynamicAny/DynamicAny.h"
+#include "tao/AnyTypeCode/Any.h"
+#include "tao/CDR.h"
+#include "ace/Get_Opt.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/Stats.h"
+#include "ace/Throughput_Stats.h"
+#include "ace/Sample_History.h"
+#include "ace/OS_NS_stdlib.h"
+
+static int niterations = 20;
+static CORBA::ULong length = 100000;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("n:l:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'n':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'l':
+        length = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-n <iterations> "
+                           "-l <sequence length> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  return 0;
+}
+
+/// Demarshal a copy of @a any, encoded as in an Any received in a
+/// request.
+static bool
+encode (const CORBA::Any &any, CORBA::Any &encoded)
+{
+  TAO_OutputCDR out;
+  if (!(out << any))
+    {
+      return false;
+    }
+
+  TAO_InputCDR in (out);
+  return in >> encoded;
+}
+
+/// Make the DynAny of a value and convert it back to an Any.
+class Round_Trip
+{
+public:
+  Round_Trip (DynamicAny::DynAnyFactory_ptr factory,
+              const CORBA::Any &any)
+    : factory_ (factory),
+      any_ (any)
+  {
+  }
+
+  void operator() (void) const
+  {
+    DynamicAny::DynAny_var dyn = this->factory_->create_dyn_any (this->any_);
+    CORBA::Any_var result = dyn->to_any ();
+    dyn->destroy ();
+  }
+
+private:
+  DynamicAny::DynAnyFactory_ptr factory_;
+  const CORBA::Any &any_;
+};
+
+/// Make the DynAny of a sequence and read its middle element.
+class Read_Element
+{
+public:
+  Read_Element (DynamicAny::DynAnyFactory_ptr factory,
+                const CORBA::Any &any)
+    : factory_ (factory),
+      any_ (any)
+  {
+  }
+
+  void operator() (void) const
+  {
+    DynamicAny::DynAny_var dyn = this->factory_->create_dyn_any (this->any_);
+    dyn->seek (static_cast<CORBA::Long> (length / 2));
+    DynamicAny::DynAny_var element = dyn->current_component ();
+    CORBA::Any_var value = element->to_any ();
+    dyn->destroy ();
+  }
+
+private:
+  DynamicAny::DynAnyFactory_ptr factory_;
+  const CORBA::Any &any_;
+};
+
+/// Make the DynAny of a sequence and get all its elements as Anys.
+class Get_Elements
+{
+public:
+  Get_Elements (DynamicAny::DynAnyFactory_ptr factory,
+                const CORBA::Any &any)
+    : factory_ (factory),
+      any_ (any)
+  {
+  }
+
+  void operator() (void) const
+  {
+    DynamicAny::DynAny_var dyn = this->factory_->create_dyn_any (this->any_);
+    DynamicAny::DynSequence_var seq =
+      DynamicAny::DynSequence::_narrow (dyn.in ());
+    DynamicAny::AnySeq_var elements = seq->get_elements ();
+    dyn->destroy ();
+  }
+
+private:
+  DynamicAny::DynAnyFactory_ptr factory_;
+  const CORBA::Any &any_;
+};
+
+/// Make the DynAny of a sequence of longs, get its elements in bulk
+/// and put them back.
+class Bulk_Long_Seq
+{
+public:
+  Bulk_Long_Seq (DynamicAny::DynAnyFactory_ptr factory,
+                 const CORBA::Any &any)
+    : factory_ (factory),
+      any_ (any)
+  {
+  }
+
+  void operator() (void) const
+  {
+    DynamicAny::DynAny_var dyn = this->factory_->create_dyn_any (this->any_);
+    CORBA::LongSeq_var values = dyn->get_long_seq ();
+    dyn->insert_long_seq (values.in ());
+    CORBA::Any_var result = dyn->to_any ();
+    dyn->destroy ();
+  }
+
+private:
+  DynamicAny::DynAnyFactory_ptr factory_;
+  const CORBA::Any &any_;
+};
+
+template <typename OP>
+void
+measure (const ACE_TCHAR *name, const OP &op)
+{
+  ACE_Sample_History history (niterations);
+  ACE_hrtime_t test_start = ACE_OS::gethrtime ();
+
+  for (int j = 0; j != niterations; ++j)
+    {
+      ACE_hrtime_t start = ACE_OS::gethrtime ();
+
+      op ();
+
+      ACE_hrtime_t now = ACE_OS::gethrtime ();
+      history.sample (now - start);
+    }
+
+  ACE_hrtime_t test_end = ACE_OS::gethrtime ();
+
+  ACE_DEBUG ((LM_DEBUG,
+              "%s test finished\n",
+              name));
+
+  ACE_High_Res_Timer::global_scale_factor_type gsf =
+    ACE_High_Res_Timer::global_scale_factor ();
+
+  ACE_Basic_Stats stats;
+  history.collect_basic_stats (stats);
+  stats.dump_results (name, gsf);
+
+  ACE_Throughput_Stats::dump_throughput (name,
+                                         gsf,
+                                         test_end - test_start,
+                                         stats.samples_count ());
+
+  ACE_DEBUG ((LM_DEBUG, "\n"));
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var obj =
+        orb->resolve_initial_references ("DynAnyFactory");
+
+      DynamicAny::DynAnyFactory_var factory =
+        DynamicAny::DynAnyFactory::_narrow (obj.in ());
+
+      Param_Test::StructSeq structs (length);
+      structs.length (length);
+
+      Param_Test::Long_Seq longs (length);
+      longs.length (length);
+
+      for (CORBA::ULong i = 0; i != length; ++i)
+        {
+          structs[i].l = static_cast<CORBA::Long> (i);
+          structs[i].c = 'c';
+          structs[i].s = static_cast<CORBA::Short> (i);
+          structs[i].o = static_cast<CORBA::Octet> (i);
+          structs[i].f = 2.3f;
+          structs[i].b = (i % 2) == 0;
+          structs[i].d = 3.1416;
+
+          longs[i] = static_cast<CORBA::Long> (i);
+        }
+
+      CORBA::Any inserted;
+      CORBA::Any structs_any;
+      inserted <<= structs;
+      if (!encode (inserted, structs_any))
+        ACE_ERROR_RETURN ((LM_ERROR, "ERROR: cannot encode the structs\n"),
+                          1);
+
+      CORBA::Any longs_any;
+      inserted <<= longs;
+      if (!encode (inserted, longs_any))
+        ACE_ERROR_RETURN ((LM_ERROR, "ERROR: cannot encode the longs\n"),
+                          1);
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "High resolution timer calibration...."));
+      ACE_High_Res_Timer::global_scale_factor ();
+      ACE_DEBUG ((LM_DEBUG,
+                  "done\n\n"));
+
+      measure (ACE_TEXT ("StructSeq round trip"),
+               Round_Trip (factory.in (), structs_any));
+      measure (ACE_TEXT ("StructSeq element"),
+               Read_Element (factory.in (), structs_any));
+      measure (ACE_TEXT ("StructSeq get_elements"),
+               Get_Elements (factory.in (), structs_any));
+
+      measure (ACE_TEXT ("Long_Seq round trip"),
+               Round_Trip (factory.in (), longs_any));
+      measure (ACE_TEXT ("Long_Seq element"),
+               Read_Element (factory.in (), longs_any));
+      measure (ACE_TEXT ("Long_Seq get_elements"),
+               Get_Elements (factory.in (), longs_any));
+      measure (ACE_TEXT ("Long_Seq bulk get and insert"),
+               Bulk_Long_Seq (factory.in (), longs_any));
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("DynAny benchmark");
+      return 1;
+    }
+
+  return 0;
+}
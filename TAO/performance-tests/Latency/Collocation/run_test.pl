@@ -9,15 +9,21 @@ use PerlACE::TestTarget;
 
 $status = 0;
 $debug_level = '0';
+$svc_conf = 'svc.conf';
 
 foreach $i (@ARGV) {
     if ($i eq '-debug') {
         $debug_level = '10';
     }
+    elsif ($i eq '-nocache') {
+        $svc_conf = 'svc_nocache.conf';
+    }
 }
 
 my $test = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
-$T = $test->CreateProcess ("Collocated_Test", "-ORBdebuglevel $debug_level");
+my $test_conf = $test->LocalFile ($svc_conf);
+$T = $test->CreateProcess ("Collocated_Test",
+                           "-ORBdebuglevel $debug_level -ORBSvcConf $test_conf");
 $test_status = $T->SpawnWaitKill ($test->ProcessStartWaitInterval() + 45);
 
 if ($test_status != 0) {
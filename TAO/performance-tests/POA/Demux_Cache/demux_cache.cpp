@@ -0,0 +1,169 @@
+#include "TestS.h"
+#include "tao/PortableServer/PortableServer.h"
+#include "ace/Get_Opt.h"
+#include "ace/Basic_Stats.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_stdio.h"
+
+int niterations = 100000;
+int nobjects = 10;
+int depth = 1;
+
+class Target : public virtual POA_Test::Target
+{
+public:
+  virtual CORBA::Long echo (CORBA::Long x)
+  {
+    return x;
+  }
+};
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("i:n:d:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'i':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'n':
+        nobjects = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'd':
+        depth = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-i <niterations> "
+                           "-n <nobjects> "
+                           "-d <poa depth> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  if (nobjects <= 0 || depth < 0)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       "The number of objects must be positive and the depth not negative\n"),
+                      -1);
+
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// Make @a niterations requests, on object (i / burst) % nobjects
+/// for request i.
+void
+run (const ACE_TCHAR *msg,
+     Test::Target_ptr *objects,
+     int burst,
+     ACE_High_Res_Timer::global_scale_factor_type gsf)
+{
+  ACE_Basic_Stats latency;
+
+  for (int i = 0; i != niterations; ++i)
+    {
+      ACE_hrtime_t start = ACE_OS::gethrtime ();
+
+      (void) objects[(i / burst) % nobjects]->echo (i);
+
+      ACE_hrtime_t now = ACE_OS::gethrtime ();
+      latency.sample (now - start);
+    }
+
+  latency.dump_results (msg, gsf);
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var poa_object =
+        orb->resolve_initial_references("RootPOA");
+
+      if (CORBA::is_nil (poa_object.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Unable to initialize the POA.\n"),
+                          1);
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      // The objects are in a POA nested <depth> levels below the
+      // RootPOA, so finding the POA walks a longer name.
+      CORBA::PolicyList policies (0);
+      PortableServer::POA_var poa =
+        PortableServer::POA::_duplicate (root_poa.in ());
+      for (int d = 0; d != depth; ++d)
+        {
+          char name[32];
+          ACE_OS::sprintf (name, "Child_POA_%d", d);
+          poa = poa->create_POA (name, poa_manager.in (), policies);
+        }
+
+      Target *servants = 0;
+      ACE_NEW_RETURN (servants, Target[nobjects], 1);
+      Test::Target_ptr *objects = 0;
+      ACE_NEW_RETURN (objects, Test::Target_ptr[nobjects], 1);
+      for (int i = 0; i != nobjects; ++i)
+        {
+          PortableServer::ObjectId_var id =
+            poa->activate_object (&servants[i]);
+          CORBA::Object_var object =
+            poa->id_to_reference (id.in ());
+          objects[i] = Test::Target::_narrow (object.in ());
+        }
+
+      ACE_DEBUG ((LM_DEBUG, "High resolution timer calibration...."));
+      ACE_High_Res_Timer::global_scale_factor_type gsf =
+        ACE_High_Res_Timer::global_scale_factor ();
+      ACE_DEBUG ((LM_DEBUG, "done\n"));
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "Making %d requests on %d objects at depth %d\n",
+                  niterations, nobjects, depth));
+
+      // Every request on the same object, then bursts of requests on
+      // the same object, then a different object every time.
+      run (ACE_TEXT("Same target"), objects, niterations, gsf);
+      run (ACE_TEXT("Bursts of 10"), objects, 10, gsf);
+      run (ACE_TEXT("Round robin"), objects, 1, gsf);
+
+      for (int i = 0; i != nobjects; ++i)
+        CORBA::release (objects[i]);
+      delete [] objects;
+
+      root_poa->destroy (1, 1);
+      delete [] servants;
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
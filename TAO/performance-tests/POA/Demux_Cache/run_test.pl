@@ -0,0 +1,32 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$iterations = 100000;
+$status = 0;
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+$SV = $server->CreateProcess ("demux_cache");
+
+foreach $conf ("", "-ORBSvcConf no_cache.conf") {
+    foreach $depth (1, 4) {
+        print STDERR "================ Demux Cache Test, depth $depth $conf\n";
+
+        $SV->Arguments ("-i $iterations -d $depth $conf");
+
+        $test_status = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval() + 100);
+
+        if ($test_status != 0) {
+            print STDERR "ERROR: demux_cache returned $test_status\n";
+            $status = 1;
+        }
+    }
+}
+
+exit $status;
@@ -0,0 +1,98 @@
+// The operations of the interfaces of Test.idl, which are declared
+// the same way.
+
+#ifndef OPERATIONS_H
+#define OPERATIONS_H
+
+#include "TestC.h"
+
+#define VERBS_5(OP, CTX, noun) \
+  OP (CTX, get, noun) OP (CTX, set, noun) OP (CTX, find, noun) \
+  OP (CTX, list, noun) OP (CTX, create, noun)
+
+#define VERBS_10(OP, CTX, noun) \
+  VERBS_5 (OP, CTX, noun) \
+  OP (CTX, remove, noun) OP (CTX, update, noun) OP (CTX, reset, noun) \
+  OP (CTX, enable, noun) OP (CTX, disable, noun)
+
+/// Apply OP (CTX, verb, noun) to each operation of Ops_5, Ops_50 and
+/// Ops_500.
+#define OPS_5(OP, CTX) \
+  VERBS_5 (OP, CTX, account)
+
+#define OPS_50(OP, CTX) \
+  VERBS_10 (OP, CTX, account) \
+  VERBS_10 (OP, CTX, address) \
+  VERBS_10 (OP, CTX, alarm) \
+  VERBS_10 (OP, CTX, balance) \
+  VERBS_10 (OP, CTX, batch)
+
+#define OPS_500(OP, CTX) \
+  OPS_50 (OP, CTX) \
+  VERBS_10 (OP, CTX, channel) \
+  VERBS_10 (OP, CTX, client) \
+  VERBS_10 (OP, CTX, config) \
+  VERBS_10 (OP, CTX, counter) \
+  VERBS_10 (OP, CTX, device) \
+  VERBS_10 (OP, CTX, domain) \
+  VERBS_10 (OP, CTX, event) \
+  VERBS_10 (OP, CTX, filter) \
+  VERBS_10 (OP, CTX, group) \
+  VERBS_10 (OP, CTX, handle) \
+  VERBS_10 (OP, CTX, history) \
+  VERBS_10 (OP, CTX, identity) \
+  VERBS_10 (OP, CTX, index) \
+  VERBS_10 (OP, CTX, item) \
+  VERBS_10 (OP, CTX, job) \
+  VERBS_10 (OP, CTX, key) \
+  VERBS_10 (OP, CTX, label) \
+  VERBS_10 (OP, CTX, limit) \
+  VERBS_10 (OP, CTX, link) \
+  VERBS_10 (OP, CTX, log) \
+  VERBS_10 (OP, CTX, mode) \
+  VERBS_10 (OP, CTX, node) \
+  VERBS_10 (OP, CTX, order) \
+  VERBS_10 (OP, CTX, owner) \
+  VERBS_10 (OP, CTX, peer) \
+  VERBS_10 (OP, CTX, policy) \
+  VERBS_10 (OP, CTX, port) \
+  VERBS_10 (OP, CTX, priority) \
+  VERBS_10 (OP, CTX, profile) \
+  VERBS_10 (OP, CTX, queue) \
+  VERBS_10 (OP, CTX, rate) \
+  VERBS_10 (OP, CTX, record) \
+  VERBS_10 (OP, CTX, region) \
+  VERBS_10 (OP, CTX, report) \
+  VERBS_10 (OP, CTX, resource) \
+  VERBS_10 (OP, CTX, role) \
+  VERBS_10 (OP, CTX, route) \
+  VERBS_10 (OP, CTX, rule) \
+  VERBS_10 (OP, CTX, schedule) \
+  VERBS_10 (OP, CTX, session) \
+  VERBS_10 (OP, CTX, state) \
+  VERBS_10 (OP, CTX, status) \
+  VERBS_10 (OP, CTX, stream) \
+  VERBS_10 (OP, CTX, target) \
+  VERBS_10 (OP, CTX, timer)
+
+#define OPERATION_POINTER(CTX, verb, noun) &CTX::verb ## _ ## noun,
+
+/// The operations of Test::Ops_5.
+CORBA::Long (Test::Ops_5::* const ops_5_operations[]) (CORBA::Long) =
+{
+  OPS_5 (OPERATION_POINTER, Test::Ops_5)
+};
+
+/// The operations of Test::Ops_50.
+CORBA::Long (Test::Ops_50::* const ops_50_operations[]) (CORBA::Long) =
+{
+  OPS_50 (OPERATION_POINTER, Test::Ops_50)
+};
+
+/// The operations of Test::Ops_500.
+CORBA::Long (Test::Ops_500::* const ops_500_operations[]) (CORBA::Long) =
+{
+  OPS_500 (OPERATION_POINTER, Test::Ops_500)
+};
+
+#endif /* OPERATIONS_H */
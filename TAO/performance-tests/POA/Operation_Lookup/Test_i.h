@@ -0,0 +1,31 @@
+// The servants of the interfaces of Test.idl, each operation
+// returns its argument.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "TestS.h"
+#include "Operations.h"
+
+#define SERVANT_OPERATION(CTX, verb, noun) \
+  virtual CORBA::Long verb ## _ ## noun (CORBA::Long x) { return x; }
+
+class Ops_5_i : public virtual POA_Test::Ops_5
+{
+public:
+  OPS_5 (SERVANT_OPERATION, Ops_5)
+};
+
+class Ops_50_i : public virtual POA_Test::Ops_50
+{
+public:
+  OPS_50 (SERVANT_OPERATION, Ops_50)
+};
+
+class Ops_500_i : public virtual POA_Test::Ops_500
+{
+public:
+  OPS_500 (SERVANT_OPERATION, Ops_500)
+};
+
+#endif /* TEST_I_H */
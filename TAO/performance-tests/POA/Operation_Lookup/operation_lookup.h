@@ -0,0 +1,130 @@
+// The test itself, compiled against the skeletons of each operation
+// lookup strategy, see Operation_Lookup.mpc.
+
+#ifndef OPERATION_LOOKUP_H
+#define OPERATION_LOOKUP_H
+
+#include "Test_i.h"
+#include "Operations.h"
+#include "tao/PortableServer/PortableServer.h"
+#include "ace/Get_Opt.h"
+#include "ace/Basic_Stats.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_stdio.h"
+
+int niterations = 100000;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("i:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'i':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-i <niterations> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// Make @a niterations requests on an object of @a SERVANT, cycling
+/// through its @a noperations operations.
+template <typename SERVANT, typename INTERFACE>
+void
+run (PortableServer::POA_ptr poa,
+     CORBA::Long (INTERFACE::* const *operations) (CORBA::Long),
+     int noperations,
+     ACE_High_Res_Timer::global_scale_factor_type gsf)
+{
+  SERVANT servant;
+  PortableServer::ObjectId_var id = poa->activate_object (&servant);
+  CORBA::Object_var object = poa->id_to_reference (id.in ());
+  typename INTERFACE::_var_type target = INTERFACE::_narrow (object.in ());
+
+  ACE_Basic_Stats latency;
+
+  for (int i = 0; i != niterations; ++i)
+    {
+      ACE_hrtime_t start = ACE_OS::gethrtime ();
+
+      (void) (target.in ()->*operations[i % noperations]) (i);
+
+      ACE_hrtime_t now = ACE_OS::gethrtime ();
+      latency.sample (now - start);
+    }
+
+  ACE_TCHAR msg[64];
+  ACE_OS::sprintf (msg, ACE_TEXT("%d operations"), noperations);
+  latency.dump_results (msg, gsf);
+
+  poa->deactivate_object (id.in ());
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var poa_object =
+        orb->resolve_initial_references("RootPOA");
+
+      if (CORBA::is_nil (poa_object.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Unable to initialize the POA.\n"),
+                          1);
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      ACE_DEBUG ((LM_DEBUG, "High resolution timer calibration...."));
+      ACE_High_Res_Timer::global_scale_factor_type gsf =
+        ACE_High_Res_Timer::global_scale_factor ();
+      ACE_DEBUG ((LM_DEBUG, "done\n"));
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "Making %d requests on each interface\n",
+                  niterations));
+
+      run<Ops_5_i, Test::Ops_5> (root_poa.in (), ops_5_operations, 5, gsf);
+      run<Ops_50_i, Test::Ops_50> (root_poa.in (), ops_50_operations, 50, gsf);
+      run<Ops_500_i, Test::Ops_500> (root_poa.in (), ops_500_operations, 500, gsf);
+
+      root_poa->destroy (1, 1);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
+
+#endif /* OPERATION_LOOKUP_H */
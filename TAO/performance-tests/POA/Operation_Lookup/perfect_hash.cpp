@@ -0,0 +1,3 @@
+// The skeletons in perfect_hash_skel/ use the default perfect hashing
+// operation lookup.
+#include "operation_lookup.h"
@@ -0,0 +1,28 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$iterations = 100000;
+$status = 0;
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+foreach $strategy ("perfect_hash", "switch_dispatch") {
+    print STDERR "================ Operation Lookup Test, $strategy\n";
+
+    $SV = $server->CreateProcess ($strategy, "-i $iterations");
+
+    $test_status = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval() + 100);
+
+    if ($test_status != 0) {
+        print STDERR "ERROR: $strategy returned $test_status\n";
+        $status = 1;
+    }
+}
+
+exit $status;
@@ -0,0 +1,3 @@
+// The skeletons in switch_skel/ use the switch operation lookup, generated
+// with -H switch.
+#include "operation_lookup.h"
@@ -0,0 +1,48 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$iterations = 100000;
+$status = 0;
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+$SV = $server->CreateProcess ("servant_lookup");
+
+foreach $churn ("", "-c") {
+    foreach $threads (1, 2, 4, 8) {
+        print STDERR "================ Servant Lookup Test, $threads threads $churn\n";
+
+        $SV->Arguments ("-i $iterations -t $threads $churn");
+
+        $test_status = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval() + 100);
+
+        if ($test_status != 0) {
+            print STDERR "ERROR: servant_lookup returned $test_status\n";
+            $status = 1;
+        }
+    }
+}
+
+# The lookup cost should not depend on the number of objects.
+foreach $conf ("", "-ORBSvcConf indexed.conf") {
+    foreach $objects (100, 10000, 100000) {
+        print STDERR "================ Servant Lookup Test, $objects objects $conf\n";
+
+        $SV->Arguments ("-i $iterations -t 1 -n $objects $conf");
+
+        $test_status = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval() + 100);
+
+        if ($test_status != 0) {
+            print STDERR "ERROR: servant_lookup returned $test_status\n";
+            $status = 1;
+        }
+    }
+}
+
+exit $status;
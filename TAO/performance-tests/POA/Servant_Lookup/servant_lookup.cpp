@@ -0,0 +1,282 @@
+#include "TestS.h"
+#include "tao/PortableServer/PortableServer.h"
+#include "ace/Get_Opt.h"
+#include "ace/Task.h"
+#include "ace/Basic_Stats.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/Atomic_Op.h"
+#include "ace/OS_NS_time.h"
+
+int niterations = 100000;
+int nthreads = 4;
+int nobjects = 100;
+int do_churn = 0;
+
+class Target : public virtual POA_Test::Target
+{
+public:
+  virtual CORBA::Long echo (CORBA::Long x)
+  {
+    return x;
+  }
+};
+
+/// Make requests on all the objects, one after the other.
+class Worker : public ACE_Task_Base
+{
+public:
+  Worker (Test::Target_ptr *objects)
+    : objects_ (objects)
+  {
+  }
+
+  virtual int svc (void)
+  {
+    try
+      {
+        for (int i = 0; i != niterations; ++i)
+          {
+            ACE_hrtime_t start = ACE_OS::gethrtime ();
+
+            (void) this->objects_[i % nobjects]->echo (i);
+
+            ACE_hrtime_t now = ACE_OS::gethrtime ();
+            this->latency_.sample (now - start);
+          }
+      }
+    catch (const CORBA::Exception& ex)
+      {
+        ex._tao_print_exception ("Worker::svc");
+        return -1;
+      }
+    return 0;
+  }
+
+  void accumulate_and_dump (ACE_Basic_Stats &totals,
+                            const ACE_TCHAR *msg,
+                            ACE_High_Res_Timer::global_scale_factor_type gsf)
+  {
+    totals.accumulate (this->latency_);
+    this->latency_.dump_results (msg, gsf);
+  }
+
+private:
+  Test::Target_ptr *objects_;
+  ACE_Basic_Stats latency_;
+};
+
+/// Activate and deactivate an object until told to stop.
+class Churn : public ACE_Task_Base
+{
+public:
+  Churn (PortableServer::POA_ptr poa)
+    : poa_ (PortableServer::POA::_duplicate (poa)),
+      stop_ (0),
+      cycles_ (0)
+  {
+  }
+
+  virtual int svc (void)
+  {
+    try
+      {
+        Target servant;
+        while (this->stop_ == 0)
+          {
+            PortableServer::ObjectId_var id =
+              this->poa_->activate_object (&servant);
+            this->poa_->deactivate_object (id.in ());
+            ++this->cycles_;
+          }
+      }
+    catch (const CORBA::Exception& ex)
+      {
+        ex._tao_print_exception ("Churn::svc");
+        return -1;
+      }
+    return 0;
+  }
+
+  void stop (void)
+  {
+    this->stop_ = 1;
+  }
+
+  unsigned long cycles (void) const
+  {
+    return this->cycles_;
+  }
+
+private:
+  PortableServer::POA_var poa_;
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, int> stop_;
+  unsigned long cycles_;
+};
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("i:t:n:c"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'i':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 't':
+        nthreads = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'n':
+        nobjects = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'c':
+        do_churn = 1;
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-i <niterations> "
+                           "-t <nthreads> "
+                           "-n <nobjects> "
+                           "-c "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  if (nthreads <= 0 || nobjects <= 0)
+    ACE_ERROR_RETURN ((LM_ERROR,
+                       "The number of threads and objects must be positive\n"),
+                      -1);
+
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var poa_object =
+        orb->resolve_initial_references("RootPOA");
+
+      if (CORBA::is_nil (poa_object.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Unable to initialize the POA.\n"),
+                          1);
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      Target *servants = 0;
+      ACE_NEW_RETURN (servants, Target[nobjects], 1);
+      Test::Target_ptr *objects = 0;
+      ACE_NEW_RETURN (objects, Test::Target_ptr[nobjects], 1);
+      for (int i = 0; i != nobjects; ++i)
+        {
+          PortableServer::ObjectId_var id =
+            root_poa->activate_object (&servants[i]);
+          CORBA::Object_var object =
+            root_poa->id_to_reference (id.in ());
+          objects[i] = Test::Target::_narrow (object.in ());
+        }
+
+      ACE_DEBUG ((LM_DEBUG, "High resolution timer calibration...."));
+      ACE_High_Res_Timer::global_scale_factor_type gsf =
+        ACE_High_Res_Timer::global_scale_factor ();
+      ACE_DEBUG ((LM_DEBUG, "done\n"));
+
+      Churn churn (root_poa.in ());
+      if (do_churn
+          && churn.activate (THR_NEW_LWP | THR_JOINABLE, 1, 1) == -1)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "Cannot activate the churn thread\n"),
+                          1);
+
+      Worker **workers = 0;
+      ACE_NEW_RETURN (workers, Worker *[nthreads], 1);
+      for (int j = 0; j != nthreads; ++j)
+        ACE_NEW_RETURN (workers[j], Worker (objects), 1);
+
+      ACE_DEBUG ((LM_DEBUG,
+                  "Making %d requests on %d objects in %d threads\n",
+                  niterations, nobjects, nthreads));
+
+      ACE_hrtime_t test_start = ACE_OS::gethrtime ();
+      for (int j = 0; j != nthreads; ++j)
+        {
+          if (workers[j]->activate (THR_NEW_LWP | THR_JOINABLE, 1, 1) == -1)
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "Cannot activate worker thread %d\n", j),
+                              1);
+        }
+      for (int j = 0; j != nthreads; ++j)
+        workers[j]->wait ();
+      ACE_hrtime_t test_end = ACE_OS::gethrtime ();
+
+      churn.stop ();
+      churn.wait ();
+
+      ACE_Basic_Stats totals;
+      for (int j = 0; j != nthreads; ++j)
+        {
+          ACE_TCHAR buf[64];
+          ACE_OS::sprintf (buf, ACE_TEXT("Thread[%d]"), j);
+          workers[j]->accumulate_and_dump (totals, buf, gsf);
+          delete workers[j];
+        }
+      delete [] workers;
+
+      totals.dump_results (ACE_TEXT("Aggregated"), gsf);
+
+      ACE_hrtime_t const elapsed = (test_end - test_start) / gsf;
+      if (elapsed != 0)
+        {
+          ACE_UINT64 const requests =
+            static_cast<ACE_UINT64> (niterations) * nthreads;
+          ACE_DEBUG ((LM_DEBUG,
+                      "Throughput: %Q requests/second\n",
+                      requests * 1000000 / elapsed));
+        }
+
+      if (do_churn)
+        ACE_DEBUG ((LM_DEBUG,
+                    "Activation cycles: %lu\n",
+                    churn.cycles ()));
+
+      for (int i = 0; i != nobjects; ++i)
+        CORBA::release (objects[i]);
+      delete [] objects;
+
+      root_poa->destroy (1, 1);
+      delete [] servants;
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,39 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file   Compressors.h
+ *
+ *  Each benchmark executable links one of the *_compressors.cpp files,
+ *  which creates the compressor factories it measures.
+ */
+//=============================================================================
+
+#ifndef BENCHMARK_COMPRESSORS_H
+#define BENCHMARK_COMPRESSORS_H
+
+#include "tao/Compression/Compression.h"
+#include "ace/Vector_T.h"
+
+struct Compressor_Under_Test
+{
+  /// Name of the compressor in the results.
+  const char *label;
+
+  ::Compression::CompressorFactory_var factory;
+};
+
+typedef ACE_Vector<Compressor_Under_Test> Compressor_List;
+
+/**
+ * Add the factories to measure to @a compressors.  @a samples holds
+ * @a sample_count messages like the measured ones, one after the
+ * other, @a sample_sizes gives their sizes: factories that use a
+ * dictionary can train it on them.  Returns -1 on failure.
+ */
+int create_compressors (const ::Compression::Buffer &samples,
+                        const size_t *sample_sizes,
+                        unsigned int sample_count,
+                        Compressor_List &compressors);
+
+#endif /* BENCHMARK_COMPRESSORS_H */
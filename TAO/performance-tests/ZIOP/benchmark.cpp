@@ -0,0 +1,289 @@
+//=============================================================================
+/**
+ *  @file   benchmark.cpp
+ *
+ * Measure the ratio and the throughput of the ZIOP compressors on
+ * marshaled IDL payloads, from single small records to large
+ * sequences.
+ */
+//=============================================================================
+
+#include "PayloadC.h"
+#include "Compressors.h"
+#include "tao/CDR.h"
+#include "ace/Get_Opt.h"
+#include "ace/High_Res_Timer.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_stdio.h"
+
+static int niterations = 200;
+static ::Compression::CompressionLevel level = 3;
+
+/// The measured messages of each payload, the dictionaries are
+/// trained on other ones.
+static const CORBA::ULong nmessages = 64;
+static const CORBA::ULong nsamples = 256;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("n:l:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'n':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case 'l':
+        level = static_cast< ::Compression::CompressionLevel> (
+          ACE_OS::atoi (get_opts.opt_arg ()));
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-n <iterations> "
+                           "-l <compression level> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  return 0;
+}
+
+/// Deterministic pseudo random numbers, so all the runs measure the
+/// same messages.
+class Generator
+{
+public:
+  explicit Generator (CORBA::ULong seed) : state_ (seed * 2654435761u + 1) {}
+
+  CORBA::ULong next (CORBA::ULong bound)
+  {
+    this->state_ = this->state_ * 1103515245u + 12345u;
+    return (this->state_ >> 8) % bound;
+  }
+
+private:
+  CORBA::ULong state_;
+};
+
+static const char * const symbols[] =
+  { "ACME", "GLOBEX", "HOOLI", "INITECH", "STARK", "UMBRELLA", "WAYNE" };
+static const CORBA::ULong nsymbols = sizeof (symbols) / sizeof (symbols[0]);
+
+void
+make_quote (Generator &random, CORBA::ULong i, Benchmark::Quote &quote)
+{
+  quote.symbol = symbols[random.next (nsymbols)];
+  quote.timestamp = 1500000000000ULL + i * 250 + random.next (250);
+  quote.bid = 100.0 + random.next (2000) * 0.05;
+  quote.ask = quote.bid + 0.05 * (1 + random.next (4));
+  quote.bid_size = 100 * static_cast<CORBA::Long> (random.next (50));
+  quote.ask_size = 100 * static_cast<CORBA::Long> (random.next (50));
+  quote.exchange = "NAPQ"[random.next (4)];
+}
+
+/// Marshal @a payload into @a message, like the body of a request.
+template <typename T>
+void
+marshal (const T &payload, ::Compression::Buffer &message)
+{
+  TAO_OutputCDR cdr;
+  cdr << payload;
+
+  message.length (static_cast<CORBA::ULong> (cdr.total_length ()));
+  CORBA::Octet *buf = message.get_buffer ();
+  for (const ACE_Message_Block *mb = cdr.begin (); mb != 0; mb = mb->cont ())
+    {
+      ACE_OS::memcpy (buf, mb->rd_ptr (), mb->length ());
+      buf += mb->length ();
+    }
+}
+
+void
+make_message (const char *payload,
+              CORBA::ULong seed,
+              ::Compression::Buffer &message)
+{
+  Generator random (seed);
+
+  if (ACE_OS::strcmp (payload, "quote") == 0)
+    {
+      Benchmark::Quote quote;
+      make_quote (random, seed, quote);
+      marshal (quote, message);
+    }
+  else if (ACE_OS::strcmp (payload, "quotes") == 0)
+    {
+      Benchmark::QuoteSeq quotes (100);
+      quotes.length (100);
+      for (CORBA::ULong i = 0; i != quotes.length (); ++i)
+        make_quote (random, seed * 100 + i, quotes[i]);
+      marshal (quotes, message);
+    }
+  else if (ACE_OS::strcmp (payload, "measurements") == 0)
+    {
+      Benchmark::MeasurementSeq measurements (1000);
+      measurements.length (1000);
+      CORBA::Float value = 20.0f;
+      for (CORBA::ULong i = 0; i != measurements.length (); ++i)
+        {
+          value += (static_cast<CORBA::Long> (random.next (21)) - 10) * 0.01f;
+          measurements[i].sensor = i % 16;
+          measurements[i].value = value;
+          measurements[i].status = random.next (100) == 0 ? 1 : 0;
+        }
+      marshal (measurements, message);
+    }
+  else
+    {
+      Benchmark::OrderSeq orders (50);
+      orders.length (50);
+      for (CORBA::ULong i = 0; i != orders.length (); ++i)
+        {
+          char account[32];
+          ACE_OS::sprintf (account, "ACCOUNT-%04u",
+                           static_cast<unsigned int> (random.next (20)));
+          orders[i].account = account;
+          orders[i].instrument = symbols[random.next (nsymbols)];
+          orders[i].comment =
+            random.next (2) == 0 ? "good till cancelled"
+                                 : "fill or kill, notify the desk";
+          orders[i].quantity = 100 * (1 + random.next (100));
+          orders[i].limit = 100.0 + random.next (2000) * 0.05;
+        }
+      marshal (orders, message);
+    }
+}
+
+int
+measure (const char *payload,
+         const Compressor_Under_Test &compressor_under_test,
+         const ::Compression::Buffer *messages)
+{
+  ::Compression::Compressor_var compressor =
+    compressor_under_test.factory->get_compressor (level);
+
+  ::Compression::Buffer compressed[nmessages];
+  ::Compression::Buffer decompressed;
+
+  ACE_hrtime_t compress_time = 0;
+  ACE_hrtime_t decompress_time = 0;
+  CORBA::ULongLong original_bytes = 0;
+  CORBA::ULongLong compressed_bytes = 0;
+
+  for (int j = 0; j != niterations; ++j)
+    {
+      ACE_High_Res_Timer timer;
+      timer.start ();
+      for (CORBA::ULong i = 0; i != nmessages; ++i)
+        compressor->compress (messages[i], compressed[i]);
+      timer.stop ();
+
+      ACE_hrtime_t usecs = 0;
+      timer.elapsed_microseconds (usecs);
+      compress_time += usecs;
+
+      timer.start ();
+      for (CORBA::ULong i = 0; i != nmessages; ++i)
+        {
+          // Like ZIOP, the original length is known.
+          decompressed.length (messages[i].length ());
+          compressor->decompress (compressed[i], decompressed);
+        }
+      timer.stop ();
+
+      timer.elapsed_microseconds (usecs);
+      decompress_time += usecs;
+    }
+
+  for (CORBA::ULong i = 0; i != nmessages; ++i)
+    {
+      original_bytes += messages[i].length ();
+      compressed_bytes += compressed[i].length ();
+
+      decompressed.length (messages[i].length ());
+      compressor->decompress (compressed[i], decompressed);
+      if (decompressed != messages[i])
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C corrupts the %C payload\n",
+                           compressor_under_test.label, payload),
+                          -1);
+    }
+
+  // Bytes per microsecond are MB/s.
+  double const total = static_cast<double> (original_bytes) * niterations;
+  ACE_DEBUG ((LM_DEBUG,
+              "%-12C %-10C size %6u ratio %6.3f "
+              "compress %9.1f MB/s decompress %9.1f MB/s\n",
+              payload,
+              compressor_under_test.label,
+              static_cast<unsigned int> (original_bytes / nmessages),
+              static_cast<double> (compressed_bytes) / original_bytes,
+              compress_time == 0 ? 0.0 : total / compress_time,
+              decompress_time == 0 ? 0.0 : total / decompress_time));
+
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      static const char * const payloads[] =
+        { "quote", "quotes", "measurements", "orders" };
+
+      for (size_t p = 0; p != sizeof (payloads) / sizeof (payloads[0]); ++p)
+        {
+          ::Compression::Buffer messages[nmessages];
+          for (CORBA::ULong i = 0; i != nmessages; ++i)
+            make_message (payloads[p], i, messages[i]);
+
+          ::Compression::Buffer samples;
+          size_t sample_sizes[nsamples];
+          for (CORBA::ULong i = 0; i != nsamples; ++i)
+            {
+              ::Compression::Buffer sample;
+              make_message (payloads[p], nmessages + i, sample);
+
+              CORBA::ULong const offset = samples.length ();
+              samples.length (offset + sample.length ());
+              ACE_OS::memcpy (samples.get_buffer () + offset,
+                              sample.get_buffer (),
+                              sample.length ());
+              sample_sizes[i] = sample.length ();
+            }
+
+          Compressor_List compressors;
+          if (create_compressors (samples,
+                                  sample_sizes,
+                                  nsamples,
+                                  compressors) != 0)
+            return 1;
+
+          for (size_t c = 0; c != compressors.size (); ++c)
+            if (measure (payloads[p], compressors[c], messages) != 0)
+              return 1;
+        }
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
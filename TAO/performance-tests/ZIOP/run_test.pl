@@ -0,0 +1,40 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+my $target = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+# Pass the options to all benchmarks, e.g. -l 1 for the fastest
+# compression level.
+my $args = join (' ', @ARGV);
+
+my @benchmarks = qw(
+                    zlib_benchmark
+                    bzip2_benchmark
+                    lzo_benchmark
+                    lz4_benchmark
+                    zstd_benchmark
+                   );
+
+my $status = 0;
+
+foreach my $process (@benchmarks) {
+    $BM = $target->CreateProcess ($process, $args);
+
+    # Only the compressors that were built are measured.
+    next unless -e $BM->Executable;
+
+    my $result = $BM->SpawnWaitKill ($target->ProcessStartWaitInterval () + 285);
+
+    if ($result != 0) {
+        print STDERR "ERROR: $process returned $result\n";
+        $status = 1;
+    }
+}
+
+exit $status;
@@ -0,0 +1,19 @@
+#include "Compressors.h"
+#include "tao/Compression/zlib/ZlibCompressor_Factory.h"
+
+int
+create_compressors (const ::Compression::Buffer &,
+                    const size_t *,
+                    unsigned int,
+                    Compressor_List &compressors)
+{
+  Compressor_Under_Test compressor;
+  compressor.label = "zlib";
+
+  ::Compression::CompressorFactory_ptr factory = 0;
+  ACE_NEW_RETURN (factory, TAO::Zlib_CompressorFactory (), -1);
+  compressor.factory = factory;
+
+  compressors.push_back (compressor);
+  return 0;
+}
@@ -0,0 +1,42 @@
+#include "Compressors.h"
+#include "tao/Compression/zstd/ZstdCompressor_Factory.h"
+
+int
+create_compressors (const ::Compression::Buffer &samples,
+                    const size_t *sample_sizes,
+                    unsigned int sample_count,
+                    Compressor_List &compressors)
+{
+  Compressor_Under_Test compressor;
+  ::Compression::CompressorFactory_ptr factory = 0;
+
+  compressor.label = "zstd";
+  ACE_NEW_RETURN (factory, TAO::Zstd_CompressorFactory (), -1);
+  compressor.factory = factory;
+  compressors.push_back (compressor);
+
+  // The same compressor with a dictionary trained on the payload.
+  ::Compression::Buffer dictionary;
+  try
+    {
+      TAO::Zstd_CompressorFactory::train_dictionary (samples,
+                                                     sample_sizes,
+                                                     sample_count,
+                                                     16 * 1024,
+                                                     dictionary);
+    }
+  catch (const ::Compression::CompressionException &ex)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "ERROR: cannot train a dictionary: %C\n",
+                         ex.description.in ()),
+                        -1);
+    }
+
+  compressor.label = "zstd+dict";
+  ACE_NEW_RETURN (factory, TAO::Zstd_CompressorFactory (dictionary), -1);
+  compressor.factory = factory;
+  compressors.push_back (compressor);
+
+  return 0;
+}
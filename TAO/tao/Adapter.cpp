@@ -1,4 +1,5 @@
 #include "tao/Adapter.h"
+#include "tao/Object.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -6,4 +7,16 @@ TAO_Adapter::~TAO_Adapter (void)
 {
 }
 
+int
+TAO_Adapter::dispatch_collocated (TAO_Stub *,
+                                  TAO_ServerRequest &,
+                                  CORBA::Object_out)
+{
+  return TAO_Adapter::DS_MISMATCHED_KEY;
+}
+
+TAO::Collocation_Cache::~Collocation_Cache (void)
+{
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -35,6 +35,22 @@ namespace CORBA
 namespace TAO
 {
   class ObjectKey;
+
+  /**
+   * @class Collocation_Cache
+   *
+   * @brief What an adapter remembers in a collocated object reference.
+   *
+   * The adapter that makes a stub collocated can attach a cache to
+   * it, to dispatch the thru-POA collocated requests on the stub
+   * without demultiplexing their object key again.  The stub owns
+   * the cache.
+   */
+  class TAO_Export Collocation_Cache
+  {
+  public:
+    virtual ~Collocation_Cache (void);
+  };
 }
 
 class TAO_ORB_Core;
@@ -70,6 +86,17 @@ public:
                         TAO_ServerRequest &request,
                         CORBA::Object_out forward_to) = 0;
 
+  /**
+   * Dispatch the thru-POA collocated request @a request on the object
+   * of @a stub, using the Collocation_Cache the adapter attached to
+   * the stub.  Return DS_MISMATCHED_KEY to have the request dispatched
+   * through the request dispatcher instead, which is what the default
+   * implementation does.
+   */
+  virtual int dispatch_collocated (TAO_Stub *stub,
+                                   TAO_ServerRequest &request,
+                                   CORBA::Object_out forward_to);
+
   enum {
     /// The operation was successfully dispatched, an exception may
     /// have been raised, but that is a correct execution too.
@@ -68,6 +68,15 @@ TAO::TypeCode::Alias<char const *,
 {
 }
 
+bool
+TAO::TypeCode::Alias<char const *,
+                     CORBA::TypeCode_ptr const *,
+                     TAO::Null_RefCount_Policy>::tao_cache_marshal_plan (
+  void) const
+{
+  return true;
+}
+
 CORBA::Boolean
 TAO::TypeCode::Alias<char const *,
                      CORBA::TypeCode_ptr const *,
@@ -71,6 +71,7 @@ namespace TAO
       virtual bool tao_marshal (TAO_OutputCDR & cdr, CORBA::ULong offset) const;
       virtual void tao_duplicate (void);
       virtual void tao_release (void);
+      virtual bool tao_cache_marshal_plan (void) const;
       //@}
 
     protected:
@@ -0,0 +1,484 @@
+#include "tao/AnyTypeCode/Any_CDR_View.h"
+#include "tao/AnyTypeCode/Any.h"
+#include "tao/AnyTypeCode/Any_Impl.h"
+#include "tao/AnyTypeCode/Any_Unknown_IDL_Type.h"
+#include "tao/AnyTypeCode/Marshal.h"
+#include "tao/SystemException.h"
+
+#include "ace/OS_NS_string.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// The size and alignment of a primitive of @a kind, false when the
+  /// values of @a kind have no fixed size.
+  bool
+  primitive_layout (CORBA::TCKind kind, size_t &size, size_t &align)
+  {
+    switch (kind)
+      {
+      case CORBA::tk_octet:
+      case CORBA::tk_boolean:
+      case CORBA::tk_char:
+        size = ACE_CDR::OCTET_SIZE;
+        align = ACE_CDR::OCTET_ALIGN;
+        return true;
+      case CORBA::tk_short:
+      case CORBA::tk_ushort:
+        size = ACE_CDR::SHORT_SIZE;
+        align = ACE_CDR::SHORT_ALIGN;
+        return true;
+      case CORBA::tk_long:
+      case CORBA::tk_ulong:
+      case CORBA::tk_float:
+      case CORBA::tk_enum:
+        size = ACE_CDR::LONG_SIZE;
+        align = ACE_CDR::LONG_ALIGN;
+        return true;
+      case CORBA::tk_longlong:
+      case CORBA::tk_ulonglong:
+      case CORBA::tk_double:
+        size = ACE_CDR::LONGLONG_SIZE;
+        align = ACE_CDR::LONGLONG_ALIGN;
+        return true;
+      case CORBA::tk_longdouble:
+        size = ACE_CDR::LONGDOUBLE_SIZE;
+        align = ACE_CDR::LONGDOUBLE_ALIGN;
+        return true;
+      default:
+        return false;
+      }
+  }
+
+  /// Skip @a count values of type @a tc.
+  bool
+  skip_values (CORBA::TypeCode_ptr tc, TAO_InputCDR &cdr, CORBA::ULong count)
+  {
+    if (count == 0)
+      {
+        return true;
+      }
+
+    size_t size = 0;
+    size_t align = 0;
+    if (primitive_layout (tc->kind (), size, align))
+      {
+        char *dummy = 0;
+        return cdr.adjust (0, align, dummy) == 0
+               && cdr.skip_bytes (size * count);
+      }
+
+    for (CORBA::ULong i = 0; i != count; ++i)
+      {
+        if (TAO_Marshal_Object::perform_skip (tc, &cdr)
+              != TAO::TRAVERSE_CONTINUE)
+          {
+            return false;
+          }
+      }
+    return true;
+  }
+
+  CORBA::TypeCode_ptr
+  unalias (CORBA::TypeCode_ptr tc)
+  {
+    CORBA::TypeCode_var base = CORBA::TypeCode::_duplicate (tc);
+    while (base->kind () == CORBA::tk_alias)
+      {
+        base = base->content_type ();
+      }
+    return base._retn ();
+  }
+}
+
+TAO::Any_CDR_View::Any_CDR_View (void)
+  : cdr_ (static_cast<size_t> (0)),
+    valid_ (false)
+{
+}
+
+TAO::Any_CDR_View::Any_CDR_View (const CORBA::Any &any)
+  : cdr_ (static_cast<size_t> (0)),
+    valid_ (false)
+{
+  TAO::Any_Impl * const impl = any.impl ();
+  if (impl == 0)
+    {
+      return;
+    }
+
+  CORBA::TypeCode_var const tc = any.type ();
+
+  if (impl->encoded ())
+    {
+      TAO::Unknown_IDL_Type * const unk =
+        dynamic_cast<TAO::Unknown_IDL_Type *> (impl);
+
+      if (unk == 0)
+        {
+          return;
+        }
+
+      // Share the buffer of the Any, not its read position.
+      this->reset (tc.in (), unk->_tao_get_cdr ());
+    }
+  else
+    {
+      TAO_OutputCDR out;
+      if (!impl->marshal_value (out))
+        {
+          return;
+        }
+
+      TAO_InputCDR in (out);
+      this->reset (tc.in (), in);
+    }
+}
+
+TAO::Any_CDR_View::Any_CDR_View (CORBA::TypeCode_ptr tc,
+                                 const TAO_InputCDR &cdr)
+  : cdr_ (static_cast<size_t> (0)),
+    valid_ (false)
+{
+  this->reset (tc, cdr);
+}
+
+void
+TAO::Any_CDR_View::reset (CORBA::TypeCode_ptr tc, const TAO_InputCDR &cdr)
+{
+  this->type_ = CORBA::TypeCode::_duplicate (tc);
+  this->base_type_ = unalias (tc);
+  this->cdr_ = cdr;
+  this->valid_ = true;
+}
+
+bool
+TAO::Any_CDR_View::valid (void) const
+{
+  return this->valid_;
+}
+
+CORBA::TypeCode_ptr
+TAO::Any_CDR_View::type (void) const
+{
+  return this->type_.in ();
+}
+
+CORBA::TypeCode_ptr
+TAO::Any_CDR_View::base_type (void) const
+{
+  return this->base_type_.in ();
+}
+
+CORBA::TCKind
+TAO::Any_CDR_View::kind (void) const
+{
+  return this->valid_ ? this->base_type ()->kind () : CORBA::tk_null;
+}
+
+const TAO_InputCDR &
+TAO::Any_CDR_View::cdr (void) const
+{
+  return this->cdr_;
+}
+
+bool
+TAO::Any_CDR_View::member (CORBA::ULong index, Any_CDR_View &member) const
+{
+  CORBA::TCKind const kind = this->kind ();
+  if (kind != CORBA::tk_struct && kind != CORBA::tk_except)
+    {
+      return false;
+    }
+
+  CORBA::TypeCode_ptr const tc = this->base_type ();
+  if (index >= tc->member_count ())
+    {
+      return false;
+    }
+
+  TAO_InputCDR cdr (this->cdr_);
+
+  // Exceptions are encoded with their repository id first.
+  if (kind == CORBA::tk_except && !cdr.skip_string ())
+    {
+      return false;
+    }
+
+  for (CORBA::ULong i = 0; i != index; ++i)
+    {
+      CORBA::TypeCode_var const member_tc = tc->member_type (i);
+      if (!skip_values (member_tc.in (), cdr, 1))
+        {
+          return false;
+        }
+    }
+
+  CORBA::TypeCode_var const member_tc = tc->member_type (index);
+  member.reset (member_tc.in (), cdr);
+  return true;
+}
+
+bool
+TAO::Any_CDR_View::member (const char *name, Any_CDR_View &member) const
+{
+  CORBA::TCKind const kind = this->kind ();
+  if (kind != CORBA::tk_struct && kind != CORBA::tk_except)
+    {
+      return false;
+    }
+
+  CORBA::TypeCode_ptr const tc = this->base_type ();
+  CORBA::ULong const count = tc->member_count ();
+  for (CORBA::ULong i = 0; i != count; ++i)
+    {
+      if (ACE_OS::strcmp (tc->member_name (i), name) == 0)
+        {
+          return this->member (i, member);
+        }
+    }
+
+  return false;
+}
+
+bool
+TAO::Any_CDR_View::length (CORBA::ULong &length) const
+{
+  switch (this->kind ())
+    {
+    case CORBA::tk_sequence:
+      {
+        TAO_InputCDR cdr (this->cdr_);
+        return cdr.read_ulong (length);
+      }
+    case CORBA::tk_array:
+      length = this->base_type ()->length ();
+      return true;
+    default:
+      return false;
+    }
+}
+
+bool
+TAO::Any_CDR_View::element (CORBA::ULong index, Any_CDR_View &element) const
+{
+  CORBA::TCKind const kind = this->kind ();
+  if (kind != CORBA::tk_sequence && kind != CORBA::tk_array)
+    {
+      return false;
+    }
+
+  TAO_InputCDR cdr (this->cdr_);
+
+  CORBA::ULong length = 0;
+  if (kind == CORBA::tk_sequence)
+    {
+      if (!cdr.read_ulong (length))
+        {
+          return false;
+        }
+    }
+  else
+    {
+      length = this->base_type ()->length ();
+    }
+
+  if (index >= length)
+    {
+      return false;
+    }
+
+  CORBA::TypeCode_var const content = this->base_type ()->content_type ();
+  CORBA::TypeCode_var const base_content = unalias (content.in ());
+  if (!skip_values (base_content.in (), cdr, index))
+    {
+      return false;
+    }
+
+  element.reset (content.in (), cdr);
+  return true;
+}
+
+bool
+TAO::Any_CDR_View::next (void)
+{
+  if (!this->valid_
+      || !skip_values (this->base_type (), this->cdr_, 1))
+    {
+      this->valid_ = false;
+      return false;
+    }
+  return true;
+}
+
+bool
+TAO::Any_CDR_View::read_label (CORBA::TCKind kind,
+                               TAO_InputCDR &cdr,
+                               ACE_CDR::ULongLong &label)
+{
+  switch (kind)
+    {
+    case CORBA::tk_short:
+      {
+        CORBA::Short v = 0;
+        if (!cdr.read_short (v))
+          return false;
+        label = static_cast<ACE_CDR::ULongLong> (v);
+        return true;
+      }
+    case CORBA::tk_ushort:
+      {
+        CORBA::UShort v = 0;
+        if (!cdr.read_ushort (v))
+          return false;
+        label = v;
+        return true;
+      }
+    case CORBA::tk_long:
+      {
+        CORBA::Long v = 0;
+        if (!cdr.read_long (v))
+          return false;
+        label = static_cast<ACE_CDR::ULongLong> (v);
+        return true;
+      }
+    case CORBA::tk_ulong:
+    case CORBA::tk_enum:
+      {
+        CORBA::ULong v = 0;
+        if (!cdr.read_ulong (v))
+          return false;
+        label = v;
+        return true;
+      }
+    case CORBA::tk_longlong:
+      {
+        CORBA::LongLong v = 0;
+        if (!cdr.read_longlong (v))
+          return false;
+        label = static_cast<ACE_CDR::ULongLong> (v);
+        return true;
+      }
+    case CORBA::tk_ulonglong:
+      return cdr.read_ulonglong (label);
+    case CORBA::tk_char:
+      {
+        CORBA::Char v = 0;
+        if (!cdr.read_char (v))
+          return false;
+        label = static_cast<unsigned char> (v);
+        return true;
+      }
+    case CORBA::tk_wchar:
+      {
+        CORBA::WChar v = 0;
+        if (!cdr.read_wchar (v))
+          return false;
+        label = static_cast<ACE_CDR::ULongLong> (v);
+        return true;
+      }
+    case CORBA::tk_boolean:
+      {
+        CORBA::Boolean v = false;
+        if (!cdr.read_boolean (v))
+          return false;
+        label = v ? 1 : 0;
+        return true;
+      }
+    default:
+      return false;
+    }
+}
+
+bool
+TAO::Any_CDR_View::discriminator (Any_CDR_View &discriminator) const
+{
+  if (this->kind () != CORBA::tk_union)
+    {
+      return false;
+    }
+
+  CORBA::TypeCode_var const disc_tc =
+    this->base_type ()->discriminator_type ();
+  discriminator.reset (disc_tc.in (), this->cdr_);
+  return true;
+}
+
+bool
+TAO::Any_CDR_View::active_member (Any_CDR_View &member) const
+{
+  if (this->kind () != CORBA::tk_union)
+    {
+      return false;
+    }
+
+  CORBA::TypeCode_ptr const tc = this->base_type ();
+  CORBA::TypeCode_var const disc_tc = tc->discriminator_type ();
+  CORBA::TypeCode_var const base_disc_tc = unalias (disc_tc.in ());
+  CORBA::TCKind const disc_kind = base_disc_tc->kind ();
+
+  TAO_InputCDR cdr (this->cdr_);
+  ACE_CDR::ULongLong disc = 0;
+  if (!read_label (disc_kind, cdr, disc))
+    {
+      return false;
+    }
+
+  CORBA::Long const default_index = tc->default_index ();
+  CORBA::ULong const count = tc->member_count ();
+
+  for (CORBA::ULong i = 0; i != count; ++i)
+    {
+      if (static_cast<CORBA::Long> (i) == default_index)
+        {
+          continue;
+        }
+
+      CORBA::Any_var const label_any = tc->member_label (i);
+      Any_CDR_View const label_view (label_any.in ());
+      if (!label_view.valid ())
+        {
+          return false;
+        }
+
+      TAO_InputCDR label_cdr (label_view.cdr_);
+      ACE_CDR::ULongLong label = 0;
+      if (read_label (disc_kind, label_cdr, label) && label == disc)
+        {
+          CORBA::TypeCode_var const member_tc = tc->member_type (i);
+          member.reset (member_tc.in (), cdr);
+          return true;
+        }
+    }
+
+  if (default_index >= 0)
+    {
+      CORBA::TypeCode_var const member_tc =
+        tc->member_type (static_cast<CORBA::ULong> (default_index));
+      member.reset (member_tc.in (), cdr);
+      return true;
+    }
+
+  return false;
+}
+
+bool
+TAO::Any_CDR_View::value (CORBA::Any &any) const
+{
+  if (!this->valid_)
+    {
+      return false;
+    }
+
+  // Unknown_IDL_Type copies the bytes of this value only.
+  TAO_InputCDR cdr (this->cdr_);
+  TAO::Unknown_IDL_Type *unk = 0;
+  ACE_NEW_RETURN (unk,
+                  TAO::Unknown_IDL_Type (this->type_.in (), cdr),
+                  false);
+  any.replace (unk);
+  return true;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
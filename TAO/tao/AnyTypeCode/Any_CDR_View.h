@@ -0,0 +1,132 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Any_CDR_View.h
+ *
+ *  Read-only navigation of the encoded value of an Any.
+ */
+//=============================================================================
+
+#ifndef TAO_ANY_CDR_VIEW_H
+#define TAO_ANY_CDR_VIEW_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/AnyTypeCode/TAO_AnyTypeCode_Export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/AnyTypeCode/TypeCode.h"
+#include "tao/CDR.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace CORBA
+{
+  class Any;
+}
+
+namespace TAO
+{
+  /**
+   * @class Any_CDR_View
+   *
+   * @brief A view of a value, or of a part of it, in the CDR stream
+   * of an Any.
+   *
+   * Extracting a member of a struct held by an Any demarshals the
+   * whole struct into its generated type, and DynamicAny copies every
+   * member into a DynAny of its own.  A view instead reads the
+   * stream of the Any in place: it skips the members, elements and
+   * union branches in front of the part it navigates to, and decodes
+   * nothing else.  Only the value of the last part is copied, into an
+   * Any, by value().
+   *
+   * The views of an Any share its buffer, they stay valid as long as
+   * the Any holds the same value.  Aliases are looked through.
+   */
+  class TAO_AnyTypeCode_Export Any_CDR_View
+  {
+  public:
+    /// An invalid view.
+    Any_CDR_View (void);
+
+    /// A view of the value of @a any.
+    explicit Any_CDR_View (const CORBA::Any &any);
+
+    /// A view of the value of type @a tc at the read position of
+    /// @a cdr.
+    Any_CDR_View (CORBA::TypeCode_ptr tc, const TAO_InputCDR &cdr);
+
+    /// False when the Any was empty or a navigation failed.
+    bool valid (void) const;
+
+    /// The type of the viewed value, as the Any or the enclosing
+    /// TypeCode gave it.
+    CORBA::TypeCode_ptr type (void) const;
+
+    /// The kind of the viewed value, aliases removed.
+    CORBA::TCKind kind (void) const;
+
+    /// A stream positioned at the viewed value, copy it to read the
+    /// value.
+    const TAO_InputCDR &cdr (void) const;
+
+    /// Move @a member to the member at @a index of a struct or
+    /// exception.
+    bool member (CORBA::ULong index, Any_CDR_View &member) const;
+
+    /// Move @a member to the member called @a name of a struct or
+    /// exception.
+    bool member (const char *name, Any_CDR_View &member) const;
+
+    /// Move @a element to the element at @a index of a sequence or
+    /// array.
+    bool element (CORBA::ULong index, Any_CDR_View &element) const;
+
+    /// The number of elements of a sequence or array.
+    bool length (CORBA::ULong &length) const;
+
+    /// Move @a discriminator to the discriminator of a union.
+    bool discriminator (Any_CDR_View &discriminator) const;
+
+    /// Move @a member to the active member of a union, false when no
+    /// member is active.
+    bool active_member (Any_CDR_View &member) const;
+
+    /// Move this view past its value to the next value of the same
+    /// type, the next element of a sequence or array.
+    bool next (void);
+
+    /// Copy the viewed value, and only it, into @a any.
+    bool value (CORBA::Any &any) const;
+
+  private:
+    /// Set the view to the value of type @a tc at the read position
+    /// of @a cdr.
+    void reset (CORBA::TypeCode_ptr tc, const TAO_InputCDR &cdr);
+
+    /// The unaliased type of the value.
+    CORBA::TypeCode_ptr base_type (void) const;
+
+    /// Read a discriminator of @a kind from @a cdr, widened.
+    static bool read_label (CORBA::TCKind kind,
+                            TAO_InputCDR &cdr,
+                            ACE_CDR::ULongLong &label);
+
+  private:
+    CORBA::TypeCode_var type_;
+    CORBA::TypeCode_var base_type_;
+    TAO_InputCDR cdr_;
+    bool valid_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_ANY_CDR_VIEW_H */
@@ -10,6 +10,7 @@
 
 #include "ace/Dynamic_Service.h"
 #include "ace/OS_NS_string.h"
+#include "ace/Auto_Ptr.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -106,13 +107,25 @@ TAO::Unknown_IDL_Type::_tao_byte_order (void) const
 void
 TAO::Unknown_IDL_Type::_tao_decode (TAO_InputCDR & cdr)
 {
-  // @@ (JP) The following code depends on the fact that
-  //         TAO_InputCDR does not contain chained message blocks,
-  //         otherwise <begin> and <end> could be part of
-  //         different buffers!
-
   // This will be the start of a new message block.
   char const * const begin = cdr.rd_ptr ();
+  size_t const begin_length = cdr.length ();
+
+  // The value of a stream that contains chained message blocks (the
+  // fragments of a GIOP message) can be in different buffers, it is
+  // read again from a copy of the stream.
+  ACE_InputCDR *chained = 0;
+  if (cdr.start ()->cont () != 0)
+    {
+      ACE_NEW_THROW_EX (chained,
+                        ACE_InputCDR (cdr),
+                        CORBA::NO_MEMORY ());
+    }
+#if defined (ACE_HAS_CPP11)
+  std::unique_ptr<ACE_InputCDR> chained_safety (chained);
+#else
+  auto_ptr<ACE_InputCDR> chained_safety (chained);
+#endif /* ACE_HAS_CPP11 */
 
   // Skip over the next argument.
   TAO::traverse_status const status =
@@ -123,15 +136,12 @@ TAO::Unknown_IDL_Type::_tao_decode (TAO_InputCDR & cdr)
       throw ::CORBA::MARSHAL ();
     }
 
-  // This will be the end of the new message block.
-  char const * const end = cdr.rd_ptr ();
-
   // The ACE_CDR::mb_align() call can shift the rd_ptr by up to
   // ACE_CDR::MAX_ALIGNMENT - 1 bytes. Similarly, the offset adjustment
   // can move the rd_ptr by up to the same amount. We accommodate
   // this by including 2 * ACE_CDR::MAX_ALIGNMENT bytes of additional
   // space in the message block.
-  size_t const size = end - begin;
+  size_t const size = begin_length - cdr.length ();
 
   ACE_Message_Block new_mb (size + 2 * ACE_CDR::MAX_ALIGNMENT);
 
@@ -146,7 +156,16 @@ TAO::Unknown_IDL_Type::_tao_decode (TAO_InputCDR & cdr)
   new_mb.rd_ptr (offset);
   new_mb.wr_ptr (offset + size);
 
-  ACE_OS::memcpy (new_mb.rd_ptr (), begin, size);
+  if (chained == 0)
+    {
+      ACE_OS::memcpy (new_mb.rd_ptr (), begin, size);
+    }
+  else if (!chained->read_octet_array (
+             reinterpret_cast<ACE_CDR::Octet *> (new_mb.rd_ptr ()),
+             static_cast<ACE_CDR::ULong> (size)))
+    {
+      throw ::CORBA::MARSHAL ();
+    }
 
   this->cdr_.reset (&new_mb, cdr.byte_order ());
   this->cdr_.char_translator (cdr.char_translator ());
@@ -13,6 +13,7 @@
 //=============================================================================
 
 #include "tao/AnyTypeCode/Marshal.h"
+#include "tao/AnyTypeCode/Marshal_Plan.h"
 #include "tao/AnyTypeCode/TypeCode.h"
 
 #if !defined (__ACE_INLINE__)
@@ -84,6 +85,11 @@ TAO_Marshal_Object::perform_skip (CORBA::TypeCode_ptr tc, TAO_InputCDR *stream)
       }
     case CORBA::tk_struct:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (stream))
+          return plan->skip (stream);
+
         TAO_Marshal_Struct marshal;
         return marshal.skip (tc, stream);
       }
@@ -99,16 +105,31 @@ TAO_Marshal_Object::perform_skip (CORBA::TypeCode_ptr tc, TAO_InputCDR *stream)
       }
     case CORBA::tk_sequence:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (stream))
+          return plan->skip (stream);
+
         TAO_Marshal_Sequence marshal;
         return marshal.skip (tc, stream);
       }
     case CORBA::tk_array:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (stream))
+          return plan->skip (stream);
+
         TAO_Marshal_Array marshal;
         return marshal.skip (tc, stream);
       }
     case CORBA::tk_alias:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (stream))
+          return plan->skip (stream);
+
         TAO_Marshal_Alias marshal;
         return marshal.skip (tc, stream);
       }
@@ -193,6 +214,11 @@ TAO_Marshal_Object::perform_append (CORBA::TypeCode_ptr tc,
       }
     case CORBA::tk_struct:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (src, dest))
+          return plan->append (src, dest);
+
         TAO_Marshal_Struct marshal;
         return marshal.append (tc, src, dest);
       }
@@ -208,16 +234,31 @@ TAO_Marshal_Object::perform_append (CORBA::TypeCode_ptr tc,
       }
     case CORBA::tk_sequence:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (src, dest))
+          return plan->append (src, dest);
+
         TAO_Marshal_Sequence marshal;
         return marshal.append (tc, src, dest);
       }
     case CORBA::tk_array:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (src, dest))
+          return plan->append (src, dest);
+
         TAO_Marshal_Array marshal;
         return marshal.append (tc, src, dest);
       }
     case CORBA::tk_alias:
       {
+        TAO::TypeCode::Marshal_Plan const * const plan =
+          tc->tao_marshal_plan ();
+        if (plan != 0 && plan->applies (src, dest))
+          return plan->append (src, dest);
+
         TAO_Marshal_Alias marshal;
         return marshal.append (tc, src, dest);
       }
@@ -0,0 +1,587 @@
+#include "tao/AnyTypeCode/Marshal_Plan.h"
+#include "tao/AnyTypeCode/TypeCode.h"
+#include "tao/CDR.h"
+#include "tao/SystemException.h"
+#include "tao/debug.h"
+
+#include "ace/OS_NS_string.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// The alignment of a primitive in this build.
+  inline CORBA::ULong
+  cdr_align (CORBA::ULong align)
+  {
+#if !defined (ACE_LACKS_CDR_ALIGNMENT)
+    return align;
+#else
+    ACE_UNUSED_ARG (align);
+    return 1;
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+  }
+}
+
+TAO::TypeCode::Marshal_Plan::Marshal_Plan (CORBA::TypeCode_ptr tc)
+  : compiled_ (true),
+    fixed_ (false),
+    chars_ (false)
+{
+  CORBA::TypeCode_var unaliased = CORBA::TypeCode::_duplicate (tc);
+  while (unaliased->kind () == CORBA::tk_alias)
+    {
+      unaliased = unaliased->content_type ();
+    }
+
+  CORBA::TCKind const kind = unaliased->kind ();
+  if (kind == CORBA::tk_array || kind == CORBA::tk_sequence)
+    {
+      // The top level is always expanded, interpreting it would come
+      // back here.
+      CORBA::TypeCode_var content = unaliased->content_type ();
+      if (interpret_elements (content.in ()))
+        {
+          this->compiled_ = false;
+        }
+      else
+        {
+          this->add_repeat (content.in (),
+                            kind == CORBA::tk_array ? unaliased->length () : 0,
+                            1);
+        }
+    }
+  else if (kind == CORBA::tk_struct)
+    {
+      CORBA::ULong const member_count = unaliased->member_count ();
+      for (CORBA::ULong i = 0; i != member_count; ++i)
+        {
+          CORBA::TypeCode_var member = unaliased->member_type (i);
+          this->add (member.in (), 1);
+        }
+    }
+  else
+    {
+      this->add (unaliased.in (), 1);
+    }
+
+  this->complete ();
+}
+
+TAO::TypeCode::Marshal_Plan::Marshal_Plan (void)
+  : compiled_ (true),
+    fixed_ (false),
+    chars_ (false)
+{
+}
+
+TAO::TypeCode::Marshal_Plan::~Marshal_Plan (void)
+{
+  for (size_t i = 0; i != this->steps_.size (); ++i)
+    {
+      delete this->steps_[i].element;
+    }
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::compiled (void) const
+{
+  return this->compiled_;
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::fixed (void) const
+{
+  return this->fixed_;
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::applies (TAO_InputCDR const *src,
+                                      TAO_OutputCDR const *dest) const
+{
+  // Translated chars may change length, they are left to
+  // TAO_Marshal_Primitive and the CDR streams.
+  return this->compiled_
+         && !(this->chars_
+              && ((src != 0 && src->char_translator () != 0)
+                  || (dest != 0 && dest->char_translator () != 0)));
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::interpret_elements (CORBA::TypeCode_ptr content)
+{
+  // TAO_Marshal_Array/Sequence copy wchars in bulk, which a plan
+  // cannot express since a single wchar is variable length.
+  CORBA::TypeCode_var unaliased = CORBA::TypeCode::_duplicate (content);
+  while (unaliased->kind () == CORBA::tk_alias)
+    {
+      unaliased = unaliased->content_type ();
+    }
+  return unaliased->kind () == CORBA::tk_wchar;
+}
+
+void
+TAO::TypeCode::Marshal_Plan::add (CORBA::TypeCode_ptr tc, int depth)
+{
+  CORBA::TCKind const kind = tc->kind ();
+
+  switch (kind)
+    {
+    case CORBA::tk_null:
+    case CORBA::tk_void:
+      break;
+    case CORBA::tk_char:
+      this->chars_ = true;
+      this->add_run (ACE_CDR::OCTET_SIZE, ACE_CDR::OCTET_ALIGN, 1);
+      break;
+    case CORBA::tk_boolean:
+    case CORBA::tk_octet:
+      this->add_run (ACE_CDR::OCTET_SIZE, ACE_CDR::OCTET_ALIGN, 1);
+      break;
+    case CORBA::tk_short:
+    case CORBA::tk_ushort:
+      this->add_run (ACE_CDR::SHORT_SIZE, ACE_CDR::SHORT_ALIGN, 1);
+      break;
+    case CORBA::tk_long:
+    case CORBA::tk_ulong:
+    case CORBA::tk_float:
+    case CORBA::tk_enum:
+      this->add_run (ACE_CDR::LONG_SIZE, ACE_CDR::LONG_ALIGN, 1);
+      break;
+    case CORBA::tk_double:
+    case CORBA::tk_longlong:
+    case CORBA::tk_ulonglong:
+      this->add_run (ACE_CDR::LONGLONG_SIZE, ACE_CDR::LONGLONG_ALIGN, 1);
+      break;
+    case CORBA::tk_longdouble:
+      this->add_run (ACE_CDR::LONGDOUBLE_SIZE, ACE_CDR::LONGDOUBLE_ALIGN, 1);
+      break;
+
+    case CORBA::tk_alias:
+    case CORBA::tk_struct:
+    case CORBA::tk_array:
+    case CORBA::tk_sequence:
+      if (depth >= TAO_MARSHAL_PLAN_MAX_DEPTH)
+        {
+          this->add_interpret (tc);
+        }
+      else if (kind == CORBA::tk_alias)
+        {
+          CORBA::TypeCode_var content = tc->content_type ();
+          this->add (content.in (), depth + 1);
+        }
+      else if (kind == CORBA::tk_struct)
+        {
+          CORBA::ULong const member_count = tc->member_count ();
+          for (CORBA::ULong i = 0; i != member_count; ++i)
+            {
+              CORBA::TypeCode_var member = tc->member_type (i);
+              this->add (member.in (), depth + 1);
+            }
+        }
+      else
+        {
+          CORBA::TypeCode_var content = tc->content_type ();
+          if (interpret_elements (content.in ()))
+            {
+              this->add_interpret (tc);
+            }
+          else
+            {
+              this->add_repeat (content.in (),
+                                kind == CORBA::tk_array ? tc->length () : 0,
+                                depth + 1);
+            }
+        }
+      break;
+
+    default:
+      this->add_interpret (tc);
+      break;
+    }
+}
+
+void
+TAO::TypeCode::Marshal_Plan::add_run (CORBA::ULong size,
+                                      CORBA::ULong align,
+                                      CORBA::ULong count)
+{
+  if (count == 0)
+    {
+      return;
+    }
+
+  align = cdr_align (align);
+
+  size_t const n = this->steps_.size ();
+  if (n != 0)
+    {
+      Step &last = this->steps_[n - 1];
+      if (last.kind == Step::RUN && last.size == size && last.align == align)
+        {
+          // The primitive after a run of the same primitives is
+          // already aligned.
+          last.count += count;
+          return;
+        }
+    }
+
+  Step const step = { Step::RUN, size, align, count, 0, 0 };
+  this->steps_.push_back (step);
+}
+
+void
+TAO::TypeCode::Marshal_Plan::add_interpret (CORBA::TypeCode_ptr tc)
+{
+  Step const step = { Step::INTERPRET, 0, 0, 0, tc, 0 };
+  this->steps_.push_back (step);
+}
+
+void
+TAO::TypeCode::Marshal_Plan::add_repeat (CORBA::TypeCode_ptr content,
+                                         CORBA::ULong count,
+                                         int depth)
+{
+  Marshal_Plan *element = 0;
+  ACE_NEW_THROW_EX (element,
+                    Marshal_Plan,
+                    CORBA::NO_MEMORY ());
+  element->add (content, depth);
+  element->complete ();
+  this->chars_ = this->chars_ || element->chars_;
+
+  if (element->steps_.size () == 0)
+    {
+      // Elements without data, only a sequence length is left.
+      delete element;
+      if (count == 0)
+        {
+          this->add_run (ACE_CDR::LONG_SIZE, ACE_CDR::LONG_ALIGN, 1);
+        }
+      return;
+    }
+
+  if (count != 0 && element->steps_.size () == 1
+      && element->steps_[0].kind == Step::RUN)
+    {
+      // An array of primitives, or of structs of a single primitive
+      // type, is a single run.
+      Step const &run = element->steps_[0];
+      CORBA::ULong const size = run.size;
+      CORBA::ULong const align = run.align;
+      CORBA::ULong const total = run.count * count;
+      delete element;
+      this->add_run (size, align, total);
+      return;
+    }
+
+  Step const step = { Step::REPEAT, 0, 0, count, 0, element };
+  this->steps_.push_back (step);
+}
+
+void
+TAO::TypeCode::Marshal_Plan::complete (void)
+{
+  this->fixed_ = true;
+  for (size_t i = 0; i != this->steps_.size (); ++i)
+    {
+      Step const &step = this->steps_[i];
+      if (step.kind == Step::INTERPRET
+          || (step.kind == Step::REPEAT
+              && (step.count == 0 || !step.element->fixed_)))
+        {
+          this->fixed_ = false;
+          break;
+        }
+    }
+
+  if (this->fixed_)
+    {
+      for (size_t start = 0; start != ACE_CDR::MAX_ALIGNMENT; ++start)
+        {
+          this->span_[start] = this->walk (start) - start;
+        }
+    }
+}
+
+size_t
+TAO::TypeCode::Marshal_Plan::walk (size_t offset) const
+{
+  for (size_t i = 0; i != this->steps_.size (); ++i)
+    {
+      Step const &step = this->steps_[i];
+      if (step.kind == Step::RUN)
+        {
+          offset = ACE_align_binary (offset, step.align)
+                   + step.size * step.count;
+        }
+      else
+        {
+          for (CORBA::ULong j = 0; j != step.count; ++j)
+            {
+              offset = step.element->walk (offset);
+            }
+        }
+    }
+  return offset;
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::skip_run (TAO_InputCDR *stream,
+                                       CORBA::ULong size,
+                                       CORBA::ULong align,
+                                       size_t count)
+{
+  char *dummy = 0;
+  return stream->adjust (0, align, dummy) == 0
+         && stream->skip_bytes (size * count);
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::append_run (TAO_InputCDR *src,
+                                         TAO_OutputCDR *dest,
+                                         CORBA::ULong size,
+                                         CORBA::ULong align,
+                                         size_t count)
+{
+  // The read_*_array() operations take a 32 bit length.
+  if (count > ACE_UINT32_MAX)
+    {
+      return false;
+    }
+
+  // Read straight into the output buffer, the input stream swaps the
+  // bytes when needed.
+  char *buf = 0;
+  if (dest->adjust (size * count, align, buf) != 0)
+    {
+      return false;
+    }
+
+  switch (size)
+    {
+    case ACE_CDR::OCTET_SIZE:
+      return src->read_octet_array (
+        reinterpret_cast<ACE_CDR::Octet *> (buf),
+        static_cast<ACE_CDR::ULong> (count));
+    case ACE_CDR::SHORT_SIZE:
+      return src->read_ushort_array (
+        reinterpret_cast<ACE_CDR::UShort *> (buf),
+        static_cast<ACE_CDR::ULong> (count));
+    case ACE_CDR::LONG_SIZE:
+      return src->read_ulong_array (
+        reinterpret_cast<ACE_CDR::ULong *> (buf),
+        static_cast<ACE_CDR::ULong> (count));
+    case ACE_CDR::LONGLONG_SIZE:
+      return src->read_ulonglong_array (
+        reinterpret_cast<ACE_CDR::ULongLong *> (buf),
+        static_cast<ACE_CDR::ULong> (count));
+    case ACE_CDR::LONGDOUBLE_SIZE:
+      return src->read_longdouble_array (
+        reinterpret_cast<ACE_CDR::LongDouble *> (buf),
+        static_cast<ACE_CDR::ULong> (count));
+    default:
+      return false;
+    }
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::skip_i (TAO_InputCDR *stream) const
+{
+  if (this->fixed_)
+    {
+#if !defined (ACE_LACKS_CDR_ALIGNMENT)
+      size_t const start =
+        reinterpret_cast<size_t> (stream->rd_ptr ()) % ACE_CDR::MAX_ALIGNMENT;
+#else
+      size_t const start = 0;
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+      return stream->skip_bytes (this->span_[start]);
+    }
+
+  for (size_t i = 0; i != this->steps_.size (); ++i)
+    {
+      Step const &step = this->steps_[i];
+      switch (step.kind)
+        {
+        case Step::RUN:
+          if (!skip_run (stream, step.size, step.align, step.count))
+            {
+              return false;
+            }
+          break;
+
+        case Step::REPEAT:
+          {
+            CORBA::ULong count = step.count;
+            if (count == 0 && !stream->read_ulong (count))
+              {
+                return false;
+              }
+
+            Marshal_Plan const &element = *step.element;
+            if (element.steps_.size () == 1
+                && element.steps_[0].kind == Step::RUN)
+              {
+                Step const &run = element.steps_[0];
+                if (count != 0
+                    && !skip_run (stream, run.size, run.align,
+                                  static_cast<size_t> (run.count) * count))
+                  {
+                    return false;
+                  }
+                break;
+              }
+
+            for (CORBA::ULong j = 0; j != count; ++j)
+              {
+                if (!element.skip_i (stream))
+                  {
+                    return false;
+                  }
+              }
+          }
+          break;
+
+        case Step::INTERPRET:
+          if (TAO_Marshal_Object::perform_skip (step.tc, stream)
+              != TAO::TRAVERSE_CONTINUE)
+            {
+              return false;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+bool
+TAO::TypeCode::Marshal_Plan::append_i (TAO_InputCDR *src,
+                                       TAO_OutputCDR *dest) const
+{
+  if (this->fixed_)
+    {
+#if !defined (ACE_LACKS_CDR_ALIGNMENT)
+      size_t const start =
+        reinterpret_cast<size_t> (src->rd_ptr ()) % ACE_CDR::MAX_ALIGNMENT;
+      bool const aligned =
+        dest->current_alignment () % ACE_CDR::MAX_ALIGNMENT == start;
+#else
+      size_t const start = 0;
+      bool const aligned = true;
+#endif /* ACE_LACKS_CDR_ALIGNMENT */
+
+      if (aligned && src->do_byte_swap () == dest->do_byte_swap ())
+        {
+          // Same layout on both sides, padding included.
+          size_t const span = this->span_[start];
+          char *from = 0;
+          char *to = 0;
+          if (src->adjust (span, 1, from) != 0
+              || dest->adjust (span, 1, to) != 0)
+            {
+              return false;
+            }
+          ACE_OS::memcpy (to, from, span);
+          return true;
+        }
+    }
+
+  for (size_t i = 0; i != this->steps_.size (); ++i)
+    {
+      Step const &step = this->steps_[i];
+      switch (step.kind)
+        {
+        case Step::RUN:
+          if (!append_run (src, dest, step.size, step.align, step.count))
+            {
+              return false;
+            }
+          break;
+
+        case Step::REPEAT:
+          {
+            CORBA::ULong count = step.count;
+            if (count == 0
+                && !(src->read_ulong (count) && dest->write_ulong (count)))
+              {
+                return false;
+              }
+
+            Marshal_Plan const &element = *step.element;
+            if (element.steps_.size () == 1
+                && element.steps_[0].kind == Step::RUN)
+              {
+                Step const &run = element.steps_[0];
+                if (count != 0
+                    && !append_run (src, dest,
+                                    run.size, run.align,
+                                  static_cast<size_t> (run.count) * count))
+                  {
+                    return false;
+                  }
+                break;
+              }
+
+            for (CORBA::ULong j = 0; j != count; ++j)
+              {
+                if (!element.append_i (src, dest))
+                  {
+                    return false;
+                  }
+              }
+          }
+          break;
+
+        case Step::INTERPRET:
+          if (TAO_Marshal_Object::perform_append (step.tc, src, dest)
+              != TAO::TRAVERSE_CONTINUE)
+            {
+              return false;
+            }
+          break;
+        }
+    }
+
+  return true;
+}
+
+TAO::traverse_status
+TAO::TypeCode::Marshal_Plan::skip (TAO_InputCDR *stream) const
+{
+  if (this->skip_i (stream))
+    {
+      return TAO::TRAVERSE_CONTINUE;
+    }
+
+  if (TAO_debug_level > 0)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+                     ACE_TEXT ("TAO (%P|%t) - Marshal_Plan::skip ")
+                     ACE_TEXT ("detected error\n")));
+    }
+
+  throw ::CORBA::MARSHAL (0, CORBA::COMPLETED_MAYBE);
+}
+
+TAO::traverse_status
+TAO::TypeCode::Marshal_Plan::append (TAO_InputCDR *src,
+                                     TAO_OutputCDR *dest) const
+{
+  if (this->append_i (src, dest))
+    {
+      return TAO::TRAVERSE_CONTINUE;
+    }
+
+  if (TAO_debug_level > 0)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+                     ACE_TEXT ("TAO (%P|%t) - Marshal_Plan::append ")
+                     ACE_TEXT ("detected error\n")));
+    }
+
+  throw ::CORBA::MARSHAL (0, CORBA::COMPLETED_MAYBE);
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
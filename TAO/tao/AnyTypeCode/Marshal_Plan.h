@@ -0,0 +1,180 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Marshal_Plan.h
+ *
+ *  Compiled form of a TypeCode for skipping and appending its values.
+ */
+//=============================================================================
+
+#ifndef TAO_MARSHAL_PLAN_H
+#define TAO_MARSHAL_PLAN_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/AnyTypeCode/Marshal.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/CDR_Base.h"
+#include "ace/Vector_T.h"
+
+/// The nesting depth of structs, arrays and sequences flattened into a
+/// plan, deeper members (and recursive types) are interpreted.
+#if !defined (TAO_MARSHAL_PLAN_MAX_DEPTH)
+# define TAO_MARSHAL_PLAN_MAX_DEPTH 8
+#endif /* TAO_MARSHAL_PLAN_MAX_DEPTH */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace TypeCode
+  {
+    /**
+     * @class Marshal_Plan
+     *
+     * @brief Skips and appends the values of a struct, alias, array
+     * or sequence TypeCode without interpreting it.
+     *
+     * The TAO_Marshal_Object classes walk the TypeCode of a value for
+     * every value, fetching each member TypeCode through its virtual
+     * accessors.  A plan flattens the TypeCode once into a list of
+     * steps:
+     *
+     * - runs of primitives of the same size, skipped or copied (and
+     *   byte swapped) with one call,
+     * - repetitions of an element plan, the length of sequences being
+     *   read from the stream,
+     * - members that have no fixed layout (strings, anys, unions,
+     *   object references...), handed to the TAO_Marshal_Object
+     *   classes.
+     *
+     * When the value has a fixed size the plan also knows how many
+     * bytes it takes from each alignment, so it is skipped in one
+     * step and appended with a single memcpy when both streams have
+     * the same byte order and alignment.
+     *
+     * The plan of a TypeCode is built on first use and kept by the
+     * TypeCode, see CORBA::TypeCode::tao_marshal_plan().  The member
+     * TypeCodes it refers to are owned by that TypeCode.
+     */
+    class TAO_AnyTypeCode_Export Marshal_Plan
+    {
+    public:
+      /// Build the plan of @a tc.
+      explicit Marshal_Plan (CORBA::TypeCode_ptr tc);
+
+      ~Marshal_Plan (void);
+
+      /// False when @a tc is better interpreted, the plan must then
+      /// not be used.
+      bool compiled (void) const;
+
+      /// True when the values have a fixed size.
+      bool fixed (void) const;
+
+      /// False when the plan must not skip the values of @a src or
+      /// append them to @a dest: it is not compiled, or it copies
+      /// chars that one of the streams translates.
+      bool applies (TAO_InputCDR const *src,
+                    TAO_OutputCDR const *dest = 0) const;
+
+      TAO::traverse_status skip (TAO_InputCDR *stream) const;
+
+      TAO::traverse_status append (TAO_InputCDR *src,
+                                   TAO_OutputCDR *dest) const;
+
+    private:
+      /// A step of the plan.
+      struct Step
+      {
+        enum Kind
+        {
+          /// @c count primitives of @c size bytes aligned on @c align.
+          RUN,
+
+          /// @c count values of @c element, or a sequence of them when
+          /// @c count is zero.
+          REPEAT,
+
+          /// A value of @c tc interpreted by TAO_Marshal_Object.
+          INTERPRET
+        };
+
+        Kind kind;
+        CORBA::ULong size;
+        CORBA::ULong align;
+        CORBA::ULong count;
+        CORBA::TypeCode_ptr tc;
+        Marshal_Plan *element;
+      };
+
+      /// A plan for the elements of an array or sequence.
+      Marshal_Plan (void);
+
+      /// Append the steps of a member of type @a tc.
+      void add (CORBA::TypeCode_ptr tc, int depth);
+
+      /// Append a run, merged with the last step when it is a run of
+      /// the same primitives.
+      void add_run (CORBA::ULong size, CORBA::ULong align, CORBA::ULong count);
+
+      void add_interpret (CORBA::TypeCode_ptr tc);
+
+      /// Append the steps of an array (@a count elements) or of a
+      /// sequence (@a count zero) of @a content.
+      void add_repeat (CORBA::TypeCode_ptr content,
+                       CORBA::ULong count,
+                       int depth);
+
+      /// Compute fixed_ and span_ once all the steps are added.
+      void complete (void);
+
+      /// The offset after a value that starts at @a offset.
+      size_t walk (size_t offset) const;
+
+      bool skip_i (TAO_InputCDR *stream) const;
+      bool append_i (TAO_InputCDR *src, TAO_OutputCDR *dest) const;
+
+      static bool skip_run (TAO_InputCDR *stream,
+                            CORBA::ULong size,
+                            CORBA::ULong align,
+                            size_t count);
+
+      static bool append_run (TAO_InputCDR *src,
+                              TAO_OutputCDR *dest,
+                              CORBA::ULong size,
+                              CORBA::ULong align,
+                              size_t count);
+
+      /// True when the elements of an array or sequence of @a content
+      /// are better handled by TAO_Marshal_Array/Sequence.
+      static bool interpret_elements (CORBA::TypeCode_ptr content);
+
+    private:
+      Marshal_Plan (Marshal_Plan const &);
+      void operator= (Marshal_Plan const &);
+
+      ACE_Vector<Step> steps_;
+
+      bool compiled_;
+      bool fixed_;
+
+      /// True when a run or a fixed value holds chars.
+      bool chars_;
+
+      /// The size of a fixed value for each alignment of its start.
+      size_t span_[ACE_CDR::MAX_ALIGNMENT];
+    };
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_MARSHAL_PLAN_H */
@@ -58,6 +58,14 @@ TAO::TypeCode::Sequence<CORBA::TypeCode_ptr const *,
 {
 }
 
+bool
+TAO::TypeCode::Sequence<CORBA::TypeCode_ptr const *,
+                        TAO::Null_RefCount_Policy>::tao_cache_marshal_plan (
+  void) const
+{
+  return true;
+}
+
 CORBA::Boolean
 TAO::TypeCode::Sequence<CORBA::TypeCode_ptr const *,
                         TAO::Null_RefCount_Policy>::equal_i (
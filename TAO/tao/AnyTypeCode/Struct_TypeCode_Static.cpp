@@ -96,6 +96,17 @@ TAO::TypeCode::Struct<char const *,
 {
 }
 
+bool
+TAO::TypeCode::Struct<char const *,
+                      CORBA::TypeCode_ptr const *,
+                      TAO::TypeCode::Struct_Field<char const *,
+                                                  CORBA::TypeCode_ptr const *> const *,
+                      TAO::Null_RefCount_Policy>::tao_cache_marshal_plan (
+  void) const
+{
+  return true;
+}
+
 CORBA::Boolean
 TAO::TypeCode::Struct<char const *,
                       CORBA::TypeCode_ptr const *,
@@ -80,6 +80,7 @@ namespace TAO
                                 CORBA::ULong offset) const;
       virtual void tao_duplicate (void);
       virtual void tao_release (void);
+      virtual bool tao_cache_marshal_plan (void) const;
       //@}
 
     protected:
@@ -4,17 +4,82 @@
 # include "tao/AnyTypeCode/TypeCode.inl"
 #endif /* ! __ACE_INLINE__ */
 
+#include "tao/AnyTypeCode/Marshal_Plan.h"
 #include "tao/CDR.h"
 #include "tao/ORB_Constants.h"
 #include "tao/debug.h"
 #include "tao/SystemException.h"
 
 #include "ace/OS_NS_string.h"
+#include "ace/Static_Object_Lock.h"
+#include "ace/Recursive_Thread_Mutex.h"
+#include "ace/Guard_T.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 CORBA::TypeCode::~TypeCode (void)
 {
+#if defined (ACE_HAS_CPP11)
+  delete this->marshal_plan_.load ();
+#else
+  delete this->marshal_plan_.value ();
+#endif /* ACE_HAS_CPP11 */
+}
+
+TAO::TypeCode::Marshal_Plan const *
+CORBA::TypeCode::tao_marshal_plan (void) const
+{
+#if defined (ACE_HAS_CPP11)
+  TAO::TypeCode::Marshal_Plan *plan =
+    this->marshal_plan_.load (std::memory_order_acquire);
+#else
+  TAO::TypeCode::Marshal_Plan *plan = this->marshal_plan_.value ();
+#endif /* ACE_HAS_CPP11 */
+
+  if (plan != 0 || !this->tao_cache_marshal_plan ())
+    {
+      return plan;
+    }
+
+  // Built outside of the lock, only the first plan is kept when
+  // threads race.
+  ACE_NEW_RETURN (plan,
+                  TAO::TypeCode::Marshal_Plan (
+                    const_cast<CORBA::TypeCode *> (this)),
+                  0);
+
+#if defined (ACE_HAS_CPP11)
+  TAO::TypeCode::Marshal_Plan *current = 0;
+  if (!this->marshal_plan_.compare_exchange_strong (
+         current, plan, std::memory_order_acq_rel))
+    {
+      delete plan;
+      plan = current;
+    }
+#else
+  ACE_MT (ACE_GUARD_RETURN (ACE_Recursive_Thread_Mutex,
+                            guard,
+                            *ACE_Static_Object_Lock::instance (),
+                            0));
+  TAO::TypeCode::Marshal_Plan * const current = this->marshal_plan_.value ();
+  if (current == 0)
+    {
+      this->marshal_plan_ = plan;
+    }
+  else
+    {
+      delete plan;
+      plan = current;
+    }
+#endif /* ACE_HAS_CPP11 */
+
+  return plan;
+}
+
+bool
+CORBA::TypeCode::tao_cache_marshal_plan (void) const
+{
+  return false;
 }
 
 bool
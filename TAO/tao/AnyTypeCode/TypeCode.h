@@ -36,8 +36,22 @@
 #include "tao/Arg_Traits_T.h"
 #include "tao/Objref_VarOut_T.h"
 
+#if defined (ACE_HAS_CPP11)
+# include <atomic>
+#else
+# include "ace/Atomic_Op.h"
+#endif /* ACE_HAS_CPP11 */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace TAO
+{
+  namespace TypeCode
+  {
+    class Marshal_Plan;
+  }
+}
+
 namespace CORBA
 {
   typedef TAO_Pseudo_Var_T<TypeCode> TypeCode_var;
@@ -410,6 +424,32 @@ namespace CORBA
     virtual bool tao_marshal (TAO_OutputCDR & cdr,
                               CORBA::ULong offset) const = 0;
 
+    /// The plan to skip and append values of this @c TypeCode.
+    /**
+     * Built on first use and kept until this @c TypeCode is
+     * destroyed.  Only struct, alias, array and sequence
+     * @c TypeCodes for which tao_cache_marshal_plan() is true have a
+     * plan.
+     *
+     * @note This is a TAO-specific method that is not part of the
+     *       standard @c CORBA::TypeCode interface.
+     */
+    TAO::TypeCode::Marshal_Plan const * tao_marshal_plan (void) const;
+
+    /// True when a marshal plan is worth building for this
+    /// @c TypeCode.
+    /**
+     * Only the static @c TypeCodes generated by the IDL compiler
+     * live long enough for their plan to pay off.  The default
+     * returns false so that the @c TypeCodes demarshaled along with
+     * each message, for instance in the @c Any of a Notify event, are
+     * interpreted instead.
+     *
+     * @note This is a TAO-specific method that is not part of the
+     *       standard @c CORBA::TypeCode interface.
+     */
+    virtual bool tao_cache_marshal_plan (void) const;
+
     /// Increase the reference count on this @c TypeCode.
     virtual void tao_duplicate (void) = 0;
 
@@ -480,6 +520,16 @@ namespace CORBA
   protected:
     /// The kind of TypeCode.
     TCKind const kind_;
+
+  private:
+    /// The plan returned by tao_marshal_plan(), zero until it is
+    /// built.  Published atomically, the plan is read without a lock.
+#if defined (ACE_HAS_CPP11)
+    mutable std::atomic<TAO::TypeCode::Marshal_Plan *> marshal_plan_;
+#else
+    mutable ACE_Atomic_Op<TAO_SYNCH_MUTEX,
+                          TAO::TypeCode::Marshal_Plan *> marshal_plan_;
+#endif /* ACE_HAS_CPP11 */
   };
 }  // End namespace CORBA
 
@@ -1507,6 +1507,12 @@ operator>> (TAO_InputCDR & cdr, CORBA::TypeCode_ptr & tc)
   TAO::TypeCodeFactory::TC_Info_List indirect_infos;
   TAO::TypeCodeFactory::TC_Info_List direct_infos;
 
+  // The indirections point back in the stream by address, the rest of
+  // a chained stream is read from one block.
+  if (cdr.start ()->cont () != 0 && cdr.pullup (cdr.length ()) != 0) {
+    return false;
+  }
+
   if (!tc_demarshal (cdr, tc, indirect_infos, direct_infos)) {
     cleanup_tc_info_list(direct_infos);
     return false;
@@ -0,0 +1,113 @@
+// -*- C++ -*-
+#include "tao/Batch_Scope.h"
+#include "tao/ORB.h"
+#include "tao/ORB_Core.h"
+#include "tao/Transport.h"
+#include "tao/SystemException.h"
+#include "tao/debug.h"
+
+#if !defined (__ACE_INLINE__)
+# include "tao/Batch_Scope.inl"
+#endif /* ! __ACE_INLINE__ */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  Batch_Scope::Batch_Scope (CORBA::ORB_ptr orb)
+    : orb_core_ (orb->orb_core ())
+    , previous_ (0)
+    , transports_ ()
+    , request_count_ (0)
+  {
+    TAO_ORB_Core_TSS_Resources *tss = this->orb_core_->get_tss_resources ();
+
+    this->previous_ = tss->batch_scope_;
+    tss->batch_scope_ = this;
+  }
+
+  Batch_Scope::~Batch_Scope (void)
+  {
+    // Stop batching first, the requests made while flushing (by
+    // nested upcalls for example) are sent as usual.
+    this->orb_core_->get_tss_resources ()->batch_scope_ = this->previous_;
+
+    if (this->flush_i () == -1 && TAO_debug_level > 0)
+      {
+        TAOLIB_ERROR ((LM_ERROR,
+                       ACE_TEXT ("TAO (%P|%t) - Batch_Scope::~Batch_Scope, ")
+                       ACE_TEXT ("cannot flush the batched requests - %m\n")));
+      }
+  }
+
+  void
+  Batch_Scope::flush (void)
+  {
+    TAO_ORB_Core_TSS_Resources *tss = this->orb_core_->get_tss_resources ();
+
+    // The requests made while flushing are not batched.
+    tss->batch_scope_ = this->previous_;
+    int const result = this->flush_i ();
+    tss->batch_scope_ = this;
+
+    if (result == -1)
+      {
+        throw ::CORBA::COMM_FAILURE (
+          CORBA::SystemException::_tao_minor_code (
+            TAO_INVOCATION_SEND_REQUEST_MINOR_CODE,
+            errno),
+          CORBA::COMPLETED_MAYBE);
+      }
+  }
+
+  void
+  Batch_Scope::add (TAO_Transport *transport)
+  {
+    ++this->request_count_;
+
+    // The requests of a scope tend to go to a few transports, most of
+    // the time to the one of the previous request.
+    for (size_t i = this->transports_.size (); i != 0; --i)
+      {
+        if (this->transports_[i - 1] == transport)
+          {
+            return;
+          }
+      }
+
+    transport->add_reference ();
+    this->transports_.push_back (transport);
+  }
+
+  int
+  Batch_Scope::flush_i (void)
+  {
+    int result = 0;
+
+    for (size_t i = 0; i != this->transports_.size (); ++i)
+      {
+        TAO_Transport *transport = this->transports_[i];
+
+        if (transport->flush_batch (0) == -1)
+          {
+            if (TAO_debug_level > 0)
+              {
+                TAOLIB_ERROR ((LM_ERROR,
+                               ACE_TEXT ("TAO (%P|%t) - Batch_Scope::flush_i, ")
+                               ACE_TEXT ("cannot flush transport[%d]\n"),
+                               transport->id ()));
+              }
+            result = -1;
+          }
+
+        transport->remove_reference ();
+      }
+
+    this->transports_.clear ();
+    this->request_count_ = 0;
+
+    return result;
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
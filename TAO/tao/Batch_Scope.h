@@ -0,0 +1,128 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Batch_Scope.h
+ *
+ *  Batch the oneway and AMI requests of a thread.
+ */
+//=============================================================================
+
+#ifndef TAO_BATCH_SCOPE_H
+#define TAO_BATCH_SCOPE_H
+
+#include /**/ "ace/pre.h"
+
+#include /**/ "tao/TAO_Export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+#include "ace/Vector_T.h"
+
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+class ACE_Time_Value;
+ACE_END_VERSIONED_NAMESPACE_DECL
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace CORBA
+{
+  class ORB;
+  typedef ORB *ORB_ptr;
+}
+
+class TAO_ORB_Core;
+class TAO_Transport;
+
+namespace TAO
+{
+  /**
+   * @class Batch_Scope
+   *
+   * @brief Batch the oneway and AMI requests of a thread.
+   *
+   * While a Batch_Scope is alive, the oneway requests and the AMI
+   * requests that the thread which created it makes through its ORB
+   * are queued in their transport instead of being sent, whatever
+   * their SyncScope policy.  flush(), or the destructor, sends the
+   * requests queued on each transport with as few writev() calls as
+   * the iovec limit allows.  The replies of the AMI requests are
+   * dispatched to their reply handlers as they arrive, as usual.
+   *
+   * Synchronous two-way requests are not batched, a two-way request
+   * made in the scope is sent after the requests queued before it on
+   * the same transport.
+   *
+   * @code
+   * {
+   *   TAO::Batch_Scope batch (orb.in ());
+   *   for (int i = 0; i != n; ++i)
+   *     sensor->sendc_sample (handler.in (), i);
+   * } // All the requests are sent here.
+   * @endcode
+   *
+   * A Batch_Scope must be destroyed by the thread that created it,
+   * scopes created in the scope of another one flush on their own.
+   */
+  class TAO_Export Batch_Scope
+  {
+  public:
+    /// Start batching the requests the calling thread makes through
+    /// @a orb.
+    explicit Batch_Scope (CORBA::ORB_ptr orb);
+
+    /// Flush the requests and stop batching.
+    ~Batch_Scope (void);
+
+    /// Send the requests queued so far, blocking until they are
+    /// written.
+    /**
+     * @throw CORBA::COMM_FAILURE if the requests could not be sent on
+     *        one of the transports.
+     */
+    void flush (void);
+
+    /// Number of requests batched since the last flush.
+    size_t request_count (void) const;
+
+    /// The scope of the calling thread for @a orb_core, 0 if there is
+    /// none.
+    static Batch_Scope *current (TAO_ORB_Core *orb_core);
+
+    /// A request was queued in @a transport, which is flushed with
+    /// the scope.
+    void add (TAO_Transport *transport);
+
+  private:
+    /// Flush the transports and release them.
+    /// @return -1 if a transport could not be flushed, otherwise 0
+    int flush_i (void);
+
+    Batch_Scope (const Batch_Scope &);
+    void operator= (const Batch_Scope &);
+
+  private:
+    TAO_ORB_Core *orb_core_;
+
+    /// The scope that was current when this one was created.
+    Batch_Scope *previous_;
+
+    /// Transports with batched requests, each one holds a reference.
+    ACE_Vector<TAO_Transport *> transports_;
+
+    size_t request_count_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+# include "tao/Batch_Scope.inl"
+#endif /* __ACE_INLINE__ */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_BATCH_SCOPE_H */
@@ -0,0 +1,21 @@
+// -*- C++ -*-
+#include "tao/ORB_Core.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  ACE_INLINE size_t
+  Batch_Scope::request_count (void) const
+  {
+    return this->request_count_;
+  }
+
+  ACE_INLINE Batch_Scope *
+  Batch_Scope::current (TAO_ORB_Core *orb_core)
+  {
+    return orb_core->get_tss_resources ()->batch_scope_;
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -356,5 +356,17 @@ TAO_InputCDR::clr_mb_flags( ACE_Message_Block::Message_Flags less_flags )
   return start_.clr_self_flags( less_flags );
 }
 
+bool
+TAO_InputCDR::can_reference_start (void) const
+{
+  return
+    this->start_.cont () == 0
+    && ACE_BIT_DISABLED (this->start_.flags (),
+                         ACE_Message_Block::DONT_DELETE)
+    && this->orb_core_ != 0
+    && this->orb_core_->resource_factory ()->
+         input_cdr_allocator_type_locked () == 1;
+}
+
 
 TAO_END_VERSIONED_NAMESPACE_DECL
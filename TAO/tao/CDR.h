@@ -419,6 +419,12 @@ public:
   ACE_Message_Block::Message_Flags
     clr_mb_flags( ACE_Message_Block::Message_Flags less_flags );
 
+  /// True when a sequence may keep a reference to the block the
+  /// stream reads from instead of copying its elements: the block is
+  /// a single heap allocated one, from an allocator that can release
+  /// it in any thread.
+  bool can_reference_start (void) const;
+
   // = TAO specific methods.
   static void throw_stub_exception (int error_num);
   static void throw_skel_exception (int error_num);
@@ -26,12 +26,14 @@
 #include "ace/iosfwd.h"
 
 #include <algorithm>
+#include <utility>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO
 {
   template <typename charT> class String_Manager_T;  // Forward declaration.
+  template <typename charT> class SSO_String_Manager_T;  // Forward declaration.
   typedef String_Manager_T<CORBA::Char> String_Manager;
   typedef String_Manager_T<CORBA::WChar> WString_Manager;
 }
@@ -71,6 +73,14 @@ namespace TAO
     {
     }
 
+#if defined (ACE_HAS_CPP11)
+    /// Move constructor, takes the string of @a s.
+    inline String_var (String_var<charT> &&s) : ptr_ (s.ptr_)
+    {
+      s.ptr_ = 0;
+    }
+#endif /* ACE_HAS_CPP11 */
+
     /// Destructor.
     inline ~String_var (void)
     {
@@ -101,6 +111,16 @@ namespace TAO
       return *this;
     }
 
+#if defined (ACE_HAS_CPP11)
+    /// Move assignment operator, takes the string of @a s.
+    inline String_var &operator= (String_var<character_type> &&s)
+    {
+      String_var <charT> tmp (std::move (s));
+      std::swap (this->ptr_, tmp.ptr_);
+      return *this;
+    }
+#endif /* ACE_HAS_CPP11 */
+
     /// Spec-defined read/write version.
     inline operator character_type *&()
     {
@@ -192,6 +212,11 @@ namespace TAO
     {
     }
 
+    /// Construction from a TAO::SSO_String_Manager.
+    inline String_out (SSO_String_Manager_T<charT> &p) : ptr_ (p.out ())
+    {
+    }
+
     /// Copy constructor.
     inline String_out (const String_out<charT> &s) : ptr_ (s.ptr_)
     {
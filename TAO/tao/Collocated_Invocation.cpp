@@ -2,6 +2,7 @@
 #include "tao/ORB_Core.h"
 #include "tao/Request_Dispatcher.h"
 #include "tao/TAO_Server_Request.h"
+#include "tao/Adapter.h"
 #include "tao/Stub.h"
 #include "tao/operation_details.h"
 #include "tao/PortableInterceptor.h"
@@ -66,9 +67,24 @@ namespace TAO
             orb_core->_incr_refcnt ();
             TAO_ORB_Core_Auto_Ptr my_orb_core (orb_core);
 
-            dispatcher->dispatch (orb_core,
-                                  request,
-                                  this->forwarded_to_.out ());
+            // The adapter of the servant may know the target of the
+            // stub from its previous requests.
+            TAO_Adapter * const adapter = orb_core->poa_adapter ();
+
+            int const result =
+              adapter == 0
+                ? TAO_Adapter::DS_MISMATCHED_KEY
+                : adapter->dispatch_collocated (
+                    this->effective_target ()->_stubobj (),
+                    request,
+                    this->forwarded_to_.out ());
+
+            if (result == TAO_Adapter::DS_MISMATCHED_KEY)
+              {
+                dispatcher->dispatch (orb_core,
+                                      request,
+                                      this->forwarded_to_.out ());
+              }
 
             if (request.is_forwarded ())
               {
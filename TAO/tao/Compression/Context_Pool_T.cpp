@@ -0,0 +1,87 @@
+#ifndef TAO_COMPRESSION_CONTEXT_POOL_T_CPP
+#define TAO_COMPRESSION_CONTEXT_POOL_T_CPP
+
+#include "tao/Compression/Context_Pool_T.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+template <typename CONTEXT, typename TRAITS>
+Compression_Context_Pool<CONTEXT, TRAITS>::Compression_Context_Pool (
+  const TRAITS &traits)
+  : traits_ (traits),
+    size_ (0)
+{
+}
+
+template <typename CONTEXT, typename TRAITS>
+Compression_Context_Pool<CONTEXT, TRAITS>::~Compression_Context_Pool (void)
+{
+  while (this->size_ != 0)
+    {
+      this->traits_.destroy (this->contexts_[--this->size_]);
+    }
+}
+
+template <typename CONTEXT, typename TRAITS>
+CONTEXT *
+Compression_Context_Pool<CONTEXT, TRAITS>::acquire (void)
+{
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, 0);
+
+    if (this->size_ != 0)
+      {
+        return this->contexts_[--this->size_];
+      }
+  }
+
+  return this->traits_.create ();
+}
+
+template <typename CONTEXT, typename TRAITS>
+void
+Compression_Context_Pool<CONTEXT, TRAITS>::release (CONTEXT *context)
+{
+  {
+    ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+    if (this->size_ != TAO_COMPRESSION_CONTEXT_POOL_SIZE)
+      {
+        this->contexts_[this->size_++] = context;
+        return;
+      }
+  }
+
+  this->traits_.destroy (context);
+}
+
+template <typename CONTEXT, typename TRAITS>
+Compression_Context_Guard<CONTEXT, TRAITS>::Compression_Context_Guard (
+  Compression_Context_Pool<CONTEXT, TRAITS> &pool)
+  : pool_ (pool),
+    context_ (pool.acquire ())
+{
+}
+
+template <typename CONTEXT, typename TRAITS>
+Compression_Context_Guard<CONTEXT, TRAITS>::~Compression_Context_Guard (void)
+{
+  if (this->context_ != 0)
+    {
+      this->pool_.release (this->context_);
+    }
+}
+
+template <typename CONTEXT, typename TRAITS>
+CONTEXT *
+Compression_Context_Guard<CONTEXT, TRAITS>::get (void) const
+{
+  return this->context_;
+}
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_COMPRESSION_CONTEXT_POOL_T_CPP */
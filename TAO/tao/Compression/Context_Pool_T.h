@@ -0,0 +1,123 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   Context_Pool_T.h
+ *
+ *  Reuse of the contexts of the compression libraries
+ */
+// ===================================================================
+
+#ifndef TAO_COMPRESSION_CONTEXT_POOL_T_H
+#define TAO_COMPRESSION_CONTEXT_POOL_T_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/orbconf.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/Thread_Mutex.h"
+#include "ace/Guard_T.h"
+
+/// The number of idle contexts a pool keeps, the contexts of the
+/// calls beyond it are destroyed when the call completes.
+#if !defined (TAO_COMPRESSION_CONTEXT_POOL_SIZE)
+# define TAO_COMPRESSION_CONTEXT_POOL_SIZE 16
+#endif /* TAO_COMPRESSION_CONTEXT_POOL_SIZE */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * @class Compression_Context_Pool
+   *
+   * @brief Keeps the idle contexts of a compressor for the next calls.
+   *
+   * Creating the context of a compression library allocates and
+   * initializes its window and hash tables, which for small messages
+   * costs more than the compression itself.  A compressor is shared
+   * by all the threads, each call takes a context from its pool and
+   * puts it back when done, so contexts are only created for the peak
+   * number of concurrent calls.
+   *
+   * TRAITS creates and destroys the contexts:
+   * @code
+   * CONTEXT *create (void) const;   // zero when it fails
+   * void destroy (CONTEXT *context) const;
+   * @endcode
+   */
+  template <typename CONTEXT, typename TRAITS>
+  class Compression_Context_Pool
+  {
+  public:
+    explicit Compression_Context_Pool (const TRAITS &traits = TRAITS ());
+
+    /// Destroy the idle contexts.
+    ~Compression_Context_Pool (void);
+
+    /// Returns an idle context, or a new one when there is none.
+    /// Returns zero when a new context cannot be created.
+    CONTEXT *acquire (void);
+
+    /// Keep @a context for the next calls, destroy it when the pool is
+    /// full.  The caller resets the context first.
+    void release (CONTEXT *context);
+
+  private:
+    Compression_Context_Pool (const Compression_Context_Pool &);
+    Compression_Context_Pool &operator= (const Compression_Context_Pool &);
+
+    TRAITS const traits_;
+
+    TAO_SYNCH_MUTEX lock_;
+
+    /// The idle contexts, the most recently used one last.
+    CONTEXT *contexts_[TAO_COMPRESSION_CONTEXT_POOL_SIZE];
+    size_t size_;
+  };
+
+  /**
+   * @class Compression_Context_Guard
+   *
+   * @brief Holds a context of a Compression_Context_Pool during a
+   * call.
+   */
+  template <typename CONTEXT, typename TRAITS>
+  class Compression_Context_Guard
+  {
+  public:
+    explicit Compression_Context_Guard (
+      Compression_Context_Pool<CONTEXT, TRAITS> &pool);
+
+    /// Return the context to its pool.
+    ~Compression_Context_Guard (void);
+
+    /// The context, zero when it could not be created.
+    CONTEXT *get (void) const;
+
+  private:
+    Compression_Context_Guard (const Compression_Context_Guard &);
+    Compression_Context_Guard &operator= (const Compression_Context_Guard &);
+
+    Compression_Context_Pool<CONTEXT, TRAITS> &pool_;
+    CONTEXT *context_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (ACE_TEMPLATES_REQUIRE_SOURCE)
+#include "tao/Compression/Context_Pool_T.cpp"
+#endif /* ACE_TEMPLATES_REQUIRE_SOURCE */
+
+#if defined (ACE_TEMPLATES_REQUIRE_PRAGMA)
+#pragma implementation ("Context_Pool_T.cpp")
+#endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_COMPRESSION_CONTEXT_POOL_T_H */
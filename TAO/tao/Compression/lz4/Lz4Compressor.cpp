@@ -0,0 +1,125 @@
+#include "Lz4Compressor.h"
+#include <lz4.h>
+#include <lz4hc.h>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+LZ4_stream_u *
+Lz4Compressor::Stream_Traits::create (void) const
+{
+  return ::LZ4_createStream ();
+}
+
+void
+Lz4Compressor::Stream_Traits::destroy (LZ4_stream_u *stream) const
+{
+  ::LZ4_freeStream (stream);
+}
+
+LZ4_streamHC_u *
+Lz4Compressor::StreamHC_Traits::create (void) const
+{
+  return ::LZ4_createStreamHC ();
+}
+
+void
+Lz4Compressor::StreamHC_Traits::destroy (LZ4_streamHC_u *stream) const
+{
+  ::LZ4_freeStreamHC (stream);
+}
+
+Lz4Compressor::Lz4Compressor (
+  ::Compression::CompressorFactory_ptr compressor_factory,
+  ::Compression::CompressionLevel compression_level) :
+    BaseCompressor (compressor_factory, compression_level)
+{
+}
+
+void
+Lz4Compressor::compress (
+    const ::Compression::Buffer & source,
+    ::Compression::Buffer & target)
+{
+  int const source_length = static_cast <int> (source.length ());
+
+  // Ensure maximum is big enough for incompressible input.
+  target.length (static_cast <CORBA::ULong> (::LZ4_compressBound (source_length)));
+  int const max_length = static_cast <int> (target.maximum ());
+
+  // The extState functions reset the state they are given.
+  int retval = 0;
+  if (this->compression_level () < LZ4HC_CLEVEL_MIN)
+    {
+      Compression_Context_Guard<LZ4_stream_u, Stream_Traits>
+        stream (this->streams_);
+
+      if (stream.get () == 0)
+        {
+          throw ::Compression::CompressionException (0, "out of memory");
+        }
+
+      retval = ::LZ4_compress_fast_extState (
+        stream.get (),
+        reinterpret_cast <const char*> (source.get_buffer ()),
+        reinterpret_cast <char*> (target.get_buffer ()),
+        source_length,
+        max_length,
+        1);
+    }
+  else
+    {
+      Compression_Context_Guard<LZ4_streamHC_u, StreamHC_Traits>
+        stream (this->streams_hc_);
+
+      if (stream.get () == 0)
+        {
+          throw ::Compression::CompressionException (0, "out of memory");
+        }
+
+      retval = ::LZ4_compress_HC_extStateHC (
+        stream.get (),
+        reinterpret_cast <const char*> (source.get_buffer ()),
+        reinterpret_cast <char*> (target.get_buffer ()),
+        source_length,
+        max_length,
+        static_cast <int> (this->compression_level ()));
+    }
+
+  if (retval <= 0)
+    {
+      throw ::Compression::CompressionException (retval, "");
+    }
+  else
+    {
+      target.length (static_cast <CORBA::ULong> (retval));
+    }
+
+  // Update statistics for this compressor
+  this->update_stats (source.length (), target.length ());
+}
+
+void
+Lz4Compressor::decompress (
+  const ::Compression::Buffer & source,
+  ::Compression::Buffer & target)
+{
+  int const retval = ::LZ4_decompress_safe (
+    reinterpret_cast <const char*> (source.get_buffer ()),
+    reinterpret_cast <char*> (target.get_buffer ()),
+    static_cast <int> (source.length ()),
+    static_cast <int> (target.maximum ()));
+
+  if (retval < 0)
+    {
+      throw ::Compression::CompressionException (retval, "");
+    }
+  else
+    {
+      target.length (static_cast <CORBA::ULong> (retval));
+    }
+}
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
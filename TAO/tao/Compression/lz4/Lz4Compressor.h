@@ -0,0 +1,81 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   Lz4Compressor.h
+ *
+ *  See https://lz4.github.io/lz4/ for the lz4 interface itself
+ */
+// ===================================================================
+
+#ifndef TAO_LZ4COMPRESSOR_H
+#define TAO_LZ4COMPRESSOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/lz4/Lz4Compressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Base_Compressor.h"
+#include "tao/Compression/Context_Pool_T.h"
+
+union LZ4_stream_u;
+union LZ4_streamHC_u;
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * LZ4 compressor.  Levels up to 2 use the fast LZ4 compressor, the
+   * higher ones the LZ4 HC compressor at that level, which trades
+   * compression speed for ratio.  Decompression is equally fast for
+   * both.  The compression states are kept for the next messages, the
+   * HC one is too large to be allocated for each message.
+   */
+  class TAO_LZ4COMPRESSOR_Export Lz4Compressor : public BaseCompressor
+  {
+    public:
+      Lz4Compressor (::Compression::CompressorFactory_ptr compressor_factory,
+                     ::Compression::CompressionLevel compression_level);
+
+      virtual void compress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+
+      virtual void decompress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+
+    private:
+      /// Creates the states of the fast compressor.
+      class Stream_Traits
+      {
+      public:
+        LZ4_stream_u *create (void) const;
+        void destroy (LZ4_stream_u *stream) const;
+      };
+
+      /// Creates the states of the HC compressor.
+      class StreamHC_Traits
+      {
+      public:
+        LZ4_streamHC_u *create (void) const;
+        void destroy (LZ4_streamHC_u *stream) const;
+      };
+
+      /// Only the pool of the compressor of the level is used.
+      Compression_Context_Pool<LZ4_stream_u, Stream_Traits> streams_;
+      Compression_Context_Pool<LZ4_streamHC_u, StreamHC_Traits> streams_hc_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_LZ4COMPRESSOR_H */
@@ -0,0 +1,60 @@
+#include "tao/Compression/lz4/Lz4Compressor_Factory.h"
+#include "tao/Compression/lz4/Lz4Compressor.h"
+#include "ace/Min_Max.h"
+#include <lz4hc.h>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+
+Lz4_CompressorFactory::Lz4_CompressorFactory (void) :
+  ::TAO::CompressorFactory (::Compression::COMPRESSORID_LZ4)
+{
+}
+
+::Compression::Compressor_ptr
+Lz4_CompressorFactory::get_compressor (
+    ::Compression::CompressionLevel compression_level)
+{
+  // Levels above the highest LZ4 HC level compress the same.
+  compression_level =
+    ace_min (compression_level,
+             ::Compression::CompressionLevel (LZ4HC_CLEVEL_MAX));
+
+  ::Compression::Compressor_ptr compressor = 0;
+
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->mutex_, 0);
+
+    try
+      {
+        Lz4CompressorMap::iterator it =
+          this->compressors_.find (compression_level);
+
+        if (it == this->compressors_.end ())
+          {
+            ACE_NEW_RETURN (compressor,
+                            ::TAO::Lz4Compressor (this, compression_level),
+                            0);
+            it = this->compressors_.insert (
+              Lz4CompressorMap::value_type (compression_level,
+                                            compressor)).first;
+          }
+
+        compressor = (*it).second.in ();
+      }
+    catch (...)
+      {
+        TAOLIB_ERROR_RETURN ((LM_ERROR,
+          ACE_TEXT ("(%P | %t) ERROR: Lz4Compressor - Unable to create ")
+          ACE_TEXT ("Lz4 Compressor at level [%d].\n"),
+          int (compression_level)), 0);
+      }
+  }
+
+  return ::Compression::Compressor::_duplicate (compressor);
+}
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
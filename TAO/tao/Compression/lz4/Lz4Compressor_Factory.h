@@ -0,0 +1,53 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   Lz4Compressor_Factory.h
+ */
+// ===================================================================
+
+#ifndef TAO_LZ4COMPRESSOR_FACTORY_H
+#define TAO_LZ4COMPRESSOR_FACTORY_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/lz4/Lz4Compressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Compressor_Factory.h"
+#include <map>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  class TAO_LZ4COMPRESSOR_Export Lz4_CompressorFactory :
+    public ::TAO::CompressorFactory
+  {
+    typedef std::map< ::Compression::CompressionLevel,
+        const ::Compression::Compressor_var> Lz4CompressorMap;
+
+  public:
+    Lz4_CompressorFactory (void);
+
+    virtual ::Compression::Compressor_ptr get_compressor (
+        ::Compression::CompressionLevel compression_level);
+
+  private:
+    ACE_UNIMPLEMENTED_FUNC (Lz4_CompressorFactory (const Lz4_CompressorFactory &))
+    ACE_UNIMPLEMENTED_FUNC (Lz4_CompressorFactory &operator= (const Lz4_CompressorFactory &))
+
+    TAO_SYNCH_MUTEX mutex_;
+    Lz4CompressorMap compressors_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_LZ4COMPRESSOR_FACTORY_H */
@@ -6,6 +6,18 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO
 {
+void *
+LzoCompressor::Work_Memory_Traits::create (void) const
+{
+  return ::lzo_malloc (LZO1X_1_MEM_COMPRESS);
+}
+
+void
+LzoCompressor::Work_Memory_Traits::destroy (void *work_memory) const
+{
+  ::lzo_free (work_memory);
+}
+
 LzoCompressor::LzoCompressor (
   ::Compression::CompressorFactory_ptr compressor_factory,
   ::Compression::CompressionLevel compression_level) :
@@ -18,7 +30,14 @@ LzoCompressor::compress (
     const ::Compression::Buffer & source,
     ::Compression::Buffer & target)
 {
-  void* wrkmem = (lzo_bytep) lzo_malloc(LZO1X_1_MEM_COMPRESS);
+  Compression_Context_Guard<void, Work_Memory_Traits>
+    wrkmem (this->work_memory_);
+
+  if (wrkmem.get () == 0)
+    {
+      throw ::Compression::CompressionException (LZO_E_OUT_OF_MEMORY, "");
+    }
+
   // Ensure maximum is at least a bit bigger than input length.
   target.length (static_cast <CORBA::ULong> ((source.length () * 1.1) + 12));
   lzo_uint max_length = static_cast <lzo_uint> (target.maximum ());
@@ -28,9 +47,7 @@ LzoCompressor::compress (
             source.length (),
             reinterpret_cast <unsigned char*>(target.get_buffer ()),
             &max_length,
-            wrkmem);
-
-  lzo_free(wrkmem);
+            wrkmem.get ());
 
   if (retval != LZO_E_OK)
     {
@@ -23,6 +23,7 @@
 
 #include "tao/Compression/Compression.h"
 #include "tao/Compression/Base_Compressor.h"
+#include "tao/Compression/Context_Pool_T.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -41,6 +42,17 @@ namespace TAO
       virtual void decompress (
           const ::Compression::Buffer & source,
           ::Compression::Buffer & target);
+
+    private:
+      /// Allocates the work memory of the compression.
+      class Work_Memory_Traits
+      {
+      public:
+        void *create (void) const;
+        void destroy (void *work_memory) const;
+      };
+
+      Compression_Context_Pool<void, Work_Memory_Traits> work_memory_;
   };
 }
 
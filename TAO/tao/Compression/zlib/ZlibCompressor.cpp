@@ -5,10 +5,68 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO
 {
+ZlibCompressor::Deflate_Traits::Deflate_Traits (int level) :
+  level_ (level)
+{
+}
+
+z_stream_s *
+ZlibCompressor::Deflate_Traits::create (void) const
+{
+  z_stream *stream = 0;
+  ACE_NEW_RETURN (stream, z_stream, 0);
+  stream->zalloc = Z_NULL;
+  stream->zfree = Z_NULL;
+  stream->opaque = Z_NULL;
+
+  if (::deflateInit (stream, this->level_) != Z_OK)
+    {
+      delete stream;
+      return 0;
+    }
+
+  return stream;
+}
+
+void
+ZlibCompressor::Deflate_Traits::destroy (z_stream_s *stream) const
+{
+  ::deflateEnd (stream);
+  delete stream;
+}
+
+z_stream_s *
+ZlibCompressor::Inflate_Traits::create (void) const
+{
+  z_stream *stream = 0;
+  ACE_NEW_RETURN (stream, z_stream, 0);
+  stream->zalloc = Z_NULL;
+  stream->zfree = Z_NULL;
+  stream->opaque = Z_NULL;
+  stream->next_in = Z_NULL;
+  stream->avail_in = 0;
+
+  if (::inflateInit (stream) != Z_OK)
+    {
+      delete stream;
+      return 0;
+    }
+
+  return stream;
+}
+
+void
+ZlibCompressor::Inflate_Traits::destroy (z_stream_s *stream) const
+{
+  ::inflateEnd (stream);
+  delete stream;
+}
+
 ZlibCompressor::ZlibCompressor (
   ::Compression::CompressorFactory_ptr compressor_factory,
   ::Compression::CompressionLevel compression_level) :
-    BaseCompressor (compressor_factory, compression_level)
+    BaseCompressor (compressor_factory, compression_level),
+    deflate_streams_ (Deflate_Traits (compression_level))
 {
 }
 
@@ -17,24 +75,39 @@ ZlibCompressor::compress (
     const ::Compression::Buffer & source,
     ::Compression::Buffer & target)
 {
-  // Ensure maximum is at least a bit bigger than input length.
-  target.length(static_cast<CORBA::ULong>((source.length() * 1.001) + 12));
+  Compression_Context_Guard<z_stream_s, Deflate_Traits>
+    stream (this->deflate_streams_);
 
-  uLongf max_length = static_cast <uLongf>(target.maximum());
+  if (stream.get () == 0)
+    {
+      throw ::Compression::CompressionException (Z_MEM_ERROR,
+                                                 ::zError (Z_MEM_ERROR));
+    }
+
+  // Ensure maximum is big enough for incompressible input.
+  target.length (static_cast <CORBA::ULong> (
+    ::deflateBound (stream.get (), source.length ())));
 
-  int const retval = ::compress2 (reinterpret_cast <Bytef*>(target.get_buffer ()),
-                                  &max_length,
-                                  reinterpret_cast <const Bytef*>(source.get_buffer ()),
-                                  source.length (),
-                                  this->compression_level ());
+  // Same zlib format as compress2(), which would initialize a new
+  // stream for each message.
+  stream.get ()->next_in =
+    const_cast <Bytef*> (reinterpret_cast <const Bytef*> (source.get_buffer ()));
+  stream.get ()->avail_in = source.length ();
+  stream.get ()->next_out = reinterpret_cast <Bytef*> (target.get_buffer ());
+  stream.get ()->avail_out = target.maximum ();
 
-  if (retval != Z_OK)
+  int const retval = ::deflate (stream.get (), Z_FINISH);
+  uLong const compressed_length = stream.get ()->total_out;
+  ::deflateReset (stream.get ());
+
+  if (retval != Z_STREAM_END)
     {
-      throw ::Compression::CompressionException (retval, ::zError (retval));
+      int const error = retval == Z_OK ? Z_BUF_ERROR : retval;
+      throw ::Compression::CompressionException (error, ::zError (error));
     }
   else
     {
-      target.length (static_cast <CORBA::ULong> (max_length));
+      target.length (static_cast <CORBA::ULong> (compressed_length));
     }
 
   // Update statistics for this compressor
@@ -46,19 +119,44 @@ ZlibCompressor::decompress (
   const ::Compression::Buffer & source,
   ::Compression::Buffer & target)
 {
-  uLongf max_length = static_cast <uLongf> (target.maximum ());
-  int const retval = uncompress (reinterpret_cast <Bytef*>(target.get_buffer ()),
-                                 &max_length,
-                                 reinterpret_cast <const Bytef*>(source.get_buffer ()),
-                                 source.length ());
+  Compression_Context_Guard<z_stream_s, Inflate_Traits>
+    stream (this->inflate_streams_);
+
+  if (stream.get () == 0)
+    {
+      throw ::Compression::CompressionException (Z_MEM_ERROR, "");
+    }
+
+  stream.get ()->next_in =
+    const_cast <Bytef*> (reinterpret_cast <const Bytef*> (source.get_buffer ()));
+  stream.get ()->avail_in = source.length ();
+  stream.get ()->next_out = reinterpret_cast <Bytef*> (target.get_buffer ());
+  stream.get ()->avail_out = target.maximum ();
+
+  int const retval = ::inflate (stream.get (), Z_FINISH);
+  uLong const decompressed_length = stream.get ()->total_out;
+  bool const target_full = stream.get ()->avail_out == 0;
+  ::inflateReset (stream.get ());
 
-  if (retval != Z_OK)
+  if (retval != Z_STREAM_END)
     {
-      throw ::Compression::CompressionException (retval, "");
+      // Like uncompress(), a truncated message is a data error and a
+      // too small target a buffer error.
+      int error = retval;
+      if (retval == Z_NEED_DICT
+          || ((retval == Z_OK || retval == Z_BUF_ERROR) && !target_full))
+        {
+          error = Z_DATA_ERROR;
+        }
+      else if (retval == Z_OK)
+        {
+          error = Z_BUF_ERROR;
+        }
+      throw ::Compression::CompressionException (error, "");
     }
   else
     {
-      target.length (static_cast  <CORBA::ULong> (max_length));
+      target.length (static_cast  <CORBA::ULong> (decompressed_length));
     }
 }
 }
@@ -23,11 +23,19 @@
 
 #include "tao/Compression/Compression.h"
 #include "tao/Compression/Base_Compressor.h"
+#include "tao/Compression/Context_Pool_T.h"
+
+struct z_stream_s;
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO
 {
+  /**
+   * zlib compressor.  The deflate and inflate streams are reset and
+   * kept for the next messages instead of being initialized for each
+   * one, which dominates the cost of compressing small messages.
+   */
   class TAO_ZLIBCOMPRESSOR_Export ZlibCompressor : public BaseCompressor
   {
     public:
@@ -41,6 +49,29 @@ namespace TAO
       virtual void decompress (
           const ::Compression::Buffer & source,
           ::Compression::Buffer & target);
+
+    private:
+      /// Creates the deflate streams at the level of the compressor.
+      class Deflate_Traits
+      {
+      public:
+        explicit Deflate_Traits (int level = -1);
+        z_stream_s *create (void) const;
+        void destroy (z_stream_s *stream) const;
+      private:
+        int level_;
+      };
+
+      /// Creates the inflate streams.
+      class Inflate_Traits
+      {
+      public:
+        z_stream_s *create (void) const;
+        void destroy (z_stream_s *stream) const;
+      };
+
+      Compression_Context_Pool<z_stream_s, Deflate_Traits> deflate_streams_;
+      Compression_Context_Pool<z_stream_s, Inflate_Traits> inflate_streams_;
   };
 }
 
@@ -0,0 +1,158 @@
+#include "ZstdCompressor.h"
+#include <zstd.h>
+#include <zstd_errors.h>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+ZSTD_CCtx_s *
+ZstdCompressor::CCtx_Traits::create (void) const
+{
+  return ::ZSTD_createCCtx ();
+}
+
+void
+ZstdCompressor::CCtx_Traits::destroy (ZSTD_CCtx_s *context) const
+{
+  ::ZSTD_freeCCtx (context);
+}
+
+ZSTD_DCtx_s *
+ZstdCompressor::DCtx_Traits::create (void) const
+{
+  return ::ZSTD_createDCtx ();
+}
+
+void
+ZstdCompressor::DCtx_Traits::destroy (ZSTD_DCtx_s *context) const
+{
+  ::ZSTD_freeDCtx (context);
+}
+
+ZstdCompressor::ZstdCompressor (
+  ::Compression::CompressorFactory_ptr compressor_factory,
+  ::Compression::CompressionLevel compression_level,
+  const ::Compression::Buffer &dictionary) :
+    BaseCompressor (compressor_factory, compression_level),
+    cdict_ (0),
+    ddict_ (0),
+    dictionary_id_ (0)
+{
+  if (dictionary.length () != 0)
+    {
+      this->cdict_ = ::ZSTD_createCDict (dictionary.get_buffer (),
+                                         dictionary.length (),
+                                         compression_level);
+      this->ddict_ = ::ZSTD_createDDict (dictionary.get_buffer (),
+                                         dictionary.length ());
+      this->dictionary_id_ =
+        ::ZSTD_getDictID_fromDict (dictionary.get_buffer (),
+                                   dictionary.length ());
+    }
+}
+
+ZstdCompressor::~ZstdCompressor (void)
+{
+  ::ZSTD_freeCDict (this->cdict_);
+  ::ZSTD_freeDDict (this->ddict_);
+}
+
+void
+ZstdCompressor::compress (
+    const ::Compression::Buffer & source,
+    ::Compression::Buffer & target)
+{
+  // Ensure maximum is big enough for incompressible input.
+  target.length (static_cast <CORBA::ULong> (
+    ::ZSTD_compressBound (source.length ())));
+
+  // Both functions start a new frame, whatever the context was
+  // used for before.
+  Compression_Context_Guard<ZSTD_CCtx_s, CCtx_Traits>
+    context (this->compression_contexts_);
+  if (context.get () == 0)
+    {
+      throw ::Compression::CompressionException (
+        ZSTD_error_memory_allocation, "");
+    }
+
+  size_t const retval =
+    this->cdict_ != 0
+      ? ::ZSTD_compress_usingCDict (context.get (),
+                                    target.get_buffer (),
+                                    target.maximum (),
+                                    source.get_buffer (),
+                                    source.length (),
+                                    this->cdict_)
+      : ::ZSTD_compressCCtx (context.get (),
+                             target.get_buffer (),
+                             target.maximum (),
+                             source.get_buffer (),
+                             source.length (),
+                             this->compression_level ());
+
+  if (::ZSTD_isError (retval))
+    {
+      throw ::Compression::CompressionException (
+        ::ZSTD_getErrorCode (retval), ::ZSTD_getErrorName (retval));
+    }
+  else
+    {
+      target.length (static_cast <CORBA::ULong> (retval));
+    }
+
+  // Update statistics for this compressor
+  this->update_stats (source.length (), target.length ());
+}
+
+void
+ZstdCompressor::decompress (
+  const ::Compression::Buffer & source,
+  ::Compression::Buffer & target)
+{
+  unsigned int const frame_dictionary_id =
+    ::ZSTD_getDictID_fromFrame (source.get_buffer (), source.length ());
+
+  if (frame_dictionary_id != 0
+      && frame_dictionary_id != this->dictionary_id_)
+    {
+      throw ::Compression::CompressionException (
+        ZSTD_error_dictionary_wrong, "dictionary mismatch");
+    }
+
+  Compression_Context_Guard<ZSTD_DCtx_s, DCtx_Traits>
+    context (this->decompression_contexts_);
+  if (context.get () == 0)
+    {
+      throw ::Compression::CompressionException (
+        ZSTD_error_memory_allocation, "");
+    }
+
+  size_t const retval =
+    this->ddict_ != 0
+      ? ::ZSTD_decompress_usingDDict (context.get (),
+                                      target.get_buffer (),
+                                      target.maximum (),
+                                      source.get_buffer (),
+                                      source.length (),
+                                      this->ddict_)
+      : ::ZSTD_decompressDCtx (context.get (),
+                               target.get_buffer (),
+                               target.maximum (),
+                               source.get_buffer (),
+                               source.length ());
+
+  if (::ZSTD_isError (retval))
+    {
+      throw ::Compression::CompressionException (
+        ::ZSTD_getErrorCode (retval), ::ZSTD_getErrorName (retval));
+    }
+  else
+    {
+      target.length (static_cast <CORBA::ULong> (retval));
+    }
+}
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,99 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   ZstdCompressor.h
+ *
+ *  See https://facebook.github.io/zstd/ for the zstd interface itself
+ */
+// ===================================================================
+
+#ifndef TAO_ZSTDCOMPRESSOR_H
+#define TAO_ZSTDCOMPRESSOR_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/zstd/ZstdCompressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Base_Compressor.h"
+#include "tao/Compression/Context_Pool_T.h"
+
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * Zstandard compressor.
+   *
+   * With a dictionary, trained on messages like the ones that are
+   * compressed, small messages compress much better: the
+   * compressor does not have to learn their structure from each of
+   * them.  Both peers must use the same dictionary, the frames carry
+   * the id of their dictionary so a frame compressed with another one
+   * raises a CompressionException instead of being decompressed into
+   * garbage.  The compression and decompression contexts are kept
+   * for the next messages.
+   */
+  class TAO_ZSTDCOMPRESSOR_Export ZstdCompressor : public BaseCompressor
+  {
+    public:
+      /// Use @a dictionary unless it is empty.
+      ZstdCompressor (::Compression::CompressorFactory_ptr compressor_factory,
+                      ::Compression::CompressionLevel compression_level,
+                      const ::Compression::Buffer &dictionary);
+
+      virtual ~ZstdCompressor (void);
+
+      virtual void compress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+
+      virtual void decompress (
+          const ::Compression::Buffer & source,
+          ::Compression::Buffer & target);
+
+    private:
+      /// Creates the compression contexts.
+      class CCtx_Traits
+      {
+      public:
+        ZSTD_CCtx_s *create (void) const;
+        void destroy (ZSTD_CCtx_s *context) const;
+      };
+
+      /// Creates the decompression contexts.
+      class DCtx_Traits
+      {
+      public:
+        ZSTD_DCtx_s *create (void) const;
+        void destroy (ZSTD_DCtx_s *context) const;
+      };
+
+      Compression_Context_Pool<ZSTD_CCtx_s, CCtx_Traits> compression_contexts_;
+      Compression_Context_Pool<ZSTD_DCtx_s, DCtx_Traits> decompression_contexts_;
+
+      /// The digested dictionary, zero without dictionary.
+      ZSTD_CDict_s *cdict_;
+      ZSTD_DDict_s *ddict_;
+
+      /// The id of the dictionary, zero without dictionary or for
+      /// raw content dictionaries.
+      unsigned int dictionary_id_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_ZSTDCOMPRESSOR_H */
@@ -0,0 +1,146 @@
+#include "tao/Compression/zstd/ZstdCompressor_Factory.h"
+#include "tao/Compression/zstd/ZstdCompressor.h"
+#include "ace/Min_Max.h"
+#include "ace/OS_NS_fcntl.h"
+#include "ace/OS_NS_unistd.h"
+#include "ace/OS_NS_sys_stat.h"
+#include <zstd.h>
+#include <zdict.h>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+
+Zstd_CompressorFactory::Zstd_CompressorFactory (void) :
+  ::TAO::CompressorFactory (::Compression::COMPRESSORID_ZSTD)
+{
+}
+
+Zstd_CompressorFactory::Zstd_CompressorFactory (
+    const ::Compression::Buffer &dictionary) :
+  ::TAO::CompressorFactory (::Compression::COMPRESSORID_ZSTD),
+  dictionary_ (dictionary)
+{
+}
+
+::Compression::Compressor_ptr
+Zstd_CompressorFactory::get_compressor (
+    ::Compression::CompressionLevel compression_level)
+{
+  // Level 0 is the default level of zstd.
+  compression_level =
+    ace_min (compression_level,
+             ::Compression::CompressionLevel (::ZSTD_maxCLevel ()));
+
+  ::Compression::Compressor_ptr compressor = 0;
+
+  {
+    ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->mutex_, 0);
+
+    try
+      {
+        ZstdCompressorMap::iterator it =
+          this->compressors_.find (compression_level);
+
+        if (it == this->compressors_.end ())
+          {
+            ACE_NEW_RETURN (compressor,
+                            ::TAO::ZstdCompressor (this,
+                                                   compression_level,
+                                                   this->dictionary_),
+                            0);
+            it = this->compressors_.insert (
+              ZstdCompressorMap::value_type (compression_level,
+                                             compressor)).first;
+          }
+
+        compressor = (*it).second.in ();
+      }
+    catch (...)
+      {
+        TAOLIB_ERROR_RETURN ((LM_ERROR,
+          ACE_TEXT ("(%P | %t) ERROR: ZstdCompressor - Unable to create ")
+          ACE_TEXT ("Zstd Compressor at level [%d].\n"),
+          int (compression_level)), 0);
+      }
+  }
+
+  return ::Compression::Compressor::_duplicate (compressor);
+}
+
+unsigned int
+Zstd_CompressorFactory::dictionary_id (void) const
+{
+  return ::ZSTD_getDictID_fromDict (this->dictionary_.get_buffer (),
+                                    this->dictionary_.length ());
+}
+
+int
+Zstd_CompressorFactory::load_dictionary (const ACE_TCHAR *filename,
+                                         ::Compression::Buffer &dictionary)
+{
+  ACE_HANDLE const handle = ACE_OS::open (filename, O_RDONLY);
+  if (handle == ACE_INVALID_HANDLE)
+    {
+      TAOLIB_ERROR_RETURN ((LM_ERROR,
+        ACE_TEXT ("(%P | %t) ERROR: ZstdCompressor - Unable to open ")
+        ACE_TEXT ("dictionary %s\n"),
+        filename), -1);
+    }
+
+  ACE_OFF_T const size = ACE_OS::filesize (handle);
+  int result = -1;
+  if (size > 0)
+    {
+      dictionary.length (static_cast <CORBA::ULong> (size));
+      if (ACE_OS::read_n (handle,
+                          dictionary.get_buffer (),
+                          dictionary.length ()) ==
+            static_cast <ssize_t> (size))
+        result = 0;
+    }
+
+  ACE_OS::close (handle);
+
+  if (result != 0)
+    {
+      dictionary.length (0);
+      TAOLIB_ERROR_RETURN ((LM_ERROR,
+        ACE_TEXT ("(%P | %t) ERROR: ZstdCompressor - Unable to read ")
+        ACE_TEXT ("dictionary %s\n"),
+        filename), -1);
+    }
+
+  return 0;
+}
+
+void
+Zstd_CompressorFactory::train_dictionary (
+  const ::Compression::Buffer &samples,
+  const size_t *sample_sizes,
+  unsigned int sample_count,
+  size_t capacity,
+  ::Compression::Buffer &dictionary)
+{
+  dictionary.length (static_cast <CORBA::ULong> (capacity));
+
+  size_t const retval =
+    ::ZDICT_trainFromBuffer (dictionary.get_buffer (),
+                             dictionary.length (),
+                             samples.get_buffer (),
+                             sample_sizes,
+                             sample_count);
+
+  if (::ZDICT_isError (retval))
+    {
+      dictionary.length (0);
+      throw ::Compression::CompressionException (
+        0, ::ZDICT_getErrorName (retval));
+    }
+
+  dictionary.length (static_cast <CORBA::ULong> (retval));
+}
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
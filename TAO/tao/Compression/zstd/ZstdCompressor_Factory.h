@@ -0,0 +1,95 @@
+// -*- C++ -*-
+
+// ===================================================================
+/**
+ *  @file   ZstdCompressor_Factory.h
+ */
+// ===================================================================
+
+#ifndef TAO_ZSTDCOMPRESSOR_FACTORY_H
+#define TAO_ZSTDCOMPRESSOR_FACTORY_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Compression/zstd/ZstdCompressor_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/Compressor_Factory.h"
+#include <map>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * Creates the Zstandard compressors of an ORB.
+   *
+   * The factory is registered with the CompressionManager of each ORB,
+   * so each ORB can be configured with its own dictionary.  A
+   * dictionary is trained once on representative messages, with
+   * train_dictionary() or with "zstd --train", and loaded by all the
+   * peers:
+   *
+   * @code
+   * ::Compression::Buffer dictionary;
+   * TAO::Zstd_CompressorFactory::load_dictionary (
+   *   ACE_TEXT ("quotes.dict"), dictionary);
+   * ::Compression::CompressorFactory_ptr factory = 0;
+   * ACE_NEW_RETURN (factory, TAO::Zstd_CompressorFactory (dictionary), 1);
+   * @endcode
+   */
+  class TAO_ZSTDCOMPRESSOR_Export Zstd_CompressorFactory :
+    public ::TAO::CompressorFactory
+  {
+    typedef std::map< ::Compression::CompressionLevel,
+        const ::Compression::Compressor_var> ZstdCompressorMap;
+
+  public:
+    Zstd_CompressorFactory (void);
+
+    /// The compressors of this factory use @a dictionary.
+    explicit Zstd_CompressorFactory (const ::Compression::Buffer &dictionary);
+
+    virtual ::Compression::Compressor_ptr get_compressor (
+        ::Compression::CompressionLevel compression_level);
+
+    /// The id of the dictionary, zero without dictionary or for a
+    /// raw content dictionary.
+    unsigned int dictionary_id (void) const;
+
+    /// Read the dictionary stored in @a filename into @a dictionary.
+    /// Returns -1 if the file cannot be read.
+    static int load_dictionary (const ACE_TCHAR *filename,
+                                ::Compression::Buffer &dictionary);
+
+    /**
+     * Train a dictionary of at most @a capacity bytes on the
+     * @a sample_count messages stored one after the other in
+     * @a samples, @a sample_sizes gives their sizes.  A hundred
+     * samples or more give the best dictionaries.
+     */
+    static void train_dictionary (const ::Compression::Buffer &samples,
+                                  const size_t *sample_sizes,
+                                  unsigned int sample_count,
+                                  size_t capacity,
+                                  ::Compression::Buffer &dictionary);
+
+  private:
+    ACE_UNIMPLEMENTED_FUNC (Zstd_CompressorFactory (const Zstd_CompressorFactory &))
+    ACE_UNIMPLEMENTED_FUNC (Zstd_CompressorFactory &operator= (const Zstd_CompressorFactory &))
+
+    TAO_SYNCH_MUTEX mutex_;
+    ZstdCompressorMap compressors_;
+    ::Compression::Buffer const dictionary_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_ZSTDCOMPRESSOR_FACTORY_H */
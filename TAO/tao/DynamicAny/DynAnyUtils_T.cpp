@@ -90,6 +90,116 @@ namespace TAO
       }
   }
 
+  template<typename T>
+  TAO_DynSequence_i *
+  DynAnySeqUtils<T>::sequence (TAO_DynCommon *the_dynany,
+                               DynamicAny::DynAny_var &component)
+  {
+    TAO_DynSequence_i *seq = dynamic_cast<TAO_DynSequence_i *> (the_dynany);
+    CORBA::TypeCode_var tc;
+
+    if (seq != 0)
+      {
+        tc = seq->type ();
+
+        if (tc->equivalent (BasicTypeTraits<T>::tc_value))
+          {
+            return seq;
+          }
+      }
+
+    if (!the_dynany->has_components ())
+      {
+        return 0;
+      }
+
+    component = the_dynany->current_component ();
+    seq = TAO_DynSequence_i::_narrow (component.in ());
+
+    if (seq == 0)
+      {
+        return 0;
+      }
+
+    tc = seq->type ();
+
+    return tc->equivalent (BasicTypeTraits<T>::tc_value) ? seq : 0;
+  }
+
+  template<typename T>
+  void
+  DynAnySeqUtils<T>::insert_value (const T &val,
+                                   TAO_DynCommon *the_dynany)
+  {
+    if (the_dynany->destroyed ())
+      {
+        throw ::CORBA::OBJECT_NOT_EXIST ();
+      }
+
+    DynamicAny::DynAny_var component;
+    TAO_DynSequence_i * const seq =
+      DynAnySeqUtils<T>::sequence (the_dynany, component);
+
+    if (seq == 0)
+      {
+        DynAnyBasicTypeUtils<T>::insert_value (val, the_dynany);
+        return;
+      }
+
+    TAO_OutputCDR out;
+
+    if (!(out << val))
+      {
+        throw ::CORBA::MARSHAL ();
+      }
+
+    TAO_InputCDR in (out);
+    seq->from_inputCDR (in);
+  }
+
+  template<typename T>
+  T *
+  DynAnySeqUtils<T>::get_value (TAO_DynCommon *the_dynany)
+  {
+    if (the_dynany->destroyed ())
+      {
+        throw ::CORBA::OBJECT_NOT_EXIST ();
+      }
+
+    DynamicAny::DynAny_var component;
+    TAO_DynSequence_i * const seq =
+      DynAnySeqUtils<T>::sequence (the_dynany, component);
+
+    T *retval = 0;
+
+    if (seq == 0)
+      {
+        const T *owned =
+          DynAnyBasicTypeUtils<T>::get_value (the_dynany);
+
+        ACE_NEW_THROW_EX (retval,
+                          T (*owned),
+                          CORBA::NO_MEMORY ());
+        return retval;
+      }
+
+    TAO_OutputCDR out;
+    seq->to_outputCDR (out);
+    TAO_InputCDR in (out);
+
+    ACE_NEW_THROW_EX (retval,
+                      T,
+                      CORBA::NO_MEMORY ());
+    ACE_Auto_Basic_Ptr<T> safe_retval (retval);
+
+    if (!(in >> *retval))
+      {
+        throw ::CORBA::MARSHAL ();
+      }
+
+    return safe_retval.release ();
+  }
+
   template<typename T>
   void
   DynAnyFlagUtils<T>::set_flag_t (DynamicAny::DynAny_ptr component,
@@ -26,6 +26,7 @@
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 class TAO_DynCommon;
+class TAO_DynSequence_i;
 
 namespace TAO
 {
@@ -42,6 +43,25 @@ namespace TAO
     get_value (TAO_DynCommon *the_dynany);
   };
 
+  // Inserts and extracts sequences of basic types.  A DynSequence of
+  // the same type, the DynAny itself or its current component, is
+  // read or replaced in bulk, any other DynAny is handled by
+  // DynAnyBasicTypeUtils.
+  template<typename T>
+  struct DynAnySeqUtils
+  {
+    static void
+    insert_value (const T &val,
+                  TAO_DynCommon *the_dynany);
+
+    static T *
+    get_value (TAO_DynCommon *the_dynany);
+
+    static TAO_DynSequence_i *
+    sequence (TAO_DynCommon *the_dynany,
+              DynamicAny::DynAny_var &component);
+  };
+
   // Encapsulates code that would otherwise be repeated in
   // TAO_DynCommon::set_flag(). Parameterized on the type
   // of dynany impl class that underlies the DynAny arg.
@@ -14,6 +14,7 @@
 #include "tao/DynamicAny/DynAnyUtils_T.h"
 
 #include "tao/AnyTypeCode/Any_Unknown_IDL_Type.h"
+#include "tao/AnyTypeCode/Marshal.h"
 #include "tao/AnyTypeCode/AnyTypeCode_methods.h"
 
 #include "tao/CDR.h"
@@ -954,79 +955,79 @@ TAO_DynCommon::get_abstract (void)
 void
 TAO_DynCommon::insert_boolean_seq (const CORBA::BooleanSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::BooleanSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::BooleanSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_octet_seq (const CORBA::OctetSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::OctetSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::OctetSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_char_seq (const CORBA::CharSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::CharSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::CharSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_short_seq (const CORBA::ShortSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::ShortSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::ShortSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_ushort_seq (const CORBA::UShortSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::UShortSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::UShortSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_long_seq (const CORBA::LongSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::LongSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::LongSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_ulong_seq (const CORBA::ULongSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::ULongSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::ULongSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_float_seq (const CORBA::FloatSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::FloatSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::FloatSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_double_seq (const CORBA::DoubleSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::DoubleSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::DoubleSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_longlong_seq (const CORBA::LongLongSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::LongLongSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::LongLongSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_ulonglong_seq (const CORBA::ULongLongSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::ULongLongSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::ULongLongSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_longdouble_seq (const CORBA::LongDoubleSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::LongDoubleSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::LongDoubleSeq>::insert_value (value, this);
 }
 
 void
 TAO_DynCommon::insert_wchar_seq (const CORBA::WCharSeq &value)
 {
-  TAO::DynAnyBasicTypeUtils<CORBA::WCharSeq>::insert_value (value, this);
+  TAO::DynAnySeqUtils<CORBA::WCharSeq>::insert_value (value, this);
 }
 
 // ****************************************************************
@@ -1034,105 +1035,79 @@ TAO_DynCommon::insert_wchar_seq (const CORBA::WCharSeq &value)
 CORBA::BooleanSeq *
 TAO_DynCommon::get_boolean_seq (void)
 {
-  const CORBA::BooleanSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::BooleanSeq>::get_value (this);
-  return new CORBA::BooleanSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::BooleanSeq>::get_value (this);
 }
 
 CORBA::OctetSeq *
 TAO_DynCommon::get_octet_seq (void)
 {
-  const CORBA::OctetSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::OctetSeq>::get_value (this);
-  return new CORBA::OctetSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::OctetSeq>::get_value (this);
 }
 
 CORBA::CharSeq *
 TAO_DynCommon::get_char_seq (void)
 {
-  const CORBA::CharSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::CharSeq>::get_value (this);
-  return new CORBA::CharSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::CharSeq>::get_value (this);
 }
 
 CORBA::ShortSeq *
 TAO_DynCommon::get_short_seq (void)
 {
-  const CORBA::ShortSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::ShortSeq>::get_value (this);
-  return new CORBA::ShortSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::ShortSeq>::get_value (this);
 }
 
 CORBA::UShortSeq *
 TAO_DynCommon::get_ushort_seq (void)
 {
-  const CORBA::UShortSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::UShortSeq>::get_value (this);
-  return new CORBA::UShortSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::UShortSeq>::get_value (this);
 }
 
 CORBA::LongSeq *
 TAO_DynCommon::get_long_seq (void)
 {
-  const CORBA::LongSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::LongSeq>::get_value (this);
-  return new CORBA::LongSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::LongSeq>::get_value (this);
 }
 
 CORBA::ULongSeq *
 TAO_DynCommon::get_ulong_seq (void)
 {
-  const CORBA::ULongSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::ULongSeq>::get_value (this);
-  return new CORBA::ULongSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::ULongSeq>::get_value (this);
 }
 
 CORBA::FloatSeq *
 TAO_DynCommon::get_float_seq (void)
 {
-  const CORBA::FloatSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::FloatSeq>::get_value (this);
-  return new CORBA::FloatSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::FloatSeq>::get_value (this);
 }
 
 CORBA::DoubleSeq *
 TAO_DynCommon::get_double_seq (void)
 {
-  const CORBA::DoubleSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::DoubleSeq>::get_value (this);
-  return new CORBA::DoubleSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::DoubleSeq>::get_value (this);
 }
 
 CORBA::LongLongSeq *
 TAO_DynCommon::get_longlong_seq (void)
 {
-  const CORBA::LongLongSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::LongLongSeq>::get_value (this);
-  return new CORBA::LongLongSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::LongLongSeq>::get_value (this);
 }
 
 CORBA::ULongLongSeq *
 TAO_DynCommon::get_ulonglong_seq (void)
 {
-  const CORBA::ULongLongSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::ULongLongSeq>::get_value (this);
-  return new CORBA::ULongLongSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::ULongLongSeq>::get_value (this);
 }
 
 CORBA::LongDoubleSeq *
 TAO_DynCommon::get_longdouble_seq (void)
 {
-  const CORBA::LongDoubleSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::LongDoubleSeq>::get_value (this);
-  return new CORBA::LongDoubleSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::LongDoubleSeq>::get_value (this);
 }
 
 CORBA::WCharSeq *
 TAO_DynCommon::get_wchar_seq (void)
 {
-  const CORBA::WCharSeq *owned =
-    TAO::DynAnyBasicTypeUtils<CORBA::WCharSeq>::get_value (this);
-  return new CORBA::WCharSeq (*owned);
+  return TAO::DynAnySeqUtils<CORBA::WCharSeq>::get_value (this);
 }
 
 // ****************************************************************
@@ -1298,6 +1273,47 @@ TAO_DynCommon::ref_to_component (CORBA::Boolean val)
   this->ref_to_component_ = val;
 }
 
+void
+TAO_DynCommon::append_value (const CORBA::Any &any,
+                             CORBA::TypeCode_ptr tc,
+                             TAO_OutputCDR &out)
+{
+  TAO::Any_Impl *impl = any.impl ();
+  TAO_OutputCDR value_out;
+  TAO_InputCDR value_cdr (static_cast<ACE_Message_Block *> (0));
+
+  if (impl->encoded ())
+    {
+      TAO::Unknown_IDL_Type * const unk =
+        dynamic_cast<TAO::Unknown_IDL_Type *> (impl);
+
+      if (!unk)
+        throw CORBA::INTERNAL ();
+
+      value_cdr = unk->_tao_get_cdr ();
+    }
+  else
+    {
+      impl->marshal_value (value_out);
+      TAO_InputCDR tmp_in (value_out);
+      value_cdr = tmp_in;
+    }
+
+  (void) TAO_Marshal_Object::perform_append (tc, &value_cdr, &out);
+}
+
+void
+TAO_DynCommon::encoded_value (CORBA::TypeCode_ptr tc,
+                              TAO_InputCDR &cdr,
+                              CORBA::Any &any)
+{
+  TAO::Unknown_IDL_Type *unk = 0;
+  ACE_NEW_THROW_EX (unk,
+                    TAO::Unknown_IDL_Type (tc, cdr),
+                    CORBA::NO_MEMORY ());
+  any.replace (unk);
+}
+
 CORBA::TypeCode_ptr
 TAO_DynCommon::check_type_and_unalias (CORBA::TypeCode_ptr tc)
 {
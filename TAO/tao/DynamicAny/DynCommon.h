@@ -21,6 +21,9 @@
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+class TAO_OutputCDR;
+class TAO_InputCDR;
+
 /**
  * @class TAO_DynCommon
  *
@@ -206,6 +209,17 @@ public:
 
   static bool is_basic_type_seq (CORBA::TypeCode_ptr tc);
 
+  /// Append the value of @a any, of type @a tc, to @a out.
+  static void append_value (const CORBA::Any &any,
+                            CORBA::TypeCode_ptr tc,
+                            TAO_OutputCDR &out);
+
+  /// Copy the value of type @a tc at the read position of @a cdr,
+  /// still encoded, into @a any.
+  static void encoded_value (CORBA::TypeCode_ptr tc,
+                             TAO_InputCDR &cdr,
+                             CORBA::Any &any);
+
   // Accessors
 
   CORBA::Boolean has_components (void) const;
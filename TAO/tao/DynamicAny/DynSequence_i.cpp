@@ -9,10 +9,152 @@
 
 #include "tao/CDR.h"
 
+#include "ace/OS_NS_string.h"
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace
+{
+  /// Size of the native value of an element of @a kind when such
+  /// elements are stored flat, 0 otherwise.
+  size_t
+  flat_element_size (CORBA::TCKind kind)
+  {
+    switch (kind)
+      {
+      case CORBA::tk_boolean:
+        return sizeof (ACE_CDR::Boolean);
+      case CORBA::tk_octet:
+        return sizeof (ACE_CDR::Octet);
+      case CORBA::tk_char:
+        return sizeof (ACE_CDR::Char);
+      case CORBA::tk_short:
+      case CORBA::tk_ushort:
+        return sizeof (ACE_CDR::Short);
+      case CORBA::tk_long:
+      case CORBA::tk_ulong:
+        return sizeof (ACE_CDR::Long);
+      case CORBA::tk_longlong:
+      case CORBA::tk_ulonglong:
+        return sizeof (ACE_CDR::LongLong);
+      case CORBA::tk_float:
+        return sizeof (ACE_CDR::Float);
+      case CORBA::tk_double:
+        return sizeof (ACE_CDR::Double);
+      case CORBA::tk_longdouble:
+        return sizeof (ACE_CDR::LongDouble);
+      default:
+        return 0;
+      }
+  }
+
+  /// Read @a count elements of @a kind from @a cdr into @a buf.
+  bool
+  read_flat (TAO_InputCDR &cdr,
+             CORBA::TCKind kind,
+             char *buf,
+             CORBA::ULong count)
+  {
+    switch (kind)
+      {
+      case CORBA::tk_boolean:
+        return cdr.read_boolean_array (
+          reinterpret_cast<ACE_CDR::Boolean *> (buf), count);
+      case CORBA::tk_octet:
+        return cdr.read_octet_array (
+          reinterpret_cast<ACE_CDR::Octet *> (buf), count);
+      case CORBA::tk_char:
+        return cdr.read_char_array (
+          reinterpret_cast<ACE_CDR::Char *> (buf), count);
+      case CORBA::tk_short:
+        return cdr.read_short_array (
+          reinterpret_cast<ACE_CDR::Short *> (buf), count);
+      case CORBA::tk_ushort:
+        return cdr.read_ushort_array (
+          reinterpret_cast<ACE_CDR::UShort *> (buf), count);
+      case CORBA::tk_long:
+        return cdr.read_long_array (
+          reinterpret_cast<ACE_CDR::Long *> (buf), count);
+      case CORBA::tk_ulong:
+        return cdr.read_ulong_array (
+          reinterpret_cast<ACE_CDR::ULong *> (buf), count);
+      case CORBA::tk_longlong:
+        return cdr.read_longlong_array (
+          reinterpret_cast<ACE_CDR::LongLong *> (buf), count);
+      case CORBA::tk_ulonglong:
+        return cdr.read_ulonglong_array (
+          reinterpret_cast<ACE_CDR::ULongLong *> (buf), count);
+      case CORBA::tk_float:
+        return cdr.read_float_array (
+          reinterpret_cast<ACE_CDR::Float *> (buf), count);
+      case CORBA::tk_double:
+        return cdr.read_double_array (
+          reinterpret_cast<ACE_CDR::Double *> (buf), count);
+      case CORBA::tk_longdouble:
+        return cdr.read_longdouble_array (
+          reinterpret_cast<ACE_CDR::LongDouble *> (buf), count);
+      default:
+        return false;
+      }
+  }
+
+  /// Write @a count elements of @a kind from @a buf to @a cdr.
+  bool
+  write_flat (TAO_OutputCDR &cdr,
+              CORBA::TCKind kind,
+              const char *buf,
+              CORBA::ULong count)
+  {
+    switch (kind)
+      {
+      case CORBA::tk_boolean:
+        return cdr.write_boolean_array (
+          reinterpret_cast<const ACE_CDR::Boolean *> (buf), count);
+      case CORBA::tk_octet:
+        return cdr.write_octet_array (
+          reinterpret_cast<const ACE_CDR::Octet *> (buf), count);
+      case CORBA::tk_char:
+        return cdr.write_char_array (
+          reinterpret_cast<const ACE_CDR::Char *> (buf), count);
+      case CORBA::tk_short:
+        return cdr.write_short_array (
+          reinterpret_cast<const ACE_CDR::Short *> (buf), count);
+      case CORBA::tk_ushort:
+        return cdr.write_ushort_array (
+          reinterpret_cast<const ACE_CDR::UShort *> (buf), count);
+      case CORBA::tk_long:
+        return cdr.write_long_array (
+          reinterpret_cast<const ACE_CDR::Long *> (buf), count);
+      case CORBA::tk_ulong:
+        return cdr.write_ulong_array (
+          reinterpret_cast<const ACE_CDR::ULong *> (buf), count);
+      case CORBA::tk_longlong:
+        return cdr.write_longlong_array (
+          reinterpret_cast<const ACE_CDR::LongLong *> (buf), count);
+      case CORBA::tk_ulonglong:
+        return cdr.write_ulonglong_array (
+          reinterpret_cast<const ACE_CDR::ULongLong *> (buf), count);
+      case CORBA::tk_float:
+        return cdr.write_float_array (
+          reinterpret_cast<const ACE_CDR::Float *> (buf), count);
+      case CORBA::tk_double:
+        return cdr.write_double_array (
+          reinterpret_cast<const ACE_CDR::Double *> (buf), count);
+      case CORBA::tk_longdouble:
+        return cdr.write_longdouble_array (
+          reinterpret_cast<const ACE_CDR::LongDouble *> (buf), count);
+      default:
+        return false;
+      }
+  }
+}
+
 TAO_DynSequence_i::TAO_DynSequence_i (CORBA::Boolean allow_truncation)
   : TAO_DynCommon (allow_truncation)
+  , flat_kind_ (CORBA::tk_null)
+  , flat_size_ (0)
+  , cdr_ (static_cast<ACE_Message_Block *> (0))
+  , encoded_count_ (0)
 {
 }
 
@@ -28,7 +170,16 @@ TAO_DynSequence_i::init_common (void)
   this->has_components_ = true;
   this->destroyed_ = false;
   this->current_position_ = -1;
-  this->component_count_ = static_cast<CORBA::ULong> (this->da_members_.size ());
+  this->component_count_ = 0;
+  this->encoded_count_ = 0;
+
+  // Elements of the basic types are kept as plain values.
+  CORBA::TypeCode_var element_type = this->get_element_type ();
+  CORBA::TCKind const kind =
+    TAO_DynAnyFactory::unalias (element_type.in ());
+
+  this->flat_size_ = flat_element_size (kind);
+  this->flat_kind_ = this->flat_size_ != 0 ? kind : CORBA::tk_null;
 }
 
 void
@@ -45,9 +196,10 @@ TAO_DynSequence_i::init (const CORBA::Any& any)
 
   this->type_ = tc;
 
+  this->init_common ();
+
   // Get the CDR stream of the Any, if there isn't one, make one.
   TAO::Any_Impl *impl = any.impl ();
-  CORBA::ULong length;
   TAO_OutputCDR out;
   TAO_InputCDR cdr (static_cast<ACE_Message_Block *> (0));
 
@@ -68,39 +220,9 @@ TAO_DynSequence_i::init (const CORBA::Any& any)
       cdr = tmp_in;
     }
 
-  // If the any is a sequence, first 4 bytes of cdr hold the
-  // length.
-  cdr.read_ulong (length);
-
-  // Resize the array.
-  this->da_members_.size (length);
-
-  this->init_common ();
-
-  // Get the type of the sequence elments.
-  CORBA::TypeCode_var field_tc =
-    this->get_element_type ();
-
-  for (CORBA::ULong i = 0; i < length; ++i)
-    {
-      CORBA::Any field_any;
-      TAO_InputCDR unk_in (cdr);
-      TAO::Unknown_IDL_Type *field_unk = 0;
-      ACE_NEW (field_unk,
-               TAO::Unknown_IDL_Type (field_tc.in (), unk_in));
-      field_any.replace (field_unk);
-
-      // This recursive step will call the correct constructor
-      // based on the type of field_any.
-      this->da_members_[i] =
-        TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
-          field_any._tao_get_typecode (),
-          field_any,
-          this->allow_truncation_ );
+  this->from_inputCDR (cdr);
 
-      // Move to the next field in the CDR stream.
-      (void) TAO_Marshal_Object::perform_skip (field_tc.in (), &cdr);
-    }
+  this->current_position_ = -1;
 }
 
 void
@@ -113,12 +235,12 @@ TAO_DynSequence_i::init (CORBA::TypeCode_ptr tc)
       throw DynamicAny::DynAnyFactory::InconsistentTypeCode ();
     }
 
+  this->type_ = CORBA::TypeCode::_duplicate (tc);
+
   // Empty sequence.
   this->da_members_.size (0);
 
   this->init_common ();
-
-  this->type_ = CORBA::TypeCode::_duplicate (tc);
 }
 
 // ****************************************************************
@@ -158,6 +280,247 @@ TAO_DynSequence_i::get_element_type (void)
   return retval;
 }
 
+DynamicAny::DynAny_ptr
+TAO_DynSequence_i::element (CORBA::ULong index)
+{
+  if (CORBA::is_nil (this->da_members_[index].in ()))
+    {
+      if (this->flat_size_ != 0 || index < this->encoded_count_)
+        {
+          CORBA::Any field_any;
+          this->stored_element (index, field_any);
+
+          // This recursive step will call the correct constructor
+          // based on the type of field_any.
+          this->da_members_[index] =
+            TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
+              field_any._tao_get_typecode (),
+              field_any,
+              this->allow_truncation_ );
+        }
+      else
+        {
+          CORBA::TypeCode_var field_tc = this->get_element_type ();
+
+          this->da_members_[index] =
+            TAO::MakeDynAnyUtils::make_dyn_any_t<CORBA::TypeCode_ptr> (
+              field_tc.in (),
+              field_tc.in (),
+              this->allow_truncation_ );
+        }
+    }
+
+  return this->da_members_[index].in ();
+}
+
+void
+TAO_DynSequence_i::stored_element (CORBA::ULong index, CORBA::Any &any)
+{
+  CORBA::TypeCode_var field_tc = this->get_element_type ();
+
+  if (this->flat_size_ != 0)
+    {
+      TAO_OutputCDR out;
+      (void) write_flat (out,
+                         this->flat_kind_,
+                         &this->flat_[index * this->flat_size_],
+                         1);
+      TAO_InputCDR in (out);
+      TAO_DynCommon::encoded_value (field_tc.in (), in, any);
+    }
+  else
+    {
+      TAO_InputCDR in (this->cdr_);
+      this->locate (index, in);
+      TAO_DynCommon::encoded_value (field_tc.in (), in, any);
+    }
+}
+
+void
+TAO_DynSequence_i::locate (CORBA::ULong index, TAO_InputCDR &cdr)
+{
+  cdr = this->cdr_;
+
+  if (index == 0)
+    {
+      return;
+    }
+
+  // One pass over the encoded elements finds all of them.
+  if (this->offsets_.size () < this->encoded_count_)
+    {
+      CORBA::TypeCode_var field_tc = this->get_element_type ();
+      TAO_InputCDR walk (this->cdr_);
+
+      this->offsets_.size (this->encoded_count_);
+
+      for (CORBA::ULong i = 0; i < this->encoded_count_; ++i)
+        {
+          this->offsets_[i] = walk.rd_ptr () - this->cdr_.rd_ptr ();
+
+          if (TAO_Marshal_Object::perform_skip (field_tc.in (), &walk)
+                != TAO::TRAVERSE_CONTINUE)
+            {
+              this->offsets_.size (0);
+              throw ::CORBA::MARSHAL ();
+            }
+        }
+    }
+
+  cdr.skip_bytes (this->offsets_[index]);
+}
+
+void
+TAO_DynSequence_i::release_elements (CORBA::ULong first)
+{
+  for (CORBA::ULong i = first; i < this->component_count_; ++i)
+    {
+      if (!CORBA::is_nil (this->da_members_[i].in ()))
+        {
+          this->da_members_[i]->destroy ();
+          this->da_members_[i] = DynamicAny::DynAny::_nil ();
+        }
+    }
+}
+
+void
+TAO_DynSequence_i::resize (CORBA::ULong length)
+{
+  // Destroy any dangling members first, then shrink or grow the
+  // array.
+  this->release_elements (length);
+  this->da_members_.size (length);
+
+  if (this->flat_size_ != 0)
+    {
+      this->flat_.size (length * this->flat_size_);
+
+      // All bits zero is the default value of every basic type.
+      if (length > this->component_count_)
+        {
+          ACE_OS::memset (&this->flat_[this->component_count_
+                                       * this->flat_size_],
+                          0,
+                          (length - this->component_count_)
+                            * this->flat_size_);
+        }
+    }
+  else if (length < this->encoded_count_)
+    {
+      this->encoded_count_ = length;
+    }
+
+  this->component_count_ = length;
+}
+
+void
+TAO_DynSequence_i::from_inputCDR (TAO_InputCDR &cdr)
+{
+  CORBA::ULong length = 0;
+
+  // If the any is a sequence, first 4 bytes of cdr hold the
+  // length.
+  if (!cdr.read_ulong (length))
+    {
+      throw ::CORBA::MARSHAL ();
+    }
+
+  this->release_elements (0);
+  this->offsets_.size (0);
+
+  if (this->flat_size_ != 0)
+    {
+      // Each element takes at least one byte of the stream.
+      if (length > cdr.length ())
+        {
+          throw ::CORBA::MARSHAL ();
+        }
+
+      this->flat_.size (length * this->flat_size_);
+
+      if (length != 0
+          && !read_flat (cdr, this->flat_kind_, &this->flat_[0], length))
+        {
+          throw ::CORBA::MARSHAL ();
+        }
+
+      this->encoded_count_ = 0;
+    }
+  else
+    {
+      // The elements are skipped over only when one past the first
+      // is asked for.
+      this->cdr_ = cdr;
+      this->encoded_count_ = length;
+    }
+
+  this->da_members_.size (length);
+  this->component_count_ = length;
+  this->current_position_ = length ? 0 : -1;
+}
+
+void
+TAO_DynSequence_i::to_outputCDR (TAO_OutputCDR &out_cdr)
+{
+  out_cdr.write_ulong (this->component_count_);
+
+  CORBA::TypeCode_var field_tc =
+    this->get_element_type ();
+
+  // Follows the element i while it is encoded in cdr_.
+  TAO_InputCDR field_cdr (this->cdr_);
+
+  CORBA::ULong i = 0;
+
+  while (i < this->component_count_)
+    {
+      bool const stored = CORBA::is_nil (this->da_members_[i].in ());
+
+      if (stored && this->flat_size_ != 0)
+        {
+          // Write the whole run of values without a DynAny at once.
+          CORBA::ULong end = i + 1;
+
+          while (end < this->component_count_
+                 && CORBA::is_nil (this->da_members_[end].in ()))
+            {
+              ++end;
+            }
+
+          (void) write_flat (out_cdr,
+                             this->flat_kind_,
+                             &this->flat_[i * this->flat_size_],
+                             end - i);
+          i = end;
+          continue;
+        }
+
+      if (i < this->encoded_count_)
+        {
+          if (stored)
+            {
+              (void) TAO_Marshal_Object::perform_append (field_tc.in (),
+                                                         &field_cdr,
+                                                         &out_cdr);
+              ++i;
+              continue;
+            }
+
+          (void) TAO_Marshal_Object::perform_skip (field_tc.in (),
+                                                   &field_cdr);
+        }
+
+      // Recursive step
+      CORBA::Any_var field_any =
+        this->element (i)->to_any ();
+
+      TAO_DynCommon::append_value (field_any.in (),
+                                   field_tc.in (),
+                                   out_cdr);
+      ++i;
+    }
+}
+
 // = Functions specific to DynSequence.
 
 CORBA::ULong
@@ -214,36 +577,8 @@ TAO_DynSequence_i::set_length (CORBA::ULong length)
         }
     }
 
-  if (length > this->component_count_)
-    {
-      // Grow array first, then initialize new members.
-      this->da_members_.size (length);
-
-      CORBA::TypeCode_var elemtype =
-        stripped_tc->content_type ();
-
-      for (CORBA::ULong i = this->component_count_; i < length; ++i)
-        {
-          this->da_members_[i] =
-        TAO::MakeDynAnyUtils::make_dyn_any_t<CORBA::TypeCode_ptr> (
-          elemtype.in (),
-          elemtype.in (),
-          this->allow_truncation_ );
-        }
-    }
-  else if (length < this->component_count_)
-    {
-      // Destroy any dangling members first, then shrink array.
-      for (CORBA::ULong j = length; j < this->component_count_; ++j)
-        {
-          this->da_members_[j]->destroy ();
-        }
-
-      this->da_members_.size (length);
-    }
-
-  // Now we can update component_count_.
-  this->component_count_ = length;
+  // New members get their DynAny when first asked for.
+  this->resize (length);
 }
 
 DynamicAny::AnySeq *
@@ -254,7 +589,7 @@ TAO_DynSequence_i::get_elements (void)
       throw ::CORBA::OBJECT_NOT_EXIST ();
     }
 
-  CORBA::ULong length = static_cast<CORBA::ULong> (this->da_members_.size ());
+  CORBA::ULong length = this->component_count_;
 
   DynamicAny::AnySeq *elements;
   ACE_NEW_THROW_EX (elements,
@@ -267,11 +602,18 @@ TAO_DynSequence_i::get_elements (void)
   // Initialize each Any.
   for (CORBA::ULong i = 0; i < length; ++i)
     {
-      CORBA::Any_var tmp =
-        this->da_members_[i]->to_any ();
-
+      if (CORBA::is_nil (this->da_members_[i].in ())
+          && (this->flat_size_ != 0 || i < this->encoded_count_))
+        {
+          this->stored_element (i, safe_retval[i]);
+        }
+      else
+        {
+          CORBA::Any_var tmp =
+            this->element (i)->to_any ();
 
-      safe_retval[i] = tmp.in ();
+          safe_retval[i] = tmp.in ();
+        }
     }
 
   return safe_retval._retn ();
@@ -296,67 +638,44 @@ TAO_DynSequence_i::set_elements (const DynamicAny::AnySeq & value)
       throw DynamicAny::DynAny::InvalidValue ();
     }
 
-  // CORBA 2.4.2.
-  if (length == 0)
-    {
-      this->current_position_ = -1;
-    }
-  else
-    {
-      this->current_position_ = 0;
-    }
-
-  // If the array grows, we must do it now.
-  if (length > this->component_count_)
-    {
-      this->da_members_.size (length);
-    }
-
   CORBA::TypeCode_var element_type = this->get_element_type ();
 
   CORBA::TypeCode_var value_tc;
 
+  // Check each arg element for type match before changing anything.
   for (CORBA::ULong i = 0; i < length; ++i)
     {
-      // Check each arg element for type match.
       value_tc = value[i].type ();
       CORBA::Boolean equivalent =
         value_tc->equivalent (element_type.in ());
 
-      if (equivalent)
-        {
-          // Destroy any existing members.
-          if (i < this->component_count_)
-            {
-              this->da_members_[i]->destroy ();
-            }
-
-          this->da_members_[i] =
-            TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
-              value[i]._tao_get_typecode (),
-              value[i],
-              this->allow_truncation_ );
-        }
-      else
+      if (!equivalent)
         {
           throw DynamicAny::DynAny::TypeMismatch ();
         }
     }
 
-  // Destroy any dangling members.
-  for (CORBA::ULong j = length; j < this->component_count_; ++j)
+  // The new elements are stored as the encoded sequence.
+  TAO_OutputCDR out_cdr;
+  out_cdr.write_ulong (length);
+
+  for (CORBA::ULong i = 0; i < length; ++i)
     {
-      this->da_members_[j]->destroy ();
+      TAO_DynCommon::append_value (value[i], element_type.in (), out_cdr);
     }
 
-  // If the array shrinks, we must wait until now to do it.
-  if (length < this->component_count_)
+  TAO_InputCDR in_cdr (out_cdr);
+  this->from_inputCDR (in_cdr);
+
+  // CORBA 2.4.2.
+  if (length == 0)
     {
-      this->da_members_.size (length);
+      this->current_position_ = -1;
+    }
+  else
+    {
+      this->current_position_ = 0;
     }
-
-  // Now we can update component_count_.
-  this->component_count_ = length;
 }
 
 DynamicAny::DynAnySeq *
@@ -377,12 +696,13 @@ TAO_DynSequence_i::get_elements_as_dyn_any (void)
 
   for (CORBA::ULong i = 0; i < this->component_count_; ++i)
     {
+      DynamicAny::DynAny_ptr const member = this->element (i);
+
       // A deep copy is made only by copy() (CORBA 2.4.2 section 9.2.3.6).
       // Set the flag so the caller can't destroy.
-      this->set_flag (this->da_members_[i].in (), 0);
+      this->set_flag (member, 0);
 
-      safe_retval[i] =
-        DynamicAny::DynAny::_duplicate (this->da_members_[i].in ());
+      safe_retval[i] = DynamicAny::DynAny::_duplicate (member);
     }
 
   return safe_retval._retn ();
@@ -408,55 +728,38 @@ TAO_DynSequence_i::set_elements_as_dyn_any (
       throw DynamicAny::DynAny::InvalidValue ();
     }
 
-  // If the array grows, we must do it now.
-  if (length > this->component_count_)
-    {
-      this->da_members_.size (length);
-    }
-
   CORBA::TypeCode_var element_type =
     this->get_element_type ();
 
   CORBA::TypeCode_var val_type;
   CORBA::Boolean equivalent;
 
+  // Check each arg element for type match before changing anything.
   for (CORBA::ULong i = 0; i < length; ++i)
     {
       val_type = values[i]->type ();
 
       equivalent = val_type->equivalent (element_type.in ());
 
-      if (equivalent)
-        {
-          // Destroy any existing members.
-          if (i < this->component_count_)
-            {
-              this->da_members_[i]->destroy ();
-            }
-
-          this->da_members_[i] =
-            values[i]->copy ();
-        }
-      else
+      if (!equivalent)
         {
           throw DynamicAny::DynAny::TypeMismatch ();
         }
     }
 
-  // Destroy any dangling members.
-  for (CORBA::ULong j = length; j < this->component_count_; ++j)
-    {
-      this->da_members_[j]->destroy ();
-    }
+  this->resize (length);
 
-  // If the array shrinks, we must wait until now to do it.
-  if (length < this->component_count_)
+  for (CORBA::ULong i = 0; i < length; ++i)
     {
-      this->da_members_.size (length);
-    }
+      // Destroy any existing members.
+      if (!CORBA::is_nil (this->da_members_[i].in ()))
+        {
+          this->da_members_[i]->destroy ();
+        }
 
-  // Now we can update component_count_.
-  this->component_count_ = length;
+      this->da_members_[i] =
+        values[i]->copy ();
+    }
 }
 
 // ****************************************************************
@@ -497,63 +800,7 @@ TAO_DynSequence_i::from_any (const CORBA::Any & any)
           cdr = tmp_in;
         }
 
-
-      CORBA::ULong arg_length;
-
-      // If the any is a sequence, first 4 bytes of cdr hold the
-      // length.
-      cdr.read_ulong (arg_length);
-
-      // If the array grows, we must do it now.
-      if (arg_length > this->component_count_)
-        {
-          this->da_members_.size (arg_length);
-        }
-
-      CORBA::TypeCode_var field_tc =
-        this->get_element_type ();
-
-      for (CORBA::ULong i = 0; i < arg_length; ++i)
-        {
-          CORBA::Any field_any;
-          TAO_InputCDR unk_in (cdr);
-          TAO::Unknown_IDL_Type *field_unk = 0;
-          ACE_NEW (field_unk,
-                   TAO::Unknown_IDL_Type (field_tc.in (),
-                                          unk_in));
-          field_any.replace (field_unk);
-
-          if (i < this->component_count_)
-            {
-              this->da_members_[i]->destroy ();
-            }
-
-          this->da_members_[i] =
-            TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
-              field_any._tao_get_typecode (),
-              field_any,
-              this->allow_truncation_ );
-
-          // Move to the next field in the CDR stream.
-          (void) TAO_Marshal_Object::perform_skip (field_tc.in (), &cdr);
-        }
-
-      // Destroy any dangling members.
-      for (CORBA::ULong j = arg_length; j < this->component_count_; ++j)
-        {
-          this->da_members_[j]->destroy ();
-        }
-
-      // If the array shrinks, we must wait until now to do it.
-      if (arg_length < this->component_count_)
-        {
-          this->da_members_.size (arg_length);
-        }
-
-      // Now we can update component_count_.
-      this->component_count_ = arg_length;
-
-      this->current_position_ = arg_length ? 0 : -1;
+      this->from_inputCDR (cdr);
     }
   else
     {
@@ -570,42 +817,7 @@ TAO_DynSequence_i::to_any (void)
     }
 
   TAO_OutputCDR out_cdr;
-  out_cdr.write_ulong (this->component_count_);
-
-  CORBA::TypeCode_var field_tc =
-    this->get_element_type ();
-
-  for (CORBA::ULong i = 0; i < this->component_count_; ++i)
-    {
-      // Recursive step
-      CORBA::Any_var field_any =
-        this->da_members_[i]->to_any ();
-
-      TAO::Any_Impl *field_impl = field_any->impl ();
-      TAO_OutputCDR field_out;
-      TAO_InputCDR field_cdr (static_cast<ACE_Message_Block *> (0));
-
-      if (field_impl->encoded ())
-        {
-          TAO::Unknown_IDL_Type * const field_unk =
-            dynamic_cast<TAO::Unknown_IDL_Type *> (field_impl);
-
-          if (!field_unk)
-            throw CORBA::INTERNAL ();
-
-          field_cdr = field_unk->_tao_get_cdr ();
-        }
-      else
-        {
-          field_impl->marshal_value (field_out);
-          TAO_InputCDR tmp_in (field_out);
-          field_cdr = tmp_in;
-        }
-
-      (void) TAO_Marshal_Object::perform_append (field_tc.in (),
-                                                 &field_cdr,
-                                                 &out_cdr);
-    }
+  this->to_outputCDR (out_cdr);
 
   TAO_InputCDR in_cdr (out_cdr);
 
@@ -656,7 +868,7 @@ TAO_DynSequence_i::equal (DynamicAny::DynAny_ptr rhs)
       tmp = rhs->current_component ();
 
       // Recursive step.
-      member_equal = tmp->equal (this->da_members_[i].in ());
+      member_equal = tmp->equal (this->element (i));
 
       if (!member_equal)
         {
@@ -677,9 +889,15 @@ TAO_DynSequence_i::destroy (void)
 
   if (!this->ref_to_component_ || this->container_is_destroying_)
     {
-      // Do a deep destroy.
+      // Do a deep destroy, elements without a DynAny have nothing
+      // to destroy.
       for (CORBA::ULong i = 0; i < this->component_count_; ++i)
         {
+          if (CORBA::is_nil (this->da_members_[i].in ()))
+            {
+              continue;
+            }
+
           this->set_flag (da_members_[i].in (), 1);
 
           this->da_members_[i]->destroy ();
@@ -704,9 +922,11 @@ TAO_DynSequence_i::current_component (void)
 
   CORBA::ULong index = static_cast<CORBA::ULong> (this->current_position_);
 
-  this->set_flag (this->da_members_[index].in (), 0);
+  DynamicAny::DynAny_ptr const member = this->element (index);
+
+  this->set_flag (member, 0);
 
-  return DynamicAny::DynAny::_duplicate (this->da_members_[index].in ());
+  return DynamicAny::DynAny::_duplicate (member);
 }
 
 TAO_END_VERSIONED_NAMESPACE_DECL
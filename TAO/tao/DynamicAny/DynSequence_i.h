@@ -20,6 +20,7 @@
 
 #include "tao/DynamicAny/DynCommon.h"
 #include "tao/LocalObject.h"
+#include "tao/CDR.h"
 #include "ace/Containers.h"
 
 #if defined (_MSC_VER)
@@ -82,6 +83,13 @@ public:
 
   virtual DynamicAny::DynAny_ptr current_component (void);
 
+  /// Replace the elements by the encoded sequence (length first) at
+  /// the read position of @a cdr, and move to the first one.
+  void from_inputCDR (TAO_InputCDR &cdr);
+
+  /// Encode the sequence, length first, in @a cdr.
+  void to_outputCDR (TAO_OutputCDR &cdr);
+
 private:
   // Utility, turns the type of elements contained in the sequence.
   CORBA::TypeCode_ptr get_element_type (void);
@@ -89,13 +97,54 @@ private:
   // Called by both versions of init().
   void init_common (void);
 
+  /// The DynAny of the element at @a index, made on first use.
+  DynamicAny::DynAny_ptr element (CORBA::ULong index);
+
+  /// Copy the stored value of the element at @a index into @a any
+  /// without making its DynAny.
+  void stored_element (CORBA::ULong index, CORBA::Any &any);
+
+  /// Position @a cdr at the encoded element at @a index.
+  void locate (CORBA::ULong index, TAO_InputCDR &cdr);
+
+  /// Destroy the DynAnys of the elements from @a first on.
+  void release_elements (CORBA::ULong first);
+
+  /// Shrink or grow the sequence to @a length elements, new elements
+  /// hold the default value of their type.
+  void resize (CORBA::ULong length);
+
   // = Use copy() or assign() instead of these
   TAO_DynSequence_i (const TAO_DynSequence_i &src);
   TAO_DynSequence_i &operator= (const TAO_DynSequence_i &src);
 
 private:
-  /// Each component is also a DynAny.
+  /**
+   * The DynAny of each element, nil until the element is asked for.
+   * An element without one holds the value stored in flat_ or in
+   * cdr_, or the default value of its type past both.
+   */
   ACE_Array_Base<DynamicAny::DynAny_var> da_members_;
+
+  /// Kind of the elements when they are of a basic type and their
+  /// values are stored in flat_, tk_null otherwise.
+  CORBA::TCKind flat_kind_;
+
+  /// Size of an element in flat_, 0 when flat_ is not used.
+  size_t flat_size_;
+
+  /// The values of all the elements in native representation.
+  ACE_Array_Base<char> flat_;
+
+  /// The encoded elements, from the first one on.
+  TAO_InputCDR cdr_;
+
+  /// Number of elements still read from cdr_.
+  CORBA::ULong encoded_count_;
+
+  /// Offset of each encoded element from the first one, computed on
+  /// the first access to an element past the first.
+  ACE_Array_Base<size_t> offsets_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
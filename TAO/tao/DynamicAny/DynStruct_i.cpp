@@ -13,6 +13,8 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 TAO_DynStruct_i::TAO_DynStruct_i (CORBA::Boolean allow_truncation)
   : TAO_DynCommon (allow_truncation)
+  , cdr_ (static_cast<ACE_Message_Block *> (0))
+  , encoded_ (false)
 {
 }
 
@@ -73,15 +75,22 @@ TAO_DynStruct_i::set_from_any (const CORBA::Any & any)
 
   this->init_common ();
 
+  // The members get their DynAny when first asked for.
+  this->members_from_any (any);
+}
+
+void
+TAO_DynStruct_i::members_from_any (const CORBA::Any &any)
+{
   // Get the CDR stream of the Any, if there isn't one, make one.
   TAO::Any_Impl *impl = any.impl ();
   TAO_OutputCDR out;
   TAO_InputCDR in (static_cast<ACE_Message_Block *> (0));
-  TAO::Unknown_IDL_Type *unk = 0;
 
   if (impl->encoded ())
     {
-      unk = dynamic_cast<TAO::Unknown_IDL_Type *> (impl);
+      TAO::Unknown_IDL_Type * const unk =
+        dynamic_cast<TAO::Unknown_IDL_Type *> (impl);
 
       if (!unk)
         throw CORBA::INTERNAL ();
@@ -95,37 +104,123 @@ TAO_DynStruct_i::set_from_any (const CORBA::Any & any)
       in = tmp_in;
     }
 
-  // If we have an exception type, unmarshal the repository ID.
-  CORBA::TCKind kind = TAO_DynAnyFactory::unalias (any._tao_get_typecode ());
+  // If we have an exception type, skip the repository ID.
+  CORBA::TCKind kind = TAO_DynAnyFactory::unalias (this->type_.in ());
 
-  if (kind == CORBA::tk_except)
+  if (kind == CORBA::tk_except && !in.skip_string ())
     {
-      CORBA::String_var str;
-      in >> str.out ();
+      throw ::CORBA::MARSHAL ();
     }
 
-  for (CORBA::ULong i = 0; i < numfields; i++)
+  this->set_encoded_members (in);
+}
+
+void
+TAO_DynStruct_i::set_encoded_members (const TAO_InputCDR &cdr)
+{
+  this->release_members ();
+
+  this->cdr_ = cdr;
+  this->encoded_ = true;
+  this->offsets_.size (0);
+}
+
+DynamicAny::DynAny_ptr
+TAO_DynStruct_i::member (CORBA::ULong index)
+{
+  if (CORBA::is_nil (this->da_members_[index].in ()))
     {
-      CORBA::TypeCode_var field_tc =
-        unaliased_tc->member_type (i);
+      if (this->encoded_)
+        {
+          CORBA::Any field_any;
+          this->stored_member (index, field_any);
 
-      CORBA::Any field_any;
-      TAO_InputCDR unk_in (in);
-      ACE_NEW (unk,
-               TAO::Unknown_IDL_Type (field_tc.in (),
-                                      unk_in));
-      field_any.replace (unk);
+          // This recursive step will call the correct constructor
+          // based on the type of field_any.
+          this->da_members_[index] =
+            TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
+              field_any._tao_get_typecode (),
+              field_any,
+              this->allow_truncation_);
+        }
+      else
+        {
+          // member_type() does not work with aliased type codes.
+          CORBA::TypeCode_var unaliased_tc =
+            TAO_DynAnyFactory::strip_alias (this->type_.in ());
+          CORBA::TypeCode_var mtype = unaliased_tc->member_type (index);
+
+          this->da_members_[index] =
+            TAO::MakeDynAnyUtils::make_dyn_any_t<CORBA::TypeCode_ptr> (
+              mtype.in (),
+              mtype.in (),
+              this->allow_truncation_);
+        }
+    }
 
-      // This recursive step will call the correct constructor
-      // based on the type of field_any.
-      this->da_members_[i] =
-        TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
-          field_any._tao_get_typecode (),
-          field_any,
-          this->allow_truncation_);
+  return this->da_members_[index].in ();
+}
 
-      // Move to the next field in the CDR stream.
-      (void) TAO_Marshal_Object::perform_skip (field_tc.in (), &in);
+void
+TAO_DynStruct_i::stored_member (CORBA::ULong index, CORBA::Any &any)
+{
+  CORBA::TypeCode_var unaliased_tc =
+    TAO_DynAnyFactory::strip_alias (this->type_.in ());
+  CORBA::TypeCode_var field_tc = unaliased_tc->member_type (index);
+
+  TAO_InputCDR in (this->cdr_);
+  this->locate (index, in);
+  TAO_DynCommon::encoded_value (field_tc.in (), in, any);
+}
+
+void
+TAO_DynStruct_i::locate (CORBA::ULong index, TAO_InputCDR &cdr)
+{
+  cdr = this->cdr_;
+
+  if (index == 0)
+    {
+      return;
+    }
+
+  // One pass over the encoded members finds all of them.
+  if (this->offsets_.size () < this->component_count_)
+    {
+      CORBA::TypeCode_var unaliased_tc =
+        TAO_DynAnyFactory::strip_alias (this->type_.in ());
+      CORBA::TypeCode_var field_tc;
+      TAO_InputCDR walk (this->cdr_);
+
+      this->offsets_.size (this->component_count_);
+
+      for (CORBA::ULong i = 0; i < this->component_count_; ++i)
+        {
+          this->offsets_[i] = walk.rd_ptr () - this->cdr_.rd_ptr ();
+
+          field_tc = unaliased_tc->member_type (i);
+
+          if (TAO_Marshal_Object::perform_skip (field_tc.in (), &walk)
+                != TAO::TRAVERSE_CONTINUE)
+            {
+              this->offsets_.size (0);
+              throw ::CORBA::MARSHAL ();
+            }
+        }
+    }
+
+  cdr.skip_bytes (this->offsets_[index]);
+}
+
+void
+TAO_DynStruct_i::release_members (void)
+{
+  for (CORBA::ULong i = 0; i < this->component_count_; ++i)
+    {
+      if (!CORBA::is_nil (this->da_members_[i].in ()))
+        {
+          this->da_members_[i]->destroy ();
+          this->da_members_[i] = DynamicAny::DynAny::_nil ();
+        }
     }
 }
 
@@ -148,19 +243,8 @@ TAO_DynStruct_i::init (CORBA::TypeCode_ptr tc)
 
   this->init_common ();
 
-  CORBA::TypeCode_var mtype;
-
-  for (CORBA::ULong i = 0; i < this->component_count_; ++i)
-    {
-      mtype = unaliased_tc->member_type (i);
-
-      // Recursively initialize each member.
-      this->da_members_[i] =
-        TAO::MakeDynAnyUtils::make_dyn_any_t<CORBA::TypeCode_ptr> (
-          mtype.in (),
-          mtype.in (),
-          this->allow_truncation_);
-    }
+  // Each member is initialized from its type when first asked for.
+  this->encoded_ = false;
 }
 
 // ****************************************************************
@@ -275,9 +359,16 @@ TAO_DynStruct_i::get_members (void)
       safe_retval[i].id =
         CORBA::string_dup (unaliased_tc->member_name (i));
 
-      temp = this->da_members_[i]->to_any ();
+      if (this->encoded_ && CORBA::is_nil (this->da_members_[i].in ()))
+        {
+          this->stored_member (i, safe_retval[i].value);
+        }
+      else
+        {
+          temp = this->member (i)->to_any ();
 
-      safe_retval[i].value = temp.in ();
+          safe_retval[i].value = temp.in ();
+        }
     }
 
   return safe_retval._retn ();
@@ -321,16 +412,21 @@ TAO_DynStruct_i::set_members (const DynamicAny::NameValuePairSeq & values)
         {
           throw DynamicAny::DynAny::TypeMismatch ();
         }
+    }
 
-      this->da_members_[i]->destroy ();
+  // The new members are stored encoded.
+  TAO_OutputCDR out_cdr;
 
-      this->da_members_[i] =
-        TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
-          values[i].value._tao_get_typecode (),
-          values[i].value,
-          this->allow_truncation_);
+  for (CORBA::ULong i = 0; i < length; ++i)
+    {
+      my_tc = unaliased_tc->member_type (i);
+
+      TAO_DynCommon::append_value (values[i].value, my_tc.in (), out_cdr);
     }
 
+  TAO_InputCDR in_cdr (out_cdr);
+  this->set_encoded_members (in_cdr);
+
   this->current_position_ = length ? 0 : -1;
 }
 
@@ -361,12 +457,13 @@ TAO_DynStruct_i::get_members_as_dyn_any (void)
     {
       safe_retval[i].id = CORBA::string_dup (unaliased_tc->member_name (i));
 
+      DynamicAny::DynAny_ptr const member = this->member (i);
+
       // A deep copy is made only by copy() (CORBA 2.4.2 section 9.2.3.6).
       // Set the flag so the caller can't destroy.
-      this->set_flag (this->da_members_[i].in (), 0);
+      this->set_flag (member, 0);
 
-      safe_retval[i].value =
-        DynamicAny::DynAny::_duplicate (this->da_members_[i].in ());
+      safe_retval[i].value = DynamicAny::DynAny::_duplicate (member);
     }
 
   return safe_retval._retn ();
@@ -414,7 +511,10 @@ TAO_DynStruct_i::set_members_as_dyn_any (
           throw DynamicAny::DynAny::TypeMismatch ();
         }
 
-      this->da_members_[i]->destroy ();
+      if (!CORBA::is_nil (this->da_members_[i].in ()))
+        {
+          this->da_members_[i]->destroy ();
+        }
 
       this->da_members_[i] =
         values[i].value->copy ();
@@ -440,66 +540,7 @@ TAO_DynStruct_i::from_any (const CORBA::Any & any)
 
   if (equivalent)
     {
-      // Get the CDR stream of the Any, if there isn't one, make one.
-      TAO::Any_Impl *impl = any.impl ();
-      TAO_OutputCDR out;
-      TAO_InputCDR in (static_cast<ACE_Message_Block *> (0));
-      TAO::Unknown_IDL_Type *unk = 0;
-
-      if (impl->encoded ())
-        {
-          unk = dynamic_cast<TAO::Unknown_IDL_Type *> (impl);
-
-          if (!unk)
-            throw CORBA::INTERNAL ();
-
-          in = unk->_tao_get_cdr ();
-        }
-      else
-        {
-          impl->marshal_value (out);
-          TAO_InputCDR tmp_in (out);
-          in = tmp_in;
-        }
-
-      // If we have an exception type, unmarshal the repository ID.
-      CORBA::TCKind kind =
-        TAO_DynAnyFactory::unalias (this->type_.in ());
-
-      if (kind == CORBA::tk_except)
-        {
-          CORBA::String_var str;
-          in >> str.out ();
-        }
-
-      CORBA::TypeCode_var field_tc;
-      CORBA::TypeCode_var unaliased =
-        TAO::unaliased_typecode (this->type_.in ()
-                                );
-
-      for (CORBA::ULong i = 0; i < this->component_count_; ++i)
-        {
-          field_tc = unaliased->member_type (i);
-
-          CORBA::Any field_any;
-          TAO_InputCDR unk_in (in);
-          TAO::Unknown_IDL_Type *unk = 0;
-          ACE_NEW (unk,
-                   TAO::Unknown_IDL_Type (field_tc.in (),
-                                          unk_in));
-          field_any.replace (unk);
-
-          this->da_members_[i]->destroy ();
-
-          this->da_members_[i] =
-            TAO::MakeDynAnyUtils::make_dyn_any_t<const CORBA::Any&> (
-              field_any._tao_get_typecode (),
-              field_any,
-              this->allow_truncation_);
-
-          // Move to the next field in the CDR stream.
-          (void) TAO_Marshal_Object::perform_skip (field_tc.in (), &in);
-        }
+      this->members_from_any (any);
 
       this->current_position_ = this->component_count_ ? 0 : -1;
     }
@@ -527,42 +568,40 @@ TAO_DynStruct_i::to_any (void)
       out_cdr << this->type_->id ();
     }
 
-  TAO::Any_Impl *field_impl = 0;
-  TAO::Unknown_IDL_Type *field_unk = 0;
-  TAO_InputCDR field_in_cdr (static_cast<ACE_Message_Block *> (0));
+  // member_type() does not work with aliased type codes.
+  CORBA::TypeCode_var unaliased_tc =
+    TAO_DynAnyFactory::strip_alias (this->type_.in ());
+
+  // Follows the member i through the encoded members.
+  TAO_InputCDR field_in_cdr (this->cdr_);
 
   for (CORBA::ULong i = 0; i < this->component_count_; ++i)
     {
       CORBA::TypeCode_var field_tc =
-        this->da_members_[i]->type ();
-
-      // Recursive step.
-      CORBA::Any_var field_any =
-        this->da_members_[i]->to_any ();
-
-      TAO_OutputCDR field_out_cdr;
-      field_impl = field_any->impl ();
-
-      if (field_impl->encoded ())
-        {
-          field_unk =
-            dynamic_cast<TAO::Unknown_IDL_Type *> (field_impl);
-
-          if (!field_unk)
-            throw CORBA::INTERNAL ();
+        unaliased_tc->member_type (i);
 
-          field_in_cdr = field_unk->_tao_get_cdr ();
-        }
-      else
+      if (this->encoded_)
         {
-          field_impl->marshal_value (field_out_cdr);
-          TAO_InputCDR tmp (field_out_cdr);
-          field_in_cdr = tmp;
+          // Copy the members nobody asked for as they are.
+          if (CORBA::is_nil (this->da_members_[i].in ()))
+            {
+              (void) TAO_Marshal_Object::perform_append (field_tc.in (),
+                                                         &field_in_cdr,
+                                                         &out_cdr);
+              continue;
+            }
+
+          (void) TAO_Marshal_Object::perform_skip (field_tc.in (),
+                                                   &field_in_cdr);
         }
 
-      (void) TAO_Marshal_Object::perform_append (field_tc.in (),
-                                                 &field_in_cdr,
-                                                 &out_cdr);
+      // Recursive step.
+      CORBA::Any_var field_any =
+        this->member (i)->to_any ();
+
+      TAO_DynCommon::append_value (field_any.in (),
+                                   field_tc.in (),
+                                   out_cdr);
     }
 
   TAO_InputCDR in_cdr (out_cdr);
@@ -607,7 +646,7 @@ TAO_DynStruct_i::equal (DynamicAny::DynAny_ptr rhs)
       tmp = rhs->current_component ();
 
       // Recursive step.
-      member_equal = tmp->equal (this->da_members_[i].in ());
+      member_equal = tmp->equal (this->member (i));
 
       if (!member_equal)
         {
@@ -628,9 +667,15 @@ TAO_DynStruct_i::destroy (void)
 
   if (!this->ref_to_component_ || this->container_is_destroying_)
     {
-      // Do a deep destroy.
+      // Do a deep destroy, members without a DynAny have nothing to
+      // destroy.
       for (CORBA::ULong i = 0; i < this->component_count_; ++i)
         {
+          if (CORBA::is_nil (this->da_members_[i].in ()))
+            {
+              continue;
+            }
+
           this->set_flag (da_members_[i].in (), 1);
 
           this->da_members_[i]->destroy ();
@@ -661,9 +706,11 @@ TAO_DynStruct_i::current_component (void)
 
   CORBA::ULong index = static_cast <CORBA::ULong> (this->current_position_);
 
-  this->set_flag (this->da_members_[index].in (), 0);
+  DynamicAny::DynAny_ptr const member = this->member (index);
+
+  this->set_flag (member, 0);
 
-  return DynamicAny::DynAny::_duplicate (this->da_members_[index].in ());
+  return DynamicAny::DynAny::_duplicate (member);
 }
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -20,6 +20,7 @@
 
 #include "tao/DynamicAny/DynCommon.h"
 #include "tao/LocalObject.h"
+#include "tao/CDR.h"
 #include "ace/Containers.h"
 
 #if defined (_MSC_VER)
@@ -93,13 +94,47 @@ private:
   /// Called by both versions of init().
   void init_common (void);
 
+  /// Keep the encoded members of the value of @a any.
+  void members_from_any (const CORBA::Any &any);
+
+  /// Keep the encoded members at the read position of @a cdr in
+  /// place of the current ones.
+  void set_encoded_members (const TAO_InputCDR &cdr);
+
+  /// The DynAny of the member at @a index, made on first use.
+  DynamicAny::DynAny_ptr member (CORBA::ULong index);
+
+  /// Copy the encoded value of the member at @a index into @a any
+  /// without making its DynAny.
+  void stored_member (CORBA::ULong index, CORBA::Any &any);
+
+  /// Position @a cdr at the encoded member at @a index.
+  void locate (CORBA::ULong index, TAO_InputCDR &cdr);
+
+  /// Destroy the DynAnys of all the members.
+  void release_members (void);
+
   // = Use copy() or assign() instead of these.
   TAO_DynStruct_i (const TAO_DynStruct_i &src);
   TAO_DynStruct_i &operator= (const TAO_DynStruct_i &src);
 
 private:
-  /// Each component is also a DynAny.
+  /**
+   * The DynAny of each member, nil until the member is asked for.
+   * A member without one holds its value encoded in cdr_, or the
+   * default value of its type when there is no encoded value.
+   */
   ACE_Array_Base<DynamicAny::DynAny_var> da_members_;
+
+  /// The encoded members, from the first one on.
+  TAO_InputCDR cdr_;
+
+  /// Do the members without a DynAny have an encoded value?
+  bool encoded_;
+
+  /// Offset of each encoded member from the first one, computed on
+  /// the first access to a member past the first.
+  ACE_Array_Base<size_t> offsets_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -25,6 +25,7 @@ TAO_GIOP_Message_Base::TAO_GIOP_Message_Base (TAO_ORB_Core *orb_core,
                                               TAO_Transport *transport,
                                               size_t input_cdr_size)
   : orb_core_ (orb_core)
+  , transport_ (transport)
   , fragmentation_strategy_ (orb_core->fragmentation_strategy (transport))
   , out_stream_ (0,
                  input_cdr_size,
@@ -275,8 +276,9 @@ TAO_GIOP_Message_Base::format_message (TAO_OutputCDR &stream, TAO_Stub *stub, TA
 
           const bool compressed=
             stub ?
-            ziop_adapter->marshal_data (stream, *stub) :
-            ziop_adapter->marshal_data (stream, *this->orb_core_, request);
+            ziop_adapter->marshal_data (stream, *stub, this->transport_) :
+            ziop_adapter->marshal_data (stream, *this->orb_core_, request,
+                                        this->transport_);
 
           if (log_msg && !compressed)
             {
@@ -703,6 +705,14 @@ TAO_GIOP_Message_Base::process_request_message (TAO_Transport *transport,
                           qd->giop_version ().minor_version (),
                           this->orb_core_);
 
+  // The rest of a chained fragmented message now belongs to the
+  // stream.
+  if (qd->msg_block ()->cont () != 0)
+    {
+      input_cdr.append (qd->msg_block ()->cont ());
+      qd->msg_block ()->cont (0);
+    }
+
   transport->assign_translators(&input_cdr,&output);
 
   // We know we have some request message. Check whether it is a
@@ -827,6 +837,14 @@ TAO_GIOP_Message_Base::process_reply_message (
                           qd->giop_version ().minor_version (),
                           this->orb_core_);
 
+  // The rest of a chained fragmented message now belongs to the
+  // stream.
+  if (qd->msg_block ()->cont () != 0)
+    {
+      input_cdr.append (qd->msg_block ()->cont ());
+      qd->msg_block ()->cont (0);
+    }
+
   // We know we have some reply message. Check whether it is a
   // GIOP_REPLY or GIOP_LOCATE_REPLY to take action.
 
@@ -1934,7 +1952,14 @@ TAO_GIOP_Message_Base::consolidate_fragmented_message (
       this->fragment_stack_.push (head);
     }
 
-  if (tail->consolidate () == -1)
+  // The fragments are kept chained, for the CDR stream to read
+  // across them, or copied in one message block.
+  int const result =
+    this->orb_core_->orb_params ()->giop_fragment_chaining ()
+    ? tail->chain ()
+    : tail->consolidate ();
+
+  if (result == -1)
     {
       // memory allocation failed
       TAO_Queued_Data::release (tail);
@@ -248,6 +248,9 @@ private:
   /// Cached ORB_Core pointer...
   TAO_ORB_Core *orb_core_;
 
+  /// The transport of the messages, ZIOP uses its link throughput.
+  TAO_Transport *transport_;
+
   /// All the implementations of GIOP message generator and parsers
   TAO_GIOP_Message_Generator_Parser_Impl tao_giop_impl_;
 
@@ -365,6 +365,9 @@ TAO_GIOP_Message_Generator_Parser_10::parse_request_header (
   CORBA::ULong length = 0;
   hdr_status = hdr_status && input.read_ulong (length);
 
+  // The operation name is used in place, it must be in one block.
+  hdr_status = hdr_status && input.pullup (length) == 0;
+
   if (hdr_status)
     {
       // Do not include NULL character at the end.
@@ -58,6 +58,7 @@
 #include "ace/checked_iterator.h"
 
 #include <algorithm>
+#include <utility>
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -167,6 +168,29 @@ public:
     return * this;
   }
 
+#if defined (ACE_HAS_CPP11)
+  /// Move constructor, takes the buffer of @a rhs and leaves it
+  /// empty, without a buffer.
+  generic_sequence(generic_sequence && rhs)
+    : maximum_(rhs.maximum_)
+    , length_(rhs.length_)
+    , buffer_(rhs.buffer_)
+    , release_(rhs.release_)
+  {
+    rhs.length_ = 0;
+    rhs.buffer_ = 0;
+    rhs.release_ = false;
+  }
+
+  /// Move assignment operator
+  generic_sequence & operator=(generic_sequence && rhs)
+  {
+    generic_sequence tmp(std::move(rhs));
+    swap(tmp);
+    return * this;
+  }
+#endif /* ACE_HAS_CPP11 */
+
   /// Destructor.
   ~generic_sequence()
   {
@@ -0,0 +1,105 @@
+// -*- C++ -*-
+#include "tao/Messaging/AMH_Coroutine.h"
+
+#if (TAO_HAS_AMH_COROUTINES == 1)
+
+#include "tao/Messaging/AMH_Response_Handler.h"
+#include "tao/SystemException.h"
+#include "tao/debug.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace AMH
+  {
+    void
+    Coroutine::promise_type::init (void)
+    {
+      this->handler_ =
+        dynamic_cast<TAO_AMH_Response_Handler *> (this->rh_.in ());
+    }
+
+    Coroutine::promise_type::~promise_type (void)
+    {
+    }
+
+    Coroutine
+    Coroutine::promise_type::get_return_object (void) noexcept
+    {
+      return Coroutine ();
+    }
+
+    std::suspend_never
+    Coroutine::promise_type::initial_suspend (void) noexcept
+    {
+      return std::suspend_never ();
+    }
+
+    std::suspend_never
+    Coroutine::promise_type::final_suspend (void) noexcept
+    {
+      return std::suspend_never ();
+    }
+
+    void
+    Coroutine::promise_type::return_void (void) noexcept
+    {
+    }
+
+    void
+    Coroutine::promise_type::unhandled_exception (void) noexcept
+    {
+      try
+        {
+          throw;
+        }
+      catch (const ::CORBA::Exception &ex)
+        {
+          this->send_exception (ex);
+        }
+      catch (...)
+        {
+          this->send_exception (::CORBA::UNKNOWN ());
+        }
+    }
+
+    void
+    Coroutine::promise_type::send_exception (
+      const ::CORBA::Exception &ex) noexcept
+    {
+      if (this->handler_ == 0)
+        {
+          if (TAO_debug_level > 0)
+            {
+              TAOLIB_ERROR ((LM_ERROR,
+                             ACE_TEXT ("TAO_Messaging (%P|%t) - ")
+                             ACE_TEXT ("AMH::Coroutine, cannot report ")
+                             ACE_TEXT ("exception %C, unknown ")
+                             ACE_TEXT ("ResponseHandler\n"),
+                             ex._name ()));
+            }
+          return;
+        }
+
+      try
+        {
+          this->handler_->_tao_rh_send_exception (ex);
+        }
+      catch (const ::CORBA::Exception &send_ex)
+        {
+          // The reply was sent already or the connection is gone.
+          if (TAO_debug_level > 0)
+            {
+              send_ex._tao_print_exception (
+                "TAO_Messaging - AMH::Coroutine, sending the "
+                "exception of the coroutine");
+            }
+        }
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_AMH_COROUTINES == 1 */
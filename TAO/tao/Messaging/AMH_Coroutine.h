@@ -0,0 +1,123 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    AMH_Coroutine.h
+ *
+ *  AMH servant operations written as C++20 coroutines.
+ */
+//=============================================================================
+
+#ifndef TAO_MESSAGING_AMH_COROUTINE_H
+#define TAO_MESSAGING_AMH_COROUTINE_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Messaging/messaging_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+
+#if (TAO_HAS_AMH_COROUTINES == 1)
+
+#include "tao/Object.h"
+
+#include <coroutine>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_AMH_Response_Handler;
+
+namespace CORBA
+{
+  class Exception;
+}
+
+namespace TAO
+{
+  namespace AMH
+  {
+    /**
+     * @class Coroutine
+     *
+     * @brief The return type of the co_* AMH servant operations.
+     *
+     * With tao_idl -GHo the AMH skeleton of each operation calls a
+     * co_<op> coroutine that the servant implements, the coroutine can
+     * co_await the co_* AMI stubs (tao_idl -GCo) of other objects and
+     * completes the request through its ResponseHandler:
+     *
+     * @code
+     * ::TAO::AMH::Coroutine
+     * Middle::co_add (Test::AMH_CalculatorResponseHandler_ptr _tao_rh,
+     *                 ::CORBA::Long a,
+     *                 ::CORBA::Long b)
+     * {
+     *   auto r = co_await this->backend_->co_add (a, b);
+     *   _tao_rh->add (r.ami_return_val);
+     * }
+     * @endcode
+     *
+     * The coroutine runs until its first suspension on the thread that
+     * dispatched the request, which returns to the ORB instead of
+     * blocking on the downstream calls.  The coroutine owns its in
+     * and inout arguments and a reference of the ResponseHandler, so
+     * both remain valid while it is suspended.  An exception that
+     * escapes the coroutine is sent back to the client, CORBA::UNKNOWN
+     * is sent for those that are not CORBA exceptions.
+     */
+    class Coroutine
+    {
+    public:
+      class TAO_Messaging_Export promise_type
+      {
+      public:
+        /// The coroutine is a member of the servant @a servant, its
+        /// first argument is the ResponseHandler @a rh.
+        template <typename SERVANT, typename... ARGS>
+        promise_type (SERVANT &, ::CORBA::Object_ptr rh, ARGS &...)
+          : rh_ (::CORBA::Object::_duplicate (rh))
+          , handler_ (0)
+        {
+          this->init ();
+        }
+
+        ~promise_type (void);
+
+        Coroutine get_return_object (void) noexcept;
+
+        std::suspend_never initial_suspend (void) noexcept;
+
+        std::suspend_never final_suspend (void) noexcept;
+
+        void return_void (void) noexcept;
+
+        /// Send the exception that escaped the coroutine to the client.
+        void unhandled_exception (void) noexcept;
+
+      private:
+        void init (void);
+
+        void send_exception (const ::CORBA::Exception &ex) noexcept;
+
+        /// Keeps the ResponseHandler alive while the coroutine runs.
+        ::CORBA::Object_var rh_;
+
+        /// The implementation of the ResponseHandler, used to report
+        /// exceptions.
+        TAO_AMH_Response_Handler *handler_;
+      };
+    };
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_AMH_COROUTINES == 1 */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_MESSAGING_AMH_COROUTINE_H */
@@ -87,6 +87,13 @@ public:
   virtual void _remove_ref (void);
   //@}
 
+  /// Send back an exception to the client.
+  /**
+   * Also used to report the exceptions that escape a coroutine AMH
+   * servant operation.
+   */
+  void _tao_rh_send_exception (const CORBA::Exception &ex);
+
 protected:
   /// Sets up the various parameters in anticipation of returning a reply
   /// to the client. return/OUT/INOUT arguments are marshalled into the
@@ -96,9 +103,6 @@ protected:
   /// Sends the marshalled reply back to the client.
   void _tao_rh_send_reply (void);
 
-  /// Send back an exception to the client.
-  void _tao_rh_send_exception (const CORBA::Exception &ex);
-
   /// Send back a location forward exception to the client.
   void _tao_rh_send_location_forward (CORBA::Object_ptr fwd,
                                       CORBA::Boolean is_perm);
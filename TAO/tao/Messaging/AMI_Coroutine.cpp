@@ -0,0 +1,169 @@
+// -*- C++ -*-
+#include "tao/Messaging/AMI_Coroutine.h"
+
+#if (TAO_HAS_AMI_COROUTINES == 1)
+
+#include "tao/CDR.h"
+#include "tao/debug.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace AMI
+  {
+    Coroutine_Reply_Dispatcher::Coroutine_Reply_Dispatcher (
+        TAO::Exception_Data *ex_data,
+        CORBA::ULong ex_count,
+        TAO_ORB_Core *orb_core)
+      : TAO_Asynch_Reply_Dispatcher (orb_core, 0)
+      , ex_data_ (ex_data)
+      , ex_count_ (ex_count)
+      , lock_ ()
+      , waiter_ ()
+      , replied_ (false)
+      , exception_ ()
+    {
+    }
+
+    Coroutine_Reply_Dispatcher::~Coroutine_Reply_Dispatcher (void)
+    {
+    }
+
+    bool
+    Coroutine_Reply_Dispatcher::suspend (std::coroutine_handle<> waiter)
+    {
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, false);
+
+      if (this->replied_)
+        {
+          return false;
+        }
+
+      this->waiter_ = waiter;
+      return true;
+    }
+
+    void
+    Coroutine_Reply_Dispatcher::cancel (void)
+    {
+      ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+      this->waiter_ = std::coroutine_handle<> ();
+    }
+
+    void
+    Coroutine_Reply_Dispatcher::raise_exception (void)
+    {
+      if (this->exception_.in () != 0)
+        {
+          this->exception_->raise_exception ();
+        }
+    }
+
+    void
+    Coroutine_Reply_Dispatcher::deliver_reply (TAO_InputCDR &cdr,
+                                               CORBA::ULong reply_status)
+    {
+      switch (reply_status)
+        {
+        case TAO_AMI_REPLY_OK:
+          if (!this->demarshal (cdr))
+            {
+              this->system_exception (
+                CORBA::MARSHAL (TAO::VMCID, CORBA::COMPLETED_YES));
+            }
+          break;
+        case TAO_AMI_REPLY_USER_EXCEPTION:
+        case TAO_AMI_REPLY_SYSTEM_EXCEPTION:
+          if (!this->exception (
+                 cdr, reply_status == TAO_AMI_REPLY_SYSTEM_EXCEPTION))
+            {
+              this->system_exception (
+                CORBA::MARSHAL (TAO::VMCID, CORBA::COMPLETED_YES));
+            }
+          break;
+        default:
+          // The Reply Handlers are not called for these replies, but
+          // the coroutine must not wait forever.
+          this->system_exception (
+            CORBA::INTERNAL (TAO::VMCID, CORBA::COMPLETED_MAYBE));
+          break;
+        }
+
+      std::coroutine_handle<> waiter;
+
+      {
+        ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+        this->replied_ = true;
+        waiter = this->waiter_;
+        this->waiter_ = std::coroutine_handle<> ();
+      }
+
+      if (waiter)
+        {
+          if (TAO_debug_level >= 4)
+            {
+              TAOLIB_DEBUG ((LM_DEBUG,
+                             ACE_TEXT ("TAO_Messaging (%P|%t) - ")
+                             ACE_TEXT ("Coroutine_Reply_Dispatcher::")
+                             ACE_TEXT ("deliver_reply, resuming the ")
+                             ACE_TEXT ("coroutine\n")));
+            }
+
+          // The awaitable holds a reference, we are not destroyed
+          // while the coroutine runs.
+          waiter.resume ();
+        }
+    }
+
+    bool
+    Coroutine_Reply_Dispatcher::exception (TAO_InputCDR &cdr,
+                                           bool is_system_exception)
+    {
+      // The reply can be in several chained blocks (the fragments of
+      // the GIOP message), the exception is read from the stream.
+      CORBA::ULong const length = static_cast<CORBA::ULong> (cdr.length ());
+
+      CORBA::OctetSeq marshaled (length);
+      marshaled.length (length);
+
+      if (!cdr.read_octet_array (marshaled.get_buffer (), length))
+        {
+          return false;
+        }
+
+      Messaging::ExceptionHolder *holder = 0;
+      ACE_NEW_RETURN (holder,
+                      TAO::ExceptionHolder (is_system_exception,
+                                            cdr.byte_order (),
+                                            marshaled,
+                                            this->ex_data_,
+                                            this->ex_count_,
+                                            cdr.char_translator (),
+                                            cdr.wchar_translator ()),
+                      false);
+
+      this->exception_ = holder;
+      return true;
+    }
+
+    void
+    Coroutine_Reply_Dispatcher::system_exception (
+      const CORBA::SystemException &ex)
+    {
+      TAO_OutputCDR out_cdr;
+
+      ex._tao_encode (out_cdr);
+
+      TAO_InputCDR cdr (out_cdr);
+
+      (void) this->exception (cdr, true);
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_AMI_COROUTINES == 1 */
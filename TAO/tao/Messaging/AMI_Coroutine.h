@@ -0,0 +1,130 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    AMI_Coroutine.h
+ *
+ *  Asynchronous invocations that C++20 coroutines can co_await.
+ */
+//=============================================================================
+
+#ifndef TAO_MESSAGING_AMI_COROUTINE_H
+#define TAO_MESSAGING_AMI_COROUTINE_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/Messaging/messaging_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+
+#if (TAO_HAS_AMI_COROUTINES == 1)
+
+#include "tao/Messaging/Asynch_Reply_Dispatcher.h"
+#include "tao/Messaging/ExceptionHolder_i.h"
+#include "tao/SystemException.h"
+#include "tao/Stub.h"
+
+#include <coroutine>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  struct Exception_Data;
+
+  namespace AMI
+  {
+    /**
+     * @class Coroutine_Reply_Dispatcher
+     *
+     * @brief Reply dispatcher of the requests made by the co_* stubs.
+     *
+     * Instead of calling a Reply Handler the dispatcher demarshals the
+     * reply and resumes the coroutine that awaits it, on the thread
+     * that dispatches the reply: a thread running the ORB event loop,
+     * or the thread waiting for another reply on the same connection.
+     * The exceptions are kept until the coroutine resumes, which
+     * raises them.
+     *
+     * The dispatcher is reference counted, the ORB holds a reference
+     * until the reply is dispatched and the Awaitable another one.
+     */
+    class TAO_Messaging_Export Coroutine_Reply_Dispatcher
+      : public TAO_Asynch_Reply_Dispatcher
+    {
+    public:
+      /// Resume @a waiter when the reply arrives.
+      /**
+       * @return false if the reply arrived already, in which case the
+       *         caller does not suspend.
+       */
+      bool suspend (std::coroutine_handle<> waiter);
+
+      /// The coroutine that awaits the reply is destroyed, it is not
+      /// resumed when the reply arrives.
+      /**
+       * The coroutine must not be destroyed while the thread that
+       * dispatches the reply resumes it.
+       */
+      void cancel (void);
+
+      /// Raise the exception the reply carried, if any.
+      void raise_exception (void);
+
+    protected:
+      /// @a ex_data and @a ex_count describe the user exceptions of the
+      /// operation, as for the Reply Handler stubs.
+      Coroutine_Reply_Dispatcher (TAO::Exception_Data *ex_data,
+                                  CORBA::ULong ex_count,
+                                  TAO_ORB_Core *orb_core);
+
+      virtual ~Coroutine_Reply_Dispatcher (void);
+
+      /// Demarshal the return value and out arguments of the reply.
+      /// @return false if they could not be demarshaled
+      virtual bool demarshal (TAO_InputCDR &cdr) = 0;
+
+      virtual void deliver_reply (TAO_InputCDR &cdr,
+                                  CORBA::ULong reply_status);
+
+    private:
+      /// Keep the exception marshaled in @a cdr.
+      /// @return false if it could not be read from @a cdr
+      bool exception (TAO_InputCDR &cdr, bool is_system_exception);
+
+      /// Keep a system exception raised locally.
+      void system_exception (const CORBA::SystemException &ex);
+
+      TAO::Exception_Data *ex_data_;
+
+      CORBA::ULong const ex_count_;
+
+      /// Protect the state shared by the thread that awaits the reply
+      /// and the one that dispatches it.
+      TAO_SYNCH_MUTEX lock_;
+
+      /// The coroutine suspended until the reply arrives.
+      std::coroutine_handle<> waiter_;
+
+      /// Has the reply been delivered?
+      bool replied_;
+
+      /// The exception of the reply, nil if there is none.
+      Messaging::ExceptionHolder_var exception_;
+    };
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include "tao/Messaging/AMI_Coroutine_T.h"
+
+#endif /* TAO_HAS_AMI_COROUTINES == 1 */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_MESSAGING_AMI_COROUTINE_H */
@@ -0,0 +1,95 @@
+// -*- C++ -*-
+#ifndef TAO_MESSAGING_AMI_COROUTINE_T_CPP
+#define TAO_MESSAGING_AMI_COROUTINE_T_CPP
+
+#include "tao/Messaging/AMI_Coroutine.h"
+
+#if (TAO_HAS_AMI_COROUTINES == 1)
+
+#include <utility>
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace AMI
+  {
+    template <typename REPLY>
+    Reply_Dispatcher_T<REPLY>::Reply_Dispatcher_T (
+        TAO::Exception_Data *ex_data,
+        CORBA::ULong ex_count,
+        TAO_ORB_Core *orb_core)
+      : Coroutine_Reply_Dispatcher (ex_data, ex_count, orb_core)
+      , reply_ ()
+    {
+    }
+
+    template <typename REPLY>
+    REPLY &
+    Reply_Dispatcher_T<REPLY>::reply (void)
+    {
+      return this->reply_;
+    }
+
+    template <typename REPLY>
+    bool
+    Reply_Dispatcher_T<REPLY>::demarshal (TAO_InputCDR &cdr)
+    {
+      return this->reply_._tao_demarshal (cdr);
+    }
+
+    template <typename REPLY>
+    Awaitable<REPLY>::Awaitable (Reply_Dispatcher_T<REPLY> *rd)
+      : rd_ (rd)
+    {
+    }
+
+    template <typename REPLY>
+    Awaitable<REPLY>::Awaitable (Awaitable &&other) noexcept
+      : rd_ (other.rd_)
+    {
+      other.rd_ = 0;
+    }
+
+    template <typename REPLY>
+    Awaitable<REPLY>::~Awaitable (void)
+    {
+      if (this->rd_ != 0)
+        {
+          // The coroutine frame that holds a suspended awaitable may be
+          // destroyed before the reply arrives, it must not be resumed.
+          this->rd_->cancel ();
+          TAO_Reply_Dispatcher::intrusive_remove_ref (this->rd_);
+        }
+    }
+
+    template <typename REPLY>
+    bool
+    Awaitable<REPLY>::await_ready (void) const noexcept
+    {
+      return false;
+    }
+
+    template <typename REPLY>
+    bool
+    Awaitable<REPLY>::await_suspend (std::coroutine_handle<> waiter)
+    {
+      return this->rd_->suspend (waiter);
+    }
+
+    template <typename REPLY>
+    REPLY
+    Awaitable<REPLY>::await_resume (void)
+    {
+      this->rd_->raise_exception ();
+
+      return std::move (this->rd_->reply ());
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* TAO_HAS_AMI_COROUTINES == 1 */
+
+#endif /* TAO_MESSAGING_AMI_COROUTINE_T_CPP */
@@ -0,0 +1,121 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    AMI_Coroutine_T.h
+ *
+ *  The awaitable returned by the co_* stubs.
+ */
+//=============================================================================
+
+#ifndef TAO_MESSAGING_AMI_COROUTINE_T_H
+#define TAO_MESSAGING_AMI_COROUTINE_T_H
+
+#include /**/ "ace/pre.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace AMI
+  {
+    /**
+     * @class Reply_Dispatcher_T
+     *
+     * @brief Reply dispatcher that demarshals the reply in a REPLY.
+     *
+     * REPLY is the <op>_reply structure that tao_idl generates for
+     * each co_<op> stub, with the return value and the out and inout
+     * arguments of the operation.
+     */
+    template <typename REPLY>
+    class Reply_Dispatcher_T : public Coroutine_Reply_Dispatcher
+    {
+    public:
+      Reply_Dispatcher_T (TAO::Exception_Data *ex_data,
+                          CORBA::ULong ex_count,
+                          TAO_ORB_Core *orb_core);
+
+      /// The demarshaled reply.
+      REPLY &reply (void);
+
+    protected:
+      virtual bool demarshal (TAO_InputCDR &cdr);
+
+    private:
+      REPLY reply_;
+    };
+
+    /**
+     * @class Awaitable
+     *
+     * @brief The result of a co_* stub.
+     *
+     * The request is sent when the co_* stub is called, co_await
+     * suspends the coroutine until the reply arrives and then returns
+     * the REPLY, or raises the exception of the reply.  The coroutine
+     * is resumed by the thread that dispatches the reply, so a thread
+     * must run the ORB event loop while the coroutine waits:
+     *
+     * @code
+     * auto r = co_await calculator->co_add (1, 2);
+     * std::cout << r.ami_return_val << std::endl;
+     * @endcode
+     *
+     * Unlike the sendc_* stubs no Reply Handler is activated, the
+     * reply is delivered directly to the Awaitable.  An Awaitable can
+     * be awaited once, an Awaitable kept in a variable is awaited with
+     * std::move.  If it is destroyed before the reply arrives the
+     * reply is dropped, this includes an Awaitable in the frame of a
+     * suspended coroutine that is destroyed.
+     */
+    template <typename REPLY>
+    class Awaitable
+    {
+    public:
+      typedef REPLY reply_type;
+
+      /// Adopt a reference of @a rd.
+      explicit Awaitable (Reply_Dispatcher_T<REPLY> *rd);
+
+      Awaitable (Awaitable &&other) noexcept;
+
+      ~Awaitable (void);
+
+      /// @name Awaitable interface
+      //@{
+      bool await_ready (void) const noexcept;
+
+      bool await_suspend (std::coroutine_handle<> waiter);
+
+      REPLY await_resume (void);
+      //@}
+
+    private:
+      Awaitable (const Awaitable &) = delete;
+      Awaitable &operator= (const Awaitable &) = delete;
+      Awaitable &operator= (Awaitable &&) = delete;
+
+    private:
+      Reply_Dispatcher_T<REPLY> *rd_;
+    };
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (ACE_TEMPLATES_REQUIRE_SOURCE)
+#include "tao/Messaging/AMI_Coroutine_T.cpp"
+#endif /* ACE_TEMPLATES_REQUIRE_SOURCE */
+
+#if defined (ACE_TEMPLATES_REQUIRE_PRAGMA)
+#pragma implementation ("AMI_Coroutine_T.cpp")
+#endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_MESSAGING_AMI_COROUTINE_T_H */
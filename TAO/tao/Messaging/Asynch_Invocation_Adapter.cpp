@@ -102,6 +102,24 @@ namespace TAO
     Invocation_Adapter::invoke (0, 0);
   }
 
+  void
+  Asynch_Invocation_Adapter::invoke (TAO_Asynch_Reply_Dispatcher_Base *rd)
+  {
+    if (TAO_debug_level >= 4)
+      {
+        TAOLIB_DEBUG ((LM_DEBUG,
+                    "TAO_Messaging (%P|%t) - Asynch_Invocation_Adapter::"
+                    "invoke, with reply dispatcher\n"));
+      }
+
+    // The reference is handed over to the ORB with the request, as
+    // the one of the reply dispatchers created above.
+    TAO_Reply_Dispatcher::intrusive_add_ref (rd);
+    this->safe_rd_.reset (rd);
+
+    Invocation_Adapter::invoke (0, 0);
+  }
+
   void
   Asynch_Invocation_Adapter::invoke (
     const TAO::Exception_Data *ex,
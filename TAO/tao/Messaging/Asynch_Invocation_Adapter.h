@@ -71,6 +71,11 @@ namespace TAO
     void invoke (Messaging::ReplyHandler_ptr reply_handler_ptr,
                  const TAO_Reply_Handler_Stub &reply_handler_stub);
 
+    /// Make the invocation with a reply dispatcher of the caller
+    /// instead of one for a Reply Handler, the replies are delivered
+    /// to @a rd.  The adapter takes a reference of @a rd.
+    void invoke (TAO_Asynch_Reply_Dispatcher_Base *rd);
+
     virtual void invoke (const TAO::Exception_Data *ex, unsigned long ex_count);
 
   protected:
@@ -22,6 +22,17 @@ TAO_Asynch_Reply_Dispatcher::TAO_Asynch_Reply_Dispatcher (
 {
 }
 
+TAO_Asynch_Reply_Dispatcher::TAO_Asynch_Reply_Dispatcher (
+    TAO_ORB_Core *orb_core,
+    ACE_Allocator *allocator
+  )
+  :TAO_Asynch_Reply_Dispatcher_Base (orb_core, allocator)
+  , reply_handler_stub_ (0)
+  , reply_handler_ ()
+  , timeout_handler_ (0)
+{
+}
+
 // Destructor.
 TAO_Asynch_Reply_Dispatcher::~TAO_Asynch_Reply_Dispatcher (void)
 {
@@ -82,63 +93,57 @@ TAO_Asynch_Reply_Dispatcher::dispatch_reply (TAO_Pluggable_Reply_Params &params)
       db->release ();
     }
 
-  if (!CORBA::is_nil (this->reply_handler_.in ()))
-    {
-      // Steal the buffer, that way we don't do any unnecessary copies of
-      // this data.
-      CORBA::ULong const max = params.svc_ctx_.maximum ();
-      CORBA::ULong const len = params.svc_ctx_.length ();
-      IOP::ServiceContext *context_list = params.svc_ctx_.get_buffer (1);
-      this->reply_service_info_.replace (max, len, context_list, 1);
+  // Steal the buffer, that way we don't do any unnecessary copies of
+  // this data.
+  CORBA::ULong const max = params.svc_ctx_.maximum ();
+  CORBA::ULong const len = params.svc_ctx_.length ();
+  IOP::ServiceContext *context_list = params.svc_ctx_.get_buffer (1);
+  this->reply_service_info_.replace (max, len, context_list, 1);
 
-      if (TAO_debug_level >= 4)
-        {
-          TAOLIB_DEBUG ((LM_DEBUG,
-                      ACE_TEXT ("TAO_Messaging (%P|%t) - Asynch_Reply_Dispatcher")
-                      ACE_TEXT ("::dispatch_reply status = %d\n"),
-                                this->reply_status_));
-        }
+  if (TAO_debug_level >= 4)
+    {
+      TAOLIB_DEBUG ((LM_DEBUG,
+                  ACE_TEXT ("TAO_Messaging (%P|%t) - Asynch_Reply_Dispatcher")
+                  ACE_TEXT ("::dispatch_reply status = %d\n"),
+                            this->reply_status_));
+    }
 
-      CORBA::ULong reply_error = TAO_AMI_REPLY_NOT_OK;
-      switch (this->reply_status_)
-        {
-        case GIOP::NO_EXCEPTION:
-          reply_error = TAO_AMI_REPLY_OK;
-          break;
-        case GIOP::USER_EXCEPTION:
-          reply_error = TAO_AMI_REPLY_USER_EXCEPTION;
-          break;
-        case GIOP::SYSTEM_EXCEPTION:
-          reply_error = TAO_AMI_REPLY_SYSTEM_EXCEPTION;
-          break;
-        case GIOP::LOCATION_FORWARD:
-          reply_error = TAO_AMI_REPLY_LOCATION_FORWARD;
-          break;
-        case GIOP::LOCATION_FORWARD_PERM:
-          reply_error = TAO_AMI_REPLY_LOCATION_FORWARD_PERM;
-          break;
-
-        default:
-          // @@ Michael: Not even the spec mentions this case.
-          //             We have to think about this case.
-          // Handle the forwarding and return so the stub restarts the
-          // request!
-          reply_error = TAO_AMI_REPLY_NOT_OK;
-          break;
-        }
+  CORBA::ULong reply_error = TAO_AMI_REPLY_NOT_OK;
+  switch (this->reply_status_)
+    {
+    case GIOP::NO_EXCEPTION:
+      reply_error = TAO_AMI_REPLY_OK;
+      break;
+    case GIOP::USER_EXCEPTION:
+      reply_error = TAO_AMI_REPLY_USER_EXCEPTION;
+      break;
+    case GIOP::SYSTEM_EXCEPTION:
+      reply_error = TAO_AMI_REPLY_SYSTEM_EXCEPTION;
+      break;
+    case GIOP::LOCATION_FORWARD:
+      reply_error = TAO_AMI_REPLY_LOCATION_FORWARD;
+      break;
+    case GIOP::LOCATION_FORWARD_PERM:
+      reply_error = TAO_AMI_REPLY_LOCATION_FORWARD_PERM;
+      break;
+
+    default:
+      // @@ Michael: Not even the spec mentions this case.
+      //             We have to think about this case.
+      // Handle the forwarding and return so the stub restarts the
+      // request!
+      reply_error = TAO_AMI_REPLY_NOT_OK;
+      break;
+    }
 
-      try
-        {
-          // Call the Reply Handler's stub.
-          this->reply_handler_stub_ (this->reply_cdr_,
-                                     this->reply_handler_.in (),
-                                     reply_error);
-        }
-      catch (const ::CORBA::Exception& ex)
-        {
-          if (TAO_debug_level >= 4)
-            ex._tao_print_exception ("Asynch_Reply_Dispatcher::dispatch_reply, exception during reply handler");
-        }
+  try
+    {
+      this->deliver_reply (this->reply_cdr_, reply_error);
+    }
+  catch (const ::CORBA::Exception& ex)
+    {
+      if (TAO_debug_level >= 4)
+        ex._tao_print_exception ("Asynch_Reply_Dispatcher::dispatch_reply, exception during reply handler");
     }
 
   this->intrusive_remove_ref (this);
@@ -163,22 +168,17 @@ TAO_Asynch_Reply_Dispatcher::connection_closed (void)
       if (!this->try_dispatch_reply ())
         return;
 
-      if (!CORBA::is_nil (this->reply_handler_.in ()))
-        {
-          // Generate a fake exception....
-          CORBA::COMM_FAILURE comm_failure (0, CORBA::COMPLETED_MAYBE);
+      // Generate a fake exception....
+      CORBA::COMM_FAILURE comm_failure (0, CORBA::COMPLETED_MAYBE);
 
-          TAO_OutputCDR out_cdr;
+      TAO_OutputCDR out_cdr;
 
-          comm_failure._tao_encode (out_cdr);
+      comm_failure._tao_encode (out_cdr);
 
-          // Turn into an output CDR
-          TAO_InputCDR cdr (out_cdr);
+      // Turn into an output CDR
+      TAO_InputCDR cdr (out_cdr);
 
-          this->reply_handler_stub_ (cdr,
-                                     this->reply_handler_.in (),
-                                     TAO_AMI_REPLY_SYSTEM_EXCEPTION);
-        }
+      this->deliver_reply (cdr, TAO_AMI_REPLY_SYSTEM_EXCEPTION);
     }
   catch (const ::CORBA::Exception& ex)
     {
@@ -222,26 +222,21 @@ TAO_Asynch_Reply_Dispatcher::reply_timed_out (void)
       if (!this->try_dispatch_reply ())
         return;
 
-      if (!CORBA::is_nil (this->reply_handler_.in ()))
-        {
-          // Generate a fake exception....
-          CORBA::TIMEOUT timeout_failure (
-            CORBA::SystemException::_tao_minor_code (
-                TAO_TIMEOUT_RECV_MINOR_CODE,
-                ETIME),
-             CORBA::COMPLETED_MAYBE);
+      // Generate a fake exception....
+      CORBA::TIMEOUT timeout_failure (
+        CORBA::SystemException::_tao_minor_code (
+            TAO_TIMEOUT_RECV_MINOR_CODE,
+            ETIME),
+         CORBA::COMPLETED_MAYBE);
 
-          TAO_OutputCDR out_cdr;
+      TAO_OutputCDR out_cdr;
 
-          timeout_failure._tao_encode (out_cdr);
+      timeout_failure._tao_encode (out_cdr);
 
-          // Turn into an output CDR
-          TAO_InputCDR cdr (out_cdr);
+      // Turn into an output CDR
+      TAO_InputCDR cdr (out_cdr);
 
-          this->reply_handler_stub_ (cdr,
-                                     this->reply_handler_.in (),
-                                     TAO_AMI_REPLY_SYSTEM_EXCEPTION);
-        }
+      this->deliver_reply (cdr, TAO_AMI_REPLY_SYSTEM_EXCEPTION);
     }
   catch (const ::CORBA::Exception& ex)
     {
@@ -254,6 +249,19 @@ TAO_Asynch_Reply_Dispatcher::reply_timed_out (void)
   this->intrusive_remove_ref (this);
 }
 
+void
+TAO_Asynch_Reply_Dispatcher::deliver_reply (TAO_InputCDR &cdr,
+                                            CORBA::ULong reply_status)
+{
+  if (!CORBA::is_nil (this->reply_handler_.in ()))
+    {
+      // Call the Reply Handler's stub.
+      this->reply_handler_stub_ (cdr,
+                                 this->reply_handler_.in (),
+                                 reply_status);
+    }
+}
+
 long
 TAO_Asynch_Reply_Dispatcher::schedule_timer (CORBA::ULong request_id,
                                              const ACE_Time_Value &max_wait_time)
@@ -58,6 +58,22 @@ public:
   long schedule_timer (CORBA::ULong request_id,
                        const ACE_Time_Value &max_wait_time);
 
+protected:
+  /// Constructor for the reply dispatchers that deliver the reply
+  /// themselves, without a Reply Handler.
+  TAO_Asynch_Reply_Dispatcher (TAO_ORB_Core *orb_core,
+                               ACE_Allocator *allocator);
+
+  /// Deliver the reply in @a cdr, or the exception it holds
+  /// depending on @a reply_status, to the Reply Handler.
+  /**
+   * Called once per request, when the reply arrives, the connection
+   * is closed or the request times out.  @a reply_status is one of
+   * the TAO_AMI_REPLY_* codes.
+   */
+  virtual void deliver_reply (TAO_InputCDR &cdr,
+                              CORBA::ULong reply_status);
+
 private:
   /// Stub for the call back method in the Reply Handler.
   TAO_Reply_Handler_Stub const reply_handler_stub_;
@@ -1068,6 +1068,14 @@ TAO_ORB_Core::init (int &argc, char *argv[] )
           this->orb_params ()->single_read_optimization
             (ACE_OS::atoi (current_arg));
 
+          arg_shifter.consume_arg ();
+        }
+      else if (0 != (current_arg = arg_shifter.get_the_parameter
+                (ACE_TEXT("-ORBGIOPFragmentChaining"))))
+        {
+          this->orb_params ()->giop_fragment_chaining
+            (ACE_OS::atoi (current_arg) != 0);
+
           arg_shifter.consume_arg ();
         }
       else if (0 != (current_arg = arg_shifter.get_the_parameter
@@ -27,6 +27,11 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 class TAO_ORB_Core;
 
+namespace TAO
+{
+  class Batch_Scope;
+}
+
 /**
  * @class TAO_ORB_Core_TSS_Resources
  *
@@ -80,6 +85,10 @@ public:
   // @CJC@  maybe we should use allocate_tss_slot_id() instead?
   bool upcalls_temporarily_suspended_on_this_thread_;
 
+  /// The innermost TAO::Batch_Scope of this thread, 0 if its requests
+  /// are not batched.
+  TAO::Batch_Scope *batch_scope_;
+
   /// Pointer to the ORB core.  Needed to get access to the TSS
   /// cleanup functions for the TSS objects stored in the TSS object
   /// array in this class.
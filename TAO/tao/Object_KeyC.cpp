@@ -215,7 +215,8 @@ TAO::ObjectKey::demarshal_key (TAO::ObjectKey &key,
       // Retrieve all the elements.
 #if (TAO_NO_COPY_OCTET_SEQUENCES == 1)
       if (ACE_BIT_DISABLED (strm.start ()->flags (),
-      ACE_Message_Block::DONT_DELETE))
+      ACE_Message_Block::DONT_DELETE)
+          && strm.start ()->cont () == 0)
       {
         key.replace (_tao_seq_len, strm.start ());
         key.mb ()->wr_ptr (key.mb()->rd_ptr () + _tao_seq_len);
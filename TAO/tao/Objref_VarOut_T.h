@@ -50,10 +50,16 @@ public:
   TAO_Objref_Var_T (void);
   TAO_Objref_Var_T (T * p) : ptr_ (p) {}
   TAO_Objref_Var_T (const TAO_Objref_Var_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  TAO_Objref_Var_T (TAO_Objref_Var_T<T> &&);
+#endif /* ACE_HAS_CPP11 */
   ~TAO_Objref_Var_T (void);
 
   TAO_Objref_Var_T<T> & operator= (T *);
   TAO_Objref_Var_T<T> & operator= (const TAO_Objref_Var_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  TAO_Objref_Var_T<T> & operator= (TAO_Objref_Var_T<T> &&);
+#endif /* ACE_HAS_CPP11 */
   T * operator-> (void) const;
 
   /// Cast operators.
@@ -8,6 +8,32 @@ TAO_Objref_Var_T<T>::TAO_Objref_Var_T (void)
 {
 }
 
+#if defined (ACE_HAS_CPP11)
+template <typename T>
+ACE_INLINE
+TAO_Objref_Var_T<T>::TAO_Objref_Var_T (TAO_Objref_Var_T<T> && p)
+  : TAO_Base_var (),
+    ptr_ (p.ptr_)
+{
+  p.ptr_ = TAO::Objref_Traits<T>::nil ();
+}
+
+template <typename T>
+ACE_INLINE
+TAO_Objref_Var_T<T> &
+TAO_Objref_Var_T<T>::operator= (TAO_Objref_Var_T<T> && p)
+{
+  if (this != &p)
+    {
+      TAO::Objref_Traits<T>::release (this->ptr_);
+      this->ptr_ = p.ptr_;
+      p.ptr_ = TAO::Objref_Traits<T>::nil ();
+    }
+
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template <typename T>
 ACE_INLINE
 TAO_Objref_Var_T<T>::~TAO_Objref_Var_T (void)
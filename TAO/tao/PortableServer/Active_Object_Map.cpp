@@ -1,5 +1,6 @@
 #include "tao/PortableServer/Active_Object_Map.h"
 #include "tao/PortableServer/Active_Object_Map_Entry.h"
+#include "tao/PortableServer/Indexed_Id_Map.h"
 
 #if !defined (__ACE_INLINE__)
 # include "tao/PortableServer/Active_Object_Map.inl"
@@ -36,6 +37,11 @@ void
 TAO_Active_Object_Map::set_system_id_size (
   const TAO_Server_Strategy_Factory::Active_Object_Map_Creation_Parameters &creation_parameters)
 {
+  // The size is only used to find the end of the POA name in the
+  // object keys of the PERSISTENT/SYSTEM_ID POAs, the POA names of
+  // the TRANSIENT POAs have a fixed size.  With the indexed strategy
+  // only the TRANSIENT POAs use TAO_Indexed_Id_Map, the PERSISTENT
+  // ones keep the maps, and the id sizes, of the default strategy.
   if (TAO_Active_Object_Map::system_id_size_ == 0)
     {
       if (creation_parameters.allow_reactivation_of_system_ids_)
@@ -48,6 +54,7 @@ TAO_Active_Object_Map::set_system_id_size (
               break;
 #endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
 
+            case TAO_INDEXED_DEMUX:
             case TAO_DYNAMIC_HASH:
             default:
               TAO_Active_Object_Map::system_id_size_ = sizeof (CORBA::ULong);
@@ -75,6 +82,7 @@ TAO_Active_Object_Map::set_system_id_size (
               break;
 #endif /* TAO_HAS_MINIMUM_POA_MAPS == 0 */
 
+            case TAO_INDEXED_DEMUX:
             case TAO_ACTIVE_DEMUX:
             default:
               TAO_Active_Object_Map::system_id_size_ =
@@ -91,7 +99,8 @@ TAO_Active_Object_Map::TAO_Active_Object_Map (
     int persistent_id_policy,
     const TAO_Server_Strategy_Factory::Active_Object_Map_Creation_Parameters &
       creation_parameters)
-  : using_active_maps_ (false)
+  : using_active_maps_ (false),
+    generation_ (0)
 {
   TAO_Active_Object_Map::set_system_id_size (creation_parameters);
 
@@ -189,9 +198,18 @@ TAO_Active_Object_Map::TAO_Active_Object_Map (
   auto_ptr<TAO_Id_Assignment_Strategy> new_id_assignment_strategy (id_assignment_strategy);
 #endif /* ACE_HAS_CPP11 */
 
+  // The indexed ids of the transient POAs are hints already, and
+  // they cannot be reactivated in a later instantiation of the POA.
+  bool const indexed_ids =
+    !user_id_policy
+    && !persistent_id_policy
+    && creation_parameters.object_lookup_strategy_for_system_id_policy_ ==
+         TAO_INDEXED_DEMUX;
+
   TAO_Id_Hint_Strategy *id_hint_strategy = 0;
-  if ((user_id_policy
-       || creation_parameters.allow_reactivation_of_system_ids_)
+  if (!indexed_ids
+      && (user_id_policy
+          || creation_parameters.allow_reactivation_of_system_ids_)
       && creation_parameters.use_active_hint_in_ids_)
     {
       this->using_active_maps_ = true;
@@ -254,8 +272,17 @@ TAO_Active_Object_Map::TAO_Active_Object_Map (
 #endif /* ACE_HAS_CPP11 */
 
   user_id_map *uim = 0;
-  if (user_id_policy
-      || creation_parameters.allow_reactivation_of_system_ids_)
+  if (indexed_ids)
+    {
+      this->using_active_maps_ = true;
+
+      ACE_NEW_THROW_EX (uim,
+                        TAO_Indexed_Id_Map (
+                          creation_parameters.active_object_map_size_),
+                        CORBA::NO_MEMORY ());
+    }
+  else if (user_id_policy
+           || creation_parameters.allow_reactivation_of_system_ids_)
     {
       switch (creation_parameters.object_lookup_strategy_for_user_id_policy_)
         {
@@ -181,6 +181,11 @@ public:
   size_t
   current_size (void);
 
+  /// Incremented every time an entry is bound or unbound, the
+  /// entries found before are only valid while it does not change.
+  unsigned long
+  generation (void) const;
+
   /// Can be used with any policy.
   static size_t
   system_id_size (void);
@@ -282,6 +287,9 @@ public:
   /// map.
   bool using_active_maps_;
 
+  /// Number of times an entry was bound or unbound.
+  unsigned long generation_;
+
   /// Size of the system id produced by the map.
   static size_t system_id_size_;
 
@@ -17,6 +17,8 @@ TAO_Active_Object_Map::bind_using_system_id_returning_system_id (
   CORBA::Short priority,
   PortableServer::ObjectId_out system_id)
 {
+  ++this->generation_;
+
   if (servant == 0 && !this->using_active_maps_)
     {
       PortableServer::ObjectId id;
@@ -55,6 +57,8 @@ TAO_Active_Object_Map::bind_using_system_id_returning_user_id (
   CORBA::Short priority,
   PortableServer::ObjectId_out user_id)
 {
+  ++this->generation_;
+
   TAO_Active_Object_Map_Entry *entry = 0;
 
   int result =
@@ -74,6 +78,8 @@ TAO_Active_Object_Map::bind_using_user_id (
   const PortableServer::ObjectId &user_id,
   CORBA::Short priority)
 {
+  ++this->generation_;
+
   TAO_Active_Object_Map_Entry *entry = 0;
   return this->id_uniqueness_strategy_->bind_using_user_id (servant,
                                                             user_id,
@@ -96,6 +102,8 @@ TAO_Active_Object_Map::find_system_id_using_user_id (
       return 0;
     }
 
+  ++this->generation_;
+
   TAO_Active_Object_Map_Entry *entry = 0;
   int result =
     this->id_uniqueness_strategy_->bind_using_user_id (0,
@@ -118,6 +126,8 @@ TAO_Active_Object_Map::rebind_using_user_id_and_system_id (
   const PortableServer::ObjectId &,
   TAO_Active_Object_Map_Entry *&entry)
 {
+  ++this->generation_;
+
   return this->id_uniqueness_strategy_->bind_using_user_id (servant,
                                                             user_id,
                                                             -1,
@@ -128,6 +138,8 @@ ACE_INLINE int
 TAO_Active_Object_Map::unbind_using_user_id (
   const PortableServer::ObjectId &user_id)
 {
+  ++this->generation_;
+
   return this->id_uniqueness_strategy_->unbind_using_user_id (user_id);
 }
 
@@ -287,4 +299,10 @@ TAO_Active_Object_Map::system_id_size (void)
   return TAO_Active_Object_Map::system_id_size_;
 }
 
+ACE_INLINE unsigned long
+TAO_Active_Object_Map::generation (void) const
+{
+  return this->generation_;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -15,6 +15,10 @@
 #include /**/ "ace/pre.h"
 
 #include "tao/PortableServer/PS_ForwardC.h"
+#include "tao/orbconf.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Synch_Traits.h"
+#include "ace/Thread_Mutex.h"
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 # pragma once
@@ -46,8 +50,10 @@ struct TAO_Active_Object_Map_Entry
   /// Servant.
   PortableServer::Servant servant_;
 
-  /// Reference count on outstanding requests on this servant.
-  CORBA::UShort reference_count_;
+  /// Reference count on outstanding requests on this servant.  The
+  /// upcalls that find the servant without the Object Adapter lock
+  /// change it concurrently.
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, CORBA::UShort> reference_count_;
 
   /// Has this servant been deactivated already?
   CORBA::Boolean deactivated_;
@@ -0,0 +1,53 @@
+#include "tao/PortableServer/Arena_Demarshal.h"
+#include "tao/CORBA_String.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+CORBA::Boolean
+TAO::Portable_Server::read_arena_string (TAO_InputCDR &cdr,
+                                         Upcall_Arena &arena,
+                                         CORBA::Char *&x)
+{
+  CORBA::ULong length = 0;
+  if (!cdr.read_ulong (length) || length > cdr.length ())
+    {
+      return false;
+    }
+
+  x = static_cast<CORBA::Char *> (arena.allocate (length == 0 ? 1 : length));
+
+  // Null strings are read as empty strings, as the stream reads
+  // them.
+  if (length == 0)
+    {
+      x[0] = '\0';
+      return true;
+    }
+
+  return cdr.read_char_array (x, length);
+}
+
+CORBA::Boolean
+TAO::Portable_Server::demarshal_in_string (TAO_InputCDR &cdr,
+                                           CORBA::String_var &x,
+                                           const CORBA::Char *&value)
+{
+  Upcall_Arena * const arena = Upcall_Arena::current ();
+  if (arena == 0 || cdr.char_translator () != 0)
+    {
+      CORBA::Boolean const result = cdr >> x.out ();
+      value = x.in ();
+      return result;
+    }
+
+  CORBA::Char *buffer = 0;
+  if (!read_arena_string (cdr, *arena, buffer))
+    {
+      return false;
+    }
+
+  value = buffer;
+  return true;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
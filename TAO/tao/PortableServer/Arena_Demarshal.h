@@ -0,0 +1,293 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Arena_Demarshal.h
+ *
+ *  Demarshaling of skeleton in arguments into the upcall arena.
+ */
+//=============================================================================
+
+#ifndef TAO_ARENA_DEMARSHAL_H
+#define TAO_ARENA_DEMARSHAL_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/PortableServer/portableserver_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Upcall_Arena.h"
+#include "tao/CDR.h"
+#include "tao/CORBA_String.h"
+#include "tao/Sequence_T.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace Portable_Server
+  {
+    /// Read a string of the stream into @a arena.
+    TAO_PortableServer_Export CORBA::Boolean
+    read_arena_string (TAO_InputCDR &cdr,
+                       Upcall_Arena &arena,
+                       CORBA::Char *&x);
+
+    /// Demarshal an in string, into the upcall arena when there is
+    /// one, otherwise into @a x.  @a value points at the string.
+    TAO_PortableServer_Export CORBA::Boolean
+    demarshal_in_string (TAO_InputCDR &cdr,
+                         CORBA::String_var &x,
+                         const CORBA::Char *&value);
+
+    /// Wide strings are demarshaled into @a x, the code set
+    /// translators decide their length.
+    template<typename S, typename S_var>
+    CORBA::Boolean
+    demarshal_in_string (TAO_InputCDR &cdr, S_var &x, const S *&value)
+    {
+      CORBA::Boolean const result = cdr >> x.out ();
+      value = x.in ();
+      return result;
+    }
+
+    /// Demarshal the buffer of an in sequence into the upcall arena,
+    /// reading the elements with the array operation @a read.
+    template<typename S, typename T>
+    CORBA::Boolean
+    demarshal_in_array (TAO_InputCDR &cdr,
+                        S &x,
+                        ACE_CDR::Boolean (ACE_InputCDR::*read) (
+                          T *, ACE_CDR::ULong))
+    {
+      Upcall_Arena * const arena = Upcall_Arena::current ();
+      if (arena == 0)
+        {
+          return cdr >> x;
+        }
+
+      CORBA::ULong length = 0;
+      if (!(cdr >> length))
+        {
+          return false;
+        }
+
+      if (length > cdr.length ())
+        {
+          return false;
+        }
+
+      if (length == 0)
+        {
+          x.length (0);
+          return true;
+        }
+
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+      if (TAO::details::demarshal_sequence_in_place (cdr, length, x))
+        {
+          return true;
+        }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
+      T * const buffer =
+        static_cast<T *> (arena->allocate (length * sizeof (T)));
+      x.replace (length, length, buffer, false);
+      return (cdr.*read) (buffer, length);
+    }
+
+    /**
+     * @struct In_Sequence_Demarshal
+     *
+     * @brief Demarshals an in sequence of T.
+     *
+     * Only the sequences of the types the stream reads as one array
+     * get their buffer from the upcall arena, the others are
+     * demarshaled as usual.
+     */
+    template<typename T>
+    struct In_Sequence_Demarshal
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return cdr >> x;
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::Boolean>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_boolean_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::Short>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_short_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::UShort>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_ushort_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::Long>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_long_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::ULong>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_ulong_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::LongLong>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_longlong_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::ULongLong>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_ulonglong_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::Float>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_float_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::Double>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_double_array);
+      }
+    };
+
+    template<>
+    struct In_Sequence_Demarshal<CORBA::LongDouble>
+    {
+      template<typename S>
+      static CORBA::Boolean demarshal (TAO_InputCDR &cdr, S &x)
+      {
+        return demarshal_in_array (cdr, x, &ACE_InputCDR::read_longdouble_array);
+      }
+    };
+
+    /// Demarshal an in argument of a variable size type.
+    template<typename S>
+    CORBA::Boolean
+    demarshal_in_argument (TAO_InputCDR &cdr, S &x, const void *)
+    {
+      return cdr >> x;
+    }
+
+    /// Demarshal an in unbounded sequence.
+    template<typename S, typename T>
+    CORBA::Boolean
+    demarshal_in_argument (TAO_InputCDR &cdr,
+                           S &x,
+                           const TAO::unbounded_value_sequence<T> *)
+    {
+      return In_Sequence_Demarshal<T>::demarshal (cdr, x);
+    }
+
+    /// Demarshal an in unbounded sequence of strings, the buffer and
+    /// the strings into the upcall arena.
+    template<typename S>
+    CORBA::Boolean
+    demarshal_in_argument (
+      TAO_InputCDR &cdr,
+      S &x,
+      const TAO::unbounded_basic_string_sequence<CORBA::Char> *)
+    {
+      Upcall_Arena * const arena = Upcall_Arena::current ();
+      if (arena == 0 || cdr.char_translator () != 0)
+        {
+          return cdr >> x;
+        }
+
+      CORBA::ULong length = 0;
+      if (!(cdr >> length))
+        {
+          return false;
+        }
+
+      if (length > cdr.length ())
+        {
+          return false;
+        }
+
+      if (length == 0)
+        {
+          x.length (0);
+          return true;
+        }
+
+      CORBA::Char ** const buffer =
+        static_cast<CORBA::Char **> (
+          arena->allocate (length * sizeof (CORBA::Char *)));
+
+      for (CORBA::ULong i = 0; i != length; ++i)
+        {
+          if (!read_arena_string (cdr, *arena, buffer[i]))
+            {
+              return false;
+            }
+        }
+
+      x.replace (length, length, buffer, false);
+      return true;
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_ARENA_DEMARSHAL_H */
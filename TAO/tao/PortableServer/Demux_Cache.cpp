@@ -0,0 +1,87 @@
+#include "tao/PortableServer/Demux_Cache.h"
+#include "tao/PortableServer/Root_POA.h"
+
+#if !defined (__ACE_INLINE__)
+# include "tao/PortableServer/Demux_Cache.inl"
+#endif /* __ACE_INLINE__ */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace Portable_Server
+  {
+    Demux_Cache::Demux_Cache (TAO_SYNCH_MUTEX *lock)
+      : lock_ (lock),
+        poa_ (0),
+        map_ (0),
+        entry_ (0),
+        adapter_generation_ (0),
+        map_generation_ (0)
+    {
+    }
+
+    void
+    Demux_Cache::update (const TAO::ObjectKey &key,
+                         unsigned long adapter_generation,
+                         const PortableServer::ObjectId &system_id,
+                         ::TAO_Root_POA *poa,
+                         TAO_Active_Object_Map_Entry *entry)
+    {
+      if (this->lock_ == 0)
+        {
+          this->update_i (key, adapter_generation, system_id, poa, entry);
+          return;
+        }
+
+      ACE_GUARD (TAO_SYNCH_MUTEX, guard, *this->lock_);
+      this->update_i (key, adapter_generation, system_id, poa, entry);
+    }
+
+    void
+    Demux_Cache::update_i (const TAO::ObjectKey &key,
+                           unsigned long adapter_generation,
+                           const PortableServer::ObjectId &system_id,
+                           ::TAO_Root_POA *poa,
+                           TAO_Active_Object_Map_Entry *entry)
+    {
+      TAO_Active_Object_Map *map = poa->get_active_object_map ();
+      if (map == 0)
+        {
+          this->entry_ = 0;
+          return;
+        }
+
+      // Reuse the buffers, the keys of a server have similar sizes.
+      this->key_.length (key.length ());
+      ACE_OS::memcpy (this->key_.get_buffer (),
+                      key.get_buffer (),
+                      key.length ());
+
+      this->system_id_.length (system_id.length ());
+      ACE_OS::memcpy (this->system_id_.get_buffer (),
+                      system_id.get_buffer (),
+                      system_id.length ());
+
+      this->poa_ = poa;
+      this->map_ = map;
+      this->entry_ = entry;
+      this->adapter_generation_ = adapter_generation;
+      this->map_generation_ = map->generation ();
+    }
+
+    Collocated_Demux_Cache::Collocated_Demux_Cache (
+      TAO_Object_Adapter *adapter)
+      : adapter_ (adapter),
+        lock_ (),
+        cache_ (&lock_)
+    {
+    }
+
+    Collocated_Demux_Cache::~Collocated_Demux_Cache (void)
+    {
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,158 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Demux_Cache.h
+ *
+ *  The last target of the upcalls of a thread.
+ */
+//=============================================================================
+
+#ifndef TAO_DEMUX_CACHE_H
+#define TAO_DEMUX_CACHE_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/PortableServer/portableserver_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/PortableServer/PS_ForwardC.h"
+#include "tao/Object_KeyC.h"
+#include "tao/Adapter.h"
+#include "tao/orbconf.h"
+
+#include "ace/Thread_Mutex.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_Root_POA;
+class TAO_Object_Adapter;
+class TAO_Active_Object_Map;
+struct TAO_Active_Object_Map_Entry;
+
+namespace TAO
+{
+  namespace Portable_Server
+  {
+    /**
+     * @class Demux_Cache
+     *
+     * @brief The last target of the upcalls of a thread.
+     *
+     * Clients tend to make many requests on the same object in a row.
+     * The cache remembers the object key of the last request of the
+     * thread, with the POA and the active object map entry it was
+     * demultiplexed to, so the next request with the same key skips
+     * parsing the key, finding the POA and finding the servant.
+     *
+     * The pointers are only used while the generations of the Object
+     * Adapter and of the active object map of the POA did not change:
+     * a POA cannot be unbound and an entry cannot be bound or
+     * unbound without invalidating them.  The cache must be used
+     * within a read section of the Object Adapter lock.
+     *
+     * A cache shared by several threads is given a @a lock that
+     * serializes find() and update().
+     */
+    class TAO_PortableServer_Export Demux_Cache
+    {
+    public:
+      explicit Demux_Cache (TAO_SYNCH_MUTEX *lock = 0);
+
+      /// Return the entry of the last target if @a key is its object
+      /// key and nothing was bound or unbound since.  Set @a poa and
+      /// @a system_id to the ones of the target.
+      TAO_Active_Object_Map_Entry *find (const TAO::ObjectKey &key,
+                                         unsigned long adapter_generation,
+                                         PortableServer::ObjectId &system_id,
+                                         ::TAO_Root_POA *&poa) const;
+
+      /// Remember the target of @a key.
+      void update (const TAO::ObjectKey &key,
+                   unsigned long adapter_generation,
+                   const PortableServer::ObjectId &system_id,
+                   ::TAO_Root_POA *poa,
+                   TAO_Active_Object_Map_Entry *entry);
+
+    private:
+      TAO_Active_Object_Map_Entry *find_i (const TAO::ObjectKey &key,
+                                           unsigned long adapter_generation,
+                                           PortableServer::ObjectId &system_id,
+                                           ::TAO_Root_POA *&poa) const;
+
+      void update_i (const TAO::ObjectKey &key,
+                     unsigned long adapter_generation,
+                     const PortableServer::ObjectId &system_id,
+                     ::TAO_Root_POA *poa,
+                     TAO_Active_Object_Map_Entry *entry);
+
+      Demux_Cache (const Demux_Cache &);
+      void operator= (const Demux_Cache &);
+
+    private:
+      /// Zero unless the cache is shared.
+      TAO_SYNCH_MUTEX *lock_;
+
+      /// The object key of the last target.
+      TAO::ObjectKey key_;
+
+      /// The system id of the last target.
+      PortableServer::ObjectId system_id_;
+
+      ::TAO_Root_POA *poa_;
+
+      TAO_Active_Object_Map *map_;
+
+      TAO_Active_Object_Map_Entry *entry_;
+
+      /// The generations of the Object Adapter and of the map when the
+      /// target was found.
+      unsigned long adapter_generation_;
+      unsigned long map_generation_;
+    };
+
+    /**
+     * @class Collocated_Demux_Cache
+     *
+     * @brief The target of the collocated requests on a stub.
+     *
+     * Attached by the Object Adapter to the collocated object
+     * references, it lets the thru-POA collocated requests on a stub
+     * skip the request dispatcher and the demultiplexing of their
+     * object key, whichever thread makes them.
+     */
+    class TAO_PortableServer_Export Collocated_Demux_Cache
+      : public ::TAO::Collocation_Cache
+    {
+    public:
+      explicit Collocated_Demux_Cache (TAO_Object_Adapter *adapter);
+
+      virtual ~Collocated_Demux_Cache (void);
+
+      /// The Object Adapter the cached pointers belong to.
+      TAO_Object_Adapter *adapter (void) const;
+
+      Demux_Cache &cache (void);
+
+    private:
+      TAO_Object_Adapter * const adapter_;
+
+      TAO_SYNCH_MUTEX lock_;
+
+      Demux_Cache cache_;
+    };
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+# include "tao/PortableServer/Demux_Cache.inl"
+#endif /* __ACE_INLINE__ */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_DEMUX_CACHE_H */
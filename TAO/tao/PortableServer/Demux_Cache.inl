@@ -0,0 +1,65 @@
+// -*- C++ -*-
+#include "tao/PortableServer/Active_Object_Map.h"
+#include "ace/OS_NS_string.h"
+#include "ace/Guard_T.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace Portable_Server
+  {
+    ACE_INLINE TAO_Active_Object_Map_Entry *
+    Demux_Cache::find (const TAO::ObjectKey &key,
+                       unsigned long adapter_generation,
+                       PortableServer::ObjectId &system_id,
+                       ::TAO_Root_POA *&poa) const
+    {
+      if (this->lock_ == 0)
+        return this->find_i (key, adapter_generation, system_id, poa);
+
+      ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, guard, *this->lock_, 0);
+      return this->find_i (key, adapter_generation, system_id, poa);
+    }
+
+    ACE_INLINE TAO_Active_Object_Map_Entry *
+    Demux_Cache::find_i (const TAO::ObjectKey &key,
+                         unsigned long adapter_generation,
+                         PortableServer::ObjectId &system_id,
+                         ::TAO_Root_POA *&poa) const
+    {
+      // Check the Object Adapter first, the map is gone with its POA.
+      if (this->entry_ == 0
+          || this->adapter_generation_ != adapter_generation
+          || this->map_generation_ != this->map_->generation ()
+          || this->key_.length () != key.length ()
+          || ACE_OS::memcmp (this->key_.get_buffer (),
+                             key.get_buffer (),
+                             key.length ()) != 0)
+        return 0;
+
+      CORBA::ULong const id_size = this->system_id_.length ();
+      system_id.length (id_size);
+      ACE_OS::memcpy (system_id.get_buffer (),
+                      this->system_id_.get_buffer (),
+                      id_size);
+
+      poa = this->poa_;
+      return this->entry_;
+    }
+
+    ACE_INLINE TAO_Object_Adapter *
+    Collocated_Demux_Cache::adapter (void) const
+    {
+      return this->adapter_;
+    }
+
+    ACE_INLINE Demux_Cache &
+    Collocated_Demux_Cache::cache (void)
+    {
+      return this->cache_;
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
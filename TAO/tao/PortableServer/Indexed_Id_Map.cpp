@@ -0,0 +1,411 @@
+// -*- C++ -*-
+#include "tao/PortableServer/Indexed_Id_Map.h"
+#include "tao/debug.h"
+#include "tao/Basic_Types.h"
+
+#if !defined (__ACE_INLINE__)
+# include "tao/PortableServer/Indexed_Id_Map.inl"
+#endif /* __ACE_INLINE__ */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// End of the free list.
+  CORBA::ULong const nil_slot = ~static_cast<CORBA::ULong> (0);
+}
+
+TAO_Indexed_Id_Map::TAO_Indexed_Id_Map (size_t size)
+  : slots_ (size),
+    used_ (0),
+    free_list_ (nil_slot),
+    current_size_ (0)
+{
+}
+
+TAO_Indexed_Id_Map::~TAO_Indexed_Id_Map (void)
+{
+}
+
+int
+TAO_Indexed_Id_Map::open (size_t length,
+                          ACE_Allocator *)
+{
+  this->close ();
+
+  if (length > this->slots_.size ())
+    return this->slots_.size (length);
+
+  return 0;
+}
+
+int
+TAO_Indexed_Id_Map::close (void)
+{
+  for (CORBA::ULong i = 0; i != this->used_; ++i)
+    this->slots_[i] = Slot ();
+
+  this->used_ = 0;
+  this->free_list_ = nil_slot;
+  this->current_size_ = 0;
+
+  return 0;
+}
+
+int
+TAO_Indexed_Id_Map::allocate (CORBA::ULong &index)
+{
+  while (this->free_list_ != nil_slot)
+    {
+      Slot &slot = this->slots_[this->free_list_];
+      index = this->free_list_;
+      this->free_list_ = slot.next_free_;
+      slot.free_listed_ = false;
+
+      // bind() may have reused the slot since it was released.
+      if (slot.value_ == 0)
+        return 0;
+    }
+
+  if (this->used_ == this->slots_.size ())
+    {
+      size_t const size = this->used_ == 0
+        ? static_cast<size_t> (ACE_DEFAULT_MAP_SIZE)
+        : 2 * static_cast<size_t> (this->used_);
+
+      if (size >= nil_slot || this->slots_.size (size) != 0)
+        return -1;
+    }
+
+  index = this->used_++;
+  return 0;
+}
+
+void
+TAO_Indexed_Id_Map::release (CORBA::ULong index)
+{
+  Slot &slot = this->slots_[index];
+  if (!slot.free_listed_)
+    {
+      slot.next_free_ = this->free_list_;
+      slot.free_listed_ = true;
+      this->free_list_ = index;
+    }
+}
+
+int
+TAO_Indexed_Id_Map::bind (const KEY &key,
+                          const VALUE &value)
+{
+  CORBA::ULong index = 0;
+  CORBA::ULong generation = 0;
+
+  // Only the keys created by this map can be bound again.
+  if (this->decode (key, index, generation) != 0
+      || index >= this->used_
+      || generation == 0
+      || generation > this->slots_[index].last_generation_)
+    return -1;
+
+  Slot &slot = this->slots_[index];
+  if (slot.value_ != 0)
+    return slot.generation_ == generation ? 1 : -1;
+
+  // The slot stays in the free list, allocate() skips it.
+  slot.value_ = value;
+  slot.generation_ = generation;
+  ++this->current_size_;
+
+  return 0;
+}
+
+int
+TAO_Indexed_Id_Map::bind_modify_key (const VALUE &,
+                                     KEY &)
+{
+  ACE_NOTSUP_RETURN (-1);
+}
+
+int
+TAO_Indexed_Id_Map::create_key (KEY &)
+{
+  ACE_NOTSUP_RETURN (-1);
+}
+
+int
+TAO_Indexed_Id_Map::bind_create_key (const VALUE &value,
+                                     KEY &key)
+{
+  CORBA::ULong index = 0;
+  if (this->allocate (index) != 0)
+    return -1;
+
+  Slot &slot = this->slots_[index];
+  slot.value_ = value;
+  slot.generation_ = ++slot.last_generation_;
+  ++this->current_size_;
+
+  TAO_Indexed_Id_Map::encode (index, slot.generation_, key);
+
+  return 0;
+}
+
+int
+TAO_Indexed_Id_Map::bind_create_key (const VALUE &value)
+{
+  KEY key;
+  return this->bind_create_key (value, key);
+}
+
+int
+TAO_Indexed_Id_Map::recover_key (const KEY &modified_key,
+                                 KEY &original_key)
+{
+  // The keys are not modified, do not copy them.
+  original_key.replace (modified_key.maximum (),
+                        modified_key.length (),
+                        const_cast<CORBA::Octet *> (modified_key.get_buffer ()),
+                        0);
+  return 0;
+}
+
+int
+TAO_Indexed_Id_Map::rebind (const KEY &,
+                            const VALUE &)
+{
+  ACE_NOTSUP_RETURN (-1);
+}
+
+int
+TAO_Indexed_Id_Map::rebind (const KEY &,
+                            const VALUE &,
+                            VALUE &)
+{
+  ACE_NOTSUP_RETURN (-1);
+}
+
+int
+TAO_Indexed_Id_Map::rebind (const KEY &,
+                            const VALUE &,
+                            KEY &,
+                            VALUE &)
+{
+  ACE_NOTSUP_RETURN (-1);
+}
+
+int
+TAO_Indexed_Id_Map::trybind (const KEY &,
+                             VALUE &)
+{
+  ACE_NOTSUP_RETURN (-1);
+}
+
+int
+TAO_Indexed_Id_Map::unbind (const KEY &key)
+{
+  VALUE value = 0;
+  return this->unbind (key, value);
+}
+
+int
+TAO_Indexed_Id_Map::unbind (const KEY &key,
+                            VALUE &value)
+{
+  Slot *slot = this->find_slot (key);
+  if (slot == 0)
+    return -1;
+
+  value = slot->value_;
+  slot->value_ = 0;
+  --this->current_size_;
+
+  this->release (static_cast<CORBA::ULong> (slot - &this->slots_[0]));
+
+  return 0;
+}
+
+void
+TAO_Indexed_Id_Map::dump (void) const
+{
+#if defined (ACE_HAS_DUMP)
+  TAOLIB_DEBUG ((LM_DEBUG,
+                 "TAO_Indexed_Id_Map: %B entries in %u of %B slots\n",
+                 this->current_size_,
+                 this->used_,
+                 this->slots_.size ()));
+#endif /* ACE_HAS_DUMP */
+}
+
+ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *
+TAO_Indexed_Id_Map::begin_impl (void)
+{
+  ACE_Iterator_Impl<value_type> *temp = 0;
+  ACE_NEW_RETURN (temp,
+                  TAO_Indexed_Id_Map_Iterator (*this, 0),
+                  0);
+  return temp;
+}
+
+ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *
+TAO_Indexed_Id_Map::end_impl (void)
+{
+  ACE_Iterator_Impl<value_type> *temp = 0;
+  ACE_NEW_RETURN (temp,
+                  TAO_Indexed_Id_Map_Iterator (*this, this->used_),
+                  0);
+  return temp;
+}
+
+ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *
+TAO_Indexed_Id_Map::rbegin_impl (void)
+{
+  ACE_Reverse_Iterator_Impl<value_type> *temp = 0;
+  ACE_NEW_RETURN (temp,
+                  TAO_Indexed_Id_Map_Reverse_Iterator (*this, this->used_),
+                  0);
+  return temp;
+}
+
+ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *
+TAO_Indexed_Id_Map::rend_impl (void)
+{
+  ACE_Reverse_Iterator_Impl<value_type> *temp = 0;
+  ACE_NEW_RETURN (temp,
+                  TAO_Indexed_Id_Map_Reverse_Iterator (*this, 0),
+                  0);
+  return temp;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TAO_Indexed_Id_Map_Iterator::TAO_Indexed_Id_Map_Iterator (
+    TAO_Indexed_Id_Map &map,
+    CORBA::ULong index)
+  : map_ (map),
+    index_ (index)
+{
+  while (this->index_ < this->map_.used_
+         && this->map_.slots_[this->index_].value_ == 0)
+    ++this->index_;
+}
+
+TAO_Indexed_Id_Map_Iterator::~TAO_Indexed_Id_Map_Iterator (void)
+{
+}
+
+ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *
+TAO_Indexed_Id_Map_Iterator::clone (void) const
+{
+  ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *temp = 0;
+  ACE_NEW_RETURN (temp,
+                  TAO_Indexed_Id_Map_Iterator (this->map_, this->index_),
+                  0);
+  return temp;
+}
+
+int
+TAO_Indexed_Id_Map_Iterator::compare (
+    const ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type> &rhs) const
+{
+  const TAO_Indexed_Id_Map_Iterator &rhs_local =
+    dynamic_cast<const TAO_Indexed_Id_Map_Iterator &> (rhs);
+
+  return &this->map_ == &rhs_local.map_ && this->index_ == rhs_local.index_;
+}
+
+TAO_Indexed_Id_Map::value_type
+TAO_Indexed_Id_Map_Iterator::dereference (void) const
+{
+  TAO_Indexed_Id_Map::Slot &slot = this->map_.slots_[this->index_];
+  TAO_Indexed_Id_Map::encode (this->index_, slot.generation_, this->key_);
+  return TAO_Indexed_Id_Map::value_type (this->key_, slot.value_);
+}
+
+void
+TAO_Indexed_Id_Map_Iterator::plus_plus (void)
+{
+  do
+    ++this->index_;
+  while (this->index_ < this->map_.used_
+         && this->map_.slots_[this->index_].value_ == 0);
+}
+
+void
+TAO_Indexed_Id_Map_Iterator::minus_minus (void)
+{
+  while (this->index_ != 0)
+    {
+      --this->index_;
+      if (this->map_.slots_[this->index_].value_ != 0)
+        break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TAO_Indexed_Id_Map_Reverse_Iterator::TAO_Indexed_Id_Map_Reverse_Iterator (
+    TAO_Indexed_Id_Map &map,
+    CORBA::ULong index)
+  : map_ (map),
+    index_ (index)
+{
+  while (this->index_ != 0
+         && this->map_.slots_[this->index_ - 1].value_ == 0)
+    --this->index_;
+}
+
+TAO_Indexed_Id_Map_Reverse_Iterator::~TAO_Indexed_Id_Map_Reverse_Iterator (void)
+{
+}
+
+ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *
+TAO_Indexed_Id_Map_Reverse_Iterator::clone (void) const
+{
+  ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *temp = 0;
+  ACE_NEW_RETURN (temp,
+                  TAO_Indexed_Id_Map_Reverse_Iterator (this->map_, this->index_),
+                  0);
+  return temp;
+}
+
+int
+TAO_Indexed_Id_Map_Reverse_Iterator::compare (
+    const ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type> &rhs) const
+{
+  const TAO_Indexed_Id_Map_Reverse_Iterator &rhs_local =
+    dynamic_cast<const TAO_Indexed_Id_Map_Reverse_Iterator &> (rhs);
+
+  return &this->map_ == &rhs_local.map_ && this->index_ == rhs_local.index_;
+}
+
+TAO_Indexed_Id_Map::value_type
+TAO_Indexed_Id_Map_Reverse_Iterator::dereference (void) const
+{
+  CORBA::ULong const index = this->index_ - 1;
+  TAO_Indexed_Id_Map::Slot &slot = this->map_.slots_[index];
+  TAO_Indexed_Id_Map::encode (index, slot.generation_, this->key_);
+  return TAO_Indexed_Id_Map::value_type (this->key_, slot.value_);
+}
+
+void
+TAO_Indexed_Id_Map_Reverse_Iterator::plus_plus (void)
+{
+  while (this->index_ != 0)
+    {
+      --this->index_;
+      if (this->index_ == 0
+          || this->map_.slots_[this->index_ - 1].value_ != 0)
+        break;
+    }
+}
+
+void
+TAO_Indexed_Id_Map_Reverse_Iterator::minus_minus (void)
+{
+  do
+    ++this->index_;
+  while (this->index_ < this->map_.used_
+         && this->map_.slots_[this->index_ - 1].value_ == 0);
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,270 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Indexed_Id_Map.h
+ *
+ *  Id map of the SYSTEM_ID and TRANSIENT POAs where the system id
+ *  is the index of the entry in a flat table.
+ */
+//=============================================================================
+
+#ifndef TAO_INDEXED_ID_MAP_H
+#define TAO_INDEXED_ID_MAP_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/PortableServer/portableserver_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/PortableServer/PS_ForwardC.h"
+#include "ace/Map_T.h"
+#include "ace/Array_Base.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+struct TAO_Active_Object_Map_Entry;
+
+/**
+ * @class TAO_Indexed_Id_Map
+ *
+ * @brief Id map with direct indexed keys.
+ *
+ * The keys created by this map are the index of a slot in a flat
+ * table, followed by the generation of the slot, each one encoded as
+ * a CORBA::ULong.  A find() decodes the index and compares the
+ * generation, so the cost of a lookup does not depend on the number
+ * of entries in the map and no hashing is done.  The generation is
+ * incremented every time a slot is reused, the keys of the entries
+ * that were unbound are detected as stale and not found.
+ *
+ * Unlike ACE_Active_Map_Manager_Adapter, bind() accepts a key that
+ * was created by this map if its slot is free, which allows the
+ * reactivation of system ids.  A slot is reused by the next
+ * bind_create_key() once its entry is unbound, a key cannot be bound
+ * again after that until the newer entry is unbound as well.
+ *
+ * The map is not synchronized, the Active Object Map is protected by
+ * the Object Adapter lock.
+ */
+class TAO_PortableServer_Export TAO_Indexed_Id_Map
+  : public ACE_Map<PortableServer::ObjectId, TAO_Active_Object_Map_Entry *>
+{
+public:
+  typedef PortableServer::ObjectId KEY;
+  typedef TAO_Active_Object_Map_Entry *VALUE;
+  typedef ACE_Map<KEY, VALUE>::value_type value_type;
+
+  /// Initialize a map with @a size slots.
+  explicit TAO_Indexed_Id_Map (size_t size = ACE_DEFAULT_MAP_SIZE);
+
+  /// Close down and release dynamically allocated resources.
+  virtual ~TAO_Indexed_Id_Map (void);
+
+  /// Size of the keys created by this map.
+  static size_t key_size (void);
+
+  virtual int open (size_t length = ACE_DEFAULT_MAP_SIZE,
+                    ACE_Allocator *alloc = 0);
+
+  virtual int close (void);
+
+  /// Bind @a value to @a key, which must have been created by this
+  /// map and refer to a free slot.  Returns -1 for a stale key whose
+  /// slot was taken by a newer entry, the entry holding the slot is
+  /// not displaced, and 1 when @a key itself is bound already.
+  virtual int bind (const KEY &key,
+                    const VALUE &value);
+
+  /// Not supported.
+  virtual int bind_modify_key (const VALUE &value,
+                               KEY &key);
+
+  /// Not supported, the keys are created when binding.
+  virtual int create_key (KEY &key);
+
+  /// Bind @a value in a free slot and return its key in @a key.
+  virtual int bind_create_key (const VALUE &value,
+                               KEY &key);
+
+  /// Bind @a value in a free slot.
+  virtual int bind_create_key (const VALUE &value);
+
+  /// The keys are not modified, @a original_key refers to the data of
+  /// @a modified_key.
+  virtual int recover_key (const KEY &modified_key,
+                           KEY &original_key);
+
+  /// Not supported.
+  virtual int rebind (const KEY &key,
+                      const VALUE &value);
+
+  /// Not supported.
+  virtual int rebind (const KEY &key,
+                      const VALUE &value,
+                      VALUE &old_value);
+
+  /// Not supported.
+  virtual int rebind (const KEY &key,
+                      const VALUE &value,
+                      KEY &old_key,
+                      VALUE &old_value);
+
+  /// Not supported.
+  virtual int trybind (const KEY &key,
+                       VALUE &value);
+
+  virtual int find (const KEY &key,
+                    VALUE &value);
+
+  virtual int find (const KEY &key);
+
+  virtual int unbind (const KEY &key);
+
+  virtual int unbind (const KEY &key,
+                      VALUE &value);
+
+  virtual size_t current_size (void) const;
+
+  virtual size_t total_size (void) const;
+
+  virtual void dump (void) const;
+
+  /// A slot of the table.
+  struct Slot
+  {
+    Slot (void);
+
+    /// The entry, 0 if the slot is free.
+    VALUE value_;
+
+    /// Generation of the key bound in the slot.
+    CORBA::ULong generation_;
+
+    /// Highest generation ever used in the slot.
+    CORBA::ULong last_generation_;
+
+    /// Next slot of the free list.
+    CORBA::ULong next_free_;
+
+    /// Is the slot in the free list?
+    bool free_listed_;
+  };
+
+protected:
+  virtual ACE_Iterator_Impl<value_type> *begin_impl (void);
+  virtual ACE_Iterator_Impl<value_type> *end_impl (void);
+  virtual ACE_Reverse_Iterator_Impl<value_type> *rbegin_impl (void);
+  virtual ACE_Reverse_Iterator_Impl<value_type> *rend_impl (void);
+
+private:
+  friend class TAO_Indexed_Id_Map_Iterator;
+  friend class TAO_Indexed_Id_Map_Reverse_Iterator;
+
+  /// Decode @a key, return -1 if it was not created by this map.
+  int decode (const KEY &key,
+              CORBA::ULong &index,
+              CORBA::ULong &generation) const;
+
+  /// Encode @a index and @a generation in @a key.
+  static void encode (CORBA::ULong index,
+                      CORBA::ULong generation,
+                      KEY &key);
+
+  /// Find the slot bound to @a key.
+  Slot *find_slot (const KEY &key);
+
+  /// Take a free slot, growing the table if there is none.
+  int allocate (CORBA::ULong &index);
+
+  /// Put slot @a index in the free list.
+  void release (CORBA::ULong index);
+
+  TAO_Indexed_Id_Map (const TAO_Indexed_Id_Map &);
+  void operator= (const TAO_Indexed_Id_Map &);
+
+private:
+  /// The table.
+  ACE_Array_Base<Slot> slots_;
+
+  /// Number of slots that were used, the others were never touched.
+  CORBA::ULong used_;
+
+  /// First slot of the free list.
+  CORBA::ULong free_list_;
+
+  /// Number of bound entries.
+  size_t current_size_;
+};
+
+/**
+ * @class TAO_Indexed_Id_Map_Iterator
+ *
+ * @brief Iterate over the bound slots of a TAO_Indexed_Id_Map.
+ */
+class TAO_PortableServer_Export TAO_Indexed_Id_Map_Iterator
+  : public ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type>
+{
+public:
+  /// Start at the first bound slot from @a index.
+  TAO_Indexed_Id_Map_Iterator (TAO_Indexed_Id_Map &map,
+                               CORBA::ULong index);
+
+  virtual ~TAO_Indexed_Id_Map_Iterator (void);
+
+  virtual ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *clone (void) const;
+  virtual int compare (const ACE_Iterator_Impl<TAO_Indexed_Id_Map::value_type> &rhs) const;
+  virtual TAO_Indexed_Id_Map::value_type dereference (void) const;
+  virtual void plus_plus (void);
+  virtual void minus_minus (void);
+
+private:
+  TAO_Indexed_Id_Map &map_;
+  CORBA::ULong index_;
+
+  /// The key of the current slot, the pairs refer to it.
+  mutable PortableServer::ObjectId key_;
+};
+
+/**
+ * @class TAO_Indexed_Id_Map_Reverse_Iterator
+ *
+ * @brief Iterate backwards over the bound slots of a
+ * TAO_Indexed_Id_Map.
+ */
+class TAO_PortableServer_Export TAO_Indexed_Id_Map_Reverse_Iterator
+  : public ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type>
+{
+public:
+  /// @a index is one past the slot of the iterator, 0 is the end.
+  TAO_Indexed_Id_Map_Reverse_Iterator (TAO_Indexed_Id_Map &map,
+                                       CORBA::ULong index);
+
+  virtual ~TAO_Indexed_Id_Map_Reverse_Iterator (void);
+
+  virtual ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type> *clone (void) const;
+  virtual int compare (const ACE_Reverse_Iterator_Impl<TAO_Indexed_Id_Map::value_type> &rhs) const;
+  virtual TAO_Indexed_Id_Map::value_type dereference (void) const;
+  virtual void plus_plus (void);
+  virtual void minus_minus (void);
+
+private:
+  TAO_Indexed_Id_Map &map_;
+  CORBA::ULong index_;
+
+  /// The key of the current slot, the pairs refer to it.
+  mutable PortableServer::ObjectId key_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+# include "tao/PortableServer/Indexed_Id_Map.inl"
+#endif /* __ACE_INLINE__ */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_INDEXED_ID_MAP_H */
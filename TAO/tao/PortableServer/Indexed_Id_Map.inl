@@ -0,0 +1,98 @@
+// -*- C++ -*-
+#include "ace/OS_NS_string.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+ACE_INLINE
+TAO_Indexed_Id_Map::Slot::Slot (void)
+  : value_ (0),
+    generation_ (0),
+    last_generation_ (0),
+    next_free_ (0),
+    free_listed_ (false)
+{
+}
+
+/* static */
+ACE_INLINE size_t
+TAO_Indexed_Id_Map::key_size (void)
+{
+  return 2 * sizeof (CORBA::ULong);
+}
+
+ACE_INLINE int
+TAO_Indexed_Id_Map::decode (const KEY &key,
+                            CORBA::ULong &index,
+                            CORBA::ULong &generation) const
+{
+  if (key.length () != TAO_Indexed_Id_Map::key_size ())
+    return -1;
+
+  const CORBA::Octet *buffer = key.get_buffer ();
+  ACE_OS::memcpy (&index, buffer, sizeof index);
+  ACE_OS::memcpy (&generation, buffer + sizeof index, sizeof generation);
+
+  return 0;
+}
+
+/* static */
+ACE_INLINE void
+TAO_Indexed_Id_Map::encode (CORBA::ULong index,
+                            CORBA::ULong generation,
+                            KEY &key)
+{
+  key.length (static_cast<CORBA::ULong> (TAO_Indexed_Id_Map::key_size ()));
+
+  CORBA::Octet *buffer = key.get_buffer ();
+  ACE_OS::memcpy (buffer, &index, sizeof index);
+  ACE_OS::memcpy (buffer + sizeof index, &generation, sizeof generation);
+}
+
+ACE_INLINE TAO_Indexed_Id_Map::Slot *
+TAO_Indexed_Id_Map::find_slot (const KEY &key)
+{
+  CORBA::ULong index = 0;
+  CORBA::ULong generation = 0;
+  if (this->decode (key, index, generation) != 0
+      || index >= this->used_)
+    return 0;
+
+  // A key of an entry that was unbound has an older generation.
+  Slot &slot = this->slots_[index];
+  if (slot.value_ == 0 || slot.generation_ != generation)
+    return 0;
+
+  return &slot;
+}
+
+ACE_INLINE int
+TAO_Indexed_Id_Map::find (const KEY &key,
+                          VALUE &value)
+{
+  Slot *slot = this->find_slot (key);
+  if (slot == 0)
+    return -1;
+
+  value = slot->value_;
+  return 0;
+}
+
+ACE_INLINE int
+TAO_Indexed_Id_Map::find (const KEY &key)
+{
+  return this->find_slot (key) == 0 ? -1 : 0;
+}
+
+ACE_INLINE size_t
+TAO_Indexed_Id_Map::current_size (void) const
+{
+  return this->current_size_;
+}
+
+ACE_INLINE size_t
+TAO_Indexed_Id_Map::total_size (void) const
+{
+  return this->slots_.size ();
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
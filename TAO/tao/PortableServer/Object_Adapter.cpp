@@ -11,6 +11,7 @@
 #include "tao/PortableServer/POAManager.h"
 #include "tao/PortableServer/POAManagerFactory.h"
 #include "tao/PortableServer/Servant_Base.h"
+#include "tao/PortableServer/Demux_Cache.h"
 
 // -- ACE Include --
 #include "ace/Auto_Ptr.h"
@@ -107,6 +108,14 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 /* static */
 CORBA::ULong TAO_Object_Adapter::transient_poa_name_size_ = 0;
 
+namespace
+{
+  extern "C" void CleanUpDemuxCache (void *object, void *)
+  {
+    delete static_cast<TAO::Portable_Server::Demux_Cache *> (object);
+  }
+}
+
 void
 TAO_Object_Adapter::set_transient_poa_name_size (const TAO_Server_Strategy_Factory::Active_Object_Map_Creation_Parameters &creation_parameters)
 {
@@ -153,10 +162,25 @@ TAO_Object_Adapter::TAO_Object_Adapter (const TAO_Server_Strategy_Factory::Activ
     poa_manager_factory_ (0),
 #endif
     default_validator_ (orb_core),
-    default_poa_policies_ ()
+    default_poa_policies_ (),
+    generation_ (0),
+    use_demux_cache_ (creation_parameters.use_demux_cache_ != 0),
+    demux_cache_slot_ (0)
 {
   TAO_Object_Adapter::set_transient_poa_name_size (creation_parameters);
 
+  if (this->use_demux_cache_
+      && orb_core.add_tss_cleanup_func (CleanUpDemuxCache,
+                                        this->demux_cache_slot_) != 0)
+    {
+      if (TAO_debug_level > 0)
+        TAOLIB_ERROR ((LM_ERROR,
+                       ACE_TEXT ("TAO (%P|%t) - TAO_Object_Adapter, ")
+                       ACE_TEXT ("cannot allocate the demux cache ")
+                       ACE_TEXT ("TSS slot, disabling the cache\n")));
+      this->use_demux_cache_ = false;
+    }
+
   Hint_Strategy *hint_strategy = 0;
   if (creation_parameters.use_active_hint_in_poa_names_)
     ACE_NEW (hint_strategy,
@@ -314,12 +338,12 @@ TAO_Object_Adapter::~TAO_Object_Adapter (void)
 }
 
 /* static */
-ACE_Lock *
+TAO::Portable_Server::Object_Adapter_Lock *
 TAO_Object_Adapter::create_lock (TAO_SYNCH_MUTEX &thread_lock)
 {
-  ACE_Lock *the_lock = 0;
+  TAO::Portable_Server::Object_Adapter_Lock *the_lock = 0;
   ACE_NEW_RETURN (the_lock,
-                  ACE_Lock_Adapter<TAO_SYNCH_MUTEX> (thread_lock),
+                  TAO::Portable_Server::Object_Adapter_Lock (thread_lock),
                   0);
   return the_lock;
 }
@@ -327,7 +351,8 @@ TAO_Object_Adapter::create_lock (TAO_SYNCH_MUTEX &thread_lock)
 int
 TAO_Object_Adapter::dispatch_servant (const TAO::ObjectKey &key,
                                       TAO_ServerRequest &req,
-                                      CORBA::Object_out forward_to)
+                                      CORBA::Object_out forward_to,
+                                      TAO::Portable_Server::Demux_Cache *cache)
 {
   ACE_FUNCTION_TIMEPROBE (TAO_OBJECT_ADAPTER_DISPATCH_SERVANT_START);
 
@@ -338,7 +363,8 @@ TAO_Object_Adapter::dispatch_servant (const TAO::ObjectKey &key,
   // Set up state in the POA et al (including the POA Current), so
   // that we know that this servant is currently in an upcall.
   const char *operation = req.operation ();
-  int result = servant_upcall.prepare_for_upcall (key, operation, forward_to);
+  int result =
+    servant_upcall.prepare_for_upcall (key, operation, forward_to, cache);
 
   if (result != TAO_Adapter::DS_OK)
     return result;
@@ -418,6 +444,36 @@ TAO_Object_Adapter::locate_poa (const TAO::ObjectKey &key,
     throw ::CORBA::OBJECT_NOT_EXIST (CORBA::OMGVMCID | 2, CORBA::COMPLETED_NO);
 }
 
+int
+TAO_Object_Adapter::lookup_poa (const TAO::ObjectKey &key,
+                                PortableServer::ObjectId &system_id,
+                                TAO_Root_POA *&poa)
+{
+  TAO_Object_Adapter::poa_name poa_system_name;
+  CORBA::Boolean is_root = false;
+  CORBA::Boolean is_persistent = false;
+  CORBA::Boolean is_system_id = false;
+  TAO::Portable_Server::Temporary_Creation_Time poa_creation_time;
+
+  int const result = TAO_Root_POA::parse_key (key,
+                                              poa_system_name,
+                                              system_id,
+                                              is_root,
+                                              is_persistent,
+                                              is_system_id,
+                                              poa_creation_time);
+  if (result != 0)
+    return -1;
+
+  if (is_persistent)
+    return this->hint_strategy_->lookup_persistent_poa (poa_system_name, poa);
+
+  return this->find_transient_poa (poa_system_name,
+                                   is_root,
+                                   poa_creation_time,
+                                   poa);
+}
+
 int
 TAO_Object_Adapter::activate_poa (const poa_name &folded_name,
                                   TAO_Root_POA *&poa)
@@ -493,6 +549,8 @@ TAO_Object_Adapter::bind_poa (const poa_name &folded_name,
                               TAO_Root_POA *poa,
                               poa_name_out system_name)
 {
+  ++this->generation_;
+
   if (poa->persistent ())
     return this->bind_persistent_poa (folded_name, poa, system_name);
   else
@@ -504,12 +562,41 @@ TAO_Object_Adapter::unbind_poa (TAO_Root_POA *poa,
                                 const poa_name &folded_name,
                                 const poa_name &system_name)
 {
+  ++this->generation_;
+
   if (poa->persistent ())
     return this->unbind_persistent_poa (folded_name, system_name);
   else
     return this->unbind_transient_poa (system_name);
 }
 
+TAO::Portable_Server::Demux_Cache *
+TAO_Object_Adapter::demux_cache (void)
+{
+  if (!this->use_demux_cache_)
+    return 0;
+
+  TAO::Portable_Server::Demux_Cache *cache =
+    static_cast<TAO::Portable_Server::Demux_Cache *> (
+      this->orb_core_.get_tss_resource (this->demux_cache_slot_));
+
+  if (cache == 0)
+    {
+      ACE_NEW_RETURN (cache,
+                      TAO::Portable_Server::Demux_Cache,
+                      0);
+
+      if (this->orb_core_.set_tss_resource (this->demux_cache_slot_,
+                                            cache) != 0)
+        {
+          delete cache;
+          return 0;
+        }
+    }
+
+  return cache;
+}
+
 int
 TAO_Object_Adapter::locate_servant_i (const TAO::ObjectKey &key)
 {
@@ -828,6 +915,47 @@ TAO_Object_Adapter::dispatch (TAO::ObjectKey &key,
   return result;
 }
 
+int
+TAO_Object_Adapter::dispatch_collocated (TAO_Stub *stub,
+                                         TAO_ServerRequest &request,
+                                         CORBA::Object_out forward_to)
+{
+  TAO::Portable_Server::Collocated_Demux_Cache *cache =
+    dynamic_cast<TAO::Portable_Server::Collocated_Demux_Cache *> (
+      stub->collocation_cache ());
+
+  // The cached pointers are only valid in the adapter that found them.
+  if (cache == 0 || cache->adapter () != this)
+    return TAO_Adapter::DS_MISMATCHED_KEY;
+
+#if TAO_HAS_INTERCEPTORS == 1
+  // Only dispatch() calls the server request interceptors.
+  if (this->orb_core_.serverrequestinterceptor_adapter () != 0)
+    return TAO_Adapter::DS_MISMATCHED_KEY;
+#endif  /* TAO_HAS_INTERCEPTORS == 1 */
+
+  TAO::ObjectKey &key = request.object_key ();
+
+  if (key.length() < TAO_Root_POA::TAO_OBJECTKEY_PREFIX_SIZE
+      || ACE_OS::memcmp (key.get_buffer (),
+                         &TAO_Root_POA::objectkey_prefix[0],
+                         TAO_Root_POA::TAO_OBJECTKEY_PREFIX_SIZE) != 0)
+    {
+      return TAO_Adapter::DS_MISMATCHED_KEY;
+    }
+
+  int const result =
+    this->dispatch_servant (key, request, forward_to, &cache->cache ());
+
+  if (result == TAO_Adapter::DS_FORWARD)
+    {
+      request.reply_status (GIOP::LOCATION_FORWARD);
+      request.forward_location (forward_to.ptr ());
+    }
+
+  return result;
+}
+
 const char *
 TAO_Object_Adapter::name (void) const
 {
@@ -850,6 +978,8 @@ TAO_Object_Adapter::create_collocated_object (TAO_Stub *stub,
   // TAO_Stub::servant_orb() duplicates it.
   stub->servant_orb (this->orb_core_.orb ());
 
+  this->attach_collocation_cache (stub);
+
   // It is ok to create a collocated object even when <sb> is
   // zero. This constructor will set the stub collocated indicator and
   // the strategized proxy broker if required.
@@ -877,6 +1007,8 @@ TAO_Object_Adapter::initialize_collocated_object (TAO_Stub *stub)
   // TAO_Stub::servant_orb() duplicates it.
   stub->servant_orb (this->orb_core_.orb ());
 
+  this->attach_collocation_cache (stub);
+
   // It is ok to set the object as a collocated object even when
   // <sb> is zero.
   stub->collocated_servant (sb);
@@ -902,6 +1034,21 @@ TAO_Object_Adapter::release_poa_manager_factory (
 }
 #endif
 
+void
+TAO_Object_Adapter::attach_collocation_cache (TAO_Stub *stub)
+{
+  // The thru-POA collocated requests on the stub remember their
+  // target like the threads do.
+  if (!this->use_demux_cache_ || stub->collocation_cache () != 0)
+    return;
+
+  TAO::Portable_Server::Collocated_Demux_Cache *cache = 0;
+  ACE_NEW (cache,
+           TAO::Portable_Server::Collocated_Demux_Cache (this));
+
+  stub->collocation_cache (cache);
+}
+
 TAO_ServantBase *
 TAO_Object_Adapter::get_collocated_servant (const TAO_MProfile &mp)
 {
@@ -959,6 +1106,26 @@ int
 TAO_Object_Adapter::Active_Hint_Strategy::find_persistent_poa (
   const poa_name &system_name,
   TAO_Root_POA *&poa)
+{
+  int result = this->lookup_persistent_poa (system_name, poa);
+
+  if (result != 0)
+    {
+      poa_name folded_name;
+      if (this->persistent_poa_system_map_.recover_key (system_name,
+                                                        folded_name) == 0)
+        {
+          result = this->object_adapter_->activate_poa (folded_name, poa);
+        }
+    }
+
+  return result;
+}
+
+int
+TAO_Object_Adapter::Active_Hint_Strategy::lookup_persistent_poa (
+  const poa_name &system_name,
+  TAO_Root_POA *&poa)
 {
   poa_name folded_name;
   int result = this->persistent_poa_system_map_.recover_key (system_name,
@@ -973,10 +1140,6 @@ TAO_Object_Adapter::Active_Hint_Strategy::find_persistent_poa (
           result =
             this->object_adapter_->persistent_poa_name_map_->find (folded_name,
                                                                    poa);
-          if (result != 0)
-            {
-              result = this->object_adapter_->activate_poa (folded_name, poa);
-            }
         }
     }
 
@@ -1045,6 +1208,15 @@ TAO_Object_Adapter::No_Hint_Strategy::find_persistent_poa (
   return result;
 }
 
+int
+TAO_Object_Adapter::No_Hint_Strategy::lookup_persistent_poa (
+  const poa_name &system_name,
+  TAO_Root_POA *&poa)
+{
+  return this->object_adapter_->persistent_poa_name_map_->find (system_name,
+                                                                poa);
+}
+
 int
 TAO_Object_Adapter::No_Hint_Strategy::bind_persistent_poa (
   const poa_name &folded_name,
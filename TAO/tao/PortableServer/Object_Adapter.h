@@ -25,6 +25,7 @@
 #include "tao/PortableServer/Default_Policy_Validator.h"
 #include "tao/PortableServer/POA_Policy_Set.h"
 #include "tao/PortableServer/POAManagerC.h"
+#include "tao/PortableServer/Object_Adapter_Lock.h"
 
 #include "tao/Adapter.h"
 #include "tao/Adapter_Factory.h"
@@ -59,6 +60,7 @@ namespace TAO
     class Servant_Upcall;
     class POA_Current_Impl;
     class Temporary_Creation_Time;
+    class Demux_Cache;
   }
 }
 
@@ -87,9 +89,12 @@ public:
   /// Destructor.
   ~TAO_Object_Adapter (void);
 
+  /// Dispatch @a req to its servant.  Use @a cache instead of the
+  /// demultiplexing cache of the thread when it is not zero.
   int dispatch_servant (const TAO::ObjectKey &key,
                         TAO_ServerRequest &req,
-                        CORBA::Object_out forward_to);
+                        CORBA::Object_out forward_to,
+                        TAO::Portable_Server::Demux_Cache *cache = 0);
 
   int locate_servant (const TAO::ObjectKey &key);
 
@@ -147,6 +152,13 @@ public:
   /// Initialize the default set of POA policies.
   void init_default_policies (TAO_POA_Policy_Set &policies);
 
+  /// Incremented every time a POA is bound or unbound.
+  unsigned long generation (void) const;
+
+  /// The demultiplexing cache of the calling thread, zero if the
+  /// cache is disabled.
+  TAO::Portable_Server::Demux_Cache *demux_cache (void);
+
   // = The TAO_Adapter methods, please check tao/Adapter.h for the
   // documentation
   virtual void open (void);
@@ -156,6 +168,9 @@ public:
   virtual int dispatch (TAO::ObjectKey &key,
                         TAO_ServerRequest &request,
                         CORBA::Object_out forward_to);
+  virtual int dispatch_collocated (TAO_Stub *stub,
+                                   TAO_ServerRequest &request,
+                                   CORBA::Object_out forward_to);
   virtual const char *name (void) const;
   virtual CORBA::Object_ptr root (void);
   virtual CORBA::Object_ptr create_collocated_object (TAO_Stub *,
@@ -178,6 +193,12 @@ protected:
                    PortableServer::ObjectId &id,
                    TAO_Root_POA *&poa                  );
 
+  /// Find the POA of @a key, without activating it.  Returns -1 if
+  /// the key is invalid or the POA is not active.
+  int lookup_poa (const TAO::ObjectKey &key,
+                  PortableServer::ObjectId &id,
+                  TAO_Root_POA *&poa);
+
   int find_transient_poa (const poa_name &system_name,
                           CORBA::Boolean root,
                           const TAO::Portable_Server::Temporary_Creation_Time &poa_creation_time,
@@ -196,7 +217,8 @@ protected:
   int unbind_persistent_poa (const poa_name &folded_name,
                              const poa_name &system_name);
 
-  static ACE_Lock *create_lock (TAO_SYNCH_MUTEX &thread_lock);
+  static TAO::Portable_Server::Object_Adapter_Lock *
+    create_lock (TAO_SYNCH_MUTEX &thread_lock);
 
   virtual void do_dispatch (TAO_ServerRequest& req,
                             TAO::Portable_Server::Servant_Upcall& upcall);
@@ -220,6 +242,11 @@ public:
     virtual int find_persistent_poa (const poa_name &system_name,
                                      TAO_Root_POA *&poa) = 0;
 
+    /// Find an active persistent POA, unlike find_persistent_poa() the
+    /// adapter activators are not called.
+    virtual int lookup_persistent_poa (const poa_name &system_name,
+                                       TAO_Root_POA *&poa) = 0;
+
     virtual int bind_persistent_poa (const poa_name &folded_name,
                                      TAO_Root_POA *poa,
                                      poa_name_out system_name) = 0;
@@ -254,6 +281,9 @@ public:
     virtual int find_persistent_poa (const poa_name &system_name,
                                      TAO_Root_POA *&poa);
 
+    virtual int lookup_persistent_poa (const poa_name &system_name,
+                                       TAO_Root_POA *&poa);
+
     virtual int bind_persistent_poa (const poa_name &folded_name,
                                      TAO_Root_POA *poa,
                                      poa_name_out system_name);
@@ -291,6 +321,9 @@ public:
     virtual int find_persistent_poa (const poa_name &system_name,
                                      TAO_Root_POA *&poa);
 
+    virtual int lookup_persistent_poa (const poa_name &system_name,
+                                       TAO_Root_POA *&poa);
+
     virtual int bind_persistent_poa (const poa_name &folded_name,
                                      TAO_Root_POA *poa,
                                      poa_name_out system_name);
@@ -375,7 +408,7 @@ protected:
 
   TAO_SYNCH_MUTEX thread_lock_;
 
-  ACE_Lock *lock_;
+  TAO::Portable_Server::Object_Adapter_Lock *lock_;
 
   ACE_Reverse_Lock<ACE_Lock> reverse_lock_;
 
@@ -449,6 +482,10 @@ private:
   /// Helper method to get collocated servant
   TAO_ServantBase *get_collocated_servant (const TAO_MProfile &mp);
 
+  /// Attach a Collocated_Demux_Cache to @a stub, unless it has a
+  /// cache already or the demultiplexing cache is disabled.
+  void attach_collocation_cache (TAO_Stub *stub);
+
 #if (TAO_HAS_MINIMUM_POA == 0) && !defined (CORBA_E_COMPACT) && !defined (CORBA_E_MICRO)
   static void release_poa_manager_factory (TAO_POAManager_Factory *factory);
 #endif
@@ -485,6 +522,16 @@ private:
   /// Save a list of default policies that should be included in
   /// every POA (unless overridden).
   TAO_POA_Policy_Set default_poa_policies_;
+
+  /// Incremented every time a POA is bound or unbound, invalidates the
+  /// demultiplexing caches.
+  unsigned long generation_;
+
+  /// Is the demultiplexing cache enabled?
+  bool use_demux_cache_;
+
+  /// The ORB Core TSS slot of the demultiplexing caches.
+  size_t demux_cache_slot_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
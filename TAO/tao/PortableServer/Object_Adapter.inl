@@ -34,6 +34,12 @@ TAO_Object_Adapter::reverse_lock (void)
   return this->reverse_lock_;
 }
 
+ACE_INLINE unsigned long
+TAO_Object_Adapter::generation (void) const
+{
+  return this->generation_;
+}
+
 /* static */
 ACE_INLINE CORBA::ULong
 TAO_Object_Adapter::transient_poa_name_size ()
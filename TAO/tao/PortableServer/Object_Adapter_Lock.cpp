@@ -0,0 +1,133 @@
+#include "tao/PortableServer/Object_Adapter_Lock.h"
+
+#if !defined (__ACE_INLINE__)
+# include "tao/PortableServer/Object_Adapter_Lock.inl"
+#endif /* __ACE_INLINE__ */
+
+#include "ace/ACE.h"
+#include "ace/OS_NS_Thread.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace Portable_Server
+  {
+    Object_Adapter_Lock::Reader_Slot::Reader_Slot (void)
+      : count_ (0)
+    {
+    }
+
+    Object_Adapter_Lock::Object_Adapter_Lock (TAO_SYNCH_MUTEX &thread_lock)
+      : thread_lock_ (thread_lock),
+        writers_ (0)
+    {
+    }
+
+    Object_Adapter_Lock::~Object_Adapter_Lock (void)
+    {
+    }
+
+    int
+    Object_Adapter_Lock::remove (void)
+    {
+      return this->thread_lock_.remove ();
+    }
+
+    int
+    Object_Adapter_Lock::acquire (void)
+    {
+      int const result = this->thread_lock_.acquire ();
+      if (result == 0)
+        {
+          ++this->writers_;
+          this->wait_for_readers ();
+        }
+      return result;
+    }
+
+    int
+    Object_Adapter_Lock::tryacquire (void)
+    {
+      int const result = this->thread_lock_.tryacquire ();
+      if (result == 0)
+        {
+          ++this->writers_;
+          this->wait_for_readers ();
+        }
+      return result;
+    }
+
+    int
+    Object_Adapter_Lock::release (void)
+    {
+      --this->writers_;
+      return this->thread_lock_.release ();
+    }
+
+    int
+    Object_Adapter_Lock::acquire_read (void)
+    {
+      return this->acquire ();
+    }
+
+    int
+    Object_Adapter_Lock::acquire_write (void)
+    {
+      return this->acquire ();
+    }
+
+    int
+    Object_Adapter_Lock::tryacquire_read (void)
+    {
+      return this->tryacquire ();
+    }
+
+    int
+    Object_Adapter_Lock::tryacquire_write (void)
+    {
+      return this->tryacquire ();
+    }
+
+    int
+    Object_Adapter_Lock::tryacquire_write_upgrade (void)
+    {
+      return 0;
+    }
+
+    int
+    Object_Adapter_Lock::enter (void)
+    {
+      // Spread the threads over the slots.
+      ACE_thread_t const self = ACE_OS::thr_self ();
+      int const slot =
+        static_cast<int> (ACE::hash_pjw (reinterpret_cast<const char *> (&self),
+                                         sizeof self)
+                          % TAO_POA_READER_SLOTS);
+
+      // Count ourselves before looking at the writers, a writer counts
+      // itself before looking at the readers, so one of us always sees
+      // the other.
+      ++this->readers_[slot].count_;
+      if (this->writers_.value () != 0)
+        {
+          --this->readers_[slot].count_;
+          return -1;
+        }
+      return slot;
+    }
+
+    void
+    Object_Adapter_Lock::wait_for_readers (void)
+    {
+      // The read sections are short and never block, so spin.
+      for (int i = 0; i != TAO_POA_READER_SLOTS; ++i)
+        {
+          while (this->readers_[i].count_.value () != 0)
+            ACE_OS::thr_yield ();
+        }
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
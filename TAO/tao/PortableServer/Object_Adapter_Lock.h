@@ -0,0 +1,145 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Object_Adapter_Lock.h
+ *
+ *  The Object Adapter lock, with a read section for the servant
+ *  lookups of steady-state upcalls.
+ */
+//=============================================================================
+
+#ifndef TAO_OBJECT_ADAPTER_LOCK_H
+#define TAO_OBJECT_ADAPTER_LOCK_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/PortableServer/portableserver_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+#include "ace/Lock.h"
+#include "ace/Atomic_Op.h"
+#include "ace/Synch_Traits.h"
+#include "ace/Thread_Mutex.h"
+
+#ifndef TAO_POA_READER_SLOTS
+/// The number of reader counters of the Object Adapter lock.  The
+/// threads are spread over them so they do not all write to the same
+/// cache line.
+# define TAO_POA_READER_SLOTS 16
+#endif /* TAO_POA_READER_SLOTS */
+
+#ifndef TAO_POA_CACHE_LINE_SIZE
+/// Padding between two reader counters.
+# define TAO_POA_CACHE_LINE_SIZE 64
+#endif /* TAO_POA_CACHE_LINE_SIZE */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace Portable_Server
+  {
+    /**
+     * @class Object_Adapter_Lock
+     *
+     * @brief The Object Adapter lock.
+     *
+     * Acquiring the lock acquires the Object Adapter mutex, as the
+     * ACE_Lock_Adapter it replaces did, and then waits for the read
+     * sections in progress to finish.
+     *
+     * A read section never blocks: it only counts itself in one of the
+     * reader slots and gives up if any thread holds the lock, or waits
+     * on one of the conditions of the Object Adapter.  Within a read
+     * section the POA maps, the POA Manager states and the active
+     * object maps do not change, so the upcalls can find their servant
+     * without serializing on the mutex.
+     */
+    class TAO_PortableServer_Export Object_Adapter_Lock : public ACE_Lock
+    {
+    public:
+      /// Constructor, @a thread_lock is the Object Adapter mutex.
+      explicit Object_Adapter_Lock (TAO_SYNCH_MUTEX &thread_lock);
+
+      /// Destructor.
+      virtual ~Object_Adapter_Lock (void);
+
+      // = The ACE_Lock methods.
+      virtual int remove (void);
+      virtual int acquire (void);
+      virtual int tryacquire (void);
+      virtual int release (void);
+      virtual int acquire_read (void);
+      virtual int acquire_write (void);
+      virtual int tryacquire_read (void);
+      virtual int tryacquire_write (void);
+      virtual int tryacquire_write_upgrade (void);
+
+      /// Enter a read section.  Return the slot to pass to leave(), or
+      /// -1 if the lock is held and the caller must acquire it instead.
+      int enter (void);
+
+      /// Leave the read section entered in @a slot.
+      void leave (int slot);
+
+      /**
+       * @class Read_Guard
+       *
+       * @brief Scope a read section.
+       */
+      class Read_Guard
+      {
+      public:
+        explicit Read_Guard (Object_Adapter_Lock &lock);
+        ~Read_Guard (void);
+
+        /// Did we enter the read section?
+        bool entered (void) const;
+
+      private:
+        Object_Adapter_Lock &lock_;
+        int const slot_;
+      };
+
+    private:
+      /// Wait until there are no read sections in progress.
+      void wait_for_readers (void);
+
+      Object_Adapter_Lock (const Object_Adapter_Lock &);
+      void operator= (const Object_Adapter_Lock &);
+
+    private:
+      /// The Object Adapter mutex.
+      TAO_SYNCH_MUTEX &thread_lock_;
+
+      /// The number of threads that own the mutex, or wait on one of
+      /// the conditions built on it.
+      ACE_Atomic_Op<TAO_SYNCH_MUTEX, long> writers_;
+
+      /// The read sections in progress.
+      struct Reader_Slot
+      {
+        Reader_Slot (void);
+
+        ACE_Atomic_Op<TAO_SYNCH_MUTEX, long> count_;
+        char pad_[TAO_POA_CACHE_LINE_SIZE];
+      };
+      Reader_Slot readers_[TAO_POA_READER_SLOTS];
+    };
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#if defined (__ACE_INLINE__)
+# include "tao/PortableServer/Object_Adapter_Lock.inl"
+#endif /* __ACE_INLINE__ */
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_OBJECT_ADAPTER_LOCK_H */
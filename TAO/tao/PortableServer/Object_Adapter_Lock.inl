@@ -0,0 +1,36 @@
+// -*- C++ -*-
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  namespace Portable_Server
+  {
+    ACE_INLINE
+    Object_Adapter_Lock::Read_Guard::Read_Guard (Object_Adapter_Lock &lock)
+      : lock_ (lock),
+        slot_ (lock.enter ())
+    {
+    }
+
+    ACE_INLINE
+    Object_Adapter_Lock::Read_Guard::~Read_Guard (void)
+    {
+      if (this->slot_ != -1)
+        this->lock_.leave (this->slot_);
+    }
+
+    ACE_INLINE bool
+    Object_Adapter_Lock::Read_Guard::entered (void) const
+    {
+      return this->slot_ != -1;
+    }
+
+    ACE_INLINE void
+    Object_Adapter_Lock::leave (int slot)
+    {
+      --this->readers_[slot].count_;
+    }
+  }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
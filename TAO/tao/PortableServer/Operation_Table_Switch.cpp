@@ -0,0 +1,113 @@
+#include "tao/PortableServer/Operation_Table_Switch.h"
+#include "tao/Timeprobe.h"
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_string.h"
+
+#if defined (ACE_ENABLE_TIMEPROBES)
+
+static const char *TAO_Operation_Table_Timeprobe_Description[] =
+  {
+    "TAO_Switch_OpTable::find - start",
+    "TAO_Switch_OpTable::find - end",
+  };
+
+enum
+  {
+    // Timeprobe description table start key
+    TAO_SWITCH_OPTABLE_FIND_START = 610,
+    TAO_SWITCH_OPTABLE_FIND_END,
+  };
+
+// Setup Timeprobes
+ACE_TIMEPROBE_EVENT_DESCRIPTIONS (TAO_Operation_Table_Timeprobe_Description,
+                                  TAO_SWITCH_OPTABLE_FIND_START);
+
+#endif /* ACE_ENABLE_TIMEPROBES */
+
+/***************************************************************/
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+TAO_Switch_OpTable::TAO_Switch_OpTable (TAO_Operation_Lookup lookup)
+  : lookup_ (lookup)
+{
+}
+
+TAO_Switch_OpTable::~TAO_Switch_OpTable (void)
+{
+}
+
+TAO_operation_db_entry const *
+TAO_Switch_OpTable::lookup (const char *opname,
+                            unsigned int length) const
+{
+  if (length == 0)
+    length = static_cast<unsigned int> (ACE_OS::strlen (opname));
+
+  return this->lookup_ (opname, length);
+}
+
+int
+TAO_Switch_OpTable::bind (const char *,
+                          const TAO::Operation_Skeletons)
+{
+  return 0;
+}
+
+int
+TAO_Switch_OpTable::find (const char *opname,
+                          TAO_Skeleton &skelfunc,
+                          const unsigned int length)
+{
+  ACE_FUNCTION_TIMEPROBE (TAO_SWITCH_OPTABLE_FIND_START);
+
+  TAO_operation_db_entry const * const entry =
+    this->lookup (opname, length);
+  if (entry == 0)
+    {
+      skelfunc = 0;
+      TAOLIB_ERROR_RETURN ((LM_ERROR,
+                            ACE_TEXT ("TAO_Switch_OpTable:find for ")
+                            ACE_TEXT ("operation '%C' (length=%d) failed\n"),
+                            opname ? opname : "<null string>", length),
+                           -1);
+    }
+
+  skelfunc = entry->skel_ptr;
+
+  return 0;
+}
+
+int
+TAO_Switch_OpTable::find (const char *opname,
+                          TAO_Collocated_Skeleton &skelfunc,
+                          TAO::Collocation_Strategy st,
+                          const unsigned int length)
+{
+  ACE_FUNCTION_TIMEPROBE (TAO_SWITCH_OPTABLE_FIND_START);
+
+  TAO_operation_db_entry const * const entry =
+    this->lookup (opname, length);
+  if (entry == 0)
+    {
+      skelfunc = 0;
+      TAOLIB_ERROR_RETURN ((LM_ERROR,
+                            ACE_TEXT ("TAO_Switch_OpTable:find for ")
+                            ACE_TEXT ("operation '%C' (length=%d) failed\n"),
+                            opname ? opname : "<null string>", length),
+                           -1);
+    }
+
+  switch (st)
+    {
+    case TAO::TAO_CS_DIRECT_STRATEGY:
+      skelfunc = entry->direct_skel_ptr;
+      break;
+    default:
+      return -1;
+    }
+
+  return 0;
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
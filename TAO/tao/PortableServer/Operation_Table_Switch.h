@@ -0,0 +1,82 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Operation_Table_Switch.h
+ *
+ *  Operation table whose lookup function is generated by the IDL
+ *  compiler as nested switch statements.
+ */
+//=============================================================================
+
+#ifndef TAO_OPERATION_TABLE_SWITCH_H
+#define TAO_OPERATION_TABLE_SWITCH_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/PortableServer/portableserver_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/PortableServer/Operation_Table.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/// Find the entry of the operation @a opname, of @a length
+/// characters.  Returns 0 if the interface has no such operation.
+typedef TAO_operation_db_entry const * (*TAO_Operation_Lookup) (
+  const char *opname,
+  unsigned int length);
+
+/**
+ * @class TAO_Switch_OpTable
+ *
+ * @brief Operation table lookup strategy based on a lookup function
+ * that switches on the length and the characters of the operation
+ * name.
+ *
+ * The IDL compiler generates the lookup function with the skeleton
+ * when the <tt>-H switch</tt> option is used.  The generated
+ * _dispatch() calls the function directly, this class only serves the
+ * callers of TAO_ServantBase::_find(), such as the collocated
+ * dispatch.  No external program is needed to generate the function.
+ */
+class TAO_PortableServer_Export TAO_Switch_OpTable
+  : public TAO_Operation_Table
+{
+public:
+  /// Constructor.
+  explicit TAO_Switch_OpTable (TAO_Operation_Lookup lookup);
+
+  /// Destructor.
+  ~TAO_Switch_OpTable (void);
+
+  /// See the documentation in the base class for details.
+  virtual int find (const char *opname,
+                    TAO_Skeleton &skel_ptr,
+                    const unsigned int length = 0);
+
+  virtual int find (const char *opname,
+                    TAO_Collocated_Skeleton &skelfunc,
+                    TAO::Collocation_Strategy s,
+                    const unsigned int length = 0);
+
+  virtual int bind (const char *opname,
+                    const TAO::Operation_Skeletons skel_ptr);
+
+private:
+  /// Find the entry of @a opname, computing its length if @a length
+  /// is zero.
+  TAO_operation_db_entry const *lookup (const char *opname,
+                                        unsigned int length) const;
+
+  /// The generated lookup function.
+  TAO_Operation_Lookup const lookup_;
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_OPERATION_TABLE_SWITCH_H */
@@ -54,6 +54,7 @@
 #include "ace/Thread_Mutex.h"
 #include "ace/Recursive_Thread_Mutex.h"
 #include "ace/Null_Mutex.h"
+#include "ace/Atomic_Op.h"
 
 // This is to remove "inherits via dominance" warnings from MSVC.
 // MSVC is being a little too paranoid.
@@ -737,7 +738,10 @@ protected:
 
   CORBA::Boolean cleanup_in_progress_;
 
-  CORBA::ULong outstanding_requests_;
+  /// Upcalls in progress, the upcalls that find their servant in a
+  /// read section of the Object Adapter lock change it without the
+  /// lock.
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, CORBA::ULong> outstanding_requests_;
 
   TAO_SYNCH_CONDITION outstanding_requests_condition_;
 
@@ -179,7 +179,7 @@ TAO_Root_POA::root_key_type_length (void)
 ACE_INLINE CORBA::ULong
 TAO_Root_POA::outstanding_requests (void) const
 {
-  return this->outstanding_requests_;
+  return this->outstanding_requests_.value ();
 }
 
 ACE_INLINE CORBA::ULong
@@ -542,16 +542,30 @@ TAO_ServantBase::synchronous_upcall_dispatch (
   TAO::Portable_Server::Servant_Upcall* servant_upcall,
   TAO_ServantBase *derived_this)
 {
-  TAO_Skeleton skel;
-  char const * const opname = req.operation ();
-
-  // Handle the one ways that are SYNC_WITH_SERVER and not queued
-  req.sync_after_dispatch ();
+  TAO_Skeleton skel = 0;
 
   // Fetch the skeleton for this operation
-  if (this->_find (opname,
+  if (this->_find (req.operation (),
                    skel,
                    static_cast <unsigned int> (req.operation_length())) == -1)
+    {
+      skel = 0;
+    }
+
+  this->synchronous_upcall_dispatch (req, servant_upcall, derived_this, skel);
+}
+
+void
+TAO_ServantBase::synchronous_upcall_dispatch (
+  TAO_ServerRequest & req,
+  TAO::Portable_Server::Servant_Upcall* servant_upcall,
+  TAO_ServantBase *derived_this,
+  TAO_Skeleton skel)
+{
+  // Handle the one ways that are SYNC_WITH_SERVER and not queued
+  req.sync_after_dispatch ();
+
+  if (skel == 0)
     {
       throw ::CORBA::BAD_OPERATION ();
     }
@@ -608,9 +622,26 @@ TAO_ServantBase::asynchronous_upcall_dispatch (
   TAO::Portable_Server::Servant_Upcall *servant_upcall,
   TAO_ServantBase *derived_this)
 {
-  TAO_Skeleton skel;
-  const char *opname = req.operation ();
+  TAO_Skeleton skel = 0;
 
+  // Fetch the skeleton for this operation
+  if (this->_find (req.operation (),
+                   skel,
+                   static_cast <unsigned int> (req.operation_length())) == -1)
+    {
+      skel = 0;
+    }
+
+  this->asynchronous_upcall_dispatch (req, servant_upcall, derived_this, skel);
+}
+
+void
+TAO_ServantBase::asynchronous_upcall_dispatch (
+  TAO_ServerRequest &req,
+  TAO::Portable_Server::Servant_Upcall *servant_upcall,
+  TAO_ServantBase *derived_this,
+  TAO_Skeleton skel)
+{
   // It seems that I might have missed s/g here.  What if
   // it is a one way that is SYNC_WITH_SERVER.
   // Add the following line to handle this reply send as well.
@@ -621,10 +652,7 @@ TAO_ServantBase::asynchronous_upcall_dispatch (
       req.send_no_exception_reply ();
     }
 
-  // Fetch the skeleton for this operation
-  if (this->_find (opname,
-                   skel,
-                   static_cast <unsigned int> (req.operation_length())) == -1)
+  if (skel == 0)
     {
       throw ::CORBA::BAD_OPERATION ();
     }
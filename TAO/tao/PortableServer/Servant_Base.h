@@ -207,6 +207,20 @@ protected:
     TAO::Portable_Server::Servant_Upcall* servant_upcall,
     TAO_ServantBase *derived_this);
 
+  /// Same as above, with the skeleton of the operation already found
+  /// by the caller, zero if the operation does not exist.
+  void synchronous_upcall_dispatch (
+    TAO_ServerRequest & req,
+    TAO::Portable_Server::Servant_Upcall* servant_upcall,
+    TAO_ServantBase *derived_this,
+    TAO_Skeleton skel);
+
+  void asynchronous_upcall_dispatch (
+    TAO_ServerRequest & req,
+    TAO::Portable_Server::Servant_Upcall* servant_upcall,
+    TAO_ServantBase *derived_this,
+    TAO_Skeleton skel);
+
 protected:
   /// Reference counter.
 #if defined (ACE_HAS_CPP11)
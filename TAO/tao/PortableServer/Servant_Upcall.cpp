@@ -4,7 +4,9 @@
 #include "tao/PortableServer/Default_Servant_Dispatcher.h"
 #include "tao/PortableServer/Collocated_Object_Proxy_Broker.h"
 #include "tao/PortableServer/Active_Object_Map_Entry.h"
+#include "tao/PortableServer/POAManager.h"
 #include "tao/PortableServer/ForwardRequestC.h"
+#include "tao/PortableServer/Demux_Cache.h"
 
 // -- TAO Include --
 #include "tao/ORB.h"
@@ -35,7 +37,8 @@ namespace TAO
         cookie_ (0),
         operation_ (0),
 #endif /* TAO_HAS_MINIMUM_POA == 0 */
-        active_object_map_entry_ (0)
+        active_object_map_entry_ (0),
+        lock_free_ (false)
     {
       TAO_Object_Adapter *object_adapter =
         dynamic_cast<TAO_Object_Adapter *>(oc->poa_adapter ());
@@ -46,8 +49,17 @@ namespace TAO
     Servant_Upcall::prepare_for_upcall (
       const TAO::ObjectKey &key,
       const char *operation,
-      CORBA::Object_out forward_to)
+      CORBA::Object_out forward_to,
+      Demux_Cache *cache)
     {
+      if (cache == 0)
+        cache = this->object_adapter_->demux_cache ();
+
+      // Most requests are for active objects, they do not need to
+      // serialize on the Object Adapter lock.
+      if (this->prepare_for_upcall_fast (key, cache))
+        return TAO_Adapter::DS_OK;
+
       while (1)
         {
           bool wait_occurred_restart_call = false;
@@ -168,6 +180,134 @@ namespace TAO
       return TAO_Adapter::DS_OK;
     }
 
+    bool
+    Servant_Upcall::prepare_for_upcall_fast (const TAO::ObjectKey &key,
+                                             Demux_Cache *cache)
+    {
+      ::TAO_Root_POA *poa = 0;
+
+      {
+        // Nothing the locked path could change can change before we
+        // leave the read section.
+        Object_Adapter_Lock::Read_Guard guard (*this->object_adapter_->lock_);
+
+        if (!guard.entered ()
+            || this->object_adapter_->non_servant_upcall_in_progress_ != 0)
+          return false;
+
+        // Skip the POA and servant lookups when the thread already
+        // dispatched a request on the same object.
+        TAO_Active_Object_Map_Entry *entry = 0;
+        if (cache != 0)
+          entry = cache->find (key,
+                               this->object_adapter_->generation_,
+                               this->system_id_,
+                               poa);
+
+        if (entry == 0
+            && this->object_adapter_->lookup_poa (key,
+                                                  this->system_id_,
+                                                  poa) != 0)
+          return false;
+
+        // Servant managers and default servants are only used when the
+        // object is not in the active object map.
+        if (poa->cached_policies ().servant_retention () !=
+              PortableServer::RETAIN
+            || poa->tao_poa_manager ().get_state_i () !=
+              PortableServer::POAManager::ACTIVE
+            || poa->cleanup_in_progress_
+            || poa->waiting_destruction_)
+          return false;
+
+        this->current_context_.setup (poa, key);
+
+        PortableServer::Servant servant = 0;
+        if (entry != 0)
+          {
+            // Same as ServantRetentionStrategyRetain::find_servant().
+            if (!entry->deactivated_ && entry->servant_ != 0)
+              {
+                this->current_context_.object_id (entry->user_id_);
+                this->user_id (&this->current_context_.object_id ());
+                this->active_object_map_entry (entry);
+                this->increment_servant_refcount ();
+                servant = entry->servant_;
+              }
+          }
+        else
+          {
+            try
+              {
+                servant = poa->find_servant (this->system_id_,
+                                             *this,
+                                             this->current_context_);
+              }
+            catch (...)
+              {
+                // Let the locked path report the error.
+              }
+
+            if (servant != 0 && cache != 0)
+              cache->update (key,
+                             this->object_adapter_->generation_,
+                             this->system_id_,
+                             poa,
+                             this->active_object_map_entry_);
+          }
+
+        if (servant == 0)
+          {
+            this->current_context_.teardown ();
+            this->active_object_map_entry_ = 0;
+            return false;
+          }
+
+        // find_servant() pinned the servant, pin the POA too.
+        poa->increment_outstanding_requests ();
+
+        this->poa_ = poa;
+        this->servant_ = servant;
+        this->lock_free_ = true;
+        this->state_ = OBJECT_ADAPTER_LOCK_RELEASED;
+      }
+
+      this->current_context_.servant (this->servant_);
+      this->current_context_.priority (this->active_object_map_entry_->priority_);
+
+      // Serialize servants (if appropriate).
+      this->single_threaded_poa_setup ();
+
+      // We have acquired the servant lock.  Record this for later use.
+      this->state_ = SERVANT_LOCK_ACQUIRED;
+
+      return true;
+    }
+
+    bool
+    Servant_Upcall::upcall_cleanup_fast (void)
+    {
+      Object_Adapter_Lock::Read_Guard guard (*this->object_adapter_->lock_);
+
+      // Neither count can drop to zero unless the servant is
+      // deactivated or the POA destroyed, those are left to the locked
+      // path so it can clean up and wake up the waiting threads.
+      if (!guard.entered ()
+          || this->object_adapter_->non_servant_upcall_in_progress_ != 0
+          || this->active_object_map_entry_->deactivated_
+          || this->poa_->wait_for_completion_pending_
+          || this->poa_->waiting_destruction_)
+        return false;
+
+      --this->active_object_map_entry_->reference_count_;
+      this->poa_->decrement_outstanding_requests ();
+
+      // Teardown current for this request.
+      this->current_context_.teardown ();
+
+      return true;
+    }
+
     void
     Servant_Upcall::pre_invoke_remote_request (TAO_ServerRequest &req)
     {
@@ -249,6 +389,13 @@ namespace TAO
           // state, it is ok to call it outside the lock.
           this->post_invoke_servant_cleanup ();
 
+          if (this->lock_free_)
+            {
+              this->lock_free_ = false;
+              if (this->upcall_cleanup_fast ())
+                break;
+            }
+
           // Since the object adapter lock was released, we must acquire
           // it.
           //
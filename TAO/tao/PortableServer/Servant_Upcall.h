@@ -47,6 +47,8 @@ namespace TAO
 {
   namespace Portable_Server
   {
+    class Demux_Cache;
+
     /**
      * @class Servant_Upcall
      *
@@ -95,10 +97,12 @@ namespace TAO
       /// Destructor.
       ~Servant_Upcall (void);
 
-      /// Locate POA and servant.
+      /// Locate POA and servant.  Use @a cache instead of the
+      /// demultiplexing cache of the thread when it is not zero.
       int prepare_for_upcall (const TAO::ObjectKey &key,
                               const char *operation,
-                              CORBA::Object_out forward_to);
+                              CORBA::Object_out forward_to,
+                              Demux_Cache *cache = 0);
 
       /// Helper.
       int prepare_for_upcall_i (const TAO::ObjectKey &key,
@@ -180,6 +184,17 @@ namespace TAO
 
     protected:
 
+      /// Find the servant of an active object in a RETAIN POA without
+      /// the Object Adapter lock.  Returns false, with nothing changed,
+      /// if the request needs the locked path.
+      bool prepare_for_upcall_fast (const TAO::ObjectKey &key,
+                                    Demux_Cache *cache);
+
+      /// Undo prepare_for_upcall_fast() without the Object Adapter lock.
+      /// Returns false, with nothing changed, if the cleanup may have to
+      /// wake up other threads and needs the locked path.
+      bool upcall_cleanup_fast (void);
+
       void post_invoke_servant_cleanup (void);
       void single_threaded_poa_setup (void);
       void single_threaded_poa_cleanup (void);
@@ -223,6 +238,9 @@ namespace TAO
       /// Preinvoke data for the upcall.
       Pre_Invoke_State pre_invoke_state_;
 
+      /// Was the servant found without the Object Adapter lock?
+      bool lock_free_;
+
     private:
       Servant_Upcall (const Servant_Upcall &);
       void operator= (const Servant_Upcall &);
@@ -5,6 +5,8 @@
 #include "tao/PortableServer/UB_String_SArgument_T.h"
 #endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
 
+#include "tao/PortableServer/Arena_Demarshal.h"
+
 #if !defined (__ACE_INLINE__)
 #include "tao/PortableServer/UB_String_SArgument_T.inl"
 #endif /* __ACE_INLINE__ */
@@ -15,7 +17,8 @@ template<typename S, typename S_var>
 CORBA::Boolean
 TAO::In_UB_String_SArgument_T<S,S_var>::demarshal (TAO_InputCDR &cdr)
 {
-  return cdr >> this->x_.out ();
+  return
+    TAO::Portable_Server::demarshal_in_string (cdr, this->x_, this->value_);
 }
 
 #if TAO_HAS_INTERCEPTORS == 1
@@ -25,7 +28,7 @@ void
 TAO::In_UB_String_SArgument_T<S,S_var>::interceptor_value (
   CORBA::Any *any) const
 {
-  (*any) <<= this->x_.in ();
+  (*any) <<= this->value_;
 }
 
 #endif /* TAO_HAS_INTERCEPTORS */
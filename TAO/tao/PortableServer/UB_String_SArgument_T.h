@@ -42,7 +42,11 @@ namespace TAO
     S const * arg (void) const;
 
   private:
+    /// Holds the string when it is not in the upcall arena.
     S_var x_;
+
+    /// The demarshaled string.
+    S const * value_;
   };
 
   /**
@@ -4,13 +4,14 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 template<typename S, typename S_var>
 ACE_INLINE
 TAO::In_UB_String_SArgument_T<S,S_var>::In_UB_String_SArgument_T (void)
+  : value_ (0)
 {}
 
 template<typename S, typename S_var>
 const S *
 TAO::In_UB_String_SArgument_T<S,S_var>::arg (void) const
 {
-  return this->x_.in ();
+  return this->value_;
 }
 
 // ==========================================================================
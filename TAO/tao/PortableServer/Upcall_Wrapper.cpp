@@ -15,6 +15,7 @@
 #include "tao/CDR.h"
 #include "tao/Argument.h"
 #include "tao/operation_details.h"
+#include "tao/Upcall_Arena.h"
 #include "ace/Log_Msg.h"
 #include "tao/debug.h"
 
@@ -32,6 +33,10 @@ TAO::Upcall_Wrapper::upcall (TAO_ServerRequest & server_request,
 #endif  /* TAO_HAS_INTERCEPTORS == 1 */
                              )
 {
+  // The in arguments are demarshaled into the arena of the thread,
+  // they stay there until the reply is marshaled.
+  TAO::Upcall_Arena::Scope const arena_scope;
+
   if (server_request.collocated ()
     && server_request.operation_details ()->cac () != 0)
     {
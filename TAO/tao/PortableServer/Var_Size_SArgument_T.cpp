@@ -5,6 +5,7 @@
 #include "tao/PortableServer/Var_Size_SArgument_T.h"
 #endif /* ACE_TEMPLATES_REQUIRE_PRAGMA */
 
+#include "tao/PortableServer/Arena_Demarshal.h"
 #include "tao/SystemException.h"
 
 #if !defined (__ACE_INLINE__)
@@ -18,7 +19,8 @@ template<typename S,
 CORBA::Boolean
 TAO::In_Var_Size_SArgument_T<S,Insert_Policy>::demarshal (TAO_InputCDR &cdr)
 {
-  return cdr >> this->x_;
+  return
+    TAO::Portable_Server::demarshal_in_argument (cdr, this->x_, &this->x_);
 }
 
 #if TAO_HAS_INTERCEPTORS == 1
@@ -915,6 +915,7 @@ operator>>(TAO_InputCDR& cdr, TAO_opaque& x)
 #if (TAO_NO_COPY_OCTET_SEQUENCES == 1)
   if(ACE_BIT_DISABLED(cdr.start()->flags(),
                       ACE_Message_Block::DONT_DELETE)
+     && cdr.start()->cont() == 0
      && (cdr.orb_core() == 0
          || 1 == cdr.orb_core()->
          resource_factory()->
@@ -236,4 +236,34 @@ TAO_Queued_Data::consolidate (void)
   return 0;
 }
 
+int
+TAO_Queued_Data::chain (void)
+{
+  if (!this->state_.more_fragments () || this->msg_block_->cont () == 0)
+    return 0;
+
+  // The CDR stream aligns the data on the addresses in the blocks,
+  // each fragment must end and the next one start on an aligned
+  // address.  The fragments of TAO are padded to a multiple of
+  // ACE_CDR::MAX_ALIGNMENT, the other ORBs may not do that.
+  bool aligned = !this->state_.compressed ();
+
+  for (ACE_Message_Block *i = this->msg_block_;
+       aligned && i->cont () != 0;
+       i = i->cont ())
+    {
+      aligned =
+        ACE_ptr_align_binary (i->wr_ptr (), ACE_CDR::MAX_ALIGNMENT) == i->wr_ptr ()
+        && ACE_ptr_align_binary (i->cont ()->rd_ptr (), ACE_CDR::MAX_ALIGNMENT)
+             == i->cont ()->rd_ptr ();
+    }
+
+  if (!aligned)
+    return this->consolidate ();
+
+  this->state_.more_fragments (false);
+
+  return 0;
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
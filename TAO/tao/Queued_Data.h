@@ -39,8 +39,8 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
  *
  * The ACE_Message_Block contained within this class may contain a chain
  * of message blocks (usually when GIOP fragments are involved).  In that
- * case consolidate () needs to be called prior to being sent to higher
- * layers of the ORB when the GIOP fragment chain is complete.
+ * case consolidate () or chain () needs to be called prior to being sent
+ * to higher layers of the ORB when the GIOP fragment chain is complete.
  */
 class TAO_Export TAO_Queued_Data
 {
@@ -71,6 +71,13 @@ public:
   /// @return -1 if consolidation failed, eg out or memory, otherwise 0
   int consolidate (void);
 
+  /// Keep the chained message blocks of the fragments, the message is
+  /// read from the chain by the CDR stream without copying it.  Falls
+  /// back to consolidate() when the fragments are not aligned on
+  /// ACE_CDR::MAX_ALIGNMENT or the message is compressed.
+  /// @return -1 if consolidation failed, eg out of memory, otherwise 0
+  int chain (void);
+
   /// Get missing data
   size_t missing_data (void) const;
 
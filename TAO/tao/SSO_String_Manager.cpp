@@ -0,0 +1,62 @@
+#include "tao/SSO_String_Manager_T.h"
+#include "tao/CDR.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+CORBA::Boolean
+operator<< (TAO_OutputCDR &strm, const TAO::SSO_String_Manager &x)
+{
+  return strm << x.in ();
+}
+
+CORBA::Boolean
+operator<< (TAO_OutputCDR &strm, const TAO::SSO_WString_Manager &x)
+{
+  return strm << x.in ();
+}
+
+CORBA::Boolean
+operator>> (TAO_InputCDR &strm, TAO::SSO_String_Manager &x)
+{
+  if (strm.char_translator () != 0)
+    {
+      return strm >> x.out ();
+    }
+
+  CORBA::ULong length = 0;
+  if (!strm.read_ulong (length) || length > strm.length ())
+    {
+      return false;
+    }
+
+  // Null strings are read as empty strings, as the stream reads them.
+  CORBA::Char * const buffer = x.allocate (length == 0 ? 0 : length - 1);
+  if (buffer == 0)
+    {
+      return false;
+    }
+
+  if (length == 0)
+    {
+      buffer[0] = '\0';
+      return true;
+    }
+
+  if (!strm.read_char_array (buffer, length))
+    {
+      buffer[0] = '\0';
+      return false;
+    }
+
+  return true;
+}
+
+CORBA::Boolean
+operator>> (TAO_InputCDR &strm, TAO::SSO_WString_Manager &x)
+{
+  // The length of a wide string depends on the GIOP version and the
+  // code set, leave it to the stream.
+  return strm >> x.out ();
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,297 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    SSO_String_Manager_T.h
+ *
+ *  String members with inline storage for short strings, generated by
+ *  tao_idl -Gsso.
+ */
+//=============================================================================
+
+#ifndef TAO_SSO_STRING_MANAGER_T
+#define TAO_SSO_STRING_MANAGER_T
+
+#include /**/ "ace/pre.h"
+
+#include /**/ "tao/TAO_Export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "ace/OS_NS_string.h"
+#include "tao/orbconf.h"
+#include "tao/Basic_Types.h"
+#include "tao/String_Traits_Base_T.h"
+
+#include <algorithm>
+
+/****************************************************************/
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+class TAO_OutputCDR;
+class TAO_InputCDR;
+
+namespace TAO
+{
+/**
+ * @class SSO_String_Manager_T
+ *
+ * @brief A String_Manager_T keeping short strings inline.
+ *
+ * Strings shorter than TAO_SSO_STRING_MANAGER_SIZE characters are
+ * copied into the manager instead of being allocated with
+ * CORBA::string_dup, so a default constructed member or one assigned
+ * a short identifier does not touch the heap.  Longer strings, and
+ * the strings the manager is given ownership of, live on the heap as
+ * with String_Manager_T.
+ *
+ * The interface is that of String_Manager_T.  inout () and _retn ()
+ * hand out heap strings, as the C++ mapping allows the caller to free
+ * or replace them, and move an inline string to the heap first.
+ */
+template <typename charT>
+class SSO_String_Manager_T
+{
+public:
+  typedef charT character_type;
+  typedef TAO::details::string_traits_base <charT> s_traits;
+
+  /// Number of characters, terminating null included, kept inline.
+  enum { inline_size = TAO_SSO_STRING_MANAGER_SIZE };
+
+  /// Default CTOR will initialize the string to the empty string.
+  inline SSO_String_Manager_T (void) : ptr_ (buffer_)
+  {
+    this->buffer_[0] = 0;
+  }
+
+  /// Copy constructor
+  inline SSO_String_Manager_T (const SSO_String_Manager_T<charT> &rhs) :
+    ptr_ (buffer_)
+  {
+    this->buffer_[0] = 0;
+    this->assign (rhs.ptr_);
+  }
+
+#if defined (ACE_HAS_CPP11)
+  /// Move constructor, takes the heap string of @a rhs and leaves it
+  /// null, as _retn() does.
+  inline SSO_String_Manager_T (SSO_String_Manager_T<charT> &&rhs) :
+    ptr_ (buffer_)
+  {
+    this->buffer_[0] = 0;
+    if (rhs.ptr_ == rhs.buffer_)
+      {
+        this->assign (rhs.buffer_);
+      }
+    else
+      {
+        this->ptr_ = rhs.ptr_;
+      }
+    rhs.ptr_ = 0;
+  }
+#endif /* ACE_HAS_CPP11 */
+
+  /// Constructor from const char* makes a copy.
+  inline SSO_String_Manager_T (const character_type *s) : ptr_ (buffer_)
+  {
+    this->buffer_[0] = 0;
+    this->assign (s);
+  }
+
+  /// Destructor
+  inline ~SSO_String_Manager_T (void) {
+    this->release_heap ();
+  }
+
+  /// Assignment from another managed type
+  inline SSO_String_Manager_T &operator= (const SSO_String_Manager_T<charT> &rhs) {
+    this->assign (rhs.ptr_);
+    return *this;
+  }
+
+#if defined (ACE_HAS_CPP11)
+  /// Move assignment, takes the heap string of @a rhs and leaves it
+  /// null.
+  inline SSO_String_Manager_T &operator= (SSO_String_Manager_T<charT> &&rhs) {
+    if (this != &rhs)
+      {
+        if (rhs.ptr_ == rhs.buffer_)
+          {
+            this->assign (rhs.buffer_);
+          }
+        else
+          {
+            this->release_heap ();
+            this->ptr_ = rhs.ptr_;
+          }
+        rhs.ptr_ = 0;
+      }
+    return *this;
+  }
+#endif /* ACE_HAS_CPP11 */
+
+  /// Assignment from var type will make a copy
+  inline SSO_String_Manager_T &operator= (const typename s_traits::string_var& value) {
+    this->assign (value.in ());
+    return *this;
+  }
+
+  /// Assignment from a constant * will make a copy
+  inline SSO_String_Manager_T &operator= (const character_type *p) {
+    this->assign (p);
+    return *this;
+  }
+
+  /// Assignment from char* will not make a copy. The manager will now
+  /// own the string.
+  inline SSO_String_Manager_T &operator= (character_type *p) {
+    this->release_heap ();
+    this->ptr_ = p;
+    return *this;
+  }
+
+  /// Cast (read-only)
+  inline operator const character_type*() const {
+    return this->ptr_;
+  }
+
+  /// For in parameter.
+  inline const character_type *in (void) const {
+    return this->ptr_;
+  }
+
+  /// For inout parameter.
+  inline character_type *&inout (void) {
+    if (this->ptr_ == this->buffer_)
+      {
+        this->ptr_ = s_traits::duplicate (this->buffer_);
+      }
+    return this->ptr_;
+  }
+
+  /// for out parameter.
+  inline character_type *&out (void) {
+    this->release_heap ();
+    this->ptr_ = 0;
+    return this->ptr_;
+  }
+
+  /// For string of return type.
+  inline character_type *_retn (void) {
+    character_type *temp = this->ptr_;
+    if (temp == this->buffer_)
+      {
+        temp = s_traits::duplicate (this->buffer_);
+      }
+    this->ptr_ = 0;
+    return temp;
+  }
+
+  /// TAO extension.  Make room for a string of @a length characters,
+  /// not counting the terminating null, and return it to be filled.
+  /// Returns 0 when the string cannot be allocated.
+  inline character_type *allocate (CORBA::ULong length) {
+    if (length < static_cast<CORBA::ULong> (inline_size))
+      {
+        this->release_heap ();
+        this->ptr_ = this->buffer_;
+      }
+    else
+      {
+        character_type * const p = s_traits::allocate (length);
+        if (p == 0)
+          {
+            return 0;
+          }
+        this->release_heap ();
+        this->ptr_ = p;
+      }
+    return this->ptr_;
+  }
+
+private:
+  /// Copy @a s, inline when it fits.
+  inline void assign (const character_type *s) {
+    if (s == this->ptr_)
+      {
+        return;
+      }
+
+    if (s == 0)
+      {
+        this->release_heap ();
+        this->ptr_ = 0;
+        return;
+      }
+
+    size_t const length = ACE_OS::strlen (s);
+    if (length < static_cast<size_t> (inline_size))
+      {
+        // s may be part of the heap string, copy it before releasing.
+        character_type * const old = this->ptr_;
+        ACE_OS::memmove (this->buffer_, s, (length + 1) * sizeof (character_type));
+        this->ptr_ = this->buffer_;
+        if (old != this->buffer_)
+          {
+            s_traits::release (old);
+          }
+      }
+    else
+      {
+        character_type * const p = s_traits::duplicate (s);
+        this->release_heap ();
+        this->ptr_ = p;
+      }
+  }
+
+  /// Free the string when it lives on the heap.
+  inline void release_heap (void) {
+    if (this->ptr_ != this->buffer_)
+      {
+        s_traits::release (this->ptr_);
+      }
+  }
+
+private:
+  /// The string, buffer_, a heap string or null.
+  character_type *ptr_;
+
+  /// The inline storage.
+  character_type buffer_[inline_size];
+};
+
+  typedef TAO::SSO_String_Manager_T<CORBA::Char> SSO_String_Manager;
+  typedef TAO::SSO_String_Manager_T<CORBA::WChar> SSO_WString_Manager;
+}
+
+inline bool operator< (const TAO::SSO_String_Manager &lhs, const TAO::SSO_String_Manager &rhs)
+{
+  return ACE_OS::strcmp (lhs.in(), rhs.in ()) < 0;
+}
+
+inline bool operator< (const TAO::SSO_WString_Manager &lhs, const TAO::SSO_WString_Manager &rhs)
+{
+  return ACE_OS::strcmp (lhs.in(), rhs.in ()) < 0;
+}
+
+/// Marshal the string, as strm << x.in () does.
+TAO_Export CORBA::Boolean operator<< (TAO_OutputCDR &strm,
+                                      const TAO::SSO_String_Manager &x);
+TAO_Export CORBA::Boolean operator<< (TAO_OutputCDR &strm,
+                                      const TAO::SSO_WString_Manager &x);
+
+/// Demarshal a string into @a x, inline when it fits and the stream
+/// has no code set translator.
+TAO_Export CORBA::Boolean operator>> (TAO_InputCDR &strm,
+                                      TAO::SSO_String_Manager &x);
+TAO_Export CORBA::Boolean operator>> (TAO_InputCDR &strm,
+                                      TAO::SSO_WString_Manager &x);
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_SSO_STRING_MANAGER_T */
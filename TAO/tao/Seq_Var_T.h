@@ -21,6 +21,8 @@
 
 #include "tao/Basic_Types.h"
 
+#include <utility>
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 /**
@@ -37,6 +39,9 @@ public:
   TAO_Seq_Var_Base_T (void);
   TAO_Seq_Var_Base_T (T *);
   TAO_Seq_Var_Base_T (const TAO_Seq_Var_Base_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  TAO_Seq_Var_Base_T (TAO_Seq_Var_Base_T<T> &&);
+#endif /* ACE_HAS_CPP11 */
 
   ~TAO_Seq_Var_Base_T (void);
 
@@ -81,12 +86,18 @@ public:
   TAO_FixedSeq_Var_T (void);
   TAO_FixedSeq_Var_T (T *);
   TAO_FixedSeq_Var_T (const TAO_FixedSeq_Var_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  TAO_FixedSeq_Var_T (TAO_FixedSeq_Var_T<T> &&);
+#endif /* ACE_HAS_CPP11 */
 
   // Fixed-size base types only.
   TAO_FixedSeq_Var_T (const T &);
 
   TAO_FixedSeq_Var_T & operator= (T *);
   TAO_FixedSeq_Var_T & operator= (const TAO_FixedSeq_Var_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  TAO_FixedSeq_Var_T & operator= (TAO_FixedSeq_Var_T<T> &&);
+#endif /* ACE_HAS_CPP11 */
 
   T_elem operator[] (CORBA::ULong index);
   T_const_elem operator[] (CORBA::ULong index) const;
@@ -111,9 +122,15 @@ public:
   TAO_VarSeq_Var_T (void);
   TAO_VarSeq_Var_T (T *);
   TAO_VarSeq_Var_T (const TAO_VarSeq_Var_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  TAO_VarSeq_Var_T (TAO_VarSeq_Var_T<T> &&);
+#endif /* ACE_HAS_CPP11 */
 
   TAO_VarSeq_Var_T & operator= (T *);
   TAO_VarSeq_Var_T & operator= (const TAO_VarSeq_Var_T<T> &);
+#if defined (ACE_HAS_CPP11)
+  TAO_VarSeq_Var_T & operator= (TAO_VarSeq_Var_T<T> &&);
+#endif /* ACE_HAS_CPP11 */
 
   T_elem operator[] (CORBA::ULong index);
   T_const_elem operator[] (CORBA::ULong index) const;
@@ -15,6 +15,16 @@ TAO_Seq_Var_Base_T<T>::TAO_Seq_Var_Base_T (T * p)
   : ptr_ (p)
 {}
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Seq_Var_Base_T<T>::TAO_Seq_Var_Base_T (TAO_Seq_Var_Base_T<T> && p)
+  : ptr_ (p.ptr_)
+{
+  p.ptr_ = 0;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Seq_Var_Base_T<T>::~TAO_Seq_Var_Base_T (void)
@@ -133,6 +143,15 @@ TAO_FixedSeq_Var_T<T>::TAO_FixedSeq_Var_T (const T & p)
            T (p));
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_FixedSeq_Var_T<T>::TAO_FixedSeq_Var_T (TAO_FixedSeq_Var_T<T> && p)
+  : TAO_Seq_Var_Base_T<T> (std::move (p))
+{
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_FixedSeq_Var_T<T> &
@@ -143,6 +162,22 @@ TAO_FixedSeq_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_FixedSeq_Var_T<T> &
+TAO_FixedSeq_Var_T<T>::operator= (TAO_FixedSeq_Var_T<T> && p)
+{
+  if (this != &p)
+    {
+      delete this->ptr_;
+      this->ptr_ = p.ptr_;
+      p.ptr_ = 0;
+    }
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 typename TAO_FixedSeq_Var_T<T>::T_elem
@@ -181,6 +216,15 @@ TAO_VarSeq_Var_T<T>::TAO_VarSeq_Var_T (
 {
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_VarSeq_Var_T<T>::TAO_VarSeq_Var_T (TAO_VarSeq_Var_T<T> && p)
+  : TAO_Seq_Var_Base_T<T> (std::move (p))
+{
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_VarSeq_Var_T<T> &
@@ -191,6 +235,22 @@ TAO_VarSeq_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_VarSeq_Var_T<T> &
+TAO_VarSeq_Var_T<T>::operator= (TAO_VarSeq_Var_T<T> && p)
+{
+  if (this != &p)
+    {
+      delete this->ptr_;
+      this->ptr_ = p.ptr_;
+      p.ptr_ = 0;
+    }
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 // Variable-size types only
 template<typename T>
 ACE_INLINE
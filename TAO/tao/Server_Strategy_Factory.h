@@ -31,6 +31,7 @@ enum TAO_Demux_Strategy
   TAO_LINEAR,
   TAO_DYNAMIC_HASH,
   TAO_ACTIVE_DEMUX,
+  TAO_INDEXED_DEMUX,
   TAO_USER_DEFINED
 };
 
@@ -82,6 +83,11 @@ public:
     TAO_Demux_Strategy poa_lookup_strategy_for_persistent_id_policy_;
 
     int use_active_hint_in_poa_names_;
+
+    /// Flag to indicate whether each thread should remember the
+    /// target of its last upcall, to demultiplex the requests on the
+    /// same object without looking up the POA and the servant again.
+    int use_demux_cache_;
   };
 
   /// Constructor.
@@ -24,6 +24,7 @@
 #include "tao/String_Traits_Base_T.h"
 
 #include <algorithm>
+#include <utility>
 
 /****************************************************************/
 
@@ -49,6 +50,16 @@ public:
   {
   }
 
+#if defined (ACE_HAS_CPP11)
+  /// Move constructor, takes the string of @a rhs and leaves it null,
+  /// as _retn() does.
+  inline String_Manager_T (String_Manager_T<charT> &&rhs) :
+    ptr_ (rhs.ptr_)
+  {
+    rhs.ptr_ = 0;
+  }
+#endif /* ACE_HAS_CPP11 */
+
   /// Constructor from const char* makes a copy.
   inline String_Manager_T (const character_type *s) :
     ptr_ (s_traits::duplicate (s))
@@ -69,6 +80,15 @@ public:
     return *this;
   }
 
+#if defined (ACE_HAS_CPP11)
+  /// Move assignment, takes the string of @a rhs and leaves it null.
+  inline String_Manager_T &operator= (String_Manager_T<charT> &&rhs) {
+    String_Manager_T <character_type> tmp (std::move (rhs));
+    std::swap (this->ptr_, tmp.ptr_);
+    return *this;
+  }
+#endif /* ACE_HAS_CPP11 */
+
   /// Assignment from var type will make a copy
   inline String_Manager_T &operator= (const typename s_traits::string_var& value) {
     // Strongly exception safe by means of copy and non-throwing swap
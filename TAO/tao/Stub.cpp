@@ -17,6 +17,7 @@
 #include "tao/Policy_Set.h"
 #include "tao/SystemException.h"
 #include "tao/CDR.h"
+#include "tao/Adapter.h"
 
 #if !defined (__ACE_INLINE__)
 # include "tao/Stub.inl"
@@ -36,6 +37,7 @@ TAO_Stub::TAO_Stub (const char *repository_id,
   , is_collocated_ (false)
   , servant_orb_ ()
   , collocated_servant_ (0)
+  , collocation_cache_ (0)
   , object_proxy_broker_ (the_tao_remote_object_proxy_broker ())
   , base_profiles_ ((CORBA::ULong) 0)
   , forward_profiles_ (0)
@@ -103,6 +105,27 @@ TAO_Stub::~TAO_Stub (void)
   delete this->ior_info_;
 
   delete this->forwarded_ior_info_;
+
+  delete this->collocation_cache_;
+}
+
+void
+TAO_Stub::collocation_cache (TAO::Collocation_Cache *cache)
+{
+  {
+    ACE_MT (ACE_GUARD (TAO_SYNCH_MUTEX,
+                       guard,
+                       this->profile_lock_));
+
+    // Invocations may be using the current cache.
+    if (this->collocation_cache_ == 0)
+      {
+        this->collocation_cache_ = cache;
+        return;
+      }
+  }
+
+  delete cache;
 }
 
 void
@@ -45,6 +45,7 @@ namespace TAO
 {
   class ObjectKey;
   class Object_Proxy_Broker;
+  class Collocation_Cache;
   class Transport_Queueing_Strategy;
 }
 
@@ -238,6 +239,18 @@ public:
   /// Accessor for the servant reference in collocated cases.
   TAO_Abstract_ServantBase* collocated_servant (void) const;
 
+  /**
+   * THREAD SAFE
+   * Attach the cache of the adapter that made this stub collocated,
+   * the stub owns it.  A stub keeps the first cache attached to it
+   * until it is destroyed, @a cache is deleted if the stub has one
+   * already.
+   */
+  void collocation_cache (TAO::Collocation_Cache *cache);
+
+  /// Accessor for the collocation cache, 0 if none was attached.
+  TAO::Collocation_Cache *collocation_cache (void) const;
+
   /// Mutator for setting the object proxy broker pointer.
   /// CORBA::Objects using this stub will use this for standard calls
   /// like is_a; get_interface; etc...
@@ -355,6 +368,10 @@ protected:
   /// Servant pointer.  It is 0 except for collocated objects.
   TAO_Abstract_ServantBase *collocated_servant_;
 
+  /// The cache of the adapter of the servant, used by the thru-POA
+  /// collocated invocations.
+  TAO::Collocation_Cache *collocation_cache_;
+
   /// Pointer to the Proxy Broker
   /**
     * This cached pointer instance takes care of routing the call for
@@ -341,6 +341,12 @@ TAO_Stub::collocated_servant (TAO_Abstract_ServantBase * servant)
   this->collocated_servant_ = servant;
 }
 
+ACE_INLINE TAO::Collocation_Cache *
+TAO_Stub::collocation_cache (void) const
+{
+  return this->collocation_cache_;
+}
+
 ACE_INLINE TAO::Object_Proxy_Broker *
 TAO_Stub::object_proxy_broker (void) const
 {
@@ -24,6 +24,7 @@
 #include "tao/Environment.h"
 
 #include "tao/Policy_Current_Impl.h"
+#include "tao/Upcall_Arena.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -119,6 +120,9 @@ public:
   TAO::Transport_Selection_Guard* tsg_;
 
 #endif  /* TAO_HAS_TRANSPORT_CURRENT == 1 */
+
+  /// Storage for the in arguments of the upcalls of the thread.
+  TAO::Upcall_Arena upcall_arena_;
 };
 
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -92,6 +92,9 @@ TAO_Tagged_Profile::unmarshall_object_key_i (TAO_InputCDR &input)
   CORBA::Long key_length = 0;
   hdr_status = hdr_status && input.read_long (key_length);
 
+  // The object key is used in place, it must be in one block.
+  hdr_status = hdr_status && input.pullup (key_length) == 0;
+
   if (hdr_status)
     {
       this->object_key_.replace (key_length,
@@ -153,6 +156,7 @@ TAO_Tagged_Profile::unmarshall_ref_addr_i (TAO_InputCDR &input)
   // Get the length of the type_id
   CORBA::Long id_length = 0;
   hdr_status = hdr_status && input.read_long (id_length);
+  hdr_status = hdr_status && input.pullup (id_length) == 0;
 
   if (hdr_status)
     {
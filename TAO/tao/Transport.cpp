@@ -24,6 +24,7 @@
 #include "tao/operation_details.h"
 #include "tao/Transport_Descriptor_Interface.h"
 #include "tao/ORB_Time_Policy.h"
+#include "tao/Batch_Scope.h"
 
 #include "ace/OS_NS_sys_time.h"
 #include "ace/OS_NS_stdio.h"
@@ -139,7 +140,10 @@ TAO_Transport::TAO_Transport (CORBA::ULong tag,
   , id_ ((size_t) this)
   , purging_order_ (0)
   , recv_buffer_size_ (0)
+  , recv_size_estimate_ (0)
   , sent_byte_count_ (0)
+  , link_throughput_ (0)
+  , link_blocked_since_ (ACE_Time_Value::zero)
   , is_connected_ (false)
   , connection_closed_on_read_ (false)
   , messaging_object_ (0)
@@ -1013,6 +1017,50 @@ TAO_Transport::drain_queue (TAO::Transport::Drain_Constraints const & dc)
   return retval;
 }
 
+void
+TAO_Transport::update_link_throughput (size_t byte_count,
+                                       size_t requested,
+                                       bool would_block)
+{
+  // While the sends complete at once they only measure the copy into
+  // the socket buffer, the link throughput shows once it is full.
+  bool const limited = would_block || byte_count < requested;
+  if (!limited && this->link_blocked_since_ == ACE_Time_Value::zero)
+    {
+      return;
+    }
+
+  ACE_Time_Value const now = ACE_OS::gettimeofday ();
+
+  if (byte_count != 0 && this->link_blocked_since_ != ACE_Time_Value::zero)
+    {
+      ACE_UINT64 usecs = 0;
+      (now - this->link_blocked_since_).to_usec (usecs);
+      if (usecs != 0)
+        {
+          size_t const sample =
+            static_cast<size_t> (byte_count * ACE_UINT64 (1000000) / usecs);
+
+          // Same weight as the estimate of the message size.
+          unsigned long const current = this->link_throughput_.value ();
+          this->link_throughput_ =
+            current == 0
+              ? sample
+              : current - current / 8 + sample / 8;
+        }
+    }
+
+  if (!limited)
+    {
+      this->link_blocked_since_ = ACE_Time_Value::zero;
+    }
+  else if (byte_count != 0
+           || this->link_blocked_since_ == ACE_Time_Value::zero)
+    {
+      this->link_blocked_since_ = now;
+    }
+}
+
 TAO_Transport::Drain_Result
 TAO_Transport::drain_queue_helper (int &iovcnt, iovec iov[],
     TAO::Transport::Drain_Constraints const & dc)
@@ -1068,12 +1116,20 @@ TAO_Transport::drain_queue_helper (int &iovcnt, iovec iov[],
 
       if (errno == EWOULDBLOCK || errno == EAGAIN)
         {
+          this->update_link_throughput (0, 0, true);
           return DR_WOULDBLOCK;
         }
 
       return DR_ERROR;
     }
 
+  size_t requested = 0;
+  for (int i = 0; i != iovcnt; ++i)
+    {
+      requested += iov[i].iov_len;
+    }
+  this->update_link_throughput (byte_count, requested, false);
+
   // ... now we need to update the queue, removing elements
   // that have been sent, and updating the last element if it
   // was only partially sent ...
@@ -1415,9 +1471,25 @@ TAO_Transport::send_message_shared_i (TAO_Stub *stub,
         break;
 
       case TAO_Message_Semantics::TAO_ONEWAY_REQUEST:
-        ret = this->send_asynchronous_message_i (stub,
-                                                 message_block,
-                                                 max_wait_time);
+        {
+          // Oneways and AMI requests are queued while the thread is in
+          // a batch scope.
+          TAO::Batch_Scope * const batch =
+            TAO::Batch_Scope::current (this->orb_core_);
+
+          if (batch != 0)
+            {
+              ret = this->send_batched_message_i (batch,
+                                                  message_block,
+                                                  max_wait_time);
+            }
+          else
+            {
+              ret = this->send_asynchronous_message_i (stub,
+                                                       message_block,
+                                                       max_wait_time);
+            }
+        }
         break;
     }
 
@@ -1578,7 +1650,7 @@ TAO_Transport::send_asynchronous_message_i (TAO_Stub *stub,
           TAOLIB_DEBUG ((LM_DEBUG,
                       ACE_TEXT ("TAO (%P|%t) - Transport[%d]::")
                       ACE_TEXT ("send_asynchronous_message_i, ")
-                      ACE_TEXT ("cannot queue message for  - %m\n"),
+                      ACE_TEXT ("cannot queue message - %m\n"),
                       this->id ()));
         }
       return -1;
@@ -1681,6 +1753,65 @@ TAO_Transport::send_asynchronous_message_i (TAO_Stub *stub,
   return 0;
 }
 
+int
+TAO_Transport::send_batched_message_i (TAO::Batch_Scope *batch,
+                                       const ACE_Message_Block *message_block,
+                                       ACE_Time_Value *max_wait_time)
+{
+  if (this->queue_message_i (message_block, max_wait_time) == -1)
+    {
+      if (TAO_debug_level > 0)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                      ACE_TEXT ("TAO (%P|%t) - Transport[%d]::")
+                      ACE_TEXT ("send_batched_message_i, ")
+                      ACE_TEXT ("cannot queue message - %m\n"),
+                      this->id ()));
+        }
+      return -1;
+    }
+
+  batch->add (this);
+
+  return 0;
+}
+
+int
+TAO_Transport::flush_batch (ACE_Time_Value *max_wait_time)
+{
+  if (!this->is_connected_)
+    {
+      // The queue is drained when the connection completes
+      return 0;
+    }
+
+  TAO::Transport::Drain_Constraints dc (
+      max_wait_time, this->using_blocking_io_for_asynch_messages ());
+
+  if (this->drain_queue (dc) == DR_ERROR)
+    {
+      this->close_connection ();
+      return -1;
+    }
+
+  if (this->queue_is_empty ())
+    {
+      return 0;
+    }
+
+  // The connection could not take all the messages, let the flushing
+  // strategy send the rest.
+  TAO_Flushing_Strategy *flushing_strategy =
+    this->orb_core ()->flushing_strategy ();
+
+  if (flushing_strategy->schedule_output (this) == -1)
+    {
+      return -1;
+    }
+
+  return flushing_strategy->flush_transport (this, max_wait_time);
+}
+
 int
 TAO_Transport::queue_message_i (const ACE_Message_Block *message_block,
                                 ACE_Time_Value *max_wait_time, bool back)
@@ -1955,6 +2086,8 @@ TAO_Transport::handle_input_missing_data (TAO_Resume_Handle &rh,
         {
           return -1;
         }
+
+      this->recv_buffer_allocated ();
     }
 
   // Saving the size of the received buffer in case any one needs to
@@ -2022,6 +2155,19 @@ TAO_Transport::handle_input_parse_extra_messages (
           (message_block, q_data)) != -1 &&
          q_data != 0) // paranoid check
     {
+      // Each message is copied to its own buffer, only the one cut off
+      // at the end of the buffer on the stack did not fit in it
+      if (q_data->missing_data () != 0)
+        {
+          this->recv_buffer_allocated ();
+        }
+
+      if (q_data->missing_data () != TAO_MISSING_DATA_UNDEFINED)
+        {
+          this->estimate_message_size (q_data->msg_block ()->length ()
+                                       + q_data->missing_data ());
+        }
+
       if (q_data->missing_data () == 0)
         {
           if (this->consolidate_enqueue_message (q_data) == -1)
@@ -2046,6 +2192,35 @@ TAO_Transport::handle_input_parse_extra_messages (
   return 0;
 }
 
+int
+TAO_Transport::allocate_recv_buffer (ACE_Message_Block &mb, size_t size)
+{
+  ACE_Data_Block *db =
+    mb.data_block ()->clone_nocopy (0, size + ACE_CDR::MAX_ALIGNMENT);
+
+  if (db == 0)
+    {
+      return -1;
+    }
+
+  size_t const mb_len = mb.length ();
+  char *start = ACE_ptr_align_binary (db->base (),
+                                      ACE_CDR::MAX_ALIGNMENT);
+
+  ACE_OS::memcpy (start, mb.rd_ptr (), mb_len);
+
+  // The block is released with the message block, and is not copied
+  // again by TAO_Queued_Data::duplicate()
+  mb.data_block (db);
+  mb.clr_self_flags (ACE_Message_Block::DONT_DELETE);
+  mb.rd_ptr (start);
+  mb.wr_ptr (start + mb_len);
+
+  this->recv_buffer_allocated ();
+
+  return 0;
+}
+
 int
 TAO_Transport::handle_input_parse_data  (TAO_Resume_Handle &rh,
                                          ACE_Time_Value * max_wait_time)
@@ -2101,17 +2276,25 @@ TAO_Transport::handle_input_parse_data  (TAO_Resume_Handle &rh,
       return -1;
     }
 
-  if (this->orb_core_->orb_params ()->single_read_optimization ())
+  // Read as much as the buffer holds while the messages received
+  // lately fit in it. Data left over by the previous read may be
+  // longer than a GIOP header, it is always completed that way.
+  if (this->orb_core_->orb_params ()->single_read_optimization ()
+      && (this->recv_size_estimate_ <= message_block.space ()
+          || (this->partial_message_ != 0
+              && this->partial_message_->length () > 0)))
     {
       recv_size = message_block.space ();
     }
   else
     {
-      // Single read optimization has been de-activated. That means
-      // that we need to read from transport the GIOP header first
-      // before the payload. This codes first checks the incoming
-      // stack for partial messages which needs to be
-      // consolidated. Otherwise we are in new cycle, reading complete
+      // Single read optimization has been de-activated, or the
+      // messages received lately did not fit in the buffer on the
+      // stack. That means that we need to read from transport the
+      // GIOP header first before the payload, the payload is then
+      // read in a buffer of the exact size of the message. This codes
+      // first checks the incoming stack for partial messages which
+      // needs to be consolidated. Otherwise we are in new cycle, reading complete
       // GIOP header of new incoming message.
       if (this->incoming_message_stack_.top (q_data) != -1
            && q_data->missing_data () == TAO_MISSING_DATA_UNDEFINED)
@@ -2304,6 +2487,11 @@ TAO_Transport::handle_input_parse_data  (TAO_Resume_Handle &rh,
       // POST: qd.missing_data_ == 0 --> mesg_length <= message_block.length()
       // This prevents seeking rd_ptr behind the wr_ptr
 
+      if (qd.missing_data () != TAO_MISSING_DATA_UNDEFINED)
+        {
+          this->estimate_message_size (mesg_length);
+        }
+
       if (qd.missing_data () != 0 ||
           qd.more_fragments () ||
           qd.msg_type () == GIOP::Fragment)
@@ -2346,18 +2534,14 @@ TAO_Transport::handle_input_parse_data  (TAO_Resume_Handle &rh,
             }
           else if (qd.missing_data () != TAO_MISSING_DATA_UNDEFINED)
             {
-              // Incomplete message, must be the last one in buffer
-
-              if (qd.missing_data () != TAO_MISSING_DATA_UNDEFINED &&
-                  qd.missing_data () > message_block.space ())
+              // Incomplete message, must be the last one in buffer.
+              // Move it to a buffer on the heap of the exact size of
+              // the message, the missing data is read there directly
+              if (this->allocate_recv_buffer (message_block,
+                                              message_block.length ()
+                                              + qd.missing_data ()) == -1)
                 {
-                  // Re-Allocate correct size on heap
-                  if (ACE_CDR::grow (qd.msg_block (),
-                                     message_block.length ()
-                                     + qd.missing_data ()) == -1)
-                    {
-                      return -1;
-                    }
+                  return -1;
                 }
 
               TAO_Queued_Data *nqd = TAO_Queued_Data::duplicate (qd);
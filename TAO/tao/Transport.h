@@ -28,6 +28,7 @@
 #include "tao/Message_Semantics.h"
 #include "ace/Time_Value.h"
 #include "ace/Basic_Stats.h"
+#include "ace/Atomic_Op.h"
 
 struct iovec;
 
@@ -51,6 +52,8 @@ class TAO_ServerRequest;
 
 namespace TAO
 {
+  class Batch_Scope;
+
   /**
    * @note Should this be in TAO namespace. Seems like a candidate
    * that should be in the transport
@@ -778,12 +781,30 @@ public:
                                    const ACE_Message_Block *message_block,
                                    ACE_Time_Value *max_wait_time);
 
+  /// Send the messages queued by a TAO::Batch_Scope.
+  /**
+   * The queue is drained with as few writev() calls as possible, if
+   * the connection cannot take all of it the flushing strategy waits
+   * until it is empty.  A transport that is not connected yet sends
+   * its queue once the connection completes.
+   *
+   * @return -1 error, otherwise 0
+   */
+  int flush_batch (ACE_Time_Value *max_wait_time);
+
 protected:
   /// Process the message by sending it to the higher layers of the
   /// ORB.
   int process_parsed_messages (TAO_Queued_Data *qd,
                                TAO_Resume_Handle &rh);
 
+  /// Update link_throughput_ after a send of @a byte_count bytes out
+  /// of @a requested, @a would_block is set when the send did not
+  /// transfer anything.
+  void update_link_throughput (size_t byte_count,
+                               size_t requested,
+                               bool would_block);
+
   /// Implement send_message_shared() assuming the handler_lock_ is
   /// held.
   int send_message_shared_i (TAO_Stub *stub,
@@ -873,6 +894,14 @@ public:
   /// Accessor to sent_byte_count_
   size_t sent_byte_count (void) const;
 
+  /**
+   * Estimated throughput of the link in bytes per second, zero while
+   * it is unknown.  It is measured only while the link limits the
+   * sends: after a send that would block or was partial, the bytes of
+   * the next send are divided by the time spent waiting for it.
+   */
+  size_t link_throughput (void) const;
+
   /// CodeSet Negotiation - Get the char codeset translator factory
   TAO_Codeset_Translator_Base *char_translator (void) const;
 
@@ -984,6 +1013,11 @@ private:
                                    const ACE_Message_Block *message_block,
                                    ACE_Time_Value *max_wait_time);
 
+  /// Queue an asynchronous message until @a batch is flushed.
+  int send_batched_message_i (TAO::Batch_Scope *batch,
+                              const ACE_Message_Block *message_block,
+                              ACE_Time_Value *max_wait_time);
+
   /// A helper method used by send_synchronous_message_i() and
   /// send_reply_message_i(). Reusable code that could be used by both
   /// the methods.
@@ -1018,6 +1052,19 @@ private:
   /// in @a message_block.
   int handle_input_parse_extra_messages (ACE_Message_Block &message_block);
 
+  /// Account a message of @a size bytes in the running estimate of
+  /// the size of the incoming messages.
+  void estimate_message_size (size_t size);
+
+  /// Move the data of @a mb to a buffer on the heap that can hold
+  /// @a size bytes.
+  /// @return -1 error, otherwise 0
+  int allocate_recv_buffer (ACE_Message_Block &mb, size_t size);
+
+  /// Count a buffer allocated on the heap to receive a message that
+  /// is incomplete in the buffer on the stack.
+  void recv_buffer_allocated (void);
+
   /// @return -1 error, otherwise 0
   int consolidate_enqueue_message (TAO_Queued_Data *qd);
 
@@ -1168,9 +1215,23 @@ protected:
   /// Size of the buffer received.
   size_t recv_buffer_size_;
 
+  /// Running average of the size of the messages received, used to
+  /// choose between reading as much as the buffer on the stack holds
+  /// and reading the GIOP header first.
+  size_t recv_size_estimate_;
+
   /// Number of bytes sent.
   size_t sent_byte_count_;
 
+  /// Running average of the link throughput, see link_throughput().
+  /// Updated by the sending thread with the handler lock held, read
+  /// by the ZIOP adaptive compression without it.
+  ACE_Atomic_Op<TAO_SYNCH_MUTEX, unsigned long> link_throughput_;
+
+  /// When the link started to limit the sends, zero while it does
+  /// not.
+  ACE_Time_Value link_blocked_since_;
+
   /// Is this transport really connected or not. In case of oneways with
   /// SYNC_NONE Policy we don't wait until the connection is ready and we
   /// buffer the requests in this transport until the connection is ready
@@ -1289,6 +1350,9 @@ namespace TAO
       void opened_since (const ACE_Time_Value& tv);
       const ACE_Time_Value& opened_since (void) const;
 
+      void receive_buffer_allocated (void);
+      CORBA::LongLong receive_buffer_allocations (void) const;
+
     private:
       /// Mutex guarding the internal state of the statistics
       mutable TAO_SYNCH_MUTEX stat_mutex_;
@@ -1307,6 +1371,9 @@ namespace TAO
       ACE_Basic_Stats bytes_sent_;
 
       ACE_Time_Value  opened_since_;
+
+      /// Number of buffers allocated on the heap to receive messages.
+      CORBA::LongLong recv_buffer_allocations_;
     };
   }
 }
@@ -202,6 +202,29 @@ TAO_Transport::sent_byte_count (void) const
   return this->sent_byte_count_;
 }
 
+ACE_INLINE size_t
+TAO_Transport::link_throughput (void) const
+{
+  return this->link_throughput_.value ();
+}
+
+ACE_INLINE void
+TAO_Transport::estimate_message_size (size_t size)
+{
+  // Exponentially weighted, the last eight messages or so matter.
+  this->recv_size_estimate_ =
+    this->recv_size_estimate_ - this->recv_size_estimate_ / 8 + size / 8;
+}
+
+ACE_INLINE void
+TAO_Transport::recv_buffer_allocated (void)
+{
+#if TAO_HAS_TRANSPORT_CURRENT == 1
+  if (this->stats_ != 0)
+    this->stats_->receive_buffer_allocated ();
+#endif /* TAO_HAS_TRANSPORT_CURRENT == 1 */
+}
+
 #if TAO_HAS_TRANSPORT_CURRENT == 1
 
 ACE_INLINE TAO::Transport::Stats*
@@ -217,6 +240,7 @@ TAO::Transport::Stats::Stats ()
   , bytes_rcvd_()
   , bytes_sent_ ()
   , opened_since_ ()
+  , recv_buffer_allocations_ (0)
 {
 }
 
@@ -286,6 +310,22 @@ TAO::Transport::Stats::opened_since (void) const
   return this->opened_since_;
 }
 
+ACE_INLINE void
+TAO::Transport::Stats::receive_buffer_allocated (void)
+{
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->stat_mutex_);
+
+  ++this->recv_buffer_allocations_;
+}
+
+ACE_INLINE CORBA::LongLong
+TAO::Transport::Stats::receive_buffer_allocations (void) const
+{
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->stat_mutex_, 0);
+
+  return this->recv_buffer_allocations_;
+}
+
 #endif /* TAO_HAS_TRANSPORT_CURRENT == 1 */
 
 ACE_INLINE int
@@ -95,6 +95,11 @@ namespace TAO
       return msecs;
     }
 
+    CounterT Current_Impl::receive_buffer_allocations (void)
+    {
+      return transport_stats ()->receive_buffer_allocations ();
+    }
+
   }
 
 }
@@ -58,6 +58,8 @@ namespace TAO
         virtual CounterT messages_received (void);
 
         virtual ::TimeBase::TimeT open_since (void);
+
+        virtual CounterT receive_buffer_allocations (void);
         //@}
 
       protected:
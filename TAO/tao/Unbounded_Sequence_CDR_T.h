@@ -16,6 +16,46 @@
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO {
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  namespace details {
+    /**
+     * Make @a target reference the @a new_length elements at the read
+     * position of @a strm instead of copying them.  That is only done
+     * when the stream holds them as the host does, in its byte order
+     * and aligned for the type, in a single block the sequence can
+     * keep a reference to.  Returns false when the elements must be
+     * copied.
+     */
+    template <typename stream, typename value_t>
+    bool demarshal_sequence_in_place(stream & strm, ::CORBA::ULong new_length, TAO::unbounded_value_sequence <value_t> & target) {
+      if (new_length == 0
+          || strm.do_byte_swap()
+          || !strm.can_reference_start()) {
+        return false;
+      }
+      if (strm.align_read_ptr(sizeof (value_t)) != 0) {
+        return false;
+      }
+      char * const data = strm.rd_ptr();
+      size_t const size = new_length * sizeof (value_t);
+      if (size > strm.length()
+          || ACE_ptr_align_binary (data, sizeof (value_t)) != data) {
+        return false;
+      }
+      target.replace(new_length, strm.start());
+      strm.skip_bytes(size);
+      return true;
+    }
+
+    /// Booleans are always copied, the stream may hold other values
+    /// than 0 and 1.
+    template <typename stream>
+    bool demarshal_sequence_in_place(stream &, ::CORBA::ULong, TAO::unbounded_value_sequence <CORBA::Boolean> &) {
+      return false;
+    }
+  }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
   template <typename stream>
   bool demarshal_sequence(stream & strm, unbounded_value_sequence <CORBA::Short> & target) {
     typedef TAO::unbounded_value_sequence <CORBA::Short> sequence;
@@ -26,6 +66,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -46,6 +91,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -66,6 +116,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -86,6 +141,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -109,7 +169,8 @@ namespace TAO {
     }
     sequence tmp(new_length);
     tmp.length(new_length);
-    if (ACE_BIT_DISABLED (strm.start ()->flags (), ACE_Message_Block::DONT_DELETE))
+    if (ACE_BIT_DISABLED (strm.start ()->flags (), ACE_Message_Block::DONT_DELETE)
+        && strm.start ()->cont () == 0)
     {
       TAO_ORB_Core* orb_core = strm.orb_core ();
       if (orb_core != 0 && strm.orb_core ()->resource_factory ()->
@@ -203,6 +264,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -223,6 +289,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -243,6 +314,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
@@ -263,6 +339,11 @@ namespace TAO {
     if (new_length > strm.length()) {
       return false;
     }
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    if (details::demarshal_sequence_in_place(strm, new_length, target)) {
+      return true;
+    }
+#endif
     sequence tmp(new_length);
     tmp.length(new_length);
     typename sequence::value_type * buffer = tmp.get_buffer();
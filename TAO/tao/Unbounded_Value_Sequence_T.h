@@ -9,10 +9,15 @@
  * @author Carlos O'Ryan
  */
 
+#include "tao/orbconf.h"
 #include "tao/Unbounded_Value_Allocation_Traits_T.h"
 #include "tao/Value_Traits_T.h"
 #include "tao/Generic_Sequence_T.h"
 
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+# include "ace/Message_Block.h"
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace TAO
@@ -33,6 +38,51 @@ public:
   typedef details::value_traits<value_type,true> element_traits;
   typedef details::generic_sequence<value_type, allocation_traits, element_traits> implementation_type;
 
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  inline unbounded_value_sequence()
+    : impl_()
+    , mb_(0)
+  {}
+  inline explicit unbounded_value_sequence(CORBA::ULong maximum)
+    : impl_(maximum)
+    , mb_(0)
+  {}
+  inline unbounded_value_sequence(
+      CORBA::ULong maximum,
+      CORBA::ULong length,
+      value_type * data,
+      CORBA::Boolean release = false)
+    : impl_(maximum, length, data, release)
+    , mb_(0)
+  {}
+  /// A copy owns its elements, it never references a message block.
+  inline unbounded_value_sequence(unbounded_value_sequence const & rhs)
+    : impl_(rhs.impl_)
+    , mb_(0)
+  {}
+  inline unbounded_value_sequence & operator=(unbounded_value_sequence const & rhs) {
+    unbounded_value_sequence tmp(rhs);
+    swap(tmp);
+    return * this;
+  }
+#if defined (ACE_HAS_CPP11)
+  /// A move takes over the message block referenced by @a rhs.
+  inline unbounded_value_sequence(unbounded_value_sequence && rhs)
+    : impl_(std::move(rhs.impl_))
+    , mb_(rhs.mb_)
+  {
+    rhs.mb_ = 0;
+  }
+  inline unbounded_value_sequence & operator=(unbounded_value_sequence && rhs) {
+    unbounded_value_sequence tmp(std::move(rhs));
+    swap(tmp);
+    return * this;
+  }
+#endif /* ACE_HAS_CPP11 */
+  inline ~unbounded_value_sequence() {
+    ACE_Message_Block::release(mb_);
+  }
+#else
   inline unbounded_value_sequence()
     : impl_()
   {}
@@ -47,6 +97,7 @@ public:
     : impl_(maximum, length, data, release)
   {}
   /* Use default ctor, operator= and dtor */
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
   inline CORBA::ULong maximum() const {
     return impl_.maximum();
   }
@@ -58,6 +109,13 @@ public:
   }
   inline void length(CORBA::ULong length) {
     impl_.length(length);
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    // Growing past the referenced elements copied them.
+    if (mb_ != 0 && impl_.release()) {
+      ACE_Message_Block::release(mb_);
+      mb_ = 0;
+    }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
   }
   inline value_type const & operator[](CORBA::ULong i) const {
     return impl_[i];
@@ -71,6 +129,10 @@ public:
       value_type * data,
       CORBA::Boolean release = false) {
     impl_.replace(maximum, length, data, release);
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    ACE_Message_Block::release(mb_);
+    mb_ = 0;
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
   }
   inline value_type const * get_buffer() const {
     return impl_.get_buffer();
@@ -80,6 +142,9 @@ public:
   }
   inline void swap(unbounded_value_sequence & rhs) throw() {
     impl_.swap(rhs.impl_);
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+    std::swap(mb_, rhs.mb_);
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
   }
   static value_type * allocbuf(CORBA::ULong maximum) {
     return implementation_type::allocbuf(maximum);
@@ -88,6 +153,29 @@ public:
     implementation_type::freebuf(buffer);
   }
 
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  /// Returns the message block holding the elements, 0 when the
+  /// sequence has a buffer of its own.  The caller must *not* release
+  /// it.
+  inline ACE_Message_Block* mb (void) const {
+    return mb_;
+  }
+
+  /// Reference the @a length elements at the read position of @a mb
+  /// instead of a buffer.  It takes a duplicate of @a mb so the user
+  /// still owns it.  The elements must be aligned and in the byte
+  /// order of the host.
+  inline void replace (CORBA::ULong length, const ACE_Message_Block* mb) {
+    unbounded_value_sequence tmp(
+      length,
+      length,
+      reinterpret_cast<value_type *> (mb->rd_ptr()),
+      false);
+    tmp.mb_ = ACE_Message_Block::duplicate(mb);
+    swap(tmp);
+  }
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
 #if defined TAO_HAS_SEQUENCE_ITERATORS && TAO_HAS_SEQUENCE_ITERATORS == 1
 
   ///
@@ -155,6 +243,11 @@ public:
 
 private:
   implementation_type impl_;
+
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+  /// Holds the received elements when the buffer references them.
+  ACE_Message_Block* mb_;
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
 };
 
 } // namespace TAO
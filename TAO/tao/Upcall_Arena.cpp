@@ -0,0 +1,181 @@
+#include "tao/Upcall_Arena.h"
+#include "tao/TSS_Resources.h"
+#include "tao/SystemException.h"
+#include "ace/Basic_Types.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// Alignment of the allocations, that of the widest CDR type.
+  size_t const alignment = sizeof (ACE_CDR::LongDouble);
+
+  /// Number of blocks kept when the outermost scope closes.
+  size_t const retained_blocks = 4;
+}
+
+struct TAO::Upcall_Arena::Block
+{
+  Block *next_;
+  size_t size_;
+};
+
+TAO::Upcall_Arena::Upcall_Arena (void)
+  : blocks_ (0)
+  , current_ (0)
+  , used_ (0)
+  , large_ (0)
+  , depth_ (0)
+{
+}
+
+TAO::Upcall_Arena::~Upcall_Arena (void)
+{
+  this->release (0, 0, 0);
+
+  while (this->blocks_ != 0)
+    {
+      Block * const block = this->blocks_;
+      this->blocks_ = block->next_;
+      delete [] reinterpret_cast<char *> (block);
+    }
+}
+
+TAO::Upcall_Arena *
+TAO::Upcall_Arena::current (void)
+{
+#if TAO_HAS_UPCALL_ARENA == 1
+  Upcall_Arena * const arena = &TAO_TSS_Resources::instance ()->upcall_arena_;
+  return arena->depth_ != 0 ? arena : 0;
+#else
+  return 0;
+#endif /* TAO_HAS_UPCALL_ARENA == 1 */
+}
+
+void *
+TAO::Upcall_Arena::allocate (size_t size)
+{
+  size = size == 0 ? alignment : ACE_align_binary (size, alignment);
+
+  if (size > TAO_UPCALL_ARENA_BLOCK_SIZE / 4)
+    {
+      Block * const block = new_block (size);
+      block->next_ = this->large_;
+      this->large_ = block;
+      return data (block);
+    }
+
+  if (this->current_ == 0)
+    {
+      if (this->blocks_ == 0)
+        {
+          this->blocks_ = new_block (TAO_UPCALL_ARENA_BLOCK_SIZE);
+        }
+      this->current_ = this->blocks_;
+      this->used_ = 0;
+    }
+  else if (this->used_ + size > this->current_->size_)
+    {
+      if (this->current_->next_ == 0)
+        {
+          this->current_->next_ = new_block (TAO_UPCALL_ARENA_BLOCK_SIZE);
+        }
+      this->current_ = this->current_->next_;
+      this->used_ = 0;
+    }
+
+  char * const result = data (this->current_) + this->used_;
+  this->used_ += size;
+  return result;
+}
+
+TAO::Upcall_Arena::Block *
+TAO::Upcall_Arena::new_block (size_t size)
+{
+  char *raw = 0;
+  ACE_NEW_THROW_EX (raw,
+                    char[ACE_align_binary (sizeof (Block), alignment) + size],
+                    CORBA::NO_MEMORY (
+                      CORBA::SystemException::_tao_minor_code (0, ENOMEM),
+                      CORBA::COMPLETED_NO));
+
+  Block * const block = reinterpret_cast<Block *> (raw);
+  block->next_ = 0;
+  block->size_ = size;
+  return block;
+}
+
+char *
+TAO::Upcall_Arena::data (Block *block)
+{
+  return
+    reinterpret_cast<char *> (block)
+    + ACE_align_binary (sizeof (Block), alignment);
+}
+
+void
+TAO::Upcall_Arena::release (Block *block, size_t used, Block *large)
+{
+  while (this->large_ != large)
+    {
+      Block * const oversized = this->large_;
+      this->large_ = oversized->next_;
+      delete [] reinterpret_cast<char *> (oversized);
+    }
+
+  this->current_ = block;
+  this->used_ = used;
+
+  if (this->depth_ != 0 || this->blocks_ == 0)
+    {
+      return;
+    }
+
+  // An upcall with unusually large arguments should not keep its
+  // blocks for the whole life of the thread.
+  Block *last = this->blocks_;
+  for (size_t i = 1; i < retained_blocks && last->next_ != 0; ++i)
+    {
+      last = last->next_;
+    }
+
+  Block *extra = last->next_;
+  last->next_ = 0;
+  while (extra != 0)
+    {
+      Block * const next = extra->next_;
+      delete [] reinterpret_cast<char *> (extra);
+      extra = next;
+    }
+}
+
+// ==========================================================================
+
+TAO::Upcall_Arena::Scope::Scope (void)
+#if TAO_HAS_UPCALL_ARENA == 1
+  : arena_ (&TAO_TSS_Resources::instance ()->upcall_arena_)
+  , block_ (arena_->current_)
+  , used_ (arena_->used_)
+  , large_ (arena_->large_)
+{
+  ++this->arena_->depth_;
+}
+#else
+  : arena_ (0)
+  , block_ (0)
+  , used_ (0)
+  , large_ (0)
+{
+}
+#endif /* TAO_HAS_UPCALL_ARENA == 1 */
+
+TAO::Upcall_Arena::Scope::~Scope (void)
+{
+  if (this->arena_ != 0)
+    {
+      --this->arena_->depth_;
+      this->arena_->release (this->block_, this->used_, this->large_);
+    }
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,127 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file    Upcall_Arena.h
+ *
+ *  Per thread storage for the in arguments of a skeleton upcall.
+ */
+//=============================================================================
+
+#ifndef TAO_UPCALL_ARENA_H
+#define TAO_UPCALL_ARENA_H
+
+#include /**/ "ace/pre.h"
+
+#include "tao/TAO_Export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/orbconf.h"
+#include "ace/CDR_Base.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace TAO
+{
+  /**
+   * @class Upcall_Arena
+   *
+   * @brief A bump allocator for the in arguments of the upcalls of a
+   * thread.
+   *
+   * The skeleton argument templates demarshal in strings and the
+   * buffers of in sequences into the arena instead of allocating them
+   * one by one from the heap.  An upcall opens a Scope before its
+   * arguments are demarshaled and closes it once the reply is
+   * marshaled, giving back everything allocated since.  Nested upcalls
+   * on the same thread open nested scopes, which close first.
+   *
+   * The first blocks are kept for the next upcalls of the thread.
+   * Allocations larger than a quarter of TAO_UPCALL_ARENA_BLOCK_SIZE
+   * get a block of their own, returned to the heap when their scope
+   * closes.
+   */
+  class TAO_Export Upcall_Arena
+  {
+    struct Block;
+
+  public:
+    Upcall_Arena (void);
+    ~Upcall_Arena (void);
+
+    /// The arena of the calling thread, 0 outside of an upcall or
+    /// when TAO is built without upcall arena.
+    static Upcall_Arena *current (void);
+
+    /// Allocate @a size bytes, aligned for any CDR type, valid until
+    /// the innermost scope closes.  Throws CORBA::NO_MEMORY.
+    void *allocate (size_t size);
+
+    /**
+     * @class Scope
+     *
+     * @brief Opens a scope on the arena of the calling thread and
+     * releases what was allocated in it on destruction.
+     */
+    class TAO_Export Scope
+    {
+    public:
+      Scope (void);
+      ~Scope (void);
+
+    private:
+      Scope (const Scope &);
+      Scope &operator= (const Scope &);
+
+    private:
+      /// The arena, 0 when TAO is built without upcall arena.
+      Upcall_Arena *arena_;
+
+      /// Where the arena stood when the scope opened.
+      //@{
+      Block *block_;
+      size_t used_;
+      Block *large_;
+      //@}
+    };
+
+  private:
+    /// Allocate a block of @a size usable bytes.
+    static Block *new_block (size_t size);
+
+    /// The usable bytes of @a block.
+    static char *data (Block *block);
+
+    /// Give back what was allocated since the mark, and trim the kept
+    /// blocks once the outermost scope closes.
+    void release (Block *block, size_t used, Block *large);
+
+    Upcall_Arena (const Upcall_Arena &);
+    Upcall_Arena &operator= (const Upcall_Arena &);
+
+  private:
+    /// The blocks, kept from upcall to upcall.
+    Block *blocks_;
+
+    /// The block being filled, 0 when nothing is allocated.
+    Block *current_;
+
+    /// The bytes used in current_.
+    size_t used_;
+
+    /// The oversized allocations of the open scopes, newest first.
+    Block *large_;
+
+    /// The number of open scopes.
+    unsigned long depth_;
+  };
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+
+#endif /* TAO_UPCALL_ARENA_H */
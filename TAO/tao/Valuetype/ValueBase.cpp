@@ -238,6 +238,13 @@ CORBA::ValueBase::_tao_unmarshal_pre (
 
   CORBA::Boolean is_chunked = false;
 
+  // The values, repository ids and chunks are found by their address
+  // in the stream, the rest of a chained stream is read from one block.
+  if (strm.start ()->cont () != 0 && strm.pullup (strm.length ()) != 0)
+    {
+      return false;
+    }
+
   // Save the position of the start of the ValueType
   // to allow caching for later indirection.
   if (strm.align_read_ptr (ACE_CDR::LONG_SIZE))
@@ -476,6 +483,13 @@ CORBA::ValueBase::_tao_validate_box_type (TAO_InputCDR &strm,
   null_object = false;
   is_indirected = false;
 
+  // The indirections are found by their address in the stream, the
+  // rest of a chained stream is read from one block.
+  if (strm.start ()->cont () != 0 && strm.pullup (strm.length ()) != 0)
+    {
+      return false;
+    }
+
   if (!strm.read_long (value_tag))
     {
       return false;
@@ -13,6 +13,16 @@ TAO_Var_Base_T<T>::TAO_Var_Base_T (T * p)
   : ptr_ (p)
 {}
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Var_Base_T<T>::TAO_Var_Base_T (TAO_Var_Base_T<T> && p)
+  : ptr_ (p.ptr_)
+{
+  p.ptr_ = 0;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Var_Base_T<T>::~TAO_Var_Base_T (void)
@@ -86,6 +96,14 @@ TAO_Fixed_Var_T<T>::TAO_Fixed_Var_T (const TAO_Fixed_Var_T<T> & p)
   : TAO_Var_Base_T<T> (p)
 {}
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Fixed_Var_T<T>::TAO_Fixed_Var_T (TAO_Fixed_Var_T<T> && p)
+  : TAO_Var_Base_T<T> (std::move (p))
+{}
+#endif /* ACE_HAS_CPP11 */
+
 // Fixed-size types only.
 template<typename T>
 ACE_INLINE
@@ -105,6 +123,22 @@ TAO_Fixed_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Fixed_Var_T<T> &
+TAO_Fixed_Var_T<T>::operator= (TAO_Fixed_Var_T<T> && p)
+{
+  if (this != &p)
+    {
+      delete this->ptr_;
+      this->ptr_ = p.ptr_;
+      p.ptr_ = 0;
+    }
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Fixed_Var_T<T>::operator const T & () const
@@ -174,6 +208,14 @@ TAO_Var_Var_T<T>::TAO_Var_Var_T (const TAO_Var_Var_T<T> & p)
   : TAO_Var_Base_T<T> (p)
 {}
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Var_Var_T<T>::TAO_Var_Var_T (TAO_Var_Var_T<T> && p)
+  : TAO_Var_Base_T<T> (std::move (p))
+{}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Var_Var_T<T> &
@@ -184,6 +226,22 @@ TAO_Var_Var_T<T>::operator= (T * p)
   return *this;
 }
 
+#if defined (ACE_HAS_CPP11)
+template<typename T>
+ACE_INLINE
+TAO_Var_Var_T<T> &
+TAO_Var_Var_T<T>::operator= (TAO_Var_Var_T<T> && p)
+{
+  if (this != &p)
+    {
+      delete this->ptr_;
+      this->ptr_ = p.ptr_;
+      p.ptr_ = 0;
+    }
+  return *this;
+}
+#endif /* ACE_HAS_CPP11 */
+
 template<typename T>
 ACE_INLINE
 TAO_Var_Var_T<T>::operator const T & () const
@@ -7,9 +7,39 @@
 #include "tao/operation_details.h"
 #include "tao/Stub.h"
 #include "tao/Transport.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_strings.h"
+#include "ace/OS_NS_stdlib.h"
+#include "ace/High_Res_Timer.h"
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace
+{
+  /// Releases the memory of a pooled output buffer that grew beyond
+  /// TAO_ZIOP_MAX_POOLED_BUFFER_SIZE, the thread does not keep the
+  /// memory of its largest message.
+  class Output_Buffer_Trimmer
+  {
+  public:
+    explicit Output_Buffer_Trimmer (::Compression::Buffer &buffer)
+      : buffer_ (buffer)
+    {
+    }
+
+    ~Output_Buffer_Trimmer (void)
+    {
+      if (this->buffer_.maximum () > TAO_ZIOP_MAX_POOLED_BUFFER_SIZE)
+        {
+          this->buffer_ = ::Compression::Buffer ();
+        }
+    }
+
+  private:
+    ::Compression::Buffer &buffer_;
+  };
+}
+
 TAO_ZIOP_Loader::TAO_ZIOP_Loader (void)
   : initialized_ (false)
 {
@@ -20,8 +50,48 @@ TAO_ZIOP_Loader::~TAO_ZIOP_Loader (void)
 }
 
 int
-TAO_ZIOP_Loader::init (int, ACE_TCHAR* [])
+TAO_ZIOP_Loader::init (int argc, ACE_TCHAR* argv[])
 {
+  for (int curarg = 0; curarg < argc; ++curarg)
+    {
+      if (ACE_OS::strcasecmp (argv[curarg],
+                              ACE_TEXT ("-ZIOPAdaptive")) == 0)
+        {
+          ++curarg;
+          if (curarg < argc)
+            {
+              this->adaptive_.enabled (ACE_OS::atoi (argv[curarg]) != 0);
+            }
+        }
+      else if (ACE_OS::strcasecmp (argv[curarg],
+                                   ACE_TEXT ("-ZIOPAdaptiveLinkSpeed")) == 0)
+        {
+          ++curarg;
+          if (curarg < argc)
+            {
+              this->adaptive_.default_link_throughput (
+                static_cast<size_t> (ACE_OS::strtoul (argv[curarg], 0, 10)));
+            }
+        }
+      else if (ACE_OS::strcasecmp (argv[curarg],
+                                   ACE_TEXT ("-ZIOPAdaptiveSampleInterval")) == 0)
+        {
+          ++curarg;
+          if (curarg < argc)
+            {
+              this->adaptive_.sample_interval (
+                static_cast<CORBA::ULong> (ACE_OS::strtoul (argv[curarg], 0, 10)));
+            }
+        }
+      else if (TAO_debug_level > 0)
+        {
+          TAOLIB_ERROR ((LM_ERROR,
+                         ACE_TEXT ("ZIOP (%P|%t) TAO_ZIOP_Loader::init, ")
+                         ACE_TEXT ("unknown option <%s>.\n"),
+                         argv[curarg]));
+        }
+    }
+
 #if defined (TAO_HAS_CORBA_MESSAGING) && TAO_HAS_CORBA_MESSAGING != 0
   if (!this->initialized_ && TAO_DEF_GIOP_MINOR >= 2)
     {
@@ -114,6 +184,8 @@ TAO_ZIOP_Loader::ziop_compressorid_name (::Compression::CompressorId st)
       case ::Compression::COMPRESSORID_7X: return "7X";
       case ::Compression::COMPRESSORID_XAR: return "XAR";
       case ::Compression::COMPRESSORID_RLE: return "RLE";
+      case ::Compression::COMPRESSORID_LZ4: return "LZ4";
+      case ::Compression::COMPRESSORID_ZSTD: return "ZSTD";
     }
 
   return "Unknown";
@@ -217,30 +289,57 @@ TAO_ZIOP_Loader::decompress (ACE_Data_Block **db, TAO_Queued_Data& qd,
           // datablock so we can't look it up anyway.)
           Compression::Compressor_var compressor (
             manager->get_compressor (data.compressor, 0));
+
+          size_t const new_data_length = (size_t)(data.original_length +
+                                         TAO_GIOP_MESSAGE_HEADER_LEN);
+
+          // Decompress straight behind the GIOP header in a block of
+          // the input CDR allocators of the ORB, instead of into a
+          // temporary sequence which is then copied.
+          ACE_Data_Block *new_db =
+            orb_core.create_input_cdr_data_block (new_data_length);
+          if (new_db == 0)
+            TAOLIB_ERROR_RETURN((LM_ERROR,
+                              ACE_TEXT ("ZIOP (%P|%t) ")
+                              ACE_TEXT ("TAO_ZIOP_Loader::decompress, ")
+                              ACE_TEXT ("failed to allocate %B bytes\n"),
+                              new_data_length),
+                              false);
+
+          // Releases new_db unless it is returned.
+          ACE_Message_Block mb (new_db);
+          qd.msg_block ()->rd_ptr (initial_rd_ptr);
+          mb.copy (qd.msg_block ()->base () + begin,
+                   TAO_GIOP_MESSAGE_HEADER_LEN);
+
           CORBA::OctetSeq myout;
-          myout.length (data.original_length);
+          myout.replace (data.original_length,
+                         data.original_length,
+                         reinterpret_cast<CORBA::Octet *> (mb.wr_ptr ()),
+                         false);
 
           if (decompress (compressor.in (), data.data, myout))
             {
-              size_t new_data_length = (size_t)(data.original_length +
-                                       TAO_GIOP_MESSAGE_HEADER_LEN);
-
-              ACE_Message_Block mb (new_data_length);
-              qd.msg_block ()->rd_ptr (initial_rd_ptr);
-              mb.copy (qd.msg_block ()->base () + begin,
-                            TAO_GIOP_MESSAGE_HEADER_LEN);
-
-              if (mb.copy ((char*)myout.get_buffer (false),
-                           static_cast<size_t> (data.original_length)) != 0)
+              if (myout.length () != data.original_length)
                 TAOLIB_ERROR_RETURN((LM_ERROR,
                                   ACE_TEXT ("ZIOP (%P|%t) ")
                                   ACE_TEXT ("TAO_ZIOP_Loader::decompress, ")
-                                  ACE_TEXT ("failed to copy decompressed data, ")
-                                  ACE_TEXT ("Buffer too small\n")),
+                                  ACE_TEXT ("decompressed %u bytes instead ")
+                                  ACE_TEXT ("of %u\n"),
+                                  myout.length (),
+                                  data.original_length),
                                   false);
+              // A compressor that grew the target did not decompress
+              // in place.
+              if (myout.get_buffer () !=
+                    reinterpret_cast<CORBA::Octet *> (mb.wr_ptr ()))
+                {
+                  ACE_OS::memcpy (mb.wr_ptr (),
+                                  myout.get_buffer (),
+                                  data.original_length);
+                }
               // change it into a GIOP message..
               mb.base ()[0] = 0x47;
-              ACE_CDR::mb_align (&mb);
 
               if (TAO_debug_level > 9)
                 {  // we're only logging ZIOP messages. Log datablock before it's
@@ -251,10 +350,11 @@ TAO_ZIOP_Loader::decompress (ACE_Data_Block **db, TAO_Queued_Data& qd,
                                    data.compressor, compressor->compression_level ());
                 }
               //replace data block
-              *db = mb.data_block ()->duplicate ();
+              *db = new_db->duplicate ();
               (*db)->size (new_data_length);
               return true;
             }
+          return false;
         }
       catch (const ::Compression::UnknownCompressorId &)
         {
@@ -503,7 +603,9 @@ TAO_ZIOP_Loader::complete_compression (Compression::Compressor_ptr compressor,
                                        CORBA::ULong low_value,
                                        Compression::CompressionRatio min_ratio,
                                        CORBA::ULong original_data_length,
-                                       Compression::CompressorId compressor_id)
+                                       Compression::CompressorId compressor_id,
+                                       Compression::CompressionLevel compression_level,
+                                       const char *message_class)
 {
    static const CORBA::ULong
       Compression_Overhead = sizeof (compressor_id)
@@ -516,11 +618,29 @@ TAO_ZIOP_Loader::complete_compression (Compression::Compressor_ptr compressor,
 
   if (low_value <= original_data_length)
     {
-      CORBA::OctetSeq output;
+      // The output buffer of the thread keeps its memory for the next
+      // messages, the compressed data is copied into the CDR stream.
+      ::Compression::Buffer local_output;
+      ::Compression::Buffer *pooled_output =
+        ACE_TSS_GET (&this->output_buffer_, ::Compression::Buffer);
+      ::Compression::Buffer &output =
+        pooled_output != 0 ? *pooled_output : local_output;
+
       CORBA::OctetSeq input (original_data_length, &mb);
       output.length (original_data_length);
+      Output_Buffer_Trimmer trimmer (output);
+
+      ACE_Time_Value const start = ACE_High_Res_Timer::gettimeofday_hr ();
+      bool const compressed = this->compress (compressor, input, output);
+      if (compressed)
+        {
+          this->adaptive_.compressed (
+            message_class, compression_level, original_data_length,
+            output.length () + Compression_Overhead,
+            ACE_High_Res_Timer::gettimeofday_hr () - start);
+        }
 
-      if (!this->compress (compressor, input, output))
+      if (!compressed)
         {
           if (TAO_debug_level > 0)
             {
@@ -544,6 +664,7 @@ TAO_ZIOP_Loader::complete_compression (Compression::Compressor_ptr compressor,
                           static_cast <unsigned int> (original_data_length)
                         ));
             }
+          this->adaptive_.sent (original_data_length, original_data_length);
           return false;
         }
       else if (this->check_min_ratio (
@@ -553,11 +674,16 @@ TAO_ZIOP_Loader::complete_compression (Compression::Compressor_ptr compressor,
         {
           mb.wr_ptr (mb.rd_ptr ());
           cdr.current_alignment (mb.wr_ptr() - mb.base ());
+          // Marshal the members of a ZIOP::CompressionData, without
+          // copying the output into it first.
           ZIOP::CompressionData data;
           data.compressor = compressor_id;
           data.original_length = input.length();
-          data.data = output;
-          cdr << data;
+          cdr << data.compressor;
+          cdr << data.original_length;
+          cdr << output;
+          this->adaptive_.sent (original_data_length,
+                                output.length () + Compression_Overhead);
           mb.rd_ptr(initial_rd_ptr);
           size_t begin = (mb.rd_ptr() - mb.base ());
           mb.data_block ()->base ()[0 + begin] = 0x5A;
@@ -572,7 +698,10 @@ TAO_ZIOP_Loader::complete_compression (Compression::Compressor_ptr compressor,
             }
         }
       else
-        return false;
+        {
+          this->adaptive_.sent (original_data_length, original_data_length);
+          return false;
+        }
     }
     else if (TAO_debug_level > 8)
       {
@@ -595,7 +724,9 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
                CORBA::ULong low_value,
                ::Compression::CompressionRatio min_ratio,
                ::Compression::CompressorId compressor_id,
-               ::Compression::CompressionLevel compression_level)
+               ::Compression::CompressionLevel compression_level,
+               const char *message_class,
+               TAO_Transport *transport)
 {
   bool compressed = true;
 
@@ -612,7 +743,18 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
   CORBA::ULong const original_data_length =
     (CORBA::ULong)(current->wr_ptr() - current->rd_ptr());
 
-  if (original_data_length > 0)
+  if (original_data_length > 0
+      && low_value <= original_data_length
+      && !this->adaptive_.compress (
+            message_class,
+            original_data_length,
+            transport != 0 ? transport->link_throughput () : 0,
+            compression_level))
+    {
+      this->adaptive_.sent (original_data_length, original_data_length);
+      compressed = false;
+    }
+  else if (original_data_length > 0)
     {
       Compression::CompressionManager_var manager =
         Compression::CompressionManager::_narrow (compression_manager);
@@ -624,7 +766,8 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
 
           compressed = complete_compression (compressor.in (), cdr, *current,
                 initial_rd_ptr, low_value, min_ratio,
-                original_data_length, compressor_id);
+                original_data_length, compressor_id,
+                compression_level, message_class);
         }
     }
   // set back read pointer in case no compression was done...
@@ -634,6 +777,20 @@ TAO_ZIOP_Loader::compress_data (TAO_OutputCDR &cdr,
 
 bool
 TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub)
+{
+  return this->marshal_data (cdr, stub, 0);
+}
+
+bool
+TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core,
+                               TAO_ServerRequest *request)
+{
+  return this->marshal_data (cdr, orb_core, request, 0);
+}
+
+bool
+TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub,
+                               TAO_Transport *transport)
 {
 #if defined (TAO_HAS_ZIOP) && TAO_HAS_ZIOP != 0
   Compression::CompressorId compressor_id = Compression::COMPRESSORID_NONE;
@@ -665,18 +822,22 @@ TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub)
 
       return this->compress_data (cdr, compression_manager.in (),
                                   low_value, min_ratio,
-                                  compressor_id, compression_level);
+                                  compressor_id, compression_level,
+                                  stub.type_id.in (), transport);
     }
 #else /* TAO_HAS_ZIOP */
   ACE_UNUSED_ARG (cdr);
   ACE_UNUSED_ARG (stub);
+  ACE_UNUSED_ARG (transport);
 #endif /* TAO_HAS_ZIOP */
 
   return false; // Did not compress
 }
 
 bool
-TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core, TAO_ServerRequest *request)
+TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core,
+                               TAO_ServerRequest *request,
+                               TAO_Transport *transport)
 {
   // If there is no TAO_ServerRequest supplied, then there are no client side ZIOP policies to check.
   if (!request)
@@ -811,7 +972,9 @@ TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core, TAO_S
               return this->compress_data (cdr, compression_manager.in (),
                                           low_value, min_ratio,
                                           serverEntry->compressor_id,
-                                          compression_level);
+                                          compression_level,
+                                          request->operation (),
+                                          transport);
             }
 
           if (7 < TAO_debug_level)
@@ -840,6 +1003,7 @@ TAO_ZIOP_Loader::marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core, TAO_S
 #else /* TAO_HAS_ZIOP */
   ACE_UNUSED_ARG (cdr);
   ACE_UNUSED_ARG (orb_core);
+  ACE_UNUSED_ARG (transport);
 #endif /* TAO_HAS_ZIOP */
 
   return false; // Did not compress
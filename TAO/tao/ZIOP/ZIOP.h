@@ -24,7 +24,15 @@
 #include "tao/ZIOP_Adapter.h"
 #include "tao/Compression/Compression.h"
 #include "tao/Policy_Validator.h"
+#include "tao/ZIOP/ZIOP_Adaptive_Compression.h"
 #include "ace/Service_Config.h"
+#include "ace/TSS_T.h"
+
+/// Compression output buffers up to this size are kept by their
+/// thread for its next messages.
+#if !defined (TAO_ZIOP_MAX_POOLED_BUFFER_SIZE)
+# define TAO_ZIOP_MAX_POOLED_BUFFER_SIZE 262144
+#endif /* TAO_ZIOP_MAX_POOLED_BUFFER_SIZE */
 
 TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -51,8 +59,17 @@ public:
   // Compress the @a stream. Starting point of the compression is rd_ptr()
   virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub);
   virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core, TAO_ServerRequest *request);
-
-  /// Initialize the BiDIR loader hooks.
+  virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub,
+                             TAO_Transport *transport);
+  virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core,
+                             TAO_ServerRequest *request,
+                             TAO_Transport *transport);
+
+  /**
+   * Initialize the BiDIR loader hooks.  Accepts
+   * -ZIOPAdaptive <0|1>, -ZIOPAdaptiveLinkSpeed <bytes per second> and
+   * -ZIOPAdaptiveSampleInterval <messages>.
+   */
   virtual int init (int argc, ACE_TCHAR* []);
 
   virtual void load_policy_validators (TAO_Policy_Validator &validator);
@@ -68,6 +85,12 @@ private:
   /// Set to true after init is called.
   bool initialized_;
 
+  /// The compression output buffer of each thread.
+  ACE_TSS< ::Compression::Buffer> output_buffer_;
+
+  /// Decides whether compressing a message pays off, when enabled.
+  TAO_ZIOP_Adaptive_Compression adaptive_;
+
   /// dump a ZIOP datablock after (de)compression
   void dump_msg (const char *type,  const u_char *ptr,
                 size_t len, size_t original_data_length,
@@ -98,14 +121,20 @@ private:
                              CORBA::ULong low_value,
                              Compression::CompressionRatio min_ratio,
                              CORBA::ULong original_data_length,
-                             Compression::CompressorId compressor_id);
+                             Compression::CompressorId compressor_id,
+                             Compression::CompressionLevel compression_level,
+                             const char *message_class);
 
+  /// @a message_class groups the messages for the adaptive mode and
+  /// @a transport, when not zero, estimates the link throughput.
   bool compress_data (TAO_OutputCDR &cdr,
                       CORBA::Object_ptr compression_manager,
                       CORBA::ULong low_value,
                       ::Compression::CompressionRatio min_ratio,
                       ::Compression::CompressorId compressor_id,
-                      ::Compression::CompressionLevel compression_level);
+                      ::Compression::CompressionLevel compression_level,
+                      const char *message_class,
+                      TAO_Transport *transport);
 
   bool compress (Compression::Compressor_ptr compressor,
                  const ::Compression::Buffer &source,
@@ -0,0 +1,315 @@
+#include "tao/ZIOP/ZIOP_Adaptive_Compression.h"
+#include "tao/debug.h"
+#include "ace/Guard_T.h"
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace
+{
+  /// The second level sampled, the fastest of most compressors.
+  ::Compression::CompressionLevel const fast_level = 1;
+}
+
+TAO_ZIOP_Adaptive_Compression::Level_Stats::Level_Stats (void)
+  : level (0),
+    ratio (1.0),
+    speed (0.0),
+    samples (0)
+{
+}
+
+TAO_ZIOP_Adaptive_Compression::Class_Stats::Class_Stats (void)
+  : messages (0)
+{
+}
+
+TAO_ZIOP_Adaptive_Compression::TAO_ZIOP_Adaptive_Compression (void)
+  : enabled_ (false),
+    default_link_throughput_ (125000000),
+    sample_interval_ (16),
+    compressed_messages_ (0),
+    skipped_messages_ (0),
+    saved_bytes_ (0)
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+    , compressed_monitor_ (0)
+    , skipped_monitor_ (0)
+    , saved_bytes_monitor_ (0)
+    , link_throughput_monitor_ (0)
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+{
+}
+
+TAO_ZIOP_Adaptive_Compression::~TAO_ZIOP_Adaptive_Compression (void)
+{
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  if (this->compressed_monitor_ != 0)
+    {
+      this->compressed_monitor_->remove_from_registry ();
+      this->skipped_monitor_->remove_from_registry ();
+      this->saved_bytes_monitor_->remove_from_registry ();
+      this->link_throughput_monitor_->remove_from_registry ();
+      this->compressed_monitor_->remove_ref ();
+      this->skipped_monitor_->remove_ref ();
+      this->saved_bytes_monitor_->remove_ref ();
+      this->link_throughput_monitor_->remove_ref ();
+    }
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+}
+
+void
+TAO_ZIOP_Adaptive_Compression::enabled (bool enabled)
+{
+  this->enabled_ = enabled;
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  if (enabled && this->compressed_monitor_ == 0)
+    {
+      ACE_NEW (this->compressed_monitor_,
+               ACE::Monitor_Control::Size_Monitor ("ZIOP_Compressed_Messages"));
+      ACE_NEW (this->skipped_monitor_,
+               ACE::Monitor_Control::Size_Monitor ("ZIOP_Uncompressed_Messages"));
+      ACE_NEW (this->saved_bytes_monitor_,
+               ACE::Monitor_Control::Size_Monitor ("ZIOP_Saved_Bytes"));
+      ACE_NEW (this->link_throughput_monitor_,
+               ACE::Monitor_Control::Size_Monitor ("ZIOP_Link_Throughput"));
+
+      this->compressed_monitor_->add_to_registry ();
+      this->skipped_monitor_->add_to_registry ();
+      this->saved_bytes_monitor_->add_to_registry ();
+      this->link_throughput_monitor_->add_to_registry ();
+    }
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+}
+
+bool
+TAO_ZIOP_Adaptive_Compression::enabled (void) const
+{
+  return this->enabled_;
+}
+
+void
+TAO_ZIOP_Adaptive_Compression::default_link_throughput (size_t throughput)
+{
+  this->default_link_throughput_ = throughput;
+}
+
+void
+TAO_ZIOP_Adaptive_Compression::sample_interval (CORBA::ULong interval)
+{
+  this->sample_interval_ = interval == 0 ? 1 : interval;
+}
+
+TAO_ZIOP_Adaptive_Compression::Level_Stats *
+TAO_ZIOP_Adaptive_Compression::find_level (
+  Class_Stats &stats,
+  ::Compression::CompressionLevel level)
+{
+  for (size_t i = 0; i != sizeof (stats.levels) / sizeof (stats.levels[0]); ++i)
+    {
+      if (stats.levels[i].level == level)
+        {
+          return &stats.levels[i];
+        }
+    }
+  return 0;
+}
+
+double
+TAO_ZIOP_Adaptive_Compression::gain (const Level_Stats &stats,
+                                     CORBA::ULong length,
+                                     size_t link_throughput)
+{
+  double const saved =
+    length * (1.0 - stats.ratio) / static_cast<double> (link_throughput);
+  double const cost = stats.speed > 0.0 ? length / stats.speed : 0.0;
+  return saved - cost;
+}
+
+bool
+TAO_ZIOP_Adaptive_Compression::compress (
+  const char *message_class,
+  CORBA::ULong length,
+  size_t link_throughput,
+  ::Compression::CompressionLevel &level)
+{
+  if (!this->enabled_ || message_class == 0)
+    {
+      return true;
+    }
+
+  if (link_throughput == 0)
+    {
+      link_throughput = this->default_link_throughput_;
+    }
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  this->link_throughput_monitor_->receive (link_throughput);
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+
+  ACE_GUARD_RETURN (TAO_SYNCH_MUTEX, ace_mon, this->lock_, true);
+
+  // Look up without copying the name, it is only copied for a new
+  // class.
+  ACE_CString const key (message_class, 0, false);
+  Class_Map::iterator it = this->classes_.find (key);
+  if (it == this->classes_.end ())
+    {
+      if (this->classes_.size () >= TAO_ZIOP_ADAPTIVE_MAX_CLASSES)
+        {
+          return true;
+        }
+      it = this->classes_.insert (
+        Class_Map::value_type (ACE_CString (message_class),
+                               Class_Stats ())).first;
+    }
+
+  Class_Stats &stats = it->second;
+  ++stats.messages;
+
+  // The first level follows the policies, the second one is only
+  // sampled below them.
+  Level_Stats &policy = stats.levels[0];
+  if (policy.level != level || policy.samples == 0)
+    {
+      policy = Level_Stats ();
+      policy.level = level;
+    }
+  Level_Stats *fast = 0;
+  if (level > fast_level)
+    {
+      fast = &stats.levels[1];
+      fast->level = fast_level;
+    }
+
+  if (policy.samples == 0)
+    {
+      return true;
+    }
+
+  if (fast != 0 && fast->samples == 0)
+    {
+      level = fast_level;
+      return true;
+    }
+
+  if (stats.messages % this->sample_interval_ == 0)
+    {
+      if (fast != 0 && fast->samples < policy.samples)
+        {
+          level = fast_level;
+        }
+      return true;
+    }
+
+  double const policy_gain = gain (policy, length, link_throughput);
+  double const fast_gain =
+    fast != 0 ? gain (*fast, length, link_throughput) : policy_gain;
+
+  if (policy_gain <= 0.0 && fast_gain <= 0.0)
+    {
+      if (TAO_debug_level > 8)
+        {
+          TAOLIB_DEBUG ((LM_DEBUG,
+                         ACE_TEXT ("ZIOP (%P|%t) ")
+                         ACE_TEXT ("TAO_ZIOP_Adaptive_Compression::compress, ")
+                         ACE_TEXT ("%C, %u bytes at %B bytes/s, ratio %4.2f ")
+                         ACE_TEXT ("does not pay off (did not compress).\n"),
+                         message_class,
+                         length,
+                         link_throughput,
+                         policy.ratio));
+        }
+      return false;
+    }
+
+  if (fast_gain > policy_gain)
+    {
+      level = fast_level;
+    }
+
+  return true;
+}
+
+void
+TAO_ZIOP_Adaptive_Compression::compressed (
+  const char *message_class,
+  ::Compression::CompressionLevel level,
+  CORBA::ULong length,
+  CORBA::ULong compressed_length,
+  const ACE_Time_Value &elapsed)
+{
+  if (!this->enabled_ || message_class == 0 || length == 0)
+    {
+      return;
+    }
+
+  ACE_UINT64 usecs = 0;
+  elapsed.to_usec (usecs);
+  if (usecs == 0)
+    {
+      usecs = 1;
+    }
+
+  double const ratio = static_cast<double> (compressed_length) / length;
+  double const speed = length * 1000000.0 / static_cast<double> (usecs);
+
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  Class_Map::iterator const it =
+    this->classes_.find (ACE_CString (message_class, 0, false));
+  if (it == this->classes_.end ())
+    {
+      return;
+    }
+
+  Level_Stats *stats = find_level (it->second, level);
+  if (stats == 0)
+    {
+      return;
+    }
+
+  if (stats->samples == 0)
+    {
+      stats->ratio = ratio;
+      stats->speed = speed;
+    }
+  else
+    {
+      stats->ratio += (ratio - stats->ratio) / 8;
+      stats->speed += (speed - stats->speed) / 8;
+    }
+  ++stats->samples;
+}
+
+void
+TAO_ZIOP_Adaptive_Compression::sent (CORBA::ULong length,
+                                     CORBA::ULong sent_length)
+{
+  if (!this->enabled_)
+    {
+      return;
+    }
+
+  ACE_GUARD (TAO_SYNCH_MUTEX, ace_mon, this->lock_);
+
+  if (sent_length < length)
+    {
+      ++this->compressed_messages_;
+      this->saved_bytes_ += length - sent_length;
+    }
+  else
+    {
+      ++this->skipped_messages_;
+    }
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  this->compressed_monitor_->receive (
+    static_cast<size_t> (this->compressed_messages_));
+  this->skipped_monitor_->receive (
+    static_cast<size_t> (this->skipped_messages_));
+  this->saved_bytes_monitor_->receive (
+    static_cast<size_t> (this->saved_bytes_));
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+}
+
+TAO_END_VERSIONED_NAMESPACE_DECL
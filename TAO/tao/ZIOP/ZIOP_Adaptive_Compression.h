@@ -0,0 +1,167 @@
+// -*- C++ -*-
+
+//=============================================================================
+/**
+ *  @file ZIOP_Adaptive_Compression.h
+ *
+ *  Decides per message whether compressing it pays off
+ */
+//=============================================================================
+
+#ifndef TAO_ZIOP_ADAPTIVE_COMPRESSION_H
+#define TAO_ZIOP_ADAPTIVE_COMPRESSION_H
+#include /**/ "ace/pre.h"
+
+#include "tao/ZIOP/ziop_export.h"
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+# pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+#include "tao/Compression/Compression.h"
+#include "ace/SString.h"
+#include "ace/Time_Value.h"
+#include <map>
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+#include "ace/Monitor_Size.h"
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+
+/// The number of message classes whose statistics are kept, the
+/// messages of the other classes are compressed as the policies say.
+#if !defined (TAO_ZIOP_ADAPTIVE_MAX_CLASSES)
+# define TAO_ZIOP_ADAPTIVE_MAX_CLASSES 1024
+#endif /* TAO_ZIOP_ADAPTIVE_MAX_CLASSES */
+
+TAO_BEGIN_VERSIONED_NAMESPACE_DECL
+
+/**
+ * @class TAO_ZIOP_Adaptive_Compression
+ *
+ * @brief Chooses whether and at which level to compress each message.
+ *
+ * The compression policies only say which compressor may be used, at
+ * most at which level, and from which size and ratio on.  With them
+ * alone a message that does not compress well enough is compressed
+ * and then sent uncompressed anyway.
+ *
+ * The adaptive mode keeps, per message class (the repository id of
+ * the target for requests, the operation for replies), the running
+ * average of the ratio and of the speed of the compressor at the
+ * level of the policies and at level 1.  A message is compressed at
+ * the level where the time saved on the link, at the throughput
+ * estimated by its transport, exceeds most the time spent
+ * compressing, or sent uncompressed when neither does.  One message
+ * out of the sample interval of each class is compressed anyway, at
+ * the level with the fewest samples, so the averages follow the data.
+ */
+class TAO_ZIOP_Export TAO_ZIOP_Adaptive_Compression
+{
+public:
+  TAO_ZIOP_Adaptive_Compression (void);
+
+  ~TAO_ZIOP_Adaptive_Compression (void);
+
+  /// Enable or disable the adaptive mode.
+  void enabled (bool enabled);
+  bool enabled (void) const;
+
+  /// The link throughput in bytes per second used while the
+  /// transport has no estimate.
+  void default_link_throughput (size_t throughput);
+
+  /// One message out of @a interval of each class is compressed to
+  /// sample the compressor.
+  void sample_interval (CORBA::ULong interval);
+
+  /**
+   * Decide whether to compress a message of @a message_class of
+   * @a length bytes, sent on a link of @a link_throughput bytes per
+   * second, zero when unknown.  @a level is the level of the policies
+   * on input and the level to use on output.  Returns false when the
+   * message should be sent uncompressed.
+   */
+  bool compress (const char *message_class,
+                 CORBA::ULong length,
+                 size_t link_throughput,
+                 ::Compression::CompressionLevel &level);
+
+  /// Record that compressing @a length bytes of @a message_class at
+  /// @a level gave @a compressed_length bytes in @a elapsed.
+  void compressed (const char *message_class,
+                   ::Compression::CompressionLevel level,
+                   CORBA::ULong length,
+                   CORBA::ULong compressed_length,
+                   const ACE_Time_Value &elapsed);
+
+  /// Record a message of @a length bytes sent as @a sent_length bytes,
+  /// for the monitor points.
+  void sent (CORBA::ULong length, CORBA::ULong sent_length);
+
+private:
+  /// Statistics of the compressor at a level.
+  struct Level_Stats
+  {
+    Level_Stats (void);
+
+    ::Compression::CompressionLevel level;
+
+    /// Running average of compressed / uncompressed length.
+    double ratio;
+
+    /// Running average of the compression speed, bytes per second.
+    double speed;
+
+    CORBA::ULong samples;
+  };
+
+  /// Statistics of a message class, at the level of the policies and
+  /// at the fast level.
+  struct Class_Stats
+  {
+    Class_Stats (void);
+
+    Level_Stats levels[2];
+    CORBA::ULong messages;
+  };
+
+  typedef std::map<ACE_CString, Class_Stats> Class_Map;
+
+  /// The statistics of @a level in @a stats, zero when it has none.
+  static Level_Stats *find_level (Class_Stats &stats,
+                                  ::Compression::CompressionLevel level);
+
+  /// Time saved by compressing @a length bytes with @a stats on a link
+  /// of @a link_throughput, negative when it costs more than it saves.
+  static double gain (const Level_Stats &stats,
+                      CORBA::ULong length,
+                      size_t link_throughput);
+
+  bool enabled_;
+  size_t default_link_throughput_;
+  CORBA::ULong sample_interval_;
+
+  TAO_SYNCH_MUTEX lock_;
+  Class_Map classes_;
+
+  ACE_UINT64 compressed_messages_;
+  ACE_UINT64 skipped_messages_;
+  ACE_UINT64 saved_bytes_;
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  /// Messages sent compressed and uncompressed by the adaptive mode.
+  ACE::Monitor_Control::Size_Monitor *compressed_monitor_;
+  ACE::Monitor_Control::Size_Monitor *skipped_monitor_;
+
+  /// Bytes the compression saved on the links.
+  ACE::Monitor_Control::Size_Monitor *saved_bytes_monitor_;
+
+  /// The last link throughput estimate used for a decision.
+  ACE::Monitor_Control::Size_Monitor *link_throughput_monitor_;
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+};
+
+TAO_END_VERSIONED_NAMESPACE_DECL
+
+#include /**/ "ace/post.h"
+#endif /* TAO_ZIOP_ADAPTIVE_COMPRESSION_H */
@@ -6,4 +6,19 @@ TAO_ZIOP_Adapter::~TAO_ZIOP_Adapter (void)
 {
 }
 
+bool
+TAO_ZIOP_Adapter::marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub,
+                                TAO_Transport *)
+{
+  return this->marshal_data (cdr, stub);
+}
+
+bool
+TAO_ZIOP_Adapter::marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core,
+                                TAO_ServerRequest *request,
+                                TAO_Transport *)
+{
+  return this->marshal_data (cdr, orb_core, request);
+}
+
 TAO_END_VERSIONED_NAMESPACE_DECL
@@ -26,6 +26,7 @@ TAO_BEGIN_VERSIONED_NAMESPACE_DECL
 
 class TAO_Policy_Validator;
 class TAO_Queued_Data;
+class TAO_Transport;
 
 /**
  * @class TAO_ZIOP_Adapter
@@ -43,6 +44,15 @@ public:
   virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub) = 0;
   virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core, TAO_ServerRequest *request) = 0;
 
+  /// Compress the message in @a cdr, which is sent on @a transport
+  /// when it is known.  The default implementations ignore
+  /// @a transport and call the overloads above.
+  virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_Stub &stub,
+                             TAO_Transport *transport);
+  virtual bool marshal_data (TAO_OutputCDR &cdr, TAO_ORB_Core &orb_core,
+                             TAO_ServerRequest *request,
+                             TAO_Transport *transport);
+
   virtual void load_policy_validators (TAO_Policy_Validator &validator) = 0;
 
   /// The virtual destructor
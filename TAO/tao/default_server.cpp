@@ -182,6 +182,18 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
               ACE_OS::atoi (value);
           }
       }
+    else if (ACE_OS::strcasecmp (argv[curarg],
+                                 ACE_TEXT("-ORBPOADemuxCache")) == 0)
+      {
+        ++curarg;
+        if (curarg < argc)
+          {
+            ACE_TCHAR* value = argv[curarg];
+
+            this->active_object_map_creation_parameters_.use_demux_cache_ =
+              ACE_OS::atoi (value);
+          }
+      }
     else if (ACE_OS::strcasecmp (argv[curarg],
                                  ACE_TEXT("-ORBAllowReactivationOfSystemids")) == 0)
       {
@@ -235,6 +247,10 @@ TAO_Default_Server_Strategy_Factory::parse_args (int argc, ACE_TCHAR* argv[])
                                          ACE_TEXT("active")) == 0)
               this->active_object_map_creation_parameters_.object_lookup_strategy_for_system_id_policy_ =
                 TAO_ACTIVE_DEMUX;
+            else if (ACE_OS::strcasecmp (name,
+                                         ACE_TEXT("indexed")) == 0)
+              this->active_object_map_creation_parameters_.object_lookup_strategy_for_system_id_policy_ =
+                TAO_INDEXED_DEMUX;
             else
               this->report_option_value_error (ACE_TEXT("-ORBSystemidPolicyDemuxStrategy"), name);
           }
@@ -190,6 +190,23 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
 # define TAO_NO_COPY_OCTET_SEQUENCES 1
 #endif /* TAO_NO_COPY_OCTET_SEQUENCES */
 
+// Define to 1 to let the unbounded sequences of integer and floating
+// point types reference the elements in the received message, when
+// they arrive in the byte order of the host, instead of copying them.
+// Such a sequence keeps the whole message block alive.  The option
+// changes the layout of the sequences, define it in config.h so that
+// TAO and all the code built with it agree on it.
+#if !defined(TAO_NO_COPY_VALUE_SEQUENCES)
+# define TAO_NO_COPY_VALUE_SEQUENCES 0
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES */
+
+// The number of characters, terminating null included, that the
+// TAO::SSO_String_Manager string members generated by tao_idl -Gsso
+// keep inline.  Longer strings are allocated from the heap.
+#if !defined(TAO_SSO_STRING_MANAGER_SIZE)
+# define TAO_SSO_STRING_MANAGER_SIZE 24
+#endif /* TAO_SSO_STRING_MANAGER_SIZE */
+
 // Define if your processor does not store words with the most significant
 // byte first.
 
@@ -646,6 +663,38 @@ const size_t TAO_DEFAULT_VALUE_FACTORY_TABLE_SIZE = 128;
             TAO_HAS_CORBA_MESSAGING == 0 */
 #endif  /* !TAO_HAS_AMI_CALLBACK */
 
+// The awaitable AMI stubs (tao_idl -GCo) are enabled when TAO is
+// configured for AMI_CALLBACK and the compiler supports C++20
+// coroutines.
+// To explicitly disable them uncomment the following
+// #define TAO_HAS_AMI_COROUTINES 0
+
+/// Default AMI_COROUTINES settings
+#if !defined (TAO_HAS_AMI_COROUTINES)
+#  if (TAO_HAS_AMI_CALLBACK == 1) && defined (ACE_HAS_CPP20) && \
+      defined (__cpp_impl_coroutine)
+#    define TAO_HAS_AMI_COROUTINES 1
+#  else
+#    define TAO_HAS_AMI_COROUTINES 0
+#  endif  /* TAO_HAS_AMI_CALLBACK == 1 && ACE_HAS_CPP20 */
+#endif  /* !TAO_HAS_AMI_COROUTINES */
+
+// The coroutine AMH servant operations (tao_idl -GHo) are enabled
+// when TAO is configured for CORBA Messaging and the compiler
+// supports C++20 coroutines.
+// To explicitly disable them uncomment the following
+// #define TAO_HAS_AMH_COROUTINES 0
+
+/// Default AMH_COROUTINES settings
+#if !defined (TAO_HAS_AMH_COROUTINES)
+#  if (TAO_HAS_CORBA_MESSAGING == 1) && defined (ACE_HAS_CPP20) && \
+      defined (__cpp_impl_coroutine)
+#    define TAO_HAS_AMH_COROUTINES 1
+#  else
+#    define TAO_HAS_AMH_COROUTINES 0
+#  endif  /* TAO_HAS_CORBA_MESSAGING == 1 && ACE_HAS_CPP20 */
+#endif  /* !TAO_HAS_AMH_COROUTINES */
+
 /// Interceptors is supported by default if we are not building for
 /// MinimumCORBA.
 #if !defined (TAO_HAS_INTERCEPTORS)
@@ -825,6 +874,24 @@ enum TAO_Policy_Scope
 #    define TAO_HAS_TRANSPORT_CURRENT 1
 #endif  /* ! TAO_HAS_TRANSPORT_CURRENT */
 
+// The in arguments of a skeleton upcall are demarshaled into a per
+// thread arena, released once the reply is marshaled.  Servants must
+// copy an in argument they keep past the upcall, as the C++ mapping
+// requires.  To use the heap for them instead uncomment the following
+// #define TAO_HAS_UPCALL_ARENA 0
+
+/// Default UPCALL_ARENA settings
+#if !defined (TAO_HAS_UPCALL_ARENA)
+#    define TAO_HAS_UPCALL_ARENA 1
+#endif  /* ! TAO_HAS_UPCALL_ARENA */
+
+/// Size of the blocks of the upcall arena.  Allocations larger than a
+/// quarter of a block get a block of their own, freed at the end of
+/// the upcall.
+#if !defined (TAO_UPCALL_ARENA_BLOCK_SIZE)
+#    define TAO_UPCALL_ARENA_BLOCK_SIZE 16384
+#endif  /* ! TAO_UPCALL_ARENA_BLOCK_SIZE */
+
 #if !defined (TAO_HAS_DDL_PARSER)
 # define TAO_HAS_DDL_PARSER 1
 #endif
@@ -40,6 +40,7 @@ TAO_ORB_Parameters::TAO_ORB_Parameters (void)
   , sched_policy_ (THR_SCHED_DEFAULT)
   , scope_policy_ (THR_SCOPE_PROCESS)
   , single_read_optimization_ (1)
+  , giop_fragment_chaining_ (false)
   , shared_profile_ (0)
   , use_parallel_connects_ (false)
   , parallel_connect_delay_ (0)
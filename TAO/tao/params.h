@@ -196,6 +196,11 @@ public:
   int single_read_optimization (void) const;
   void single_read_optimization (int x);
 
+  /// Read the fragmented GIOP messages from the chained fragments
+  /// instead of copying them in one buffer.
+  bool giop_fragment_chaining (void) const;
+  void giop_fragment_chaining (bool x);
+
   /// Create shared profiles without priority
   int shared_profile (void) const;
   void shared_profile (int x);
@@ -398,6 +403,9 @@ private:
   /// Single read optimization.
   int single_read_optimization_;
 
+  /// Read the fragmented GIOP messages from the chained fragments.
+  bool giop_fragment_chaining_;
+
   /// Shared Profile - Use the same profile for multiple endpoints
   int shared_profile_;
 
@@ -289,6 +289,18 @@ TAO_ORB_Parameters::single_read_optimization (int x)
   this->single_read_optimization_ = x;
 }
 
+ACE_INLINE bool
+TAO_ORB_Parameters::giop_fragment_chaining (void) const
+{
+  return this->giop_fragment_chaining_;
+}
+
+ACE_INLINE void
+TAO_ORB_Parameters::giop_fragment_chaining (bool x)
+{
+  this->giop_fragment_chaining_ = x;
+}
+
 ACE_INLINE bool
 TAO_ORB_Parameters::use_parallel_connects (void) const
 {
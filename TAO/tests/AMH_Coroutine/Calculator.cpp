@@ -0,0 +1,29 @@
+#include "Calculator.h"
+
+Calculator::Calculator (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+{
+}
+
+CORBA::Long
+Calculator::add (CORBA::Long a, CORBA::Long b)
+{
+  if (a + b > Calculator::limit)
+    {
+      throw Test::Overflow (Calculator::limit);
+    }
+
+  return a + b;
+}
+
+char *
+Calculator::echo (const char *s)
+{
+  return CORBA::string_dup (s);
+}
+
+void
+Calculator::shutdown (void)
+{
+  this->orb_->shutdown (0);
+}
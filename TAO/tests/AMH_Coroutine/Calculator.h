@@ -0,0 +1,32 @@
+
+#ifndef CALCULATOR_H
+#define CALCULATOR_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+
+/// Implement the Test::Calculator interface, the backend
+class Calculator
+  : public virtual POA_Test::Calculator
+{
+public:
+  /// Constructor
+  Calculator (CORBA::ORB_ptr orb);
+
+  // = The skeleton methods
+  virtual CORBA::Long add (CORBA::Long a, CORBA::Long b);
+
+  virtual char *echo (const char *s);
+
+  virtual void shutdown (void);
+
+  /// The largest sum add() returns.
+  static const CORBA::Long limit = 1000000;
+
+private:
+  /// Use an ORB reference to shutdown the application.
+  CORBA::ORB_var orb_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* CALCULATOR_H */
@@ -0,0 +1,100 @@
+#include "Middle.h"
+#include "ace/OS_NS_string.h"
+
+Middle::Middle (CORBA::ORB_ptr orb, Test::Calculator_ptr backend)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+  , backend_ (Test::Calculator::_duplicate (backend))
+{
+}
+
+#if (TAO_HAS_AMH_COROUTINES == 1)
+
+::TAO::AMH::Coroutine
+Middle::co_sum (Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+                Test::LongSeq values)
+{
+  CORBA::Long total = 0;
+
+  // A Test::Overflow raised by the backend escapes the coroutine and
+  // is sent back to the client.
+  for (CORBA::ULong i = 0; i != values.length (); ++i)
+    {
+      Test::Calculator::co_add_reply const r =
+        co_await this->backend_->co_add (total, values[i]);
+
+      total = r.ami_return_val;
+    }
+
+  _tao_rh->sum (total);
+}
+
+::TAO::AMH::Coroutine
+Middle::co_echo (Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+                 CORBA::String_var s,
+                 Test::Calculator_var target)
+{
+  Test::Calculator::co_echo_reply const r =
+    co_await target->co_echo (s.in ());
+
+  // The coroutine owns its arguments, they are still valid after the
+  // suspension.
+  if (ACE_OS::strcmp (r.ami_return_val.in (), s.in ()) != 0)
+    {
+      throw CORBA::INTERNAL ();
+    }
+
+  _tao_rh->echo (r.ami_return_val.in ());
+}
+
+::TAO::AMH::Coroutine
+Middle::co_shutdown (Test::AMH_MiddleResponseHandler_ptr)
+{
+  this->orb_->shutdown (0);
+
+  co_return;
+}
+
+#else
+
+void
+Middle::sum (Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+             const Test::LongSeq &values)
+{
+  CORBA::Long total = 0;
+
+  try
+    {
+      for (CORBA::ULong i = 0; i != values.length (); ++i)
+        {
+          total = this->backend_->add (total, values[i]);
+        }
+    }
+  catch (const Test::Overflow &ex)
+    {
+      // Callee owns the memory now.
+      Test::AMH_MiddleExceptionHolder holder (
+        new Test::Overflow (ex));
+      _tao_rh->sum_excep (&holder);
+      return;
+    }
+
+  _tao_rh->sum (total);
+}
+
+void
+Middle::echo (Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+              const char *s,
+              Test::Calculator_ptr target)
+{
+  CORBA::String_var r = target->echo (s);
+
+  _tao_rh->echo (r.in ());
+}
+
+void
+Middle::shutdown (Test::AMH_MiddleResponseHandler_ptr)
+{
+  this->orb_->shutdown (0);
+}
+
+#endif /* TAO_HAS_AMH_COROUTINES == 1 */
@@ -0,0 +1,57 @@
+
+#ifndef MIDDLE_H
+#define MIDDLE_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+
+/// Implement the Test::Middle interface with coroutines
+/**
+ * Each operation awaits the replies of the backend without holding
+ * the thread that dispatched the request, and completes the request
+ * through its ResponseHandler.  Without coroutine support the
+ * operations call the backend synchronously, so the test runs in all
+ * builds.
+ */
+class Middle
+  : public virtual POA_Test::AMH_Middle
+{
+public:
+  /// Constructor
+  Middle (CORBA::ORB_ptr orb, Test::Calculator_ptr backend);
+
+#if (TAO_HAS_AMH_COROUTINES == 1)
+  // = The co_* AMH methods
+  virtual ::TAO::AMH::Coroutine co_sum (
+    Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+    Test::LongSeq values);
+
+  virtual ::TAO::AMH::Coroutine co_echo (
+    Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+    CORBA::String_var s,
+    Test::Calculator_var target);
+
+  virtual ::TAO::AMH::Coroutine co_shutdown (
+    Test::AMH_MiddleResponseHandler_ptr _tao_rh);
+#else
+  // = The AMH methods
+  virtual void sum (Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+                    const Test::LongSeq &values);
+
+  virtual void echo (Test::AMH_MiddleResponseHandler_ptr _tao_rh,
+                     const char *s,
+                     Test::Calculator_ptr target);
+
+  virtual void shutdown (Test::AMH_MiddleResponseHandler_ptr _tao_rh);
+#endif /* TAO_HAS_AMH_COROUTINES == 1 */
+
+private:
+  /// Use an ORB reference to shutdown the application.
+  CORBA::ORB_var orb_;
+
+  /// The backend sum() adds the values with.
+  Test::Calculator_var backend_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* MIDDLE_H */
@@ -0,0 +1,164 @@
+#include "TestC.h"
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_string.h"
+
+const ACE_TCHAR *ior = ACE_TEXT ("file://middle.ior");
+const ACE_TCHAR *backend_ior = ACE_TEXT ("file://backend.ior");
+CORBA::ULong nvalues = 100;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:b:n:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case 'b':
+        backend_ior = get_opts.opt_arg ();
+        break;
+
+      case 'n':
+        nvalues = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <middle ior> "
+                           "-b <backend ior> "
+                           "-n <nvalues> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+run_test (Test::Middle_ptr middle, Test::Calculator_ptr backend)
+{
+  int errors = 0;
+
+  Test::LongSeq values (nvalues);
+  values.length (nvalues);
+
+  CORBA::Long expected = 0;
+
+  for (CORBA::ULong i = 0; i != nvalues; ++i)
+    {
+      values[i] = i;
+      expected += i;
+    }
+
+  CORBA::Long const total = middle->sum (values);
+
+  if (total != expected)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: sum returned <%d>, expected <%d>\n",
+                  total, expected));
+      ++errors;
+    }
+
+  CORBA::String_var s = middle->echo ("coroutine", backend);
+
+  if (ACE_OS::strcmp (s.in (), "coroutine") != 0)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: echo returned <%C>\n",
+                  s.in ()));
+      ++errors;
+    }
+
+  // The backend raises Test::Overflow in the middle of the sum.
+  values.length (3);
+  values[0] = 1000000;
+  values[1] = 1;
+  values[2] = 1;
+
+  try
+    {
+      (void) middle->sum (values);
+
+      ACE_ERROR ((LM_ERROR, "ERROR: Test::Overflow not raised\n"));
+      ++errors;
+    }
+  catch (const Test::Overflow &ex)
+    {
+      ACE_DEBUG ((LM_DEBUG,
+                  "(%P|%t) - Test::Overflow <%d> caught\n",
+                  ex.limit));
+    }
+
+  return errors;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tmp = orb->string_to_object(ior);
+
+      Test::Middle_var middle =
+        Test::Middle::_narrow(tmp.in ());
+
+      if (CORBA::is_nil (middle.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_DEBUG,
+                             "Nil Test::Middle reference <%s>\n",
+                             ior),
+                            1);
+        }
+
+      tmp = orb->string_to_object(backend_ior);
+
+      Test::Calculator_var backend =
+        Test::Calculator::_narrow(tmp.in ());
+
+      if (CORBA::is_nil (backend.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_DEBUG,
+                             "Nil Test::Calculator reference <%s>\n",
+                             backend_ior),
+                            1);
+        }
+
+      int const errors = run_test (middle.in (), backend.in ());
+
+      if (errors != 0)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: %d checks failed\n",
+                      errors));
+          status = 1;
+        }
+
+      middle->shutdown ();
+      backend->shutdown ();
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return status;
+}
@@ -0,0 +1,118 @@
+#include "Middle.h"
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_stdio.h"
+
+const ACE_TCHAR *backend_ior = ACE_TEXT ("file://backend.ior");
+const ACE_TCHAR *ior_output_file = ACE_TEXT ("middle.ior");
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:o:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        backend_ior = get_opts.opt_arg ();
+        break;
+
+      case 'o':
+        ior_output_file = get_opts.opt_arg ();
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <backend ior> "
+                           "-o <iorfile>"
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var poa_object =
+        orb->resolve_initial_references("RootPOA");
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      if (CORBA::is_nil (root_poa.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Panic: nil RootPOA\n"),
+                          1);
+
+      PortableServer::POAManager_var poa_manager = root_poa->the_POAManager ();
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tmp = orb->string_to_object (backend_ior);
+
+      Test::Calculator_var backend =
+        Test::Calculator::_narrow (tmp.in ());
+
+      if (CORBA::is_nil (backend.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_DEBUG,
+                             "Nil Test::Calculator reference <%s>\n",
+                             backend_ior),
+                            1);
+        }
+
+      Middle *middle_impl = 0;
+      ACE_NEW_RETURN (middle_impl,
+                      Middle (orb.in (), backend.in ()),
+                      1);
+      PortableServer::ServantBase_var owner_transfer(middle_impl);
+
+      PortableServer::ObjectId_var id =
+        root_poa->activate_object (middle_impl);
+
+      CORBA::Object_var object = root_poa->id_to_reference (id.in ());
+
+      CORBA::String_var ior = orb->object_to_string (object.in ());
+
+      // Output the IOR to the <ior_output_file>
+      FILE *output_file= ACE_OS::fopen (ior_output_file, "w");
+      if (output_file == 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "Cannot open output file for writing IOR: %s\n",
+                           ior_output_file),
+                           1);
+      ACE_OS::fprintf (output_file, "%s", ior.in ());
+      ACE_OS::fclose (output_file);
+
+      poa_manager->activate ();
+
+      // The same event loop dispatches the requests of the clients
+      // and the replies of the backend, which resume the coroutines.
+      orb->run ();
+
+      ACE_DEBUG ((LM_DEBUG, "(%P|%t) middle - event loop finished\n"));
+
+      root_poa->destroy (1, 1);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+     & eval 'exec perl -S $0 $argv:q'
+     if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+$status = 0;
+$debug_level = '0';
+$cdebug_level = '0';
+foreach $i (@ARGV) {
+    if ($i eq '-debug') {
+        $debug_level = '10';
+    }
+    if ($i eq '-cdebug') {
+      $cdebug_level = '10';
+    }
+}
+
+my $backend = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+my $middle = PerlACE::TestTarget::create_target (2) || die "Create target 2 failed\n";
+my $client = PerlACE::TestTarget::create_target (3) || die "Create target 3 failed\n";
+
+my $backend_iorbase = "backend.ior";
+my $middle_iorbase = "middle.ior";
+my $backend_iorfile = $backend->LocalFile ($backend_iorbase);
+my $middle_backend_iorfile = $middle->LocalFile ($backend_iorbase);
+my $middle_iorfile = $middle->LocalFile ($middle_iorbase);
+my $client_backend_iorfile = $client->LocalFile ($backend_iorbase);
+my $client_middle_iorfile = $client->LocalFile ($middle_iorbase);
+$backend->DeleteFile($backend_iorbase);
+$middle->DeleteFile($backend_iorbase);
+$middle->DeleteFile($middle_iorbase);
+$client->DeleteFile($backend_iorbase);
+$client->DeleteFile($middle_iorbase);
+
+$BE = $backend->CreateProcess ("backend", "-ORBdebuglevel $debug_level -o $backend_iorfile");
+$MD = $middle->CreateProcess ("middle", "-ORBdebuglevel $debug_level -k file://$middle_backend_iorfile -o $middle_iorfile");
+$CL = $client->CreateProcess ("client", "-ORBdebuglevel $cdebug_level -k file://$client_middle_iorfile -b file://$client_backend_iorfile");
+
+$backend_status = $BE->Spawn ();
+
+if ($backend_status != 0) {
+    print STDERR "ERROR: backend returned $backend_status\n";
+    exit 1;
+}
+
+if ($backend->WaitForFileTimed ($backend_iorbase,
+                                $backend->ProcessStartWaitInterval()) == -1) {
+    print STDERR "ERROR: cannot find file <$backend_iorfile>\n";
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+
+if ($backend->GetFile ($backend_iorbase) == -1) {
+    print STDERR "ERROR: cannot retrieve file <$backend_iorfile>\n";
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+if ($middle->PutFile ($backend_iorbase) == -1) {
+    print STDERR "ERROR: cannot set file <$middle_backend_iorfile>\n";
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+if ($client->PutFile ($backend_iorbase) == -1) {
+    print STDERR "ERROR: cannot set file <$client_backend_iorfile>\n";
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+
+$middle_status = $MD->Spawn ();
+
+if ($middle_status != 0) {
+    print STDERR "ERROR: middle returned $middle_status\n";
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+
+if ($middle->WaitForFileTimed ($middle_iorbase,
+                               $middle->ProcessStartWaitInterval()) == -1) {
+    print STDERR "ERROR: cannot find file <$middle_iorfile>\n";
+    $MD->Kill (); $MD->TimedWait (1);
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+
+if ($middle->GetFile ($middle_iorbase) == -1) {
+    print STDERR "ERROR: cannot retrieve file <$middle_iorfile>\n";
+    $MD->Kill (); $MD->TimedWait (1);
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+if ($client->PutFile ($middle_iorbase) == -1) {
+    print STDERR "ERROR: cannot set file <$client_middle_iorfile>\n";
+    $MD->Kill (); $MD->TimedWait (1);
+    $BE->Kill (); $BE->TimedWait (1);
+    exit 1;
+}
+
+$client_status = $CL->SpawnWaitKill ($client->ProcessStartWaitInterval());
+
+if ($client_status != 0) {
+    print STDERR "ERROR: client returned $client_status\n";
+    $status = 1;
+}
+
+$middle_status = $MD->WaitKill ($middle->ProcessStopWaitInterval());
+
+if ($middle_status != 0) {
+    print STDERR "ERROR: middle returned $middle_status\n";
+    $status = 1;
+}
+
+$backend_status = $BE->WaitKill ($backend->ProcessStopWaitInterval());
+
+if ($backend_status != 0) {
+    print STDERR "ERROR: backend returned $backend_status\n";
+    $status = 1;
+}
+
+$backend->DeleteFile($backend_iorbase);
+$middle->DeleteFile($backend_iorbase);
+$middle->DeleteFile($middle_iorbase);
+$client->DeleteFile($backend_iorbase);
+$client->DeleteFile($middle_iorbase);
+
+exit $status;
@@ -0,0 +1,39 @@
+#include "Calculator.h"
+
+Calculator::Calculator (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+{
+}
+
+CORBA::Long
+Calculator::add (CORBA::Long a, CORBA::Long b)
+{
+  if (a + b > Calculator::limit)
+    {
+      throw Test::Overflow (Calculator::limit);
+    }
+
+  return a + b;
+}
+
+void
+Calculator::divide (CORBA::Long a,
+                    CORBA::Long b,
+                    CORBA::Long_out quotient,
+                    CORBA::Long_out remainder)
+{
+  quotient = a / b;
+  remainder = a % b;
+}
+
+char *
+Calculator::echo (const char *s)
+{
+  return CORBA::string_dup (s);
+}
+
+void
+Calculator::shutdown (void)
+{
+  this->orb_->shutdown (0);
+}
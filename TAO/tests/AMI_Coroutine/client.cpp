@@ -0,0 +1,298 @@
+#include "TestC.h"
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_string.h"
+
+#if (TAO_HAS_AMI_COROUTINES == 1)
+
+#include <coroutine>
+#include <utility>
+#include <vector>
+
+const ACE_TCHAR *ior = ACE_TEXT ("file://test.ior");
+int niterations = 100;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:i:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case 'i':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "-i <niterations> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// The coroutine of the test, its result is the number of errors.
+class Test_Task
+{
+public:
+  struct promise_type
+  {
+    promise_type (void)
+      : errors_ (0)
+    {
+    }
+
+    Test_Task get_return_object (void)
+    {
+      return Test_Task (
+        std::coroutine_handle<promise_type>::from_promise (*this));
+    }
+
+    std::suspend_never initial_suspend (void) noexcept
+    {
+      return std::suspend_never ();
+    }
+
+    std::suspend_always final_suspend (void) noexcept
+    {
+      return std::suspend_always ();
+    }
+
+    void return_value (int errors)
+    {
+      this->errors_ = errors;
+    }
+
+    void unhandled_exception (void)
+    {
+      ACE_ERROR ((LM_ERROR, "ERROR: unexpected exception in the coroutine\n"));
+      this->errors_ = 1;
+    }
+
+    int errors_;
+  };
+
+  explicit Test_Task (std::coroutine_handle<promise_type> h)
+    : handle_ (h)
+  {
+  }
+
+  ~Test_Task (void)
+  {
+    this->handle_.destroy ();
+  }
+
+  bool done (void) const
+  {
+    return this->handle_.done ();
+  }
+
+  int errors (void) const
+  {
+    return this->handle_.promise ().errors_;
+  }
+
+private:
+  std::coroutine_handle<promise_type> handle_;
+};
+
+Test_Task
+run_test (Test::Calculator_ptr calculator)
+{
+  int errors = 0;
+
+  try
+    {
+      // Send all the requests before waiting for the first reply.
+      std::vector< ::TAO::AMI::Awaitable<Test::Calculator::co_add_reply> >
+        pending;
+      pending.reserve (niterations);
+
+      for (int i = 0; i != niterations; ++i)
+        {
+          pending.push_back (calculator->co_add (i, i));
+        }
+
+      for (int i = 0; i != niterations; ++i)
+        {
+          Test::Calculator::co_add_reply const r =
+            co_await std::move (pending[i]);
+
+          if (r.ami_return_val != 2 * i)
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: add returned <%d>, expected <%d>\n",
+                          r.ami_return_val, 2 * i));
+              ++errors;
+            }
+        }
+
+      Test::Calculator::co_divide_reply const d =
+        co_await calculator->co_divide (17, 5);
+
+      if (d.quotient != 3 || d.remainder != 2)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: divide returned <%d,%d>, expected <3,2>\n",
+                      d.quotient, d.remainder));
+          ++errors;
+        }
+
+      Test::Calculator::co_echo_reply const e =
+        co_await calculator->co_echo ("coroutine");
+
+      if (ACE_OS::strcmp (e.ami_return_val.in (), "coroutine") != 0)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: echo returned <%C>\n",
+                      e.ami_return_val.in ()));
+          ++errors;
+        }
+
+      try
+        {
+          (void) co_await calculator->co_add (1000000, 1);
+
+          ACE_ERROR ((LM_ERROR, "ERROR: Test::Overflow not raised\n"));
+          ++errors;
+        }
+      catch (const Test::Overflow &ex)
+        {
+          ACE_DEBUG ((LM_DEBUG,
+                      "(%P|%t) - Test::Overflow <%d> caught\n",
+                      ex.limit));
+        }
+    }
+  catch (const CORBA::Exception &ex)
+    {
+      ex._tao_print_exception ("ERROR: run_test:");
+      ++errors;
+    }
+
+  co_return errors;
+}
+
+/// Set if the coroutine of abandon_test is resumed.
+bool abandoned_resumed = false;
+
+/// A coroutine that is destroyed while it awaits the reply.
+Test_Task
+abandon_test (Test::Calculator_ptr calculator)
+{
+  (void) co_await calculator->co_echo ("abandoned");
+
+  abandoned_resumed = true;
+
+  co_return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tmp = orb->string_to_object(ior);
+
+      Test::Calculator_var calculator =
+        Test::Calculator::_narrow(tmp.in ());
+
+      if (CORBA::is_nil (calculator.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_DEBUG,
+                             "Nil Test::Calculator reference <%s>\n",
+                             ior),
+                            1);
+        }
+
+      {
+        Test_Task task = run_test (calculator.in ());
+
+        // The replies resume the coroutine from the event loop.
+        while (!task.done ())
+          {
+            orb->perform_work ();
+          }
+
+        if (task.errors () != 0)
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "ERROR: %d checks failed\n",
+                        task.errors ()));
+            status = 1;
+          }
+      }
+
+      {
+        // No thread runs the event loop, the coroutine is suspended
+        // until its task is destroyed.
+        Test_Task task = abandon_test (calculator.in ());
+
+        if (task.done ())
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "ERROR: abandoned coroutine did not suspend\n"));
+            status = 1;
+          }
+      }
+
+      // The reply of the abandoned request arrives before the one of
+      // this request and is dispatched while the client waits for it.
+      CORBA::String_var s = calculator->echo ("after abandon");
+
+      for (int i = 0; i != 10; ++i)
+        {
+          ACE_Time_Value tv (0, 10000);
+          orb->perform_work (tv);
+        }
+
+      if (abandoned_resumed)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: a destroyed coroutine was resumed\n"));
+          status = 1;
+        }
+
+      calculator->shutdown ();
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return status;
+}
+
+#else
+
+int
+ACE_TMAIN(int, ACE_TCHAR *[])
+{
+  ACE_DEBUG ((LM_DEBUG,
+              "(%P|%t) - AMI coroutines are not supported "
+              "by this build\n"));
+
+  return 0;
+}
+
+#endif /* TAO_HAS_AMI_COROUTINES == 1 */
@@ -0,0 +1,32 @@
+#include "Sensor.h"
+
+Sensor::Sensor (CORBA::ORB_ptr orb)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+  , count_ (0)
+{
+}
+
+void
+Sensor::sample (CORBA::Long)
+{
+  ++this->count_;
+}
+
+CORBA::Long
+Sensor::echo (CORBA::Long value)
+{
+  ++this->count_;
+  return value;
+}
+
+CORBA::Long
+Sensor::count (void)
+{
+  return this->count_;
+}
+
+void
+Sensor::shutdown (void)
+{
+  this->orb_->shutdown (0);
+}
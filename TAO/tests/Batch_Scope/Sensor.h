@@ -0,0 +1,34 @@
+
+#ifndef SENSOR_H
+#define SENSOR_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+
+/// Implement the Test::Sensor interface
+class Sensor
+  : public virtual POA_Test::Sensor
+{
+public:
+  /// Constructor
+  Sensor (CORBA::ORB_ptr orb);
+
+  // = The skeleton methods
+  virtual void sample (CORBA::Long value);
+
+  virtual CORBA::Long echo (CORBA::Long value);
+
+  virtual CORBA::Long count (void);
+
+  virtual void shutdown (void);
+
+private:
+  /// Use an ORB reference to shutdown the application.
+  CORBA::ORB_var orb_;
+
+  /// Number of samples and echo calls received.
+  CORBA::Long count_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* SENSOR_H */
@@ -0,0 +1,214 @@
+#include "TestS.h"
+#include "tao/Batch_Scope.h"
+#include "ace/Get_Opt.h"
+
+const ACE_TCHAR *ior = ACE_TEXT ("file://test.ior");
+int niterations = 1000;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:i:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case 'i':
+        niterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "-i <niterations> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// Count the replies of the echo calls
+class Echo_Handler
+  : public virtual POA_Test::AMI_SensorHandler
+{
+public:
+  Echo_Handler (void)
+    : replies_ (0)
+    , errors_ (0)
+    , next_ (0)
+  {
+  }
+
+  virtual void echo (CORBA::Long ami_return_val)
+  {
+    // The requests of a batch are sent in order and the replies of
+    // a single connection come back in order.
+    if (ami_return_val != this->next_)
+      {
+        ACE_ERROR ((LM_ERROR,
+                    "ERROR: reply <%d> received, expected <%d>\n",
+                    ami_return_val, this->next_));
+        ++this->errors_;
+      }
+    this->next_ = ami_return_val + 1;
+    ++this->replies_;
+  }
+
+  virtual void echo_excep (::Messaging::ExceptionHolder *excep_holder)
+  {
+    try
+      {
+        excep_holder->raise_exception ();
+      }
+    catch (const CORBA::Exception& ex)
+      {
+        ex._tao_print_exception ("ERROR: echo_excep:");
+      }
+    ++this->errors_;
+    ++this->replies_;
+  }
+
+  virtual void count (CORBA::Long)
+  {
+  }
+
+  virtual void count_excep (::Messaging::ExceptionHolder *)
+  {
+  }
+
+  int replies_;
+  int errors_;
+
+private:
+  CORBA::Long next_;
+};
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var poa_object =
+        orb->resolve_initial_references("RootPOA");
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      if (CORBA::is_nil (root_poa.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Panic: nil RootPOA\n"),
+                          1);
+
+      PortableServer::POAManager_var poa_manager = root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tmp = orb->string_to_object(ior);
+
+      Test::Sensor_var sensor = Test::Sensor::_narrow(tmp.in ());
+
+      if (CORBA::is_nil (sensor.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_DEBUG,
+                             "Nil Test::Sensor reference <%s>\n",
+                             ior),
+                            1);
+        }
+
+      Echo_Handler *handler_impl = 0;
+      ACE_NEW_RETURN (handler_impl,
+                      Echo_Handler,
+                      1);
+      PortableServer::ServantBase_var owner_transfer(handler_impl);
+
+      PortableServer::ObjectId_var id =
+        root_poa->activate_object (handler_impl);
+
+      CORBA::Object_var object = root_poa->id_to_reference (id.in ());
+
+      Test::AMI_SensorHandler_var handler =
+        Test::AMI_SensorHandler::_narrow (object.in ());
+
+      // Make sure the connection is established, the first requests
+      // of a batch would otherwise wait for it in the queue.
+      (void) sensor->count ();
+
+      {
+        TAO::Batch_Scope batch (orb.in ());
+
+        for (int i = 0; i != niterations; ++i)
+          {
+            sensor->sample (i);
+            sensor->sendc_echo (handler.in (), i);
+          }
+
+        if (batch.request_count () != size_t (2 * niterations))
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "ERROR: %B requests batched, expected %d\n",
+                        batch.request_count (), 2 * niterations));
+            status = 1;
+          }
+      }
+
+      while (handler_impl->replies_ < niterations)
+        {
+          orb->perform_work ();
+        }
+
+      if (handler_impl->errors_ != 0)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: %d echo calls failed\n",
+                      handler_impl->errors_));
+          status = 1;
+        }
+
+      // The count () request is sent after the requests of the batch
+      // on the same connection.
+      CORBA::Long const count = sensor->count ();
+
+      if (count != 2 * niterations)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: the server received %d requests, expected %d\n",
+                      count, 2 * niterations));
+          status = 1;
+        }
+      else
+        {
+          ACE_DEBUG ((LM_DEBUG,
+                      "(%P|%t) - %d requests sent in a batch\n",
+                      count));
+        }
+
+      sensor->shutdown ();
+
+      root_poa->destroy (1, 1);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return status;
+}
@@ -0,0 +1,309 @@
+
+//=============================================================================
+/**
+ *  @file    any_cdr_view.cpp
+ *
+ * Verify that TAO::Any_CDR_View reads the members, elements and union
+ * branches of an Any in place, both for values inserted in the Any
+ * and for values demarshaled into it.
+ */
+//=============================================================================
+
+
+#include "tao/AnyTypeCode/Any.h"
+#include "tao/AnyTypeCode/Any_CDR_View.h"
+#include "tao/AnyTypeCode/TimeBaseA.h"
+#include "tao/AnyTypeCode/IOPA.h"
+#include "tao/AnyTypeCode/GIOPA.h"
+#include "tao/AnyTypeCode/StringSeqA.h"
+#include "tao/TimeBaseC.h"
+#include "tao/IOPC.h"
+#include "tao/GIOPC.h"
+#include "tao/CDR.h"
+#include "tao/ORB.h"
+#include "tao/SystemException.h"
+
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_string.h"
+
+namespace
+{
+  /// Demarshal a copy of @a any, the copy holds the encoded value.
+  bool
+  encode (const CORBA::Any &any, CORBA::Any &encoded)
+  {
+    TAO_OutputCDR out;
+    if (!(out << any))
+      {
+        return false;
+      }
+
+    TAO_InputCDR in (out);
+    return in >> encoded;
+  }
+
+  int
+  check_struct (const char *name, const CORBA::Any &any)
+  {
+    TAO::Any_CDR_View view (any);
+    TAO::Any_CDR_View member;
+    CORBA::Any value;
+
+    CORBA::Short tdf = 0;
+    if (!view.member ("tdf", member)
+        || !member.value (value)
+        || !(value >>= tdf)
+        || tdf != -60)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C cannot read UtcT::tdf\n",
+                           name),
+                          1);
+      }
+
+    CORBA::ULong inacclo = 0;
+    if (!view.member (1, member)
+        || !member.value (value)
+        || !(value >>= inacclo)
+        || inacclo != 0x11121314)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C cannot read UtcT::inacclo\n",
+                           name),
+                          1);
+      }
+
+    if (view.member (4, member)
+        || view.member ("none", member)
+        || view.element (0, member))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C navigates to a missing part\n",
+                           name),
+                          1);
+      }
+
+    return 0;
+  }
+
+  int
+  check_sequence (const char *name, const CORBA::Any &any)
+  {
+    TAO::Any_CDR_View view (any);
+    CORBA::ULong length = 0;
+    if (!view.length (length) || length != 3)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C has the wrong length\n",
+                           name),
+                          1);
+      }
+
+    TAO::Any_CDR_View element;
+    if (!view.element (0, element))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C has no first element\n",
+                           name),
+                          1);
+      }
+
+    for (CORBA::ULong i = 0; i != length; ++i)
+      {
+        TAO::Any_CDR_View member;
+        CORBA::Any value;
+        IOP::ComponentId tag = 0;
+
+        if ((i != 0 && !element.next ())
+            || !element.member ("tag", member)
+            || !member.value (value)
+            || !(value >>= tag)
+            || tag != i + 1)
+          {
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "ERROR: %C cannot read the tag of "
+                               "element %u\n",
+                               name,
+                               i),
+                              1);
+          }
+
+        TAO::Any_CDR_View data;
+        TAO::Any_CDR_View octet;
+        CORBA::ULong data_length = 0;
+        CORBA::Octet o = 0;
+
+        if (!element.member (1, data)
+            || !data.length (data_length)
+            || data_length != i * 3
+            || (data_length != 0
+                && (!data.element (data_length - 1, octet)
+                    || !octet.value (value)
+                    || !(value >>= CORBA::Any::to_octet (o))
+                    || o != data_length - 1)))
+          {
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "ERROR: %C cannot read the data of "
+                               "element %u\n",
+                               name,
+                               i),
+                              1);
+          }
+      }
+
+    if (view.element (length, element))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C reads past its last element\n",
+                           name),
+                          1);
+      }
+
+    return 0;
+  }
+
+  int
+  check_strings (const char *name, const CORBA::Any &any)
+  {
+    TAO::Any_CDR_View view (any);
+    TAO::Any_CDR_View element;
+    CORBA::Any value;
+    const char *s = 0;
+
+    if (!view.element (2, element)
+        || !element.value (value)
+        || !(value >>= s)
+        || ACE_OS::strcmp (s, "view") != 0)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C cannot read its last string\n",
+                           name),
+                          1);
+      }
+
+    return 0;
+  }
+
+  int
+  check_union (const char *name, const CORBA::Any &any)
+  {
+    TAO::Any_CDR_View view (any);
+    TAO::Any_CDR_View part;
+    CORBA::Any value;
+
+    CORBA::Short disc = 0;
+    if (!view.discriminator (part)
+        || !part.value (value)
+        || !(value >>= disc)
+        || disc != GIOP::ProfileAddr)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C has the wrong discriminator\n",
+                           name),
+                          1);
+      }
+
+    TAO::Any_CDR_View profile;
+    IOP::ProfileId tag = 0;
+    if (!view.active_member (profile)
+        || !profile.member ("tag", part)
+        || !part.value (value)
+        || !(value >>= tag)
+        || tag != IOP::TAG_INTERNET_IOP)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C cannot read its active member\n",
+                           name),
+                          1);
+      }
+
+    return 0;
+  }
+
+  template <typename CHECK>
+  int
+  check_both (const char *name, const CORBA::Any &any, CHECK check)
+  {
+    CORBA::Any encoded;
+    if (!encode (any, encoded))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: cannot encode %C\n",
+                           name),
+                          1);
+      }
+
+    return check (name, any) + check (name, encoded);
+  }
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      TimeBase::UtcT utc;
+      utc.time = ACE_UINT64_LITERAL (0x0102030405060708);
+      utc.inacclo = 0x11121314;
+      utc.inacchi = 0x2122;
+      utc.tdf = -60;
+      CORBA::Any utc_any;
+      utc_any <<= utc;
+      status += check_both ("TimeBase::UtcT", utc_any, check_struct);
+
+      IOP::TaggedComponentSeq components (3);
+      components.length (3);
+      for (CORBA::ULong i = 0; i != components.length (); ++i)
+        {
+          components[i].tag = i + 1;
+          components[i].component_data.length (i * 3);
+          for (CORBA::ULong j = 0; j != i * 3; ++j)
+            {
+              components[i].component_data[j] = static_cast<CORBA::Octet> (j);
+            }
+        }
+      CORBA::Any components_any;
+      components_any <<= components;
+      status += check_both ("IOP::TaggedComponentSeq",
+                            components_any,
+                            check_sequence);
+
+      CORBA::StringSeq strings (3);
+      strings.length (3);
+      strings[0] = CORBA::string_dup ("");
+      strings[1] = CORBA::string_dup ("any");
+      strings[2] = CORBA::string_dup ("view");
+      CORBA::Any strings_any;
+      strings_any <<= strings;
+      status += check_both ("CORBA::StringSeq", strings_any, check_strings);
+
+      IOP::TaggedProfile profile;
+      profile.tag = IOP::TAG_INTERNET_IOP;
+      profile.profile_data.length (5);
+      GIOP::TargetAddress address;
+      address.profile (profile);
+      CORBA::Any address_any;
+      address_any <<= address;
+      status += check_both ("GIOP::TargetAddress", address_any, check_union);
+
+      TAO::Any_CDR_View const empty ((CORBA::Any ()));
+      if (empty.valid ())
+        {
+          ACE_ERROR ((LM_ERROR, "ERROR: the view of an empty Any is valid\n"));
+          ++status;
+        }
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("any_cdr_view");
+      return 1;
+    }
+
+  return status == 0 ? 0 : 1;
+}
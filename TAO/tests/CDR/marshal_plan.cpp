@@ -0,0 +1,409 @@
+
+//=============================================================================
+/**
+ *  @file    marshal_plan.cpp
+ *
+ * Verify that the marshal plans of the TypeCodes skip and append
+ * values as their CDR operators encode them, from every alignment,
+ * that translated chars are left to the interpreter and that the
+ * TypeCodes demarshaled from a message have no plan.
+ */
+//=============================================================================
+
+
+#include "tao/AnyTypeCode/TypeCode.h"
+#include "tao/AnyTypeCode/Marshal.h"
+#include "tao/AnyTypeCode/Marshal_Plan.h"
+#include "tao/AnyTypeCode/Sequence_TypeCode_Static.h"
+#include "tao/AnyTypeCode/Null_RefCount_Policy.h"
+#include "tao/AnyTypeCode/TypeCode_Constants.h"
+#include "tao/AnyTypeCode/TimeBaseA.h"
+#include "tao/AnyTypeCode/IOPA.h"
+#include "tao/AnyTypeCode/OctetSeqA.h"
+#include "tao/AnyTypeCode/ULongSeqA.h"
+#include "tao/AnyTypeCode/StringSeqA.h"
+#include "tao/TimeBaseC.h"
+#include "tao/IOPC.h"
+#include "tao/CDR.h"
+#include "tao/ORB.h"
+#include "tao/SystemException.h"
+
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_ctype.h"
+
+#include <string>
+
+namespace
+{
+  CORBA::ULong const marker = 0xCAFEBABE;
+
+  /// A sequence of chars, declared the way the IDL compiler does.
+  TAO::TypeCode::Sequence<CORBA::TypeCode_ptr const *,
+                          TAO::Null_RefCount_Policy>
+    tc_CharSeq (CORBA::tk_sequence, &CORBA::_tc_char, 0);
+
+  /**
+   * @class Upper_Case_Translator
+   *
+   * @brief Upper cases the chars it reads.
+   */
+  class Upper_Case_Translator : public ACE_Char_Codeset_Translator
+  {
+  public:
+    virtual ACE_CDR::Boolean read_char (ACE_InputCDR &input,
+                                        ACE_CDR::Char &x)
+    {
+      ACE_CDR::Octet o = 0;
+      if (!this->read_1 (input, &o))
+        {
+          return false;
+        }
+      x = static_cast<ACE_CDR::Char> (ACE_OS::ace_toupper (o));
+      return true;
+    }
+
+    virtual ACE_CDR::Boolean read_string (ACE_InputCDR &,
+                                          ACE_CDR::Char *&)
+    {
+      return false;
+    }
+
+    virtual ACE_CDR::Boolean read_char_array (ACE_InputCDR &input,
+                                              ACE_CDR::Char *x,
+                                              ACE_CDR::ULong length)
+    {
+      if (!this->read_array (input, x, ACE_CDR::OCTET_SIZE,
+                             ACE_CDR::OCTET_ALIGN, length))
+        {
+          return false;
+        }
+      for (ACE_CDR::ULong i = 0; i != length; ++i)
+        {
+          x[i] = static_cast<ACE_CDR::Char> (
+            ACE_OS::ace_toupper (static_cast<unsigned char> (x[i])));
+        }
+      return true;
+    }
+
+    virtual ACE_CDR::Boolean write_char (ACE_OutputCDR &output,
+                                         ACE_CDR::Char x)
+    {
+      ACE_CDR::Octet const o = static_cast<ACE_CDR::Octet> (x);
+      return this->write_1 (output, &o);
+    }
+
+    virtual ACE_CDR::Boolean write_string (ACE_OutputCDR &,
+                                           ACE_CDR::ULong,
+                                           const ACE_CDR::Char *)
+    {
+      return false;
+    }
+
+    virtual ACE_CDR::Boolean write_char_array (ACE_OutputCDR &output,
+                                               const ACE_CDR::Char *x,
+                                               ACE_CDR::ULong length)
+    {
+      return this->write_array (output, x, ACE_CDR::OCTET_SIZE,
+                                ACE_CDR::OCTET_ALIGN, length);
+    }
+
+    virtual ACE_CDR::ULong ncs ()
+    {
+      return 0x00010001;
+    }
+
+    virtual ACE_CDR::ULong tcs ()
+    {
+      return 0x00010001;
+    }
+  };
+
+  /// The bytes of @a cdr.
+  std::string
+  bytes (const TAO_OutputCDR &cdr)
+  {
+    std::string result;
+    for (const ACE_Message_Block *i = cdr.begin (); i != 0; i = i->cont ())
+      {
+        result.append (i->rd_ptr (), i->length ());
+      }
+    return result;
+  }
+
+  void
+  pad (TAO_OutputCDR &cdr, size_t count)
+  {
+    for (size_t i = 0; i != count; ++i)
+      {
+        cdr.write_octet (0);
+      }
+  }
+
+  bool
+  unpad (TAO_InputCDR &cdr, size_t count)
+  {
+    return count == 0 || cdr.skip_bytes (count);
+  }
+
+  template <typename T>
+  int
+  check (const char *name, CORBA::TypeCode_ptr tc, const T &value)
+  {
+    TAO::TypeCode::Marshal_Plan const *plan = tc->tao_marshal_plan ();
+    if (plan == 0)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C has no marshal plan\n",
+                           name),
+                          1);
+      }
+
+    for (size_t src_pad = 0; src_pad != ACE_CDR::MAX_ALIGNMENT; ++src_pad)
+      {
+        TAO_OutputCDR encoded;
+        pad (encoded, src_pad);
+        if (!(encoded << value) || !(encoded << marker))
+          {
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "ERROR: cannot encode %C\n",
+                               name),
+                              1);
+          }
+
+        CORBA::ULong read_marker = 0;
+
+        TAO_InputCDR skipped (encoded);
+        if (!unpad (skipped, src_pad)
+            || TAO_Marshal_Object::perform_skip (tc, &skipped)
+                 != TAO::TRAVERSE_CONTINUE
+            || !(skipped >> read_marker)
+            || read_marker != marker)
+          {
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "ERROR: %C skipped wrong from alignment %B\n",
+                               name,
+                               src_pad),
+                              1);
+          }
+
+        for (size_t dest_pad = 0;
+             dest_pad != ACE_CDR::MAX_ALIGNMENT;
+             ++dest_pad)
+          {
+            TAO_InputCDR src (encoded);
+            TAO_OutputCDR copy;
+            pad (copy, dest_pad);
+
+            read_marker = 0;
+            if (!unpad (src, src_pad)
+                || TAO_Marshal_Object::perform_append (tc, &src, &copy)
+                     != TAO::TRAVERSE_CONTINUE
+                || !(src >> read_marker)
+                || read_marker != marker)
+              {
+                ACE_ERROR_RETURN ((LM_ERROR,
+                                   "ERROR: %C appended wrong from "
+                                   "alignment %B to %B\n",
+                                   name,
+                                   src_pad,
+                                   dest_pad),
+                                  1);
+              }
+
+            TAO_OutputCDR expected;
+            pad (expected, dest_pad);
+            expected << value;
+
+            if (bytes (copy) != bytes (expected))
+              {
+                ACE_ERROR_RETURN ((LM_ERROR,
+                                   "ERROR: %C copy differs from "
+                                   "alignment %B to %B\n",
+                                   name,
+                                   src_pad,
+                                   dest_pad),
+                                  1);
+              }
+          }
+      }
+
+    return 0;
+  }
+
+  int
+  check_translated_chars (void)
+  {
+    TAO::TypeCode::Marshal_Plan const *plan = tc_CharSeq.tao_marshal_plan ();
+    if (plan == 0 || !plan->compiled ())
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: a sequence of chars has no plan\n"),
+                          1);
+      }
+
+    TAO_OutputCDR encoded;
+    encoded.write_ulong (3);
+    encoded.write_char_array ("abc", 3);
+
+    Upper_Case_Translator translator;
+    TAO_InputCDR src (encoded);
+    src.char_translator (&translator);
+    TAO_OutputCDR copy;
+
+    if (plan->applies (&src, &copy))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: the plan copies translated chars\n"),
+                          1);
+      }
+
+    if (TAO_Marshal_Object::perform_append (&tc_CharSeq, &src, &copy)
+          != TAO::TRAVERSE_CONTINUE)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: cannot append translated chars\n"),
+                          1);
+      }
+
+    TAO_OutputCDR expected;
+    expected.write_ulong (3);
+    expected.write_char_array ("ABC", 3);
+
+    if (bytes (copy) != bytes (expected))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: the chars were not translated\n"),
+                          1);
+      }
+
+    return 0;
+  }
+
+  int
+  check_demarshaled (const TimeBase::UtcT &value)
+  {
+    TAO_OutputCDR out;
+    if (!(out << TimeBase::_tc_UtcT) || !(out << value))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: cannot encode a TypeCode\n"),
+                          1);
+      }
+
+    TAO_InputCDR in (out);
+    CORBA::TypeCode_ptr tc = CORBA::TypeCode::_nil ();
+    if (!(in >> tc))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: cannot decode a TypeCode\n"),
+                          1);
+      }
+    CORBA::TypeCode_var demarshaled = tc;
+
+    if (demarshaled->tao_marshal_plan () != 0)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: a demarshaled TypeCode has a plan\n"),
+                          1);
+      }
+
+    TAO_OutputCDR copy;
+    TAO_OutputCDR expected;
+    expected << value;
+    if (TAO_Marshal_Object::perform_append (demarshaled.in (), &in, &copy)
+          != TAO::TRAVERSE_CONTINUE
+        || bytes (copy) != bytes (expected))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: cannot append through a demarshaled "
+                           "TypeCode\n"),
+                          1);
+      }
+
+    return 0;
+  }
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      // A fixed struct of several primitive sizes.
+      TimeBase::UtcT utc;
+      utc.time = ACE_UINT64_LITERAL (0x0102030405060708);
+      utc.inacclo = 0x11121314;
+      utc.inacchi = 0x2122;
+      utc.tdf = -60;
+      status += check ("TimeBase::UtcT", TimeBase::_tc_UtcT, utc);
+      status += check_demarshaled (utc);
+
+      // A fixed struct of a single primitive type.
+      TimeBase::IntervalT interval;
+      interval.lower_bound = 1;
+      interval.upper_bound = ACE_UINT64_LITERAL (0xFFFFFFFF00000001);
+      status += check ("TimeBase::IntervalT", TimeBase::_tc_IntervalT,
+                       interval);
+
+      // Sequences of primitives.
+      CORBA::OctetSeq octets (13);
+      octets.length (13);
+      for (CORBA::ULong i = 0; i != octets.length (); ++i)
+        {
+          octets[i] = static_cast<CORBA::Octet> (i * 7);
+        }
+      status += check ("CORBA::OctetSeq", CORBA::_tc_OctetSeq, octets);
+
+      CORBA::ULongSeq ulongs (5);
+      ulongs.length (5);
+      for (CORBA::ULong i = 0; i != ulongs.length (); ++i)
+        {
+          ulongs[i] = i * 0x01010101;
+        }
+      status += check ("CORBA::ULongSeq", CORBA::_tc_ULongSeq, ulongs);
+
+      CORBA::ULongSeq empty;
+      status += check ("empty CORBA::ULongSeq", CORBA::_tc_ULongSeq, empty);
+
+      // A sequence of variable structs.
+      IOP::TaggedComponentSeq components (3);
+      components.length (3);
+      for (CORBA::ULong i = 0; i != components.length (); ++i)
+        {
+          components[i].tag = i + 1;
+          components[i].component_data.length (i * 3);
+          for (CORBA::ULong j = 0; j != i * 3; ++j)
+            {
+              components[i].component_data[j] = static_cast<CORBA::Octet> (j);
+            }
+        }
+      status += check ("IOP::TaggedComponentSeq",
+                       IOP::_tc_TaggedComponentSeq,
+                       components);
+
+      // A sequence of interpreted elements.
+      CORBA::StringSeq strings (3);
+      strings.length (3);
+      strings[0] = CORBA::string_dup ("");
+      strings[1] = CORBA::string_dup ("marshal");
+      strings[2] = CORBA::string_dup ("plan");
+      status += check ("CORBA::StringSeq", CORBA::_tc_StringSeq, strings);
+
+      // Chars translated by the stream.
+      status += check_translated_chars ();
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("marshal_plan");
+      return 1;
+    }
+
+  return status == 0 ? 0 : 1;
+}
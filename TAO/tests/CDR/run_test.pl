@@ -12,6 +12,9 @@ my $target = PerlACE::TestTarget::create_target (1);
 $brace="\#\#\#\#\#";
 %tests = ("basic_types" => "-n 256 -l 10",
           "tc" => "",
+          "marshal_plan" => "",
+          "any_cdr_view" => "",
+          "sso_string" => "",
           "growth" => "-l 64 -h 256 -s 4 -n 10 -q",
           "alignment" => "",
           "allocator" => "-q");
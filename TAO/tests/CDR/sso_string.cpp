@@ -0,0 +1,200 @@
+
+//=============================================================================
+/**
+ *  @file    sso_string.cpp
+ *
+ * Verify that TAO::SSO_String_Manager keeps short strings inline, hands
+ * out heap strings through inout () and _retn (), and demarshals the
+ * strings TAO::String_Manager marshals.
+ */
+//=============================================================================
+
+
+#include "tao/SSO_String_Manager_T.h"
+#include "tao/String_Manager_T.h"
+#include "tao/CORBA_String.h"
+#include "tao/CDR.h"
+
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_string.h"
+
+namespace
+{
+  const char short_string[] = "short";
+  const char long_string[] =
+    "a string too long to be kept in the string manager";
+
+  /// True when @a x points into @a manager itself.
+  bool
+  is_inline (const TAO::SSO_String_Manager &manager, const char *x)
+  {
+    const char * const begin = reinterpret_cast<const char *> (&manager);
+    return x >= begin && x < begin + sizeof (manager);
+  }
+
+  int
+  check_value (const char *test,
+               const TAO::SSO_String_Manager &x,
+               const char *expected,
+               bool expect_inline)
+  {
+    if (ACE_OS::strcmp (x.in (), expected) != 0)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C got <%C> instead of <%C>\n",
+                           test, x.in (), expected),
+                          1);
+      }
+
+    if (is_inline (x, x.in ()) != expect_inline)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: %C, <%C> is %Cinline\n",
+                           test, expected, expect_inline ? "not " : ""),
+                          1);
+      }
+
+    return 0;
+  }
+
+  int
+  test_assignment (void)
+  {
+    int status = 0;
+
+    TAO::SSO_String_Manager x;
+    status += check_value ("default", x, "", true);
+
+    x = short_string;
+    status += check_value ("short assignment", x, short_string, true);
+
+    x = long_string;
+    status += check_value ("long assignment", x, long_string, false);
+
+    TAO::SSO_String_Manager y (x);
+    status += check_value ("long copy", y, long_string, false);
+
+    x = short_string;
+    y = x;
+    status += check_value ("short copy", y, short_string, true);
+
+    // Ownership of a duplicated string is taken as is.
+    y = CORBA::string_dup (short_string);
+    status += check_value ("owned string", y, short_string, false);
+
+    // Assigning a part of the managed string to itself.
+    y = long_string;
+    y = static_cast<const char *> (y.in () + 40);
+    status += check_value ("self assignment", y, long_string + 40, true);
+
+    return status;
+  }
+
+  int
+  test_parameters (void)
+  {
+    int status = 0;
+
+    TAO::SSO_String_Manager x (short_string);
+
+    // inout () gives the callee a string it may free.
+    char *&inout = x.inout ();
+    if (is_inline (x, inout))
+      {
+        ACE_ERROR ((LM_ERROR, "ERROR: inout () returned the inline string\n"));
+        ++status;
+      }
+    CORBA::string_free (inout);
+    inout = CORBA::string_dup (long_string);
+    status += check_value ("inout", x, long_string, false);
+
+    x.out () = CORBA::string_dup (short_string);
+    status += check_value ("out", x, short_string, false);
+
+    x = short_string;
+    CORBA::String_var retn = x._retn ();
+    if (x.in () != 0 || ACE_OS::strcmp (retn.in (), short_string) != 0)
+      {
+        ACE_ERROR ((LM_ERROR, "ERROR: _retn () of an inline string\n"));
+        ++status;
+      }
+
+    x = long_string;
+    CORBA::String_out out (x);
+    out = CORBA::string_dup (short_string);
+    status += check_value ("String_out", x, short_string, false);
+
+#if defined (ACE_HAS_CPP11)
+    TAO::SSO_String_Manager moved (std::move (x));
+    status += check_value ("move", moved, short_string, false);
+    if (x.in () != 0)
+      {
+        ACE_ERROR ((LM_ERROR, "ERROR: moved from string is not null\n"));
+        ++status;
+      }
+#endif /* ACE_HAS_CPP11 */
+
+    return status;
+  }
+
+  int
+  test_demarshal (const char *value, bool expect_inline)
+  {
+    TAO::String_Manager source;
+    source = value;
+
+    TAO_OutputCDR out;
+    TAO::SSO_String_Manager copy (value);
+    if (!(out << source.in ()) || !(out << copy))
+      {
+        ACE_ERROR_RETURN ((LM_ERROR, "ERROR: cannot marshal <%C>\n", value),
+                          1);
+      }
+
+    int status = 0;
+    TAO_InputCDR in (out);
+    for (int i = 0; i != 2; ++i)
+      {
+        TAO::SSO_String_Manager x (long_string);
+        if (!(in >> x))
+          {
+            ACE_ERROR_RETURN ((LM_ERROR,
+                               "ERROR: cannot demarshal <%C>\n",
+                               value),
+                              1);
+          }
+        status += check_value ("demarshal", x, value, expect_inline);
+      }
+
+    return status;
+  }
+}
+
+int
+ACE_TMAIN (int, ACE_TCHAR *[])
+{
+  int status = 0;
+
+  status += test_assignment ();
+  status += test_parameters ();
+  status += test_demarshal ("", true);
+  status += test_demarshal (short_string, true);
+  status += test_demarshal (long_string, false);
+
+  TAO::SSO_WString_Manager wide;
+  wide = L"wide";
+  TAO_OutputCDR out;
+  out.set_version (1, 2);
+  if (!(out << wide))
+    {
+      ACE_ERROR ((LM_ERROR, "ERROR: cannot marshal a wide string\n"));
+      ++status;
+    }
+
+  if (status == 0)
+    {
+      ACE_DEBUG ((LM_DEBUG, "sso_string test passed\n"));
+    }
+
+  return status;
+}
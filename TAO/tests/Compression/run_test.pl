@@ -13,6 +13,8 @@ my @tests = qw(
                zlibserver
                bzip2server
                lzoserver
+               lz4server
+               zstdserver
                rleserver
               );
 
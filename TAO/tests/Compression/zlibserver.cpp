@@ -131,6 +131,97 @@ test_compression (CORBA::ULong nelements,
   return succeed;
 }
 
+/// The compressor reuses its zlib streams, each message must still
+/// be compressed on its own.
+bool
+test_stream_reuse (Compression::CompressionManager_ptr cm)
+{
+  Compression::Compressor_var compressor =
+    cm->get_compressor (::Compression::COMPRESSORID_ZLIB, 6);
+
+  CORBA::OctetSeq first;
+  first.length (2000);
+  for (CORBA::ULong j = 0; j != first.length (); ++j)
+    {
+      first[j] = static_cast<CORBA::Octet> ('a' + j % 7);
+    }
+
+  CORBA::OctetSeq second;
+  second.length (300);
+  for (CORBA::ULong j = 0; j != second.length (); ++j)
+    {
+      second[j] = static_cast<CORBA::Octet> ('z' - j % 3);
+    }
+
+  CORBA::OctetSeq expected;
+  compressor->compress (first, expected);
+
+  for (int i = 0; i != 10; ++i)
+    {
+      const CORBA::OctetSeq &message = i % 2 == 0 ? first : second;
+
+      CORBA::OctetSeq compressed;
+      compressor->compress (message, compressed);
+
+      if (i % 2 == 0 && compressed != expected)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "ERROR, compressing the same message twice "
+                             "gives different results\n"),
+                            false);
+        }
+
+      CORBA::OctetSeq decompressed;
+      decompressed.length (message.length ());
+      compressor->decompress (compressed, decompressed);
+
+      if (decompressed != message)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "ERROR, decompress not working for message %d\n",
+                             i),
+                            false);
+        }
+    }
+
+  // A truncated message must not leave the stream in a state that
+  // breaks the next message.
+  CORBA::OctetSeq truncated (expected);
+  truncated.length (expected.length () / 2);
+  CORBA::OctetSeq decompressed;
+  decompressed.length (first.length ());
+
+  bool succeed = false;
+  try
+    {
+      compressor->decompress (truncated, decompressed);
+    }
+  catch (const Compression::CompressionException&)
+    {
+      succeed = true;
+    }
+
+  if (!succeed)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "ERROR, truncated message decompressed\n"),
+                        false);
+    }
+
+  decompressed.length (first.length ());
+  compressor->decompress (expected, decompressed);
+  if (decompressed != first)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "ERROR, decompress not working after a "
+                         "truncated message\n"),
+                        false);
+    }
+
+  ACE_DEBUG ((LM_DEBUG, "Reused zlib streams worked\n"));
+  return true;
+}
+
 int
 ACE_TMAIN(int argc, ACE_TCHAR *argv[])
 {
@@ -170,6 +261,9 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
       if (!test_compression (5, manager.in ()))
         retval = 1;
 
+      if (!test_stream_reuse (manager.in ()))
+        retval = 1;
+
 
       if (!test_invalid_compression_factory (manager.in ()))
         retval = 1;
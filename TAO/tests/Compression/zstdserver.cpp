@@ -0,0 +1,305 @@
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_stdio.h"
+#include "tao/ORB.h"
+#include "tao/Compression/Compression.h"
+#include "tao/Compression/zstd/ZstdCompressor_Factory.h"
+#include "tao/CDR.h"
+
+bool
+test_invalid_compression_factory (Compression::CompressionManager_ptr cm)
+{
+  bool succeed = false;
+  try
+    {
+      // Get an invalid compression factory
+      Compression::CompressorFactory_var factory =
+        cm->get_factory (100);
+    }
+  catch (const Compression::UnknownCompressorId& ex)
+    {
+      ACE_UNUSED_ARG (ex);
+      succeed = true;
+    }
+  catch (const CORBA::Exception&)
+    {
+    }
+
+  if (!succeed)
+  {
+    ACE_ERROR ((LM_ERROR,
+                "(%t) ERROR, get invalid compression factory failed\n"));
+  }
+
+  return succeed;
+}
+
+
+bool
+test_duplicate_compression_factory (
+  Compression::CompressionManager_ptr cm,
+  Compression::CompressorFactory_ptr cf)
+{
+  bool succeed = false;
+  try
+    {
+      // Register duplicate
+      cm->register_factory (cf);
+    }
+  catch (const Compression::FactoryAlreadyRegistered&)
+    {
+      succeed = true;
+    }
+  catch (const CORBA::Exception&)
+    {
+    }
+
+  if (!succeed)
+  {
+    ACE_ERROR ((LM_ERROR,
+                "(%t) ERROR, register duplicate factory failed\n"));
+  }
+
+  return succeed;
+}
+
+bool
+test_register_nil_compression_factory (
+  Compression::CompressionManager_ptr cm)
+{
+  bool succeed = false;
+  try
+    {
+      // Register nil factory
+      cm->register_factory (Compression::CompressorFactory::_nil());
+    }
+  catch (const CORBA::BAD_PARAM& ex)
+    {
+      if ((ex.minor() & 0xFFFU) == 44)
+        {
+          succeed = true;
+        }
+    }
+  catch (const CORBA::Exception&)
+    {
+    }
+
+  if (!succeed)
+  {
+    ACE_ERROR ((LM_ERROR,
+                "(%t) ERROR, register nill factory failed\n"));
+  }
+
+  return succeed;
+}
+
+bool
+test_compression (CORBA::ULong nelements,
+                  Compression::CompressionLevel level,
+                  Compression::CompressionManager_ptr cm)
+{
+  bool succeed = false;
+
+  CORBA::OctetSeq mytest;
+  mytest.length (nelements);
+  for (CORBA::ULong j = 0; j != nelements; ++j)
+    {
+      mytest[j] = 'a';
+    }
+
+  Compression::Compressor_var compressor = cm->get_compressor (
+    ::Compression::COMPRESSORID_ZSTD, level);
+
+  CORBA::OctetSeq myout;
+  myout.length ((CORBA::ULong)(mytest.length() * 1.1));
+
+  compressor->compress (mytest, myout);
+
+  CORBA::OctetSeq decompress;
+  decompress.length (nelements);
+
+  compressor->decompress (myout, decompress);
+
+  if (decompress != mytest)
+    {
+      ACE_ERROR ((LM_ERROR, "Error, decompress not working\n"));
+    }
+  else
+    {
+      succeed = true;
+      ACE_DEBUG ((LM_DEBUG, "Compression worked with zstd level %d, "
+                            "original size %d, compressed size %d\n",
+                            level, mytest.length(), myout.length ()));
+    }
+  return succeed;
+}
+
+/// Marshal a small record, like the payload of a request.
+void
+marshal_record (CORBA::ULong i, Compression::Buffer &record)
+{
+  static const char * const symbols[] = { "ACME", "INITECH", "UMBRELLA",
+                                          "GLOBEX", "HOOLI" };
+
+  TAO_OutputCDR cdr;
+  cdr << symbols[i % 5];
+  cdr << static_cast<CORBA::ULongLong> (1500000000000ULL + i * 250);
+  cdr << static_cast<CORBA::Double> (100.0 + (i % 97) * 0.25);
+  cdr << static_cast<CORBA::Double> (100.5 + (i % 89) * 0.25);
+  cdr << static_cast<CORBA::Long> ((i * 7) % 1000);
+  cdr << static_cast<CORBA::Long> ((i * 13) % 1000);
+
+  record.length (static_cast<CORBA::ULong> (cdr.total_length ()));
+  CORBA::Octet *buf = record.get_buffer ();
+  for (const ACE_Message_Block *mb = cdr.begin (); mb != 0; mb = mb->cont ())
+    {
+      ACE_OS::memcpy (buf, mb->rd_ptr (), mb->length ());
+      buf += mb->length ();
+    }
+}
+
+bool
+test_dictionary (Compression::CompressionManager_ptr cm)
+{
+  CORBA::ULong const nsamples = 500;
+  Compression::Buffer samples;
+  size_t sample_sizes[nsamples];
+  for (CORBA::ULong i = 0; i != nsamples; ++i)
+    {
+      Compression::Buffer record;
+      marshal_record (i, record);
+      CORBA::ULong const offset = samples.length ();
+      samples.length (offset + record.length ());
+      ACE_OS::memcpy (samples.get_buffer () + offset,
+                      record.get_buffer (),
+                      record.length ());
+      sample_sizes[i] = record.length ();
+    }
+
+  Compression::Buffer dictionary;
+  TAO::Zstd_CompressorFactory::train_dictionary (samples,
+                                                 sample_sizes,
+                                                 nsamples,
+                                                 4096,
+                                                 dictionary);
+
+  Compression::CompressorFactory_ptr factory = 0;
+  ACE_NEW_RETURN (factory, TAO::Zstd_CompressorFactory (dictionary), false);
+  Compression::CompressorFactory_var dictionary_factory = factory;
+
+  Compression::Compressor_var with_dictionary =
+    dictionary_factory->get_compressor (3);
+  Compression::Compressor_var without_dictionary =
+    cm->get_compressor (::Compression::COMPRESSORID_ZSTD, 3);
+
+  // A record that was not in the samples.
+  Compression::Buffer record;
+  marshal_record (nsamples + 1, record);
+
+  Compression::Buffer plain;
+  without_dictionary->compress (record, plain);
+
+  Compression::Buffer compressed;
+  with_dictionary->compress (record, compressed);
+
+  Compression::Buffer decompressed;
+  decompressed.length (record.length ());
+  with_dictionary->decompress (compressed, decompressed);
+
+  if (decompressed != record)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "Error, decompress with dictionary not working\n"),
+                        false);
+    }
+
+  ACE_DEBUG ((LM_DEBUG, "Compression worked with zstd dictionary, "
+                        "original size %d, compressed size %d, "
+                        "without dictionary %d\n",
+                        record.length (), compressed.length (),
+                        plain.length ()));
+
+  if (compressed.length () >= plain.length ())
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "Error, dictionary does not improve compression\n"),
+                        false);
+    }
+
+  // The peer must use the same dictionary.
+  try
+    {
+      decompressed.length (record.length ());
+      without_dictionary->decompress (compressed, decompressed);
+    }
+  catch (const Compression::CompressionException&)
+    {
+      return true;
+    }
+
+  ACE_ERROR_RETURN ((LM_ERROR,
+                     "Error, no exception for a dictionary mismatch\n"),
+                    false);
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int retval = 0;
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var compression_manager =
+        orb->resolve_initial_references("CompressionManager");
+
+      Compression::CompressionManager_var manager =
+        Compression::CompressionManager::_narrow (compression_manager.in ());
+
+      if (CORBA::is_nil(manager.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Panic: nil compression manager\n"),
+                          1);
+
+      Compression::CompressorFactory_ptr compressor_factory;
+
+      ACE_NEW_RETURN (compressor_factory, TAO::Zstd_CompressorFactory (), 1);
+
+      Compression::CompressorFactory_var compr_fact = compressor_factory;
+      manager->register_factory(compr_fact.in ());
+
+      if (!test_duplicate_compression_factory (manager.in (), compr_fact.in ()))
+        retval = 1;
+
+      if (!test_register_nil_compression_factory (manager.in ()))
+        retval = 1;
+
+      // The default and a higher level.
+      if (!test_compression (1024, 0, manager.in ()))
+        retval = 1;
+
+      if (!test_compression (5, 0, manager.in ()))
+        retval = 1;
+
+      if (!test_compression (1024, 6, manager.in ()))
+        retval = 1;
+
+      if (!test_compression (5, 6, manager.in ()))
+        retval = 1;
+
+      if (!test_dictionary (manager.in ()))
+        retval = 1;
+
+      if (!test_invalid_compression_factory (manager.in ()))
+        retval = 1;
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      retval = 1;
+    }
+
+  return retval;
+}
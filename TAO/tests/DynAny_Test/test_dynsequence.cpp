@@ -44,6 +44,94 @@ compare_string_sequence_elements(
 
     return match;
 }
+
+bool
+equal_test_structs (DynAnyTests::test_struct const & lhs,
+                    DynAnyTests::test_struct const & rhs)
+{
+  if (lhs.c != rhs.c
+      || lhs.es.f != rhs.es.f
+      || lhs.es.s != rhs.es.s
+      || lhs.ss.length () != rhs.ss.length ())
+    {
+      return false;
+    }
+
+  for (CORBA::ULong i = 0; i < lhs.ss.length (); ++i)
+    {
+      if (lhs.ss[i] != rhs.ss[i])
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
+
+bool
+equal_struct_seqs (DynAnyTests::test_struct_seq const & lhs,
+                   DynAnyTests::test_struct_seq const & rhs)
+{
+  if (lhs.length () != rhs.length ())
+    {
+      return false;
+    }
+
+  for (CORBA::ULong i = 0; i < lhs.length (); ++i)
+    {
+      if (!equal_test_structs (lhs[i], rhs[i]))
+        {
+          ACE_DEBUG ((LM_DEBUG, "  mismatch with elements[%d]\n", i));
+          return false;
+        }
+    }
+
+  return true;
+}
+
+bool
+equal_string_seqs (DynAnyTests::test_seq const & seq,
+                   const char * const values[],
+                   CORBA::ULong length)
+{
+  if (seq.length () != length)
+    {
+      return false;
+    }
+
+  for (CORBA::ULong i = 0; i < length; ++i)
+    {
+      if (ACE_OS::strcmp (seq[i], values[i]) != 0)
+        {
+          ACE_DEBUG ((LM_DEBUG,
+                      "  elem[%d] = %C, expected %C\n",
+                      i, seq[i].in (), values[i]));
+          return false;
+        }
+    }
+
+  return true;
+}
+
+bool
+equal_short_seqs (CORBA::ShortSeq const & lhs,
+                  DynAnyTests::SeqShort const & rhs)
+{
+  if (lhs.length () != rhs.length ())
+    {
+      return false;
+    }
+
+  for (CORBA::ULong i = 0; i < lhs.length (); ++i)
+    {
+      if (lhs[i] != rhs[i])
+        {
+          return false;
+        }
+    }
+
+  return true;
+}
 }
 
 Test_DynSequence::Test_DynSequence (CORBA::ORB_var orb, int debug)
@@ -360,6 +448,328 @@ Test_DynSequence::run_test (void)
                      "++ OK ++\n"));
         }
 
+      ACE_DEBUG ((LM_DEBUG,
+                 "testing: struct elements after a skip/to_any\n"));
+
+      CORBA::ULong const value_count = 3;
+
+      // The elements are read from the Any without their DynAny, until
+      // they are asked for.
+      DynamicAny::DynAny_var tss_base;
+      DynamicAny::DynSequence_var tss_dyn;
+      {
+        DynAnyTests::test_struct_seq tss (3);
+        tss.length (3);
+
+        for (i = 0; i < tss.length (); ++i)
+          {
+            tss[i].c = data.m_char1;
+            tss[i].ss.length (i + 1);
+            for (CORBA::ULong j = 0; j <= i; ++j)
+              {
+                tss[i].ss[j] = static_cast<CORBA::Short> (10 * i + j);
+              }
+            tss[i].es.f = data.m_float1;
+            tss[i].es.s = static_cast<CORBA::Short> (i);
+          }
+
+        CORBA::Any tss_any;
+        tss_any <<= tss;
+        tss_base = dynany_factory->create_dyn_any (tss_any);
+        tss_dyn = DynamicAny::DynSequence::_narrow (tss_base.in ());
+
+        CORBA::Any_var untouched = tss_dyn->to_any ();
+        const DynAnyTests::test_struct_seq *tss_out = 0;
+
+        if (!(untouched.in () >>= tss_out)
+            || !equal_struct_seqs (tss, *tss_out))
+          {
+            ACE_DEBUG ((LM_DEBUG, "  untouched struct sequence differs\n"));
+            ++this->error_count_;
+          }
+
+        // The last element first, the previous ones are skipped.
+        tss_dyn->seek (2);
+        DynamicAny::DynAny_var elem = tss_dyn->current_component ();
+        elem->seek (1);
+        CORBA::ShortSeq_var elem_ss = elem->get_short_seq ();
+
+        if (elem_ss->length () != 3 || elem_ss[2u] != 22)
+          {
+            ACE_DEBUG ((LM_DEBUG, "  wrong ss in elements[2]\n"));
+            ++this->error_count_;
+          }
+
+        elem->seek (2);
+        DynamicAny::DynAny_var elem_es = elem->current_component ();
+        elem_es->seek (1);
+
+        if (elem_es->get_short () != 2)
+          {
+            ACE_DEBUG ((LM_DEBUG, "  wrong es.s in elements[2]\n"));
+            ++this->error_count_;
+          }
+
+        // Change the middle element, the first one still has no DynAny.
+        tss_dyn->seek (1);
+        elem = tss_dyn->current_component ();
+        elem->seek (2);
+        elem_es = elem->current_component ();
+        elem_es->seek (1);
+        elem_es->insert_short (data.m_short1);
+        tss[1u].es.s = data.m_short1;
+
+        CORBA::Any_var modified = tss_dyn->to_any ();
+        tss_out = 0;
+
+        if (!(modified.in () >>= tss_out)
+            || !equal_struct_seqs (tss, *tss_out))
+          {
+            ACE_DEBUG ((LM_DEBUG, "  modified struct sequence differs\n"));
+            ++this->error_count_;
+          }
+      }
+
+      ACE_DEBUG ((LM_DEBUG,
+                 "testing: string elements after a skip/to_any\n"));
+
+      DynamicAny::DynAny_var strs_base;
+      DynamicAny::DynSequence_var strs;
+      {
+        DynAnyTests::test_seq in_strs (value_count);
+        in_strs.length (value_count);
+
+        for (i = 0; i < value_count; ++i)
+          {
+            in_strs[i] = values[i];
+          }
+
+        CORBA::Any strs_any;
+        strs_any <<= in_strs;
+        strs_base = dynany_factory->create_dyn_any (strs_any);
+        strs = DynamicAny::DynSequence::_narrow (strs_base.in ());
+
+        CORBA::Any_var untouched = strs->to_any ();
+        const DynAnyTests::test_seq *strs_out = 0;
+
+        if (!(untouched.in () >>= strs_out)
+            || !equal_string_seqs (*strs_out, values, value_count))
+          {
+            ++this->error_count_;
+          }
+
+        strs->seek (2);
+        CORBA::String_var last = strs->get_string ();
+
+        if (ACE_OS::strcmp (last.in (), values[2]) != 0)
+          {
+            ACE_DEBUG ((LM_DEBUG, "  elem[2] = %C\n", last.in ()));
+            ++this->error_count_;
+          }
+
+        static const char *modified_values[] =
+        {
+          "zero",
+          "uno",
+          "two"
+        };
+
+        strs->seek (1);
+        strs->insert_string (modified_values[1]);
+
+        CORBA::Any_var modified = strs->to_any ();
+        strs_out = 0;
+
+        if (!(modified.in () >>= strs_out)
+            || !equal_string_seqs (*strs_out, modified_values, value_count))
+          {
+            ++this->error_count_;
+          }
+      }
+
+      ACE_DEBUG ((LM_DEBUG,
+                 "testing: set_length shrink and grow\n"));
+
+      {
+        // The encoded elements dropped by the shrink are not seen again,
+        // the new elements have the default value.
+        static const char *grown_values[] =
+        {
+          "zero",
+          "",
+          ""
+        };
+
+        DynAnyTests::test_seq in_strs (value_count);
+        in_strs.length (value_count);
+
+        for (i = 0; i < value_count; ++i)
+          {
+            in_strs[i] = values[i];
+          }
+
+        CORBA::Any strs_any;
+        strs_any <<= in_strs;
+        DynamicAny::DynAny_var shrink_base =
+          dynany_factory->create_dyn_any (strs_any);
+        DynamicAny::DynSequence_var shrink =
+          DynamicAny::DynSequence::_narrow (shrink_base.in ());
+
+        shrink->set_length (1);
+
+        if (shrink->get_length () != 1)
+          {
+            ++this->error_count_;
+          }
+
+        shrink->set_length (value_count);
+        shrink->seek (2);
+        CORBA::String_var grown = shrink->get_string ();
+
+        if (ACE_OS::strcmp (grown.in (), "") != 0)
+          {
+            ACE_DEBUG ((LM_DEBUG, "  elem[2] = %C\n", grown.in ()));
+            ++this->error_count_;
+          }
+
+        CORBA::Any_var grown_any = shrink->to_any ();
+        const DynAnyTests::test_seq *strs_out = 0;
+
+        if (!(grown_any.in () >>= strs_out)
+            || !equal_string_seqs (*strs_out, grown_values, value_count))
+          {
+            ++this->error_count_;
+          }
+
+        shrink->destroy ();
+
+        // The same with the elements kept as native values.
+        DynAnyTests::SeqShort in_shorts (3);
+        in_shorts.length (3);
+        in_shorts[0] = 1;
+        in_shorts[1] = 2;
+        in_shorts[2] = 3;
+
+        CORBA::Any shorts_any;
+        shorts_any <<= in_shorts;
+        shrink_base = dynany_factory->create_dyn_any (shorts_any);
+        shrink = DynamicAny::DynSequence::_narrow (shrink_base.in ());
+
+        shrink->set_length (1);
+        shrink->set_length (3);
+
+        grown_any = shrink->to_any ();
+        const DynAnyTests::SeqShort *shorts_out = 0;
+
+        if (!(grown_any.in () >>= shorts_out)
+            || shorts_out->length () != 3
+            || (*shorts_out)[0] != 1
+            || (*shorts_out)[1] != 0
+            || (*shorts_out)[2] != 0)
+          {
+            ACE_DEBUG ((LM_DEBUG, "  grown short sequence differs\n"));
+            ++this->error_count_;
+          }
+
+        shrink->destroy ();
+      }
+
+      ACE_DEBUG ((LM_DEBUG,
+                 "testing: insert_short_seq/get_short_seq\n"));
+
+      CORBA::ShortSeq bulk (4);
+      bulk.length (4);
+      for (i = 0; i < bulk.length (); ++i)
+        {
+          bulk[i] = static_cast<CORBA::Short> (100 + i);
+        }
+
+      // A sequence of the same type is replaced in one step.
+      ds_short->insert_short_seq (bulk);
+
+      if (ds_short->get_length () != bulk.length ()
+          || ds_short->get_short () != bulk[0u])
+        {
+          ++this->error_count_;
+        }
+
+      CORBA::ShortSeq_var bulk_out = ds_short->get_short_seq ();
+      CORBA::Any_var bulk_any = ds_short->to_any ();
+      const DynAnyTests::SeqShort *bulk_seq = 0;
+
+      if (bulk_out->length () != bulk.length ()
+          || !(bulk_any.in () >>= bulk_seq)
+          || !equal_short_seqs (bulk, *bulk_seq))
+        {
+          ACE_DEBUG ((LM_DEBUG, "  bulk short sequence differs\n"));
+          ++this->error_count_;
+        }
+
+      ACE_DEBUG ((LM_DEBUG,
+                 "testing: insert_*_seq/get_*_seq TypeMismatch\n"));
+
+      // An element of another type, a sequence of another type and a
+      // struct element are still rejected.
+      try
+        {
+          CORBA::LongSeq_var longs = ds_short->get_long_seq ();
+          ACE_DEBUG ((LM_DEBUG, "  get_long_seq on shorts succeeded\n"));
+          ++this->error_count_;
+        }
+      catch (const DynamicAny::DynAny::TypeMismatch &)
+        {
+        }
+
+      ds_bool->set_length (2);
+
+      try
+        {
+          ds_bool->insert_short_seq (bulk);
+          ACE_DEBUG ((LM_DEBUG, "  insert_short_seq on booleans succeeded\n"));
+          ++this->error_count_;
+        }
+      catch (const DynamicAny::DynAny::TypeMismatch &)
+        {
+        }
+
+      strs->seek (0);
+
+      try
+        {
+          strs->insert_short_seq (bulk);
+          ACE_DEBUG ((LM_DEBUG, "  insert_short_seq on strings succeeded\n"));
+          ++this->error_count_;
+        }
+      catch (const DynamicAny::DynAny::TypeMismatch &)
+        {
+        }
+
+      tss_dyn->seek (0);
+
+      try
+        {
+          tss_dyn->insert_short_seq (bulk);
+          ACE_DEBUG ((LM_DEBUG, "  insert_short_seq on structs succeeded\n"));
+          ++this->error_count_;
+        }
+      catch (const DynamicAny::DynAny::TypeMismatch &)
+        {
+        }
+
+      if (this->error_count_ == 0)
+        {
+          ACE_DEBUG ((LM_DEBUG,
+                     "++ OK ++\n"));
+        }
+
+      tss_dyn->destroy ();
+
+      strs->destroy ();
+
+      ds_short->destroy ();
+
+      ds_bool->destroy ();
+
       fa1->destroy ();
 
       ftc1->destroy ();
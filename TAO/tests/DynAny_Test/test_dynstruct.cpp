@@ -349,6 +349,125 @@ Test_DynStruct::run_test (void)
       ACE_DEBUG ((LM_DEBUG,
                 "++ OK ++\n"));
 
+      ACE_DEBUG ((LM_DEBUG,
+                  "testing: members after a skip/get_members/to_any\n"));
+
+      // The members are read from the Any without their DynAny, until
+      // they are asked for.
+      DynAnyTests::named_values nv;
+      nv.name = CORBA::string_dup ("first");
+      nv.values.length (3);
+      nv.values[0] = 1;
+      nv.values[1] = 2;
+      nv.values[2] = 3;
+      nv.label = CORBA::string_dup ("last");
+
+      CORBA::Any nv_any;
+      nv_any <<= nv;
+      DynamicAny::DynAny_var nv_base =
+        dynany_factory->create_dyn_any (nv_any);
+      DynamicAny::DynStruct_var nv_dyn =
+        DynamicAny::DynStruct::_narrow (nv_base.in ());
+
+      CORBA::Any_var nv_untouched = nv_dyn->to_any ();
+      const DynAnyTests::named_values *nv_out = 0;
+
+      if (!(nv_untouched.in () >>= nv_out)
+          || ACE_OS::strcmp (nv_out->name.in (), "first") != 0
+          || nv_out->values.length () != 3
+          || nv_out->values[2] != 3
+          || ACE_OS::strcmp (nv_out->label.in (), "last") != 0)
+        {
+          ACE_DEBUG ((LM_DEBUG, "  untouched struct differs\n"));
+          ++this->error_count_;
+        }
+
+      DynamicAny::NameValuePairSeq_var nv_members = nv_dyn->get_members ();
+      const char *nv_label = 0;
+
+      if (nv_members->length () != 3
+          || !(nv_members[2u].value >>= nv_label)
+          || ACE_OS::strcmp (nv_label, "last") != 0)
+        {
+          ACE_DEBUG ((LM_DEBUG, "  get_members differs\n"));
+          ++this->error_count_;
+        }
+
+      // The last member first, the string and the sequence before it
+      // are skipped.
+      nv_dyn->seek (2);
+      CORBA::String_var label = nv_dyn->get_string ();
+
+      if (ACE_OS::strcmp (label.in (), "last") != 0)
+        {
+          ACE_DEBUG ((LM_DEBUG, "  label = %C\n", label.in ()));
+          ++this->error_count_;
+        }
+
+      nv_dyn->seek (1);
+      CORBA::ShortSeq_var nv_values = nv_dyn->get_short_seq ();
+
+      if (nv_values->length () != 3 || nv_values[1u] != 2)
+        {
+          ACE_DEBUG ((LM_DEBUG, "  wrong values\n"));
+          ++this->error_count_;
+        }
+
+      // A sequence member of the same type is replaced in one step.
+      CORBA::ShortSeq bulk (2);
+      bulk.length (2);
+      bulk[0] = data.m_short1;
+      bulk[1] = data.m_short2;
+      nv_dyn->insert_short_seq (bulk);
+
+      nv_dyn->seek (0);
+      nv_dyn->insert_string ("renamed");
+
+      CORBA::Any_var nv_modified = nv_dyn->to_any ();
+      nv_out = 0;
+
+      if (!(nv_modified.in () >>= nv_out)
+          || ACE_OS::strcmp (nv_out->name.in (), "renamed") != 0
+          || nv_out->values.length () != 2
+          || nv_out->values[0] != data.m_short1
+          || nv_out->values[1] != data.m_short2
+          || ACE_OS::strcmp (nv_out->label.in (), "last") != 0)
+        {
+          ACE_DEBUG ((LM_DEBUG, "  modified struct differs\n"));
+          ++this->error_count_;
+        }
+
+      // A member of another type is still rejected.
+      try
+        {
+          nv_dyn->insert_short_seq (bulk);
+          ACE_DEBUG ((LM_DEBUG, "  insert_short_seq on a string "
+                                "succeeded\n"));
+          ++this->error_count_;
+        }
+      catch (const DynamicAny::DynAny::TypeMismatch &)
+        {
+        }
+
+      try
+        {
+          nv_dyn->seek (1);
+          CORBA::LongSeq_var longs = nv_dyn->get_long_seq ();
+          ACE_DEBUG ((LM_DEBUG, "  get_long_seq on shorts succeeded\n"));
+          ++this->error_count_;
+        }
+      catch (const DynamicAny::DynAny::TypeMismatch &)
+        {
+        }
+
+      nv_dyn->destroy ();
+
+      if (this->error_count_ == 0)
+        {
+          ACE_DEBUG ((LM_DEBUG,
+                      "++ OK ++\n"));
+        }
+
       ACE_DEBUG ((LM_DEBUG,
                  "testing: struct_with_long_double destroy\n"));
 
@@ -0,0 +1,54 @@
+#include "Echo.h"
+#include "Payload.h"
+
+Echo::Echo (CORBA::ORB_ptr orb)
+ : count_ (0),
+   orb_ (CORBA::ORB::_duplicate (orb))
+{
+}
+
+Test::Records *
+Echo::echo_records (CORBA::ULong seed, const Test::Records &payload)
+{
+  ++this->count_;
+
+  CORBA::ULong index = 0;
+  if (!Payload::check_records (seed, payload, index))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: (%P|%t) record %u of payload %u differs\n",
+                  index, seed));
+      throw Test::Echo::Invalid_Payload (index);
+    }
+
+  return new Test::Records (payload);
+}
+
+Test::Octets *
+Echo::echo_octets (CORBA::ULong seed, const Test::Octets &payload)
+{
+  ++this->count_;
+
+  CORBA::ULong index = 0;
+  if (!Payload::check_octets (seed, payload, index))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: (%P|%t) octet %u of payload %u differs\n",
+                  index, seed));
+      throw Test::Echo::Invalid_Payload (index);
+    }
+
+  return new Test::Octets (payload);
+}
+
+void
+Echo::shutdown (void)
+{
+  this->orb_->shutdown (0);
+}
+
+int
+Echo::get_count (void) const
+{
+  return this->count_;
+}
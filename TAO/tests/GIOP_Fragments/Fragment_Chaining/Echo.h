@@ -0,0 +1,33 @@
+#ifndef FRAGMENT_CHAINING_ECHO_H
+#define FRAGMENT_CHAINING_ECHO_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+
+/// Implement the Test::Echo interface
+class Echo
+  : public virtual POA_Test::Echo
+{
+public:
+  /// Constructor
+  Echo (CORBA::ORB_ptr orb);
+
+  // = The skeleton methods
+  virtual Test::Records * echo_records (CORBA::ULong seed,
+                                        const Test::Records &payload);
+
+  virtual Test::Octets * echo_octets (CORBA::ULong seed,
+                                      const Test::Octets &payload);
+
+  virtual void shutdown (void);
+
+  /// The number of payloads received
+  int get_count (void) const;
+
+private:
+  int count_;
+  CORBA::ORB_var orb_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* FRAGMENT_CHAINING_ECHO_H */
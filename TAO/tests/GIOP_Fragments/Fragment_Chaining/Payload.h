@@ -0,0 +1,116 @@
+#ifndef FRAGMENT_CHAINING_PAYLOAD_H
+#define FRAGMENT_CHAINING_PAYLOAD_H
+#include /**/ "ace/pre.h"
+
+#include "TestC.h"
+#include "ace/OS_NS_string.h"
+#include "ace/OS_NS_stdio.h"
+
+/// The payloads exchanged by the client and the server.  Both sides
+/// generate the expected payload from the seed and compare it with
+/// the one they received, so the demarshaling of the fragmented
+/// requests and replies is checked independently.
+namespace Payload
+{
+  inline CORBA::Octet
+  octet (CORBA::ULong seed, CORBA::ULong i)
+  {
+    return static_cast<CORBA::Octet> ((seed * 31 + i * 7) & 0xff);
+  }
+
+  inline void
+  make_octets (CORBA::ULong seed, Test::Octets &x)
+  {
+    CORBA::ULong const length = 1000 + seed * 997;
+    x.length (length);
+    for (CORBA::ULong i = 0; i != length; ++i)
+      {
+        x[i] = octet (seed, i);
+      }
+  }
+
+  /// Return true if @a x is the payload generated for @a seed,
+  /// otherwise set @a index to the first octet that differs.
+  inline bool
+  check_octets (CORBA::ULong seed, const Test::Octets &x, CORBA::ULong &index)
+  {
+    Test::Octets expected;
+    make_octets (seed, expected);
+    index = 0;
+    for (; index != x.length () && index != expected.length (); ++index)
+      {
+        if (x[index] != expected[index])
+          {
+            return false;
+          }
+      }
+    return x.length () == expected.length ();
+  }
+
+  inline void
+  make_records (CORBA::ULong seed, Test::Records &x)
+  {
+    CORBA::ULong const length = 20 + seed * 13;
+    x.length (length);
+    for (CORBA::ULong i = 0; i != length; ++i)
+      {
+        Test::Record &r = x[i];
+        r.id = static_cast<CORBA::Short> (seed + i);
+
+        // Odd name lengths shift the alignment of the next members.
+        char name[64];
+        ACE_OS::snprintf (name, sizeof name, "record-%u-%u%.*s",
+                          seed, i,
+                          static_cast<int> (i % 17), "ABCDEFGHIJKLMNOPQ");
+        r.name = name;
+
+        r.value = seed + i / 8.0;
+        r.data.length ((seed + i * 5) % 41);
+        for (CORBA::ULong j = 0; j != r.data.length (); ++j)
+          {
+            r.data[j] = octet (seed + i, j);
+          }
+        r.stamp = (static_cast<CORBA::LongLong> (seed) << 32) + i;
+        r.tag = static_cast<CORBA::Char> ('a' + i % 26);
+      }
+  }
+
+  inline bool
+  equal (const Test::Record &lhs, const Test::Record &rhs)
+  {
+    if (lhs.id != rhs.id
+        || ACE_OS::strcmp (lhs.name.in (), rhs.name.in ()) != 0
+        || lhs.value != rhs.value
+        || lhs.data.length () != rhs.data.length ()
+        || lhs.stamp != rhs.stamp
+        || lhs.tag != rhs.tag)
+      {
+        return false;
+      }
+    return lhs.data.length () == 0
+      || ACE_OS::memcmp (lhs.data.get_buffer (),
+                         rhs.data.get_buffer (),
+                         lhs.data.length ()) == 0;
+  }
+
+  /// Return true if @a x is the payload generated for @a seed,
+  /// otherwise set @a index to the first record that differs.
+  inline bool
+  check_records (CORBA::ULong seed, const Test::Records &x, CORBA::ULong &index)
+  {
+    Test::Records expected;
+    make_records (seed, expected);
+    index = 0;
+    for (; index != x.length () && index != expected.length (); ++index)
+      {
+        if (!equal (x[index], expected[index]))
+          {
+            return false;
+          }
+      }
+    return x.length () == expected.length ();
+  }
+}
+
+#include /**/ "ace/post.h"
+#endif /* FRAGMENT_CHAINING_PAYLOAD_H */
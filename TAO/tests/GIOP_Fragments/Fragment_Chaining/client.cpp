@@ -0,0 +1,110 @@
+#include "Payload.h"
+#include "ace/Get_Opt.h"
+
+static const ACE_TCHAR *ior = ACE_TEXT("file://server.ior");
+static CORBA::ULong iterations = 10;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:i:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+      case 'i':
+        iterations = ACE_OS::atoi (get_opts.opt_arg ());
+        break;
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "-i <iterations> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tmp =
+        orb->string_to_object(ior);
+
+      Test::Echo_var echo =
+        Test::Echo::_narrow(tmp.in ());
+
+      if (CORBA::is_nil (echo.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_DEBUG,
+                             "Nil Test::Echo reference <%s>\n",
+                             ior),
+                            1);
+        }
+
+      for (CORBA::ULong seed = 0; seed != iterations; ++seed)
+        {
+          CORBA::ULong index = 0;
+
+          Test::Octets octets;
+          Payload::make_octets (seed, octets);
+          Test::Octets_var octets_reply =
+            echo->echo_octets (seed, octets);
+          if (!Payload::check_octets (seed, octets_reply.in (), index))
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: octet %u of reply %u differs\n",
+                          index, seed));
+              ++status;
+            }
+
+          Test::Records records;
+          Payload::make_records (seed, records);
+          Test::Records_var records_reply =
+            echo->echo_records (seed, records);
+          if (!Payload::check_records (seed, records_reply.in (), index))
+            {
+              ACE_ERROR ((LM_ERROR,
+                          "ERROR: record %u of reply %u differs\n",
+                          index, seed));
+              ++status;
+            }
+        }
+
+      echo->shutdown ();
+
+      orb->destroy ();
+    }
+  catch (const Test::Echo::Invalid_Payload& ex)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "ERROR: the server received an invalid payload, "
+                  "index %u\n",
+                  ex.index));
+      return 1;
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return status;
+}
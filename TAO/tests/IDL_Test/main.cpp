@@ -12,11 +12,13 @@
 
 
 #include "pragmaS.h"
-#include "unionC.h"
+#include "unionS.h"
 #include "repo_id_modC.h"
 #include "constantsC.h"
 #include "nested_scopeS.h"
 #include "typedefC.h"
+#include "ssoS.h"
+#include "switch_lookupS.h"
 
 #include "ace/Log_Msg.h"
 #include "ace/OS_NS_string.h"
@@ -79,6 +81,376 @@ struct something_handler
 {
 };
 
+class move_target_i : public virtual POA_MoveTarget
+{
+};
+
+static const char sso_long[] =
+  "a string too long to be kept inline in the string member";
+
+/// Hands back its arguments, for members passed to it with -Gsso.
+class passer_i : public virtual POA_SSO::Passer
+{
+public:
+  virtual SSO::Strings *pass_struct (const SSO::Strings &in_s,
+                                     SSO::Strings &inout_s,
+                                     SSO::Strings_out out_s)
+  {
+    if (in_s.id < 0)
+      {
+        throw SSO::Failure (sso_long, "code", L"wide reason");
+      }
+
+    out_s = new SSO::Strings (inout_s);
+    inout_s = in_s;
+    return new SSO::Strings (in_s);
+  }
+
+  virtual char *pass (const char *in_s,
+                      char *&inout_s,
+                      CORBA::String_out out_s)
+  {
+    out_s = inout_s;
+    inout_s = CORBA::string_dup (sso_long);
+    return CORBA::string_dup (in_s);
+  }
+
+  virtual CORBA::WChar *wpass (const CORBA::WChar *in_s,
+                               CORBA::WChar *&inout_s,
+                               CORBA::WString_out out_s)
+  {
+    out_s = inout_s;
+    inout_s = CORBA::wstring_dup (L"a wide string too long to be inline");
+    return CORBA::wstring_dup (in_s);
+  }
+};
+
+/// True when the members of @a x and @a expected are equal.
+static bool
+same_strings (const SSO::Strings &x, const SSO::Strings &expected)
+{
+  return ACE_OS::strcmp (x.unbounded.in (), expected.unbounded.in ()) == 0
+    && ACE_OS::strcmp (x.bounded.in (), expected.bounded.in ()) == 0
+    && ACE_OS::strcmp (x.wide.in (), expected.wide.in ()) == 0
+    && ACE_OS::strcmp (x.wide_bounded.in (),
+                       expected.wide_bounded.in ()) == 0
+    && x.id == expected.id;
+}
+
+/// Round trip a struct and an exception with -Gsso string members
+/// through CDR.
+static int
+test_sso_cdr (const SSO::Strings &strings)
+{
+  int error_count = 0;
+
+  SSO::Failure failure (sso_long, "code", L"wide");
+
+  TAO_OutputCDR out;
+  out.set_version (1, 2);
+  if (!(out << strings))
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR, "error - cannot marshal SSO::Strings\n"));
+    }
+  failure._tao_encode (out);
+
+  TAO_InputCDR in (out);
+  SSO::Strings strings_copy;
+  if (!(in >> strings_copy) || !same_strings (strings_copy, strings))
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - SSO::Strings changed in a CDR round trip\n"));
+    }
+
+  CORBA::String_var id;
+  SSO::Failure failure_copy;
+  if (!(in >> id.out ()))
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR, "error - cannot demarshal SSO::Failure\n"));
+    }
+  failure_copy._tao_decode (in);
+  if (ACE_OS::strcmp (id.in (), failure._rep_id ()) != 0
+      || ACE_OS::strcmp (failure_copy.reason.in (), sso_long) != 0
+      || ACE_OS::strcmp (failure_copy.code.in (), "code") != 0
+      || ACE_OS::strcmp (failure_copy.wide_reason.in (), L"wide") != 0)
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - SSO::Failure changed in a CDR round trip\n"));
+    }
+
+  return error_count;
+}
+
+/// Pass -Gsso string members as in, inout and out arguments, and
+/// structs and exceptions holding them, through @a passer.
+static int
+test_sso_operations (SSO::Passer_ptr passer, const SSO::Strings &strings)
+{
+  int error_count = 0;
+
+  // The inout member is inline before the call and holds a heap
+  // string after it.
+  SSO::Strings args;
+  args.unbounded = "inout";
+  args.wide = L"inout";
+  CORBA::String_var ret = passer->pass (strings.bounded.in (),
+                                        args.unbounded.inout (),
+                                        args.bounded.out ());
+  if (ACE_OS::strcmp (ret.in (), strings.bounded.in ()) != 0
+      || ACE_OS::strcmp (args.unbounded.in (), sso_long) != 0
+      || ACE_OS::strcmp (args.bounded.in (), "inout") != 0)
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - string members passed as arguments\n"));
+    }
+
+  CORBA::WString_var wret = passer->wpass (strings.wide.in (),
+                                           args.wide.inout (),
+                                           args.wide_bounded.out ());
+  if (ACE_OS::strcmp (wret.in (), strings.wide.in ()) != 0
+      || ACE_OS::strcmp (args.wide.in (),
+                         L"a wide string too long to be inline") != 0
+      || ACE_OS::strcmp (args.wide_bounded.in (), L"inout") != 0)
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - wide string members passed as arguments\n"));
+    }
+
+  SSO::Strings inout (args);
+  SSO::Strings_var out;
+  SSO::Strings_var struct_ret =
+    passer->pass_struct (strings, inout, out.out ());
+  if (!same_strings (struct_ret.in (), strings)
+      || !same_strings (inout, strings)
+      || !same_strings (out.in (), args))
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - structs with string members passed as "
+                  "arguments\n"));
+    }
+
+  SSO::Strings failing (strings);
+  failing.id = -1;
+  try
+    {
+      struct_ret = passer->pass_struct (failing, inout, out.out ());
+      ++error_count;
+      ACE_ERROR ((LM_ERROR, "error - SSO::Failure was not raised\n"));
+    }
+  catch (const SSO::Failure &ex)
+    {
+      if (ACE_OS::strcmp (ex.reason.in (), sso_long) != 0
+          || ACE_OS::strcmp (ex.code.in (), "code") != 0
+          || ACE_OS::strcmp (ex.wide_reason.in (), L"wide reason") != 0)
+        {
+          ++error_count;
+          ACE_ERROR ((LM_ERROR,
+                      "error - members of a raised SSO::Failure\n"));
+        }
+    }
+
+  return error_count;
+}
+
+/// Answers each operation with its argument plus a different offset,
+/// for the skeletons generated with -H switch.
+class derived_i : public virtual POA_Switch_Lookup::Derived
+{
+public:
+  derived_i (void)
+    : count_ (0),
+      counter_ (0)
+  {
+  }
+
+  virtual CORBA::Long compute (CORBA::Long x) { return x + 1; }
+  virtual CORBA::Long compose (CORBA::Long x) { return x + 2; }
+  virtual CORBA::Long compute_all (CORBA::Long x) { return x + 3; }
+  virtual CORBA::Long computed (CORBA::Long x) { return x + 4; }
+  virtual CORBA::Long decompose (CORBA::Long x) { return x + 5; }
+
+  virtual CORBA::Long count (void) { return this->count_; }
+  virtual void count (CORBA::Long count) { this->count_ = count; }
+
+  virtual char *name (void) { return CORBA::string_dup ("derived"); }
+
+  virtual CORBA::Long counter (void) { return this->counter_; }
+  virtual void counter (CORBA::Long counter) { this->counter_ = counter; }
+
+private:
+  CORBA::Long count_;
+  CORBA::Long counter_;
+};
+
+/// Invoke the inherited and the own operations and attributes of
+/// @a derived, and an operation it does not implement, through the
+/// skeletons generated with -H switch.
+static int
+test_switch_lookup (Switch_Lookup::Derived_ptr derived)
+{
+  int error_count = 0;
+
+  Switch_Lookup::Base_var base =
+    Switch_Lookup::Base::_narrow (derived);
+
+  if (base->compute (10) != 11
+      || base->compose (10) != 12
+      || derived->compute (20) != 21
+      || derived->compose (20) != 22
+      || derived->compute_all (10) != 13
+      || derived->computed (10) != 14
+      || derived->decompose (10) != 15)
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - operation dispatched with -H switch\n"));
+    }
+
+  base->count (7);
+  derived->counter (8);
+  CORBA::String_var name = derived->name ();
+  if (derived->count () != 7
+      || base->count () != 7
+      || derived->counter () != 8
+      || ACE_OS::strcmp (name.in (), "derived") != 0)
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - attribute dispatched with -H switch\n"));
+    }
+
+  if (!derived->_is_a ("IDL:Switch_Lookup/Base:1.0")
+      || derived->_is_a ("IDL:Switch_Lookup/Unrelated:1.0"))
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - _is_a dispatched with -H switch\n"));
+    }
+
+  // An operation of the same length as compose and compute, sharing
+  // their prefix, is not found.
+  Switch_Lookup::Unrelated_var unrelated =
+    Switch_Lookup::Unrelated::_unchecked_narrow (derived);
+  try
+    {
+      unrelated->compost (10);
+
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - unknown operation dispatched with "
+                  "-H switch\n"));
+    }
+  catch (const CORBA::BAD_OPERATION &)
+    {
+    }
+
+  return error_count;
+}
+
+#if defined (ACE_HAS_CPP11)
+/// True when @a x holds the same branch and value as @a expected.
+static bool
+same_value (const MoveUnion &x, const MoveUnion &expected)
+{
+  if (x._d () != expected._d ())
+    {
+      return false;
+    }
+
+  switch (x._d ())
+    {
+    case 1:
+      return ACE_OS::strcmp (x.str (), expected.str ()) == 0;
+    case 2:
+      return x.obj ()->_is_equivalent (expected.obj ());
+    case 3:
+      return ACE_OS::strcmp (x.rec ().name.in (),
+                             expected.rec ().name.in ()) == 0
+        && x.rec ().id == expected.rec ().id;
+    default:
+      return x.l () == expected.l ();
+    }
+}
+
+/// Move construct and move assign unions holding a string, an object
+/// reference and a variable size struct, then destroy or reassign the
+/// moved from unions.
+static int
+test_union_move (MoveTarget_ptr target)
+{
+  int error_count = 0;
+
+  MoveRecord record;
+  record.name = "move record";
+  record.id = 42;
+
+  MoveUnion values[3];
+  values[0].str ("move string");
+  values[1].obj (target);
+  values[2].rec (record);
+
+  for (int i = 0; i != 3; ++i)
+    {
+      {
+        MoveUnion source (values[i]);
+        MoveUnion moved (std::move (source));
+        if (!same_value (moved, values[i]))
+          {
+            ++error_count;
+            ACE_ERROR ((LM_ERROR,
+                        "error - move construction of union "
+                        "branch %d\n",
+                        values[i]._d ()));
+          }
+      }
+
+      MoveUnion source (values[i]);
+      // The target holds another branch owning memory, which the move
+      // assignment releases.
+      MoveUnion moved (values[(i + 1) % 3]);
+      moved = std::move (source);
+      if (!same_value (moved, values[i]))
+        {
+          ++error_count;
+          ACE_ERROR ((LM_ERROR,
+                      "error - move assignment of union branch %d\n",
+                      values[i]._d ()));
+        }
+
+      source = values[(i + 2) % 3];
+      if (!same_value (source, values[(i + 2) % 3]))
+        {
+          ++error_count;
+          ACE_ERROR ((LM_ERROR,
+                      "error - assignment to moved from union "
+                      "branch %d\n",
+                      values[i]._d ()));
+        }
+    }
+
+  // Moving the struct moves its string member, leaving it null.
+  MoveRecord moved_record (std::move (record));
+  MoveRecord assigned_record;
+  assigned_record = std::move (moved_record);
+  if (record.name.in () != 0 || moved_record.name.in () != 0
+      || ACE_OS::strcmp (assigned_record.name.in (), "move record") != 0)
+    {
+      ++error_count;
+      ACE_ERROR ((LM_ERROR,
+                  "error - moved from string member is not null\n"));
+    }
+
+  return error_count;
+}
+#endif /* ACE_HAS_CPP11 */
+
 int
 ACE_TMAIN(int argc, ACE_TCHAR *argv[])
 {
@@ -399,6 +771,36 @@ ACE_TMAIN(int argc, ACE_TCHAR *argv[])
                       "default case label value\n"));
         }
 
+      // String members mapped with -Gsso.
+      SSO::Strings strings;
+      strings.unbounded = sso_long;
+      strings.bounded = "bounded";
+      strings.wide = L"wide";
+      strings.wide_bounded = L"wbounded";
+      strings.id = 42;
+      error_count += test_sso_cdr (strings);
+
+      passer_i p;
+      id = root_poa->activate_object (&p);
+      obj = root_poa->id_to_reference (id.in ());
+      SSO::Passer_var passer = SSO::Passer::_narrow (obj.in ());
+      error_count += test_sso_operations (passer.in (), strings);
+
+      derived_i d;
+      id = root_poa->activate_object (&d);
+      obj = root_poa->id_to_reference (id.in ());
+      Switch_Lookup::Derived_var derived =
+        Switch_Lookup::Derived::_narrow (obj.in ());
+      error_count += test_switch_lookup (derived.in ());
+
+#if defined (ACE_HAS_CPP11)
+      move_target_i m;
+      id = root_poa->activate_object (&m);
+      obj = root_poa->id_to_reference (id.in ());
+      MoveTarget_var move_target = MoveTarget::_narrow (obj.in ());
+      error_count += test_union_move (move_target.in ());
+#endif /* ACE_HAS_CPP11 */
+
       if (SignedGen::val !=  -3)
         {
           ++error_count;
@@ -0,0 +1,187 @@
+
+//=============================================================================
+/**
+ *  @file     Collocated_Demux_Cache.cpp
+ *
+ *   This program invokes collocated objects, so their references cache
+ *   the POA and the servant, then deactivates the objects or destroys
+ *   their POA.  The next invocations must raise OBJECT_NOT_EXIST
+ *   instead of reaching the servants found before.
+ */
+//=============================================================================
+
+
+#include "testS.h"
+
+class test_i : public virtual POA_test
+{
+public:
+  explicit test_i (CORBA::Long id);
+
+  CORBA::Long id (void);
+
+private:
+  CORBA::Long id_;
+};
+
+test_i::test_i (CORBA::Long id)
+  : id_ (id)
+{
+}
+
+CORBA::Long
+test_i::id (void)
+{
+  return this->id_;
+}
+
+/// Activate a new servant answering @a value in @a poa and return
+/// its reference.
+static test_ptr
+activate (PortableServer::POA_ptr poa,
+          CORBA::Long value,
+          PortableServer::ObjectId_out oid)
+{
+  PortableServer::ServantBase_var servant = new test_i (value);
+  PortableServer::ObjectId_var id = poa->activate_object (servant.in ());
+
+  CORBA::Object_var object = poa->id_to_reference (id.in ());
+
+  oid = id._retn ();
+  return test::_narrow (object.in ());
+}
+
+/// Invoke @a object twice, it must answer @a expected.
+static int
+check_active (const char *what,
+              test_ptr object,
+              CORBA::Long expected)
+{
+  try
+    {
+      for (int i = 0; i != 2; ++i)
+        {
+          CORBA::Long const id = object->id ();
+          if (id != expected)
+            {
+              ACE_ERROR_RETURN ((LM_ERROR,
+                                 "ERROR: %C: object %d answered %d\n",
+                                 what, expected, id),
+                                1);
+            }
+        }
+    }
+  catch (const CORBA::Exception &ex)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "ERROR: %C: object %d raised %C\n",
+                         what, expected, ex._name ()),
+                        1);
+    }
+
+  return 0;
+}
+
+/// Invoke @a object, which must raise OBJECT_NOT_EXIST.
+static int
+check_inactive (const char *what,
+                test_ptr object,
+                CORBA::Long id)
+{
+  try
+    {
+      object->id ();
+    }
+  catch (const CORBA::OBJECT_NOT_EXIST &)
+    {
+      return 0;
+    }
+  catch (const CORBA::Exception &ex)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "ERROR: %C: object %d raised %C\n",
+                         what, id, ex._name ()),
+                        1);
+    }
+
+  ACE_ERROR_RETURN ((LM_ERROR,
+                     "ERROR: %C: object %d was reached\n",
+                     what, id),
+                    1);
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var object =
+        orb->resolve_initial_references ("RootPOA");
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (object.in ());
+
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      // A deactivated object is not reached through a reference that
+      // reached it before, until its id is reactivated.
+      PortableServer::ObjectId_var id;
+      test_var first = activate (root_poa.in (), 1, id.out ());
+      status += check_active ("RootPOA", first.in (), 1);
+
+      root_poa->deactivate_object (id.in ());
+      status += check_inactive ("deactivated", first.in (), 1);
+
+      {
+        PortableServer::ServantBase_var servant = new test_i (2);
+        root_poa->activate_object_with_id (id.in (), servant.in ());
+      }
+      status += check_active ("reactivated", first.in (), 2);
+
+      // Another object of the same POA does not make the reference
+      // valid again.
+      root_poa->deactivate_object (id.in ());
+      PortableServer::ObjectId_var other_id;
+      test_var other = activate (root_poa.in (), 3, other_id.out ());
+      status += check_active ("other object", other.in (), 3);
+      status += check_inactive ("deactivated, other object",
+                                first.in (), 2);
+
+      // The objects of a destroyed POA are not reached, neither when a
+      // POA with the same name is created again.
+      CORBA::PolicyList policies;
+      PortableServer::POA_var child_poa =
+        root_poa->create_POA ("child", poa_manager.in (), policies);
+
+      PortableServer::ObjectId_var child_id;
+      test_var child = activate (child_poa.in (), 4, child_id.out ());
+      status += check_active ("child POA", child.in (), 4);
+
+      child_poa->destroy (true, true);
+      status += check_inactive ("destroyed POA", child.in (), 4);
+
+      child_poa =
+        root_poa->create_POA ("child", poa_manager.in (), policies);
+      test_var newer = activate (child_poa.in (), 5, child_id.out ());
+      status += check_active ("recreated POA", newer.in (), 5);
+      status += check_inactive ("recreated POA", child.in (), 4);
+
+      root_poa->destroy (true, true);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception &ex)
+    {
+      ex._tao_print_exception ("Exception caught");
+      return 1;
+    }
+
+  return status == 0 ? 0 : 1;
+}
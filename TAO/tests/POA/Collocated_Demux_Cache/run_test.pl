@@ -0,0 +1,31 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use lib "$ENV{ACE_ROOT}/bin";
+use PerlACE::TestTarget;
+
+my $status = 0;
+
+my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
+
+my $server_conf = $server->LocalFile ("nocache.conf");
+
+$SV = $server->CreateProcess ("Collocated_Demux_Cache");
+
+foreach $conf ("", "-ORBSvcConf $server_conf") {
+    print STDERR "================ Collocated Demux Cache Test $conf\n";
+
+    $SV->Arguments ($conf);
+
+    $test = $SV->SpawnWaitKill ($server->ProcessStartWaitInterval());
+
+    if ($test != 0) {
+        print STDERR "ERROR: test returned $test\n";
+        $status = 1;
+    }
+}
+
+exit $status;
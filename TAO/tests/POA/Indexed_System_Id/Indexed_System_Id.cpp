@@ -0,0 +1,274 @@
+
+//=============================================================================
+/**
+ *  @file     Indexed_System_Id.cpp
+ *
+ *   This program activates, invokes, deactivates and reactivates
+ *   objects in the RootPOA and in a TRANSIENT and a PERSISTENT child
+ *   POA with the SYSTEM_ID policy.  With -i the ORB is expected to run
+ *   with indexed.conf, where the transient POAs use indexed system
+ *   ids, and a stale id must not take the slot of a newer object.
+ */
+//=============================================================================
+
+
+#include "testS.h"
+#include "ace/Get_Opt.h"
+
+static bool indexed = false;
+
+static const CORBA::Long object_count = 10;
+
+static int
+parse_args (int argc, ACE_TCHAR **argv)
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("i"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'i':
+        indexed = true;
+        break;
+
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-i "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+
+  return 0;
+}
+
+class test_i : public POA_test
+{
+public:
+  explicit test_i (CORBA::Long id);
+
+  CORBA::Long id (void);
+
+private:
+  CORBA::Long id_;
+};
+
+test_i::test_i (CORBA::Long id)
+  : id_ (id)
+{
+}
+
+CORBA::Long
+test_i::id (void)
+{
+  return this->id_;
+}
+
+/// Activate a new servant answering @a value in @a poa and return
+/// the reference, after a round trip through its string form.
+static test_ptr
+activate (CORBA::ORB_ptr orb,
+          PortableServer::POA_ptr poa,
+          CORBA::Long value,
+          PortableServer::ObjectId_out oid)
+{
+  PortableServer::ServantBase_var servant = new test_i (value);
+  PortableServer::ObjectId_var id = poa->activate_object (servant.in ());
+
+  CORBA::Object_var object = poa->id_to_reference (id.in ());
+  CORBA::String_var ior = orb->object_to_string (object.in ());
+  object = orb->string_to_object (ior.in ());
+
+  oid = id._retn ();
+  return test::_narrow (object.in ());
+}
+
+/// Invoke @a object, which must answer @a expected.
+static int
+check_active (const char *poa_name,
+              test_ptr object,
+              CORBA::Long expected)
+{
+  try
+    {
+      CORBA::Long const id = object->id ();
+      if (id != expected)
+        {
+          ACE_ERROR_RETURN ((LM_ERROR,
+                             "ERROR: %C: object %d answered %d\n",
+                             poa_name, expected, id),
+                            1);
+        }
+    }
+  catch (const CORBA::Exception &ex)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "ERROR: %C: object %d raised %C\n",
+                         poa_name, expected, ex._name ()),
+                        1);
+    }
+
+  return 0;
+}
+
+/// Invoke the deactivated @a object, which must raise
+/// OBJECT_NOT_EXIST.
+static int
+check_inactive (const char *poa_name,
+                test_ptr object,
+                CORBA::Long id)
+{
+  try
+    {
+      object->id ();
+    }
+  catch (const CORBA::OBJECT_NOT_EXIST &)
+    {
+      return 0;
+    }
+  catch (const CORBA::Exception &ex)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         "ERROR: %C: deactivated object %d raised %C\n",
+                         poa_name, id, ex._name ()),
+                        1);
+    }
+
+  ACE_ERROR_RETURN ((LM_ERROR,
+                     "ERROR: %C: deactivated object %d was reached\n",
+                     poa_name, id),
+                    1);
+}
+
+static int
+test_poa (CORBA::ORB_ptr orb,
+          PortableServer::POA_ptr poa,
+          bool indexed_ids)
+{
+  CORBA::String_var name = poa->the_name ();
+  int status = 0;
+
+  PortableServer::ObjectId_var ids[object_count];
+  test_var objects[object_count];
+
+  for (CORBA::Long i = 0; i != object_count; ++i)
+    {
+      objects[i] = activate (orb, poa, i, ids[i].out ());
+    }
+
+  for (CORBA::Long i = 0; i != object_count; ++i)
+    {
+      status += check_active (name.in (), objects[i].in (), i);
+    }
+
+  // A deactivated object is not reached, until its id is reactivated.
+  CORBA::Long const victim = object_count / 2;
+  poa->deactivate_object (ids[victim].in ());
+  status += check_inactive (name.in (), objects[victim].in (), victim);
+
+  {
+    PortableServer::ServantBase_var servant = new test_i (victim);
+    poa->activate_object_with_id (ids[victim].in (), servant.in ());
+  }
+  status += check_active (name.in (), objects[victim].in (), victim);
+
+  // A newer object may get the slot of a deactivated indexed id.
+  poa->deactivate_object (ids[victim].in ());
+
+  PortableServer::ObjectId_var newer_id;
+  test_var newer = activate (orb, poa, object_count, newer_id.out ());
+  status += check_active (name.in (), newer.in (), object_count);
+  status += check_inactive (name.in (), objects[victim].in (), victim);
+
+  if (indexed_ids)
+    {
+      // The stale id cannot take the slot back from the newer object.
+      try
+        {
+          PortableServer::ServantBase_var servant = new test_i (victim);
+          poa->activate_object_with_id (ids[victim].in (), servant.in ());
+
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: %C: a stale id was reactivated\n",
+                      name.in ()));
+          ++status;
+        }
+      catch (const CORBA::OBJ_ADAPTER &)
+        {
+        }
+
+      status += check_active (name.in (), newer.in (), object_count);
+      status += check_inactive (name.in (), objects[victim].in (), victim);
+    }
+
+  for (CORBA::Long i = 0; i != object_count; ++i)
+    {
+      if (i != victim)
+        {
+          status += check_active (name.in (), objects[i].in (), i);
+        }
+    }
+
+  ACE_DEBUG ((LM_DEBUG,
+              "(%P|%t) %C: %d errors with %C system ids\n",
+              name.in (), status, indexed_ids ? "indexed" : "default"));
+
+  return status;
+}
+
+int
+ACE_TMAIN (int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var object =
+        orb->resolve_initial_references ("RootPOA");
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (object.in ());
+
+      PortableServer::POAManager_var poa_manager =
+        root_poa->the_POAManager ();
+
+      poa_manager->activate ();
+
+      // Unlike those of the RootPOA, the object keys of the child POAs
+      // have a POA name in front of the system id.
+      CORBA::PolicyList policies;
+      PortableServer::POA_var transient_poa =
+        root_poa->create_POA ("transient", poa_manager.in (), policies);
+
+      policies.length (1);
+      policies[0] =
+        root_poa->create_lifespan_policy (PortableServer::PERSISTENT);
+      PortableServer::POA_var persistent_poa =
+        root_poa->create_POA ("persistent", poa_manager.in (), policies);
+      policies[0]->destroy ();
+
+      status += test_poa (orb.in (), root_poa.in (), indexed);
+      status += test_poa (orb.in (), transient_poa.in (), indexed);
+
+      // The persistent POAs keep the ids of the default strategy.
+      status += test_poa (orb.in (), persistent_poa.in (), false);
+
+      root_poa->destroy (true, true);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception &ex)
+    {
+      ex._tao_print_exception ("Exception caught");
+      return 1;
+    }
+
+  return status == 0 ? 0 : 1;
+}
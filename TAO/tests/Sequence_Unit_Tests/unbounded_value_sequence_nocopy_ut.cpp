@@ -0,0 +1,259 @@
+/**
+ * @file
+ *
+ * @brief Unit test for unbounded sequences of basic types referencing
+ * the received message block.
+ *
+ * The checks only run when TAO is built with TAO_NO_COPY_VALUE_SEQUENCES
+ * defined to 1 in config.h, defining it for this test alone would mix
+ * both layouts of the sequences in one program.
+ */
+#include "tao/Sequence_T.h"
+#include "tao/CDR.h"
+#include "tao/ORB.h"
+#include "tao/SystemException.h"
+
+#include "test_macros.h"
+
+#include "ace/Message_Block.h"
+
+using namespace TAO_VERSIONED_NAMESPACE_NAME::TAO;
+
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+
+typedef unbounded_value_sequence<CORBA::Long> tested_sequence;
+
+CORBA::Boolean operator<< (TAO_OutputCDR &strm, const tested_sequence &sequence)
+{
+  return TAO::marshal_sequence(strm, sequence);
+}
+
+CORBA::Boolean operator>> (TAO_InputCDR &strm, tested_sequence &sequence)
+{
+  return TAO::demarshal_sequence(strm, sequence);
+}
+
+CORBA::ULong const length = 16;
+
+struct Tester
+{
+  explicit Tester(TAO_ORB_Core * orb_core)
+    : orb_core_(orb_core)
+  {}
+
+  ACE_Message_Block * alloc_and_init_mb()
+  {
+    ACE_Message_Block * mb =
+      new ACE_Message_Block (length * sizeof (CORBA::Long)
+                             + ACE_CDR::MAX_ALIGNMENT);
+    ACE_CDR::mb_align (mb);
+    for (CORBA::ULong i = 0; i != length; ++i)
+      {
+        CORBA::Long const value = i * i;
+        mb->copy (reinterpret_cast<const char *> (&value), sizeof (value));
+      }
+    return mb;
+  }
+
+  template<typename T>
+  static T swapped(T x)
+  {
+    T result;
+    ACE_CDR::swap_4(reinterpret_cast<char const *> (&x),
+                    reinterpret_cast<char *> (&result));
+    return result;
+  }
+
+  void init_sequence(tested_sequence & x)
+  {
+    x.length(length);
+    for (CORBA::ULong i = 0; i != length; ++i)
+      {
+        x[i] = i * i;
+      }
+  }
+
+  int check_values(tested_sequence const & x)
+  {
+    CHECK_EQUAL(length, x.length());
+    for (CORBA::ULong i = 0; i != length; ++i)
+      {
+        CHECK_EQUAL(CORBA::Long(i * i), x[i]);
+      }
+    return 0;
+  }
+
+  int test_replace_message_block()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    tested_sequence a;
+    a.replace(length, mb);
+    CHECK_EQUAL(false, a.release());
+    CHECK(a.mb() != 0);
+    CHECK(a.get_buffer() == reinterpret_cast<CORBA::Long *> (mb->rd_ptr()));
+
+    // The sequence keeps its own reference to the block.
+    mb->release();
+    return check_values(a);
+  }
+
+  int test_copy_owns_elements()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    tested_sequence a;
+    a.replace(length, mb);
+    mb->release();
+
+    tested_sequence b(a);
+    CHECK(b.mb() == 0);
+    CHECK_EQUAL(true, b.release());
+    CHECK(b.get_buffer() != a.get_buffer());
+    FAIL_RETURN_IF_NOT(check_values(b) == 0, b);
+
+    tested_sequence c;
+    c = a;
+    CHECK(c.mb() == 0);
+    CHECK_EQUAL(true, c.release());
+    return check_values(c);
+  }
+
+  int test_set_length()
+  {
+    ACE_Message_Block * mb = alloc_and_init_mb();
+    tested_sequence a;
+    a.replace(length, mb);
+    mb->release();
+
+    a.length(length / 2);
+    CHECK(a.mb() != 0);
+    a.length(length);
+    CHECK(a.mb() != 0);
+
+    // Growing past the maximum copies the elements.
+    a.length(length + 1);
+    CHECK(a.mb() == 0);
+    CHECK_EQUAL(true, a.release());
+    a.length(length);
+    return check_values(a);
+  }
+
+  int test_demarshal_in_place()
+  {
+    tested_sequence source;
+    init_sequence(source);
+
+    TAO_OutputCDR out;
+    CHECK(out << source);
+
+    TAO_InputCDR in(out, 0, 0, 0, this->orb_core_);
+    tested_sequence target;
+    CHECK(in >> target);
+    CHECK(target.mb() != 0);
+    CHECK_EQUAL(false, target.release());
+    return check_values(target);
+  }
+
+  int test_demarshal_swapped()
+  {
+    // Encode the sequence in the other byte order by hand, the output
+    // streams only swap when ACE is built with ACE_ENABLE_SWAP_ON_WRITE.
+    TAO_OutputCDR out;
+    CHECK(out.write_ulong(swapped(length)));
+    for (CORBA::ULong i = 0; i != length; ++i)
+      {
+        CHECK(out.write_long(swapped(CORBA::Long(i * i))));
+      }
+    out.consolidate();
+
+    TAO_InputCDR in(out.begin(), !ACE_CDR_BYTE_ORDER,
+                    TAO_DEF_GIOP_MAJOR, TAO_DEF_GIOP_MINOR,
+                    this->orb_core_);
+    tested_sequence target;
+    CHECK(in >> target);
+    CHECK(target.mb() == 0);
+    CHECK_EQUAL(true, target.release());
+    return check_values(target);
+  }
+
+  int test_demarshal_from_buffer()
+  {
+    tested_sequence source;
+    init_sequence(source);
+
+    TAO_OutputCDR out;
+    CHECK(out << source);
+    out.consolidate();
+
+    // The stream reads from a buffer of the caller, which the sequence
+    // cannot keep.
+    TAO_InputCDR in(out.begin()->rd_ptr(), out.begin()->length(),
+                    ACE_CDR_BYTE_ORDER,
+                    TAO_DEF_GIOP_MAJOR, TAO_DEF_GIOP_MINOR,
+                    this->orb_core_);
+    tested_sequence target;
+    CHECK(in >> target);
+    CHECK(target.mb() == 0);
+    CHECK_EQUAL(true, target.release());
+    return check_values(target);
+  }
+
+  int test_demarshal_without_orb()
+  {
+    tested_sequence source;
+    init_sequence(source);
+
+    TAO_OutputCDR out;
+    CHECK(out << source);
+
+    // Without an ORB the allocator of the block is unknown.
+    TAO_InputCDR in(out);
+    tested_sequence target;
+    CHECK(in >> target);
+    CHECK(target.mb() == 0);
+    return check_values(target);
+  }
+
+  int test_all()
+  {
+    int status = 0;
+    status += this->test_replace_message_block();
+    status += this->test_copy_owns_elements();
+    status += this->test_set_length();
+    status += this->test_demarshal_in_place();
+    status += this->test_demarshal_swapped();
+    status += this->test_demarshal_from_buffer();
+    status += this->test_demarshal_without_orb();
+    return status;
+  }
+
+  TAO_ORB_Core * orb_core_;
+};
+
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
+int ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+#if (TAO_NO_COPY_VALUE_SEQUENCES == 1)
+      Tester tester(orb->orb_core ());
+      status += tester.test_all();
+#else
+      ACE_DEBUG ((LM_DEBUG,
+                  ACE_TEXT ("TAO_NO_COPY_VALUE_SEQUENCES is disabled, ")
+                  ACE_TEXT ("nothing to test\n")));
+#endif /* TAO_NO_COPY_VALUE_SEQUENCES == 1 */
+
+      orb->destroy ();
+    }
+  catch (const ::CORBA::Exception &ex)
+    {
+      ex._tao_print_exception("ERROR : unexpected CORBA exception caugth :");
+      ++status;
+    }
+
+  return status;
+}
@@ -15,6 +15,8 @@
 
 #include "test_macros.h"
 
+#include <utility>
+
 
 using namespace TAO_VERSIONED_NAMESPACE_NAME::TAO;
 
@@ -388,6 +390,63 @@ struct Tester
     return 0;
   }
 
+#if defined (ACE_HAS_CPP11)
+  int test_move_constructor()
+  {
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(16);
+      x.length(8);
+      value_type const * buffer = x.get_buffer();
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+
+      tested_sequence y(std::move(x));
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+      CHECK_EQUAL(CORBA::ULong(16), y.maximum());
+      CHECK_EQUAL(CORBA::ULong(8), y.length());
+      CHECK_EQUAL(true, y.release());
+      CHECK_EQUAL(buffer, y.get_buffer());
+
+      CHECK_EQUAL(CORBA::ULong(0), x.length());
+      CHECK_EQUAL(false, x.release());
+
+      // The moved from sequence is still usable.
+      x.length(4);
+      FAIL_RETURN_IF_NOT(a.expect(1), a);
+      CHECK_EQUAL(CORBA::ULong(4), x.length());
+      CHECK_EQUAL(true, x.release());
+    }
+    FAIL_RETURN_IF_NOT(f.expect(2), f);
+    return 0;
+  }
+
+  int test_move_assignment()
+  {
+    expected_calls a(tested_allocation_traits::allocbuf_calls);
+    expected_calls f(tested_allocation_traits::freebuf_calls);
+    {
+      tested_sequence x(16);
+      x.length(8);
+      value_type const * buffer = x.get_buffer();
+      tested_sequence y(4);
+      y.length(4);
+      FAIL_RETURN_IF_NOT(a.expect(2), a);
+
+      y = std::move(x);
+      FAIL_RETURN_IF_NOT(a.expect(0), a);
+      FAIL_RETURN_IF_NOT(f.expect(1), f);
+      CHECK_EQUAL(CORBA::ULong(16), y.maximum());
+      CHECK_EQUAL(CORBA::ULong(8), y.length());
+      CHECK_EQUAL(true, y.release());
+      CHECK_EQUAL(buffer, y.get_buffer());
+      CHECK_EQUAL(CORBA::ULong(0), x.length());
+    }
+    FAIL_RETURN_IF_NOT(f.expect(1), f);
+    return 0;
+  }
+#endif /* ACE_HAS_CPP11 */
+
   int test_all()
   {
     int status = 0;
@@ -408,6 +467,10 @@ struct Tester
     status += this->test_get_buffer_false();
     status += this->test_get_buffer_true_with_release_false();
     status += this->test_get_buffer_true_with_release_true();
+#if defined (ACE_HAS_CPP11)
+    status += this->test_move_constructor();
+    status += this->test_move_assignment();
+#endif /* ACE_HAS_CPP11 */
     return status;
   }
   Tester() {}
@@ -19,13 +19,17 @@ test_transport_current (Transport::Current_ptr tc)
 
   TAO::CounterT rr = tc->messages_received ();
 
+  TAO::CounterT ba = tc->receive_buffer_allocations ();
+
   ACE_DEBUG ((LM_DEBUG,
-              ACE_TEXT ("Tester (%P|%t) Transport [%q] - Sent/Received [bytes=%q/%q, messages=%q/%q]\n"),
+              ACE_TEXT ("Tester (%P|%t) Transport [%q] - Sent/Received [bytes=%q/%q, messages=%q/%q, ")
+              ACE_TEXT ("receive buffers=%q]\n"),
               (ACE_UINT64)id,
               (ACE_UINT64)bs,
               (ACE_UINT64)br,
               (ACE_UINT64)rs,
-              (ACE_UINT64)rr));
+              (ACE_UINT64)rr,
+              (ACE_UINT64)ba));
 
   return 0;
 }
@@ -0,0 +1,35 @@
+#include "Receiver.h"
+
+Receiver::Receiver (CORBA::ORB_ptr orb, TAO::Transport::Current_ptr tc)
+  : orb_ (CORBA::ORB::_duplicate (orb))
+  , tc_ (TAO::Transport::Current::_duplicate (tc))
+{
+}
+
+Test::Receive_Info
+Receiver::receive (const CORBA::OctetSeq &data)
+{
+  Test::Receive_Info info;
+  info.allocations = this->tc_->receive_buffer_allocations ();
+  info.buffer_size = 0;
+
+#if (TAO_NO_COPY_OCTET_SEQUENCES == 1)
+  // The octets refer to the buffer the request was received in,
+  // unless that was the buffer on the stack.
+  ACE_Message_Block const * const mb = data.mb ();
+  if (mb != 0)
+    {
+      info.buffer_size = mb->data_block ()->capacity ();
+    }
+#else
+  ACE_UNUSED_ARG (data);
+#endif /* TAO_NO_COPY_OCTET_SEQUENCES == 1 */
+
+  return info;
+}
+
+void
+Receiver::shutdown (void)
+{
+  this->orb_->shutdown (0);
+}
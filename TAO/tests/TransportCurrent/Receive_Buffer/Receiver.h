@@ -0,0 +1,30 @@
+#ifndef RECEIVER_H
+#define RECEIVER_H
+#include /**/ "ace/pre.h"
+
+#include "TestS.h"
+#include "tao/TransportCurrent/Transport_Current.h"
+
+/// Implement the Test::Receiver interface
+class Receiver
+  : public virtual POA_Test::Receiver
+{
+public:
+  /// Constructor
+  Receiver (CORBA::ORB_ptr orb, TAO::Transport::Current_ptr tc);
+
+  // = The skeleton methods
+  virtual Test::Receive_Info receive (const CORBA::OctetSeq &data);
+
+  virtual void shutdown (void);
+
+private:
+  /// Use an ORB reference to shutdown the application.
+  CORBA::ORB_var orb_;
+
+  /// The Transport Current of the upcalls.
+  TAO::Transport::Current_var tc_;
+};
+
+#include /**/ "ace/post.h"
+#endif /* RECEIVER_H */
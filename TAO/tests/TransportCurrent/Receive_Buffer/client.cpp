@@ -0,0 +1,163 @@
+#include "TestC.h"
+#include "ace/Get_Opt.h"
+
+const ACE_TCHAR *ior = ACE_TEXT ("file://server.ior");
+
+/// Requests that fit in the receive buffer on the stack of the server.
+static const CORBA::ULong small_size = 64;
+
+/// Requests much larger than that buffer.
+static const CORBA::ULong large_size = 100000;
+
+static const int large_count = 10;
+
+/// Empty requests sent after the large ones, enough to bring the
+/// running average of the message size down again.
+static const int small_count = 80;
+
+/// Bytes of a request besides the octets sent, and the alignment of
+/// the buffer.
+static const CORBA::ULongLong request_overhead = 1024;
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'k':
+        ior = get_opts.opt_arg ();
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-k <ior> "
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+/// Send @a size octets and check the heap buffers the server
+/// allocated so far against @a allocations.
+static int
+send (Test::Receiver_ptr receiver,
+      CORBA::ULong size,
+      CORBA::LongLong allocations)
+{
+  CORBA::OctetSeq data (size);
+  data.length (size);
+
+  for (CORBA::ULong i = 0; i != size; ++i)
+    {
+      data[i] = static_cast<CORBA::Octet> (i);
+    }
+
+  Test::Receive_Info const info = receiver->receive (data);
+
+  int status = 0;
+
+  if (info.allocations != allocations)
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "(%P|%t) ERROR: %u octets, %q receive buffers "
+                  "allocated instead of %q\n",
+                  size,
+                  info.allocations,
+                  allocations));
+      status = 1;
+    }
+
+  // A message read in a buffer on the heap gets one of its exact
+  // size, not one rounded up by ACE_CDR::grow().
+  if (size > small_size
+      && info.buffer_size != 0
+      && (info.buffer_size < size
+          || info.buffer_size > size + request_overhead))
+    {
+      ACE_ERROR ((LM_ERROR,
+                  "(%P|%t) ERROR: %u octets received in a buffer "
+                  "of %Q bytes\n",
+                  size,
+                  info.buffer_size));
+      status = 1;
+    }
+
+  return status;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  int status = 0;
+
+  try
+    {
+      CORBA::ORB_var orb = CORBA::ORB_init (argc, argv);
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tmp = orb->string_to_object(ior);
+
+      Test::Receiver_var receiver = Test::Receiver::_narrow(tmp.in ());
+
+      if (CORBA::is_nil (receiver.in ()))
+        {
+          ACE_ERROR_RETURN ((LM_DEBUG,
+                             "Nil Test::Receiver reference <%s>\n",
+                             ior),
+                            1);
+        }
+
+      // The messages fit in the buffer on the stack.
+      CORBA::LongLong allocations = 0;
+      for (int i = 0; i != 4; ++i)
+        {
+          status += send (receiver.in (), small_size, allocations);
+        }
+
+      // Each message is read in a buffer on the heap, first after
+      // reading as much as the buffer on the stack holds, then after
+      // reading the GIOP header only.
+      for (int i = 0; i != large_count; ++i)
+        {
+          ++allocations;
+          status += send (receiver.in (),
+                          large_size + i * 1000,
+                          allocations);
+        }
+
+      // The GIOP header is still read first until the running average
+      // of the message size fits in the buffer on the stack again.
+      Test::Receive_Info info = receiver->receive (CORBA::OctetSeq ());
+      for (int i = 0; i != small_count; ++i)
+        {
+          info = receiver->receive (CORBA::OctetSeq ());
+        }
+
+      allocations = info.allocations;
+      for (int i = 0; i != 4; ++i)
+        {
+          status += send (receiver.in (), small_size, allocations);
+        }
+
+      receiver->shutdown ();
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return status == 0 ? 0 : 1;
+}
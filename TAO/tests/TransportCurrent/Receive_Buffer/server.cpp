@@ -0,0 +1,115 @@
+#include "Receiver.h"
+#include "tao/TransportCurrent/Current_Loader.h"
+#include "ace/Get_Opt.h"
+#include "ace/OS_NS_stdio.h"
+
+// Make sure the static loader is linked in, the dynamic one is
+// loaded through the service configurator.
+ACE_STATIC_SVC_REQUIRE (TAO_Transport_Current_Loader)
+
+const ACE_TCHAR *ior_output_file = ACE_TEXT ("server.ior");
+
+int
+parse_args (int argc, ACE_TCHAR *argv[])
+{
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("o:"));
+  int c;
+
+  while ((c = get_opts ()) != -1)
+    switch (c)
+      {
+      case 'o':
+        ior_output_file = get_opts.opt_arg ();
+        break;
+
+      case '?':
+      default:
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "usage:  %s "
+                           "-o <iorfile>"
+                           "\n",
+                           argv [0]),
+                          -1);
+      }
+  // Indicates successful parsing of the command line
+  return 0;
+}
+
+int
+ACE_TMAIN(int argc, ACE_TCHAR *argv[])
+{
+  try
+    {
+      CORBA::ORB_var orb =
+        CORBA::ORB_init (argc, argv);
+
+      CORBA::Object_var poa_object =
+        orb->resolve_initial_references("RootPOA");
+
+      PortableServer::POA_var root_poa =
+        PortableServer::POA::_narrow (poa_object.in ());
+
+      if (CORBA::is_nil (root_poa.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Panic: nil RootPOA\n"),
+                          1);
+
+      PortableServer::POAManager_var poa_manager = root_poa->the_POAManager ();
+
+      if (parse_args (argc, argv) != 0)
+        return 1;
+
+      CORBA::Object_var tc_object =
+        orb->resolve_initial_references ("TAO::Transport::Current");
+
+      TAO::Transport::Current_var tc =
+        TAO::Transport::Current::_narrow (tc_object.in ());
+
+      if (CORBA::is_nil (tc.in ()))
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           " (%P|%t) Panic: nil TAO::Transport::Current\n"),
+                          1);
+
+      Receiver *receiver_impl = 0;
+      ACE_NEW_RETURN (receiver_impl,
+                      Receiver (orb.in (), tc.in ()),
+                      1);
+      PortableServer::ServantBase_var owner_transfer(receiver_impl);
+
+      PortableServer::ObjectId_var id =
+        root_poa->activate_object (receiver_impl);
+
+      CORBA::Object_var object = root_poa->id_to_reference (id.in ());
+
+      Test::Receiver_var receiver = Test::Receiver::_narrow (object.in ());
+
+      CORBA::String_var ior = orb->object_to_string (receiver.in ());
+
+      // Output the IOR to the <ior_output_file>
+      FILE *output_file= ACE_OS::fopen (ior_output_file, "w");
+      if (output_file == 0)
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "Cannot open output file for writing IOR: %s\n",
+                           ior_output_file),
+                           1);
+      ACE_OS::fprintf (output_file, "%s", ior.in ());
+      ACE_OS::fclose (output_file);
+
+      poa_manager->activate ();
+
+      orb->run ();
+
+      ACE_DEBUG ((LM_DEBUG, "(%P|%t) server - event loop finished\n"));
+
+      root_poa->destroy (true, true);
+
+      orb->destroy ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Exception caught:");
+      return 1;
+    }
+
+  return 0;
+}
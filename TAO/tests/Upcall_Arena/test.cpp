@@ -0,0 +1,242 @@
+
+//=============================================================================
+/**
+ *  @file    test.cpp
+ *
+ * Verify that TAO::Upcall_Arena hands out aligned and distinct memory
+ * across blocks, gives oversized allocations a block of their own and
+ * gives back what a scope allocated when it closes.
+ */
+//=============================================================================
+
+#include "tao/Upcall_Arena.h"
+#include "tao/SystemException.h"
+
+#include "ace/Log_Msg.h"
+#include "ace/OS_NS_string.h"
+#include "ace/Vector_T.h"
+
+namespace
+{
+  size_t const small_size = 100;
+
+  bool
+  is_aligned (const void *p)
+  {
+    return reinterpret_cast<size_t> (p) % sizeof (ACE_CDR::LongDouble) == 0;
+  }
+
+  /// Allocate @a size bytes filled with @a fill.
+  char *
+  allocate (TAO::Upcall_Arena &arena, size_t size, char fill)
+  {
+    char * const p = static_cast<char *> (arena.allocate (size));
+    ACE_OS::memset (p, fill, size);
+    return p;
+  }
+
+  /// True when the @a size bytes at @a p are all @a fill.
+  bool
+  is_filled (const char *p, size_t size, char fill)
+  {
+    for (size_t i = 0; i != size; ++i)
+      {
+        if (p[i] != fill)
+          {
+            return false;
+          }
+      }
+    return true;
+  }
+
+  /// Allocate small chunks until they span more than two blocks and
+  /// check that they are aligned, distinct and cross a block boundary.
+  int
+  test_rollover (TAO::Upcall_Arena &arena)
+  {
+    ACE_Vector<char *> chunks;
+    size_t const count = 2 * TAO_UPCALL_ARENA_BLOCK_SIZE / small_size + 1;
+    for (size_t i = 0; i != count; ++i)
+      {
+        chunks.push_back (allocate (arena, small_size,
+                                    static_cast<char> (i)));
+      }
+
+    size_t const aligned_size =
+      ACE_align_binary (small_size, sizeof (ACE_CDR::LongDouble));
+
+    int status = 0;
+    size_t boundaries = 0;
+    for (size_t i = 0; i != count; ++i)
+      {
+        if (!is_aligned (chunks[i]))
+          {
+            ACE_ERROR ((LM_ERROR, "ERROR: chunk %B is not aligned\n", i));
+            ++status;
+          }
+        if (!is_filled (chunks[i], small_size, static_cast<char> (i)))
+          {
+            ACE_ERROR ((LM_ERROR, "ERROR: chunk %B was overwritten\n", i));
+            ++status;
+          }
+        // Within a block the chunks follow each other.
+        if (i != 0 && chunks[i] != chunks[i - 1] + aligned_size)
+          {
+            ++boundaries;
+          }
+      }
+
+    if (boundaries < 2)
+      {
+        ACE_ERROR ((LM_ERROR,
+                    "ERROR: %B chunks of %B bytes crossed %B block "
+                    "boundaries\n",
+                    count, small_size, boundaries));
+        ++status;
+      }
+
+    return status;
+  }
+
+  int
+  test_scopes (void)
+  {
+    int status = 0;
+
+    if (TAO::Upcall_Arena::current () != 0)
+      {
+        ACE_ERROR_RETURN ((LM_ERROR,
+                           "ERROR: an arena outside of any scope\n"),
+                          1);
+      }
+
+    char *first = 0;
+    {
+      TAO::Upcall_Arena::Scope outer;
+      TAO::Upcall_Arena * const arena = TAO::Upcall_Arena::current ();
+      if (arena == 0)
+        {
+          ACE_DEBUG ((LM_DEBUG,
+                      "TAO is built without upcall arena, "
+                      "nothing to test\n"));
+          return 0;
+        }
+
+      first = allocate (*arena, small_size, 'a');
+
+      char *inner_first = 0;
+      char *large = 0;
+      {
+        TAO::Upcall_Arena::Scope inner;
+        if (TAO::Upcall_Arena::current () != arena)
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "ERROR: a nested scope has another arena\n"));
+            ++status;
+          }
+
+        inner_first = allocate (*arena, small_size, 'b');
+        status += test_rollover (*arena);
+
+        size_t const large_size = 2 * TAO_UPCALL_ARENA_BLOCK_SIZE;
+        large = allocate (*arena, large_size, 'c');
+        if (!is_aligned (large))
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "ERROR: a large allocation is not aligned\n"));
+            ++status;
+          }
+
+        // The next small allocation goes on in the current block.
+        char * const after_large = allocate (*arena, small_size, 'd');
+        if (after_large >= large && after_large < large + large_size)
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "ERROR: an allocation inside the large block\n"));
+            ++status;
+          }
+        if (!is_filled (large, large_size, 'c'))
+          {
+            ACE_ERROR ((LM_ERROR,
+                        "ERROR: the large block was overwritten\n"));
+            ++status;
+          }
+      }
+
+      if (TAO::Upcall_Arena::current () != arena)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: closing a nested scope closed the arena\n"));
+          ++status;
+        }
+
+      if (!is_filled (first, small_size, 'a'))
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: closing a nested scope released the outer "
+                      "allocations\n"));
+          ++status;
+        }
+
+      // The nested scope gave back everything from its first
+      // allocation on, blocks of the rollover included.
+      char * const reused = allocate (*arena, small_size, 'e');
+      if (reused != inner_first)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: the memory of a nested scope was not "
+                      "reused\n"));
+          ++status;
+        }
+    }
+
+    if (TAO::Upcall_Arena::current () != 0)
+      {
+        ACE_ERROR ((LM_ERROR,
+                    "ERROR: an arena after the outermost scope closed\n"));
+        ++status;
+      }
+
+    // The kept blocks serve the next upcall of the thread.
+    {
+      TAO::Upcall_Arena::Scope again;
+      TAO::Upcall_Arena * const arena = TAO::Upcall_Arena::current ();
+      char * const reused = allocate (*arena, small_size, 'f');
+      if (reused != first)
+        {
+          ACE_ERROR ((LM_ERROR,
+                      "ERROR: the next scope did not reuse the first "
+                      "block\n"));
+          ++status;
+        }
+
+      // Going past the kept blocks still works once they were trimmed.
+      status += test_rollover (*arena);
+    }
+
+    return status;
+  }
+}
+
+int
+ACE_TMAIN (int, ACE_TCHAR *[])
+{
+  int status = 0;
+
+  try
+    {
+      status += test_scopes ();
+    }
+  catch (const CORBA::Exception& ex)
+    {
+      ex._tao_print_exception ("Upcall_Arena");
+      return 1;
+    }
+
+  if (status == 0)
+    {
+      ACE_DEBUG ((LM_DEBUG, "Upcall_Arena test passed\n"));
+    }
+
+  return status == 0 ? 0 : 1;
+}
@@ -4,23 +4,31 @@
 #include "tao/Compression/zlib/ZlibCompressor_Factory.h"
 #include "tao/Compression/bzip2/Bzip2Compressor_Factory.h"
 #include "TestCompressor/TestCompressor_Factory.h"
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+#include "ace/Monitor_Point_Registry.h"
+#include "ace/Monitor_Base.h"
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
 
 #include "common.h"
 static const ACE_TCHAR *ior = ACE_TEXT("file://") DEFAULT_IOR_FILENAME;
 static ::Compression::CompressionManager_var compression_manager = 0;
 CORBA::ULong big_msg_size = 40000;
+static bool adaptive = false;
 
 int start_tests (Test::Hello_ptr hello, CORBA::ORB_ptr orb);
 
 int
 parse_args (int argc, ACE_TCHAR *argv[])
 {
-  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("k:t:s:"));
+  ACE_Get_Opt get_opts (argc, argv, ACE_TEXT("ak:t:s:"));
   int c;
 
   while ((c = get_opts ()) != -1)
     switch (c)
       {
+      case 'a':
+        adaptive = true;
+        break;
       case 'k':
         ior = get_opts.opt_arg ();
         break;
@@ -35,6 +43,7 @@ parse_args (int argc, ACE_TCHAR *argv[])
       default:
         ACE_ERROR_RETURN ((LM_ERROR,
                            "usage:  %s "
+                           "-a "
                            "-k <ior> "
                            "\n",
                            argv [0]),
@@ -377,6 +386,66 @@ run_big_request_test (Test::Hello_ptr hello)
   return 0;
 }
 
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+double
+monitor_value (const char *name)
+{
+  ACE::Monitor_Control::Monitor_Base *monitor =
+    ACE::Monitor_Control::Monitor_Point_Registry::instance ()->get (name);
+  if (monitor == 0)
+    {
+      return -1;
+    }
+
+  double const value = monitor->last_sample ();
+  monitor->remove_ref ();
+  return value;
+}
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+
+int
+check_adaptive_results (void)
+{
+  // The working compressors of test 1 and 4 see every request, test 2
+  // throws from the compressor and test 3 stays below the low value.
+  if (!adaptive || (test != 1 && test != 4))
+    {
+      return 0;
+    }
+
+#if defined (TAO_HAS_MONITOR_POINTS) && (TAO_HAS_MONITOR_POINTS == 1)
+  double const compressed = monitor_value ("ZIOP_Compressed_Messages");
+  double const skipped = monitor_value ("ZIOP_Uncompressed_Messages");
+
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("adaptive compression, compressed = %.0f ")
+              ACE_TEXT ("uncompressed = %.0f\n"),
+              compressed, skipped));
+
+  if (compressed < 0 || skipped < 0)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("ERROR : check_adaptive_results, ")
+                         ACE_TEXT ("no adaptive compression monitors\n")),
+                        1);
+    }
+
+  if (compressed + skipped <= 0)
+    {
+      ACE_ERROR_RETURN ((LM_ERROR,
+                         ACE_TEXT ("ERROR : check_adaptive_results, no ")
+                         ACE_TEXT ("message was compressed or skipped\n")),
+                        1);
+    }
+#else
+  ACE_DEBUG ((LM_DEBUG,
+              ACE_TEXT ("adaptive compression counts not checked, ")
+              ACE_TEXT ("monitor points are disabled\n")));
+#endif /* TAO_HAS_MONITOR_POINTS==1 */
+
+  return 0;
+}
+
 int
 start_tests (Test::Hello_ptr hello, CORBA::ORB_ptr orb)
 {
@@ -389,6 +458,7 @@ start_tests (Test::Hello_ptr hello, CORBA::ORB_ptr orb)
   result += run_big_reply_test (hello);
 
   result += check_results (orb);
+  result += check_adaptive_results ();
   return result;
 }
 
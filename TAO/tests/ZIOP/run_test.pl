@@ -9,11 +9,17 @@ use PerlACE::TestTarget;
 
 $status = 0;
 $debug_level = '0';
+$svc_conf = '';
+$client_args = '';
 
 foreach $i (@ARGV) {
     if ($i eq '-debug') {
         $debug_level = '10';
     }
+    elsif ($i eq '-adaptive') {
+        $svc_conf = 'adaptive.conf';
+        $client_args = '-a';
+    }
 }
 
 my $server = PerlACE::TestTarget::create_target (1) || die "Create target 1 failed\n";
@@ -23,13 +29,19 @@ my $iorbase = "server.ior";
 my $server_iorfile = $server->LocalFile ($iorbase);
 my $client_iorfile = $client->LocalFile ($iorbase);
 
+my $server_svc_conf = '';
+my $client_svc_conf = '';
+if ($svc_conf ne '') {
+    $server_svc_conf = '-ORBSvcConf ' . $server->LocalFile ($svc_conf);
+    $client_svc_conf = '-ORBSvcConf ' . $client->LocalFile ($svc_conf);
+}
 
 for ($test = 1; $test <= 4 && $status == 0; ++$test){
     $server->DeleteFile($iorbase);
     $client->DeleteFile($iorbase);
 
-    $SV = $server->CreateProcess ("server", "-o $server_iorfile -t $test -ORBdebuglevel $debug_level");
-    $CL = $client->CreateProcess ("client", "-k file://$client_iorfile -t $test -ORBdebuglevel $debug_level");
+    $SV = $server->CreateProcess ("server", "-o $server_iorfile -t $test -ORBdebuglevel $debug_level $server_svc_conf");
+    $CL = $client->CreateProcess ("client", "-k file://$client_iorfile -t $test $client_args -ORBdebuglevel $debug_level $client_svc_conf");
     $server_status = $SV->Spawn ();
 
     print "\n\n\n====== START TEST $test/4 ======\n\n\n";